@@ -25,6 +25,7 @@ cbuffer LightBuffer : register(b8)
 // t2: 타일별 라이트 인덱스 Structured Buffer
 // 구조:  [TileIndex * MaxLightsPerTile] = LightCount
 //        [TileIndex * MaxLightsPerTile + 1 ~ ...] = LightIndices (상위 16비트: 타입, 하위 16비트: 인덱스)
+// 클러스터 모드: [ClusterIndex * 2] = 시작 위치, [ClusterIndex * 2 + 1] = LightCount, 이후 전역 LightIndices
 StructuredBuffer<uint> g_TileLightIndices : register(t2);
 
 // PointLight, SpotLight Structured Buffer
@@ -40,6 +41,10 @@ cbuffer TileCullingBuffer : register(b11)
     uint bUseTileCulling;   // 타일 컬링 활성화 여부 (0=비활성화, 1=활성화)
     uint ViewportStartX;    // 뷰포트 시작 X 좌표
     uint ViewportStartY;    // 뷰포트 시작 Y 좌표
+    uint bUseClusteredCulling; // 클러스터 컬링 여부 (1이면 TileSize/TileCount는 클러스터 화면 그리드)
+    uint ClusterSliceCount; // 로그 깊이 슬라이스 개수
+    float ClusterDepthScale; // Slice = floor(log(ViewZ) * Scale + Bias)
+    float ClusterDepthBias;
     uint2 Padding;          // 16바이트 정렬을 위한 패딩
 };
 
@@ -63,6 +63,29 @@ uint GetTileDataOffset(uint tileIndex)
     return tileIndex * MaxLightsPerTile;
 }
 
+// 클러스터 깊이 슬라이스 계산 (viewZ = SV_POSITION.w = 뷰 공간 깊이)
+// ClusterLightCuller.cpp의 DepthToSlice와 같은 식
+uint GetClusterSlice(float viewZ)
+{
+    int slice = int(floor(log(viewZ) * ClusterDepthScale + ClusterDepthBias));
+    return uint(clamp(slice, 0, int(ClusterSliceCount) - 1));
+}
+
+// 픽셀에 영향을 주는 라이트 목록 범위 (타일/클러스터 공통)
+// x: g_TileLightIndices 내 첫 라이트 인덱스 위치, y: 라이트 개수
+uint2 GetLightListRange(float4 screenPos)
+{
+    uint tileIndex = CalculateTileIndex(screenPos, ViewportStartX, ViewportStartY);
+    if (bUseClusteredCulling)
+    {
+        uint clusterIndex = GetClusterSlice(screenPos.w) * TileCountX * TileCountY + tileIndex;
+        return uint2(g_TileLightIndices[clusterIndex * 2], g_TileLightIndices[clusterIndex * 2 + 1]);
+    }
+
+    uint tileDataOffset = GetTileDataOffset(tileIndex);
+    return uint2(tileDataOffset + 1, g_TileLightIndices[tileDataOffset]);
+}
+
 //================================================================================================
 // 기본 조명 계산 함수
 //================================================================================================
@@ -856,13 +879,12 @@ float3 CalculateAllLights(
     // Point + Spot with 타일 컬링
     if (bUseTileCulling)
     {
-        uint tileIndex = CalculateTileIndex(screenPos, ViewportStartX, ViewportStartY);
-        uint tileDataOffset = GetTileDataOffset(tileIndex);
-        uint lightCount = g_TileLightIndices[tileDataOffset];
+        uint2 lightRange = GetLightListRange(screenPos);
+        uint lightCount = lightRange.y;
 
         for (uint i = 0; i < lightCount; i++)
         {
-            uint packedIndex = g_TileLightIndices[tileDataOffset + 1 + i];
+            uint packedIndex = g_TileLightIndices[lightRange.x + i];
             uint lightType = (packedIndex >> 16) & 0xFFFF;
             uint lightIdx = packedIndex & 0xFFFF;
 
@@ -0,0 +1,47 @@
+//================================================================================================
+// Filename:      VertexFormat.hlsl
+// Description:   정점 입력 형식 (FVertexDynamic / FPackedNormalVertex) 공통 처리
+//                COMPACT_VERTEX가 정의되면 노멀/탄젠트가 8면체 인코딩(R16G16_SNORM)으로 들어옴
+//                C++ 쪽 인코딩은 VertexData.cpp의 EncodeOctahedral과 일치해야 함
+//================================================================================================
+
+#ifndef VERTEX_FORMAT_HLSL
+#define VERTEX_FORMAT_HLSL
+
+// [-1, 1]^2 전개도 좌표 → 단위 벡터
+float3 DecodeOctahedral(float2 Encoded)
+{
+    float3 n = float3(Encoded.x, Encoded.y, 1.0f - abs(Encoded.x) - abs(Encoded.y));
+    float t = saturate(-n.z);
+    n.xy += (n.xy >= 0.0f) ? -t : t;
+    return normalize(n);
+}
+
+#ifdef COMPACT_VERTEX
+    #define VERTEX_NORMAL_TYPE float2
+
+    float3 DecodeVertexNormal(float2 Encoded)
+    {
+        return DecodeOctahedral(Encoded);
+    }
+
+    // xy: 8면체 인코딩, w: binormal 방향 (±1)
+    float4 DecodeVertexTangent(float4 Encoded)
+    {
+        return float4(DecodeOctahedral(Encoded.xy), Encoded.w);
+    }
+#else
+    #define VERTEX_NORMAL_TYPE float3
+
+    float3 DecodeVertexNormal(float3 Normal)
+    {
+        return Normal;
+    }
+
+    float4 DecodeVertexTangent(float4 Tangent)
+    {
+        return Tangent;
+    }
+#endif
+
+#endif // VERTEX_FORMAT_HLSL
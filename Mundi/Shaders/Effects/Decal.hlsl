@@ -16,6 +16,7 @@
 #include "../Common/LightStructures.hlsl"
 #include "../Common/LightingBuffers.hlsl"
 #include "../Common/LightingCommon.hlsl"
+#include "../Common/VertexFormat.hlsl"
 
 // --- Decal 전용 상수 버퍼 ---
 cbuffer ModelBuffer : register(b0)
@@ -60,7 +61,7 @@ SamplerState g_VSMSampler : register(s3);
 struct VS_INPUT
 {
     float3 position : POSITION;
-    float3 normal : NORMAL0;
+    VERTEX_NORMAL_TYPE normal : NORMAL0;    // COMPACT_VERTEX면 8면체 인코딩
     float2 texCoord : TEXCOORD0;
     float4 Tangent : TANGENT0;
     float4 color : COLOR;
@@ -101,7 +102,7 @@ PS_INPUT mainVS(VS_INPUT input)
 #if defined(LIGHTING_MODEL_GOURAUD) || defined(LIGHTING_MODEL_LAMBERT) || defined(LIGHTING_MODEL_PHONG)
     // 조명 계산을 위한 데이터
     output.worldPos = worldPos.xyz;
-    output.normal = normalize(mul(input.normal, (float3x3) WorldInverseTranspose));
+    output.normal = normalize(mul(DecodeVertexNormal(input.normal), (float3x3) WorldInverseTranspose));
 
     #ifdef LIGHTING_MODEL_GOURAUD
         // Gouraud: Vertex shader에서 조명 계산
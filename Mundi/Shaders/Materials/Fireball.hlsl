@@ -41,10 +41,12 @@ cbuffer FireballCB : register(b6)
 Texture2D g_NoiseTex : register(t0);
 SamplerState g_Samp : register(s1);
 
+#include "../Common/VertexFormat.hlsl"
+
 struct VS_IN
 {
     float3 Position : POSITION;
-    float3 Normal : NORMAL0;
+    VERTEX_NORMAL_TYPE Normal : NORMAL0;
     float2 TexCoord : TEXCOORD0;
 };
 struct VS_OUT
@@ -68,7 +70,7 @@ VS_OUT FireballVS(VS_IN In)
     Out.Position = mul(viewPos, ProjectionMatrix);
 
     // 노멀
-    Out.Normal = normalize(mul(In.Normal, (float3x3) WorldInverseTranspose));
+    Out.Normal = normalize(mul(DecodeVertexNormal(In.Normal), (float3x3) WorldInverseTranspose));
 
     // 카메라→뷰 방향
     Out.ViewDir = normalize(CameraPosition - Out.WorldPos);
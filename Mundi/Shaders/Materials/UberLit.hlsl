@@ -100,16 +100,24 @@ SamplerState g_Sample2 : register(s1);
 SamplerComparisonState g_ShadowSample : register(s2);
 SamplerState g_VSMSampler : register(s3);
 
+// 탄젠트 공간 노멀 (-1~1). 노멀맵은 BC5(RG 두 채널)로 쿡되므로 Z는 단위 벡터 조건으로 복원
+float3 SampleTangentNormal(float2 uv)
+{
+    float2 xy = g_NormalTexColor.Sample(g_Sample2, uv).rg * 2.0f - 1.0f;
+    return float3(xy, sqrt(saturate(1.0f - dot(xy, xy))));
+}
+
 // --- 공통 조명 시스템 include ---
 #include "../Common/LightStructures.hlsl"
 #include "../Common/LightingBuffers.hlsl"
 #include "../Common/LightingCommon.hlsl"
+#include "../Common/VertexFormat.hlsl"
 
 // --- 셰이더 입출력 구조체 ---
 struct VS_INPUT
 {
     float3 Position : POSITION;
-    float3 Normal : NORMAL0;
+    VERTEX_NORMAL_TYPE Normal : NORMAL0;    // COMPACT_VERTEX면 8면체 인코딩
     float2 TexCoord : TEXCOORD0;
     float4 Tangent : TANGENT0;
     float4 Color : COLOR;
@@ -142,6 +150,9 @@ PS_INPUT mainVS(VS_INPUT Input)
 {
     PS_INPUT Out;
 
+    float3 inputNormal = DecodeVertexNormal(Input.Normal);
+    float4 inputTangent = DecodeVertexTangent(Input.Tangent);
+
 #ifdef GPU_SKINNING
     // GPU 스키닝: 본 행렬로 버텍스 블렌딩
     float3 skinnedPosition = float3(0.0f, 0.0f, 0.0f);
@@ -159,10 +170,10 @@ PS_INPUT mainVS(VS_INPUT Input)
             skinnedPosition += mul(float4(Input.Position, 1.0f), BoneMatrices[boneIndex]).xyz * weight;
 
             // Normal 블렌딩 (w=0, 방향 벡터) - 비균등 스케일 무시하고 일반 행렬 사용
-            skinnedNormal += mul(float4(Input.Normal, 0.0f), BoneMatrices[boneIndex]).xyz * weight;
+            skinnedNormal += mul(float4(inputNormal, 0.0f), BoneMatrices[boneIndex]).xyz * weight;
 
             // Tangent 블렌딩 (w=0, 방향 벡터) - 비균등 스케일 무시하고 일반 행렬 사용
-            skinnedTangent += mul(float4(Input.Tangent.xyz, 0.0f), BoneMatrices[boneIndex]).xyz * weight;
+            skinnedTangent += mul(float4(inputTangent.xyz, 0.0f), BoneMatrices[boneIndex]).xyz * weight;
         }
     }
 
@@ -173,8 +184,8 @@ PS_INPUT mainVS(VS_INPUT Input)
 #else
     // CPU 스키닝: 이미 변환된 버텍스 사용
     float3 localPosition = Input.Position;
-    float3 localNormal = Input.Normal;
-    float3 localTangent = Input.Tangent.xyz;
+    float3 localNormal = inputNormal;
+    float3 localTangent = inputTangent.xyz;
 #endif
 
     // 위치를 월드 공간으로 먼저 변환
@@ -193,7 +204,7 @@ PS_INPUT mainVS(VS_INPUT Input)
     float3 worldNormal = normalize(mul(localNormal, (float3x3) WorldInverseTranspose));
     Out.Normal = worldNormal;
     float3 Tangent = normalize(mul(localTangent, (float3x3) WorldMatrix));
-    float3 BiTangent = normalize(cross(Tangent, worldNormal) * Input.Tangent.w);
+    float3 BiTangent = normalize(cross(Tangent, worldNormal) * inputTangent.w);
     row_major float3x3 TBN;
     TBN._m00_m01_m02 = Tangent;
     TBN._m10_m11_m12 = BiTangent;
@@ -317,8 +328,7 @@ PS_OUTPUT mainPS(PS_INPUT Input)
     
     if(bHasNormalTexture)
     {
-        normalColor = g_NormalTexColor.Sample(g_Sample2, uv);
-        normalColor = normalColor * 2.0f - 1.0f;
+        normalColor = SampleTangentNormal(uv);
         normalColor = normalize(mul(normalColor, Input.TBN));
     }
     
@@ -439,18 +449,17 @@ PS_OUTPUT mainPS(PS_INPUT Input)
     // 타일 기반 라이트 컬링 적용 (활성화된 경우)
     if (bUseTileCulling)
     {
-        // 현재 픽셀이 속한 타일 계산
-        uint tileIndex = CalculateTileIndex(Input.Position, ViewportStartX, ViewportStartY);
-        uint tileDataOffset = GetTileDataOffset(tileIndex);
+        // 현재 픽셀이 속한 타일(또는 클러스터)의 라이트 목록
+        uint2 lightRange = GetLightListRange(Input.Position);
 
         // 타일에 영향을 주는 라이트 개수
-        uint lightCount = g_TileLightIndices[tileDataOffset];
+        uint lightCount = lightRange.y;
 
         // 타일 내 라이트만 순회
         [loop]
         for (uint i = 0; i < lightCount; i++)
         {
-            uint packedIndex = g_TileLightIndices[tileDataOffset + 1 + i];
+            uint packedIndex = g_TileLightIndices[lightRange.x + i];
             uint lightType = (packedIndex >> 16) & 0xFFFF;  // 상위 16비트: 타입
             uint lightIdx = packedIndex & 0xFFFF;           // 하위 16비트: 인덱스
 
@@ -507,8 +516,7 @@ PS_OUTPUT mainPS(PS_INPUT Input)
     float3 normal = normalize(Input.Normal);
     if(bHasNormalTexture)
     {
-        normal = g_NormalTexColor.Sample(g_Sample2, uv);
-        normal = normal * 2.0f - 1.0f;
+        normal = SampleTangentNormal(uv);
         normal = normalize(mul(normal, Input.TBN));
     }
     float3 viewDir = normalize(CameraPosition - Input.WorldPos);
@@ -551,18 +559,17 @@ PS_OUTPUT mainPS(PS_INPUT Input)
     // 타일 기반 라이트 컬링 적용 (활성화된 경우)
     if (bUseTileCulling)
     {
-        // 현재 픽셀이 속한 타일 계산
-        uint tileIndex = CalculateTileIndex(Input.Position, ViewportStartX, ViewportStartY);
-        uint tileDataOffset = GetTileDataOffset(tileIndex);
+        // 현재 픽셀이 속한 타일(또는 클러스터)의 라이트 목록
+        uint2 lightRange = GetLightListRange(Input.Position);
 
         // 타일에 영향을 주는 라이트 개수
-        uint lightCount = g_TileLightIndices[tileDataOffset];
+        uint lightCount = lightRange.y;
 
         // 타일 내 라이트만 순회
         [loop]
         for (uint i = 0; i < lightCount; i++)
         {
-            uint packedIndex = g_TileLightIndices[tileDataOffset + 1 + i];
+            uint packedIndex = g_TileLightIndices[lightRange.x + i];
             uint lightType = (packedIndex >> 16) & 0xFFFF;  // 상위 16비트: 타입
             uint lightIdx = packedIndex & 0xFFFF;           // 하위 16비트: 인덱스
 
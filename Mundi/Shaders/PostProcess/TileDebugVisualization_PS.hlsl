@@ -13,6 +13,10 @@ cbuffer TileCullingBuffer : register(b11)
     uint bUseTileCulling;   // 타일 컬링 활성화 여부 (0=비활성화, 1=활성화)
     uint ViewportStartX;    // 뷰포트 시작 X 좌표
     uint ViewportStartY;    // 뷰포트 시작 Y 좌표
+    uint bUseClusteredCulling; // 클러스터 컬링 여부 (1이면 TileSize/TileCount는 클러스터 화면 그리드)
+    uint ClusterSliceCount; // 로그 깊이 슬라이스 개수
+    float ClusterDepthScale; // Slice = floor(log(ViewZ) * Scale + Bias)
+    float ClusterDepthBias;
     uint2 Padding;          // 16바이트 정렬을 위한 패딩
 };
 
@@ -98,10 +102,22 @@ float4 mainPS(float4 Pos : SV_Position, float2 TexCoord : TEXCOORD0) : SV_Target
 
     // 현재 픽셀이 속한 타일 계산
     uint tileIndex = CalculateTileIndex(Pos.xy);
-    uint tileDataOffset = GetTileDataOffset(tileIndex);
 
     // 타일의 라이트 개수
-    uint lightCount = g_TileLightIndices[tileDataOffset];
+    uint lightCount = 0;
+    if (bUseClusteredCulling)
+    {
+        // 깊이 정보가 없으므로 화면 타일 열의 모든 슬라이스 중 최대 개수를 표시
+        for (uint slice = 0; slice < ClusterSliceCount; slice++)
+        {
+            uint clusterIndex = slice * TileCountX * TileCountY + tileIndex;
+            lightCount = max(lightCount, g_TileLightIndices[clusterIndex * 2 + 1]);
+        }
+    }
+    else
+    {
+        lightCount = g_TileLightIndices[GetTileDataOffset(tileIndex)];
+    }
 
     // 히트맵 색상 계산
     float3 heatmapColor = LightCountToHeatmap(lightCount);
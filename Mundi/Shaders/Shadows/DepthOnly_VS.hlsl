@@ -15,13 +15,10 @@ cbuffer ViewProjBuffer : register(b1)
 };
 
 // --- 셰이더 입출력 구조체 ---
+// 위치만 읽으므로 정점 형식(FVertexDynamic, FSkinnedVertex, 압축 정점)과 관계없이 같은 입력 레이아웃 사용
 struct VS_INPUT
 {
     float3 Position : POSITION;
-    float3 Normal : NORMAL0;
-    float2 TexCoord : TEXCOORD0;
-    float4 Tangent : TANGENT0;
-    float4 Color : COLOR;
 };
 
 // 출력은 오직 클립 공간 위치만 필요
@@ -31,12 +31,14 @@ cbuffer ColorBuffer : register(b3)
     uint UUID;          // Object ID for picking
 }
 
+#include "../Common/VertexFormat.hlsl"
+
 // --- Input/Output Structures ---
 
 struct VS_INPUT
 {
-    float3 position : POSITION;     // Vertex position
-    float3 normal : NORMAL;         // Vertex normal
+    float3 position : POSITION;             // Vertex position
+    VERTEX_NORMAL_TYPE normal : NORMAL;     // Vertex normal (octahedral-encoded with COMPACT_VERTEX)
 };
 
 struct PS_INPUT
@@ -69,7 +71,7 @@ PS_INPUT mainVS(VS_INPUT input)
     output.position = mul(float4(input.position, 1.0f), MVP);
     
     // Transform normal from model space to world space for lighting
-    output.worldNormal = normalize(mul(input.normal, (float3x3) WorldInverseTranspose));
+    output.worldNormal = normalize(mul(DecodeVertexNormal(input.normal), (float3x3) WorldInverseTranspose));
     output.color = LerpColor;
 
     return output;
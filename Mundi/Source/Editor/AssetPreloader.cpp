@@ -0,0 +1,251 @@
+﻿#include "pch.h"
+#include "AssetPreloader.h"
+#include "ObjManager.h"
+#include "PlatformTime.h"
+#include "TaskScheduler.h"
+#include "TextureCooker.h"
+#include <filesystem>
+#include <unordered_set>
+
+namespace
+{
+	// 워커 스레드의 WIC 사용(DDS 변환)을 위한 COM 초기화 범위. 이미 다른 모드로 초기화된 스레드(게임 스레드)는 그대로 둠
+	struct FScopedCOMInitialize
+	{
+		FScopedCOMInitialize() : Result(CoInitializeEx(nullptr, COINIT_MULTITHREADED)) {}
+		~FScopedCOMInitialize()
+		{
+			if (SUCCEEDED(Result))
+			{
+				CoUninitialize();
+			}
+		}
+		HRESULT Result;
+	};
+
+	double ElapsedMS(uint64 StartCycles)
+	{
+		return FPlatformTime::ToMilliseconds(FPlatformTime::Cycles64() - StartCycles);
+	}
+}
+
+void FPreloadTimeline::Log(const char* InTitle, double InTotalWallMS) const
+{
+	double TotalCpuMS = 0.0;
+	double TotalGpuMS = 0.0;
+	for (const FPreloadTimelineEntry& Entry : Entries)
+	{
+		TotalCpuMS += Entry.CpuMS;
+		TotalGpuMS += Entry.GpuMS;
+	}
+
+	UE_LOG("[Preload] %s: %d assets, wall %.1f ms (cpu sum %.1f ms on %u workers + game thread, gpu/register sum %.1f ms)",
+		InTitle, Entries.Num(), InTotalWallMS, TotalCpuMS, FTaskScheduler::GetInstance().GetNumWorkers(), TotalGpuMS);
+	for (const TPair<const char*, double>& Phase : Phases)
+	{
+		UE_LOG("[Preload]   phase %-12s %8.1f ms", Phase.first, Phase.second);
+	}
+
+	TArray<const FPreloadTimelineEntry*> Sorted;
+	Sorted.Reserve(Entries.Num());
+	for (const FPreloadTimelineEntry& Entry : Entries)
+	{
+		Sorted.Add(&Entry);
+	}
+	std::stable_sort(Sorted.begin(), Sorted.end(), [](const FPreloadTimelineEntry* A, const FPreloadTimelineEntry* B)
+		{
+			return A->CpuMS + A->GpuMS > B->CpuMS + B->GpuMS;
+		});
+	for (const FPreloadTimelineEntry* Entry : Sorted)
+	{
+		UE_LOG("[Preload]   %-12s cpu %7.2f ms  gpu %7.2f ms  %s", Entry->Kind, Entry->CpuMS, Entry->GpuMS, Entry->Path.c_str());
+	}
+}
+
+FPreloadAssetList FAssetPreloader::Discover(const FString& InRootDir)
+{
+	FPreloadAssetList Result;
+
+	const fs::path RootDir(UTF8ToWide(InRootDir));
+	if (!fs::exists(RootDir) || !fs::is_directory(RootDir))
+	{
+		return Result;
+	}
+
+	std::unordered_set<FString> ProcessedFiles; // 중복 로딩 방지
+	for (const auto& Entry : fs::recursive_directory_iterator(RootDir))
+	{
+		if (!Entry.is_regular_file())
+			continue;
+
+		const fs::path& Path = Entry.path();
+		FString Extension = Path.extension().string();
+		std::transform(Extension.begin(), Extension.end(), Extension.begin(), [](unsigned char c) { return static_cast<char>(std::tolower(c)); });
+
+		TArray<FString>* Target = nullptr;
+		if (Extension == ".obj")
+		{
+			Target = &Result.ObjFiles;
+		}
+		else if (Extension == ".fbx")
+		{
+			Target = &Result.FbxFiles;
+		}
+		else if (Extension == ".dds" || Extension == ".jpg" || Extension == ".png")
+		{
+			Target = &Result.TextureFiles;
+		}
+
+		if (Target)
+		{
+			FString PathStr = NormalizePath(WideToUTF8(Path.wstring()));
+			if (ProcessedFiles.insert(PathStr).second)
+			{
+				Target->Add(PathStr);
+			}
+		}
+	}
+	return Result;
+}
+
+void FAssetPreloader::PreloadObjStaticMeshes(const TArray<FString>& InObjFiles, FPreloadTimeline& Timeline)
+{
+	// 이미 로드된 메시는 제외 (게임 스레드에서 확인)
+	TArray<FString> Pending;
+	for (const FString& Path : InObjFiles)
+	{
+		if (!UResourceManager::GetInstance().Get<UStaticMesh>(Path))
+		{
+			Pending.Add(Path);
+		}
+	}
+	if (Pending.IsEmpty())
+	{
+		return;
+	}
+
+	// 워커에서 기본 머티리얼을 조회하지 않도록 이름을 미리 복사
+	UMaterial* DefaultMaterial = UResourceManager::GetInstance().GetDefaultMaterial();
+	const FString DefaultMaterialName = DefaultMaterial ? DefaultMaterial->GetMaterialInfo().MaterialName : FString();
+
+	struct FObjPreloadResult
+	{
+		FStaticMesh* StaticMesh = nullptr;
+		TArray<FMaterialInfo> MaterialInfos;
+		double CpuMS = 0.0;
+	};
+	TArray<FObjPreloadResult> Results(Pending.Num());
+
+	// CPU 단계: 파싱/캐시 읽기 (에셋 하나 = 작업 하나)
+	uint64 PhaseStart = FPlatformTime::Cycles64();
+	FTaskScheduler::GetInstance().ParallelFor(Pending.Num(), 1, [&](int32 Begin, int32 End)
+		{
+			for (int32 i = Begin; i < End; ++i)
+			{
+				const uint64 Start = FPlatformTime::Cycles64();
+				Results[i].StaticMesh = FObjManager::BuildObjStaticMeshData(Pending[i], DefaultMaterialName, Results[i].MaterialInfos);
+				Results[i].CpuMS = ElapsedMS(Start);
+			}
+		});
+	Timeline.AddPhase("obj cpu", ElapsedMS(PhaseStart));
+
+	// GPU 단계: 머티리얼 등록 + 정점/인덱스 버퍼 생성 (발견 순서대로)
+	PhaseStart = FPlatformTime::Cycles64();
+	for (int32 i = 0; i < Pending.Num(); ++i)
+	{
+		const uint64 Start = FPlatformTime::Cycles64();
+		if (Results[i].StaticMesh)
+		{
+			FObjManager::RegisterObjStaticMeshData(Pending[i], Results[i].StaticMesh, Results[i].MaterialInfos);
+		}
+		FObjManager::LoadObjStaticMesh(Pending[i]);
+
+		FPreloadTimelineEntry Entry;
+		Entry.Path = Pending[i];
+		Entry.Kind = "StaticMesh";
+		Entry.CpuMS = Results[i].CpuMS;
+		Entry.GpuMS = ElapsedMS(Start);
+		Timeline.AddAsset(Entry);
+	}
+	Timeline.AddPhase("obj gpu", ElapsedMS(PhaseStart));
+}
+
+void FAssetPreloader::PreloadTextures(const TArray<FString>& InTextureFiles, FPreloadTimeline& Timeline)
+{
+	TArray<FString> Pending;
+	for (const FString& Path : InTextureFiles)
+	{
+		if (!UResourceManager::GetInstance().Get<UTexture>(Path))
+		{
+			Pending.Add(Path);
+		}
+	}
+	if (Pending.IsEmpty())
+	{
+		return;
+	}
+
+	// 캐시에 없는 텍스처를 먼저 한꺼번에 쿡 (텍스처/밉/줄 묶음 단위로 모든 코어 사용). 이후 PrepareSource는 모두 캐시 적중
+	{
+		const uint64 PhaseStart = FPlatformTime::Cycles64();
+		TArray<FTextureCookSource> CookSources;
+		CookSources.Reserve(Pending.Num());
+		for (const FString& Path : Pending)
+		{
+			CookSources.Add({ Path, true });
+		}
+		const FTextureCookStats CookStats = FTextureCooker::Cook(CookSources);
+		if (CookStats.NumCooked > 0)
+		{
+			FTextureCooker::LogStats("Preload", CookStats);
+		}
+		Timeline.AddPhase("texture cook", ElapsedMS(PhaseStart));
+	}
+
+	double CpuPhaseMS = 0.0;
+	double GpuPhaseMS = 0.0;
+	TArray<FTextureSourceData> Sources;
+	TArray<double> CpuTimes;
+
+	for (int32 BatchStart = 0; BatchStart < Pending.Num(); BatchStart += TextureBatchSize)
+	{
+		const int32 BatchCount = std::min(TextureBatchSize, Pending.Num() - BatchStart);
+		Sources.clear();
+		Sources.resize(BatchCount);
+		CpuTimes.SetNum(BatchCount, 0.0);
+
+		// CPU 단계: DDS 캐시 확인 + 파일 읽기
+		uint64 PhaseStart = FPlatformTime::Cycles64();
+		FTaskScheduler::GetInstance().ParallelFor(BatchCount, 1, [&](int32 Begin, int32 End)
+			{
+				FScopedCOMInitialize COMInitialize;
+				for (int32 i = Begin; i < End; ++i)
+				{
+					const uint64 Start = FPlatformTime::Cycles64();
+					UTexture::PrepareSource(Pending[BatchStart + i], true, Sources[i]);
+					CpuTimes[i] = ElapsedMS(Start);
+				}
+			});
+		CpuPhaseMS += ElapsedMS(PhaseStart);
+
+		// GPU 단계: 메모리에서 텍스처/SRV 생성
+		PhaseStart = FPlatformTime::Cycles64();
+		for (int32 i = 0; i < BatchCount; ++i)
+		{
+			const uint64 Start = FPlatformTime::Cycles64();
+			UResourceManager::GetInstance().Load<UTexture>(Pending[BatchStart + i], Sources[i]);
+			Sources[i] = FTextureSourceData(); // 원본 메모리 즉시 해제
+
+			FPreloadTimelineEntry Entry;
+			Entry.Path = Pending[BatchStart + i];
+			Entry.Kind = "Texture";
+			Entry.CpuMS = CpuTimes[i];
+			Entry.GpuMS = ElapsedMS(Start);
+			Timeline.AddAsset(Entry);
+		}
+		GpuPhaseMS += ElapsedMS(PhaseStart);
+	}
+
+	Timeline.AddPhase("texture cpu", CpuPhaseMS);
+	Timeline.AddPhase("texture gpu", GpuPhaseMS);
+}
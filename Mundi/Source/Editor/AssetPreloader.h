@@ -0,0 +1,56 @@
+﻿#pragma once
+#include "UEContainer.h"
+
+// 프리로드 타임라인의 에셋 한 개
+struct FPreloadTimelineEntry
+{
+	FString Path;
+	const char* Kind = "";
+	double CpuMS = 0.0;     // 워커에서의 파싱/캐시 읽기/파일 읽기 시간 (직렬 로드면 0)
+	double GpuMS = 0.0;     // 게임 스레드에서의 등록 + GPU 리소스 생성 시간
+};
+
+// 에디터 시작 시간 타임라인 (에셋별 시간 + 단계별 벽시계 시간)
+class FPreloadTimeline
+{
+public:
+	void AddAsset(const FPreloadTimelineEntry& InEntry) { Entries.Add(InEntry); }
+	void AddPhase(const char* InName, double InWallMS) { Phases.Add(TPair<const char*, double>(InName, InWallMS)); }
+
+	// 단계별 시간, 에셋별 시간(오래 걸린 순), 전체 벽시계 시간을 로그로 출력
+	void Log(const char* InTitle, double InTotalWallMS) const;
+
+private:
+	TArray<FPreloadTimelineEntry> Entries;
+	TArray<TPair<const char*, double>> Phases;
+};
+
+// 프리로드 대상 (정규화 경로, 중복 제거, 발견 순서 유지)
+struct FPreloadAssetList
+{
+	TArray<FString> ObjFiles;
+	TArray<FString> FbxFiles;
+	TArray<FString> TextureFiles;
+};
+
+/**
+ * Data/ 에셋 병렬 프리로드
+ * 1) 발견: 디렉터리를 한 번 훑어 확장자별로 분류
+ * 2) CPU 단계: OBJ 파싱/바이너리 캐시 읽기, 텍스처 DDS 변환/파일 읽기를 FTaskScheduler 워커에 분산
+ *    워커는 UObject 생성이나 UResourceManager 맵에 접근하지 않음 (맵은 동기화되지 않음)
+ * 3) GPU 단계: 게임 스레드에서 발견 순서대로 머티리얼/리소스 등록 + 버퍼/텍스처 생성
+ */
+class FAssetPreloader
+{
+public:
+	static FPreloadAssetList Discover(const FString& InRootDir);
+
+	// 아직 로드되지 않은 OBJ를 UStaticMesh로 로드
+	static void PreloadObjStaticMeshes(const TArray<FString>& InObjFiles, FPreloadTimeline& Timeline);
+
+	// 아직 로드되지 않은 텍스처를 UTexture로 로드 (원본 메모리를 제한하려고 TextureBatchSize개씩 나눠 처리)
+	static void PreloadTextures(const TArray<FString>& InTextureFiles, FPreloadTimeline& Timeline);
+
+private:
+	static constexpr int32 TextureBatchSize = 64;
+};
@@ -0,0 +1,186 @@
+﻿#include "pch.h"
+#include "AsyncLoadTest.h"
+#include "AssetPreloader.h"
+#include "PlatformTime.h"
+
+namespace
+{
+	constexpr float FrameBudget60MS = 1000.0f / 60.0f;
+	constexpr int32 CancelTestInterval = 8;   // N개마다 같은 경로로 요청을 하나 더 넣고 바로 취소
+
+	struct FAsyncLoadTestState
+	{
+		bool bRunning = false;
+		uint64 StartCycles = 0;
+		double DiscoverMS = 0.0;
+
+		int32 NumRequests = 0;
+		int32 NumFinished = 0;
+		int32 NumFailed = 0;
+		int32 NumAlreadyResident = 0;
+		int32 NumPlaceholders = 0;        // 요청 직후 플레이스홀더를 돌려준 텍스처 핸들
+		int32 NumCancelled = 0;
+		int32 NumCancelledCallbacks = 0;  // 취소했는데 호출된 콜백 (0이어야 함)
+
+		TArray<FAsyncLoadHandle> Handles;
+		TArray<float> FrameStallMS;
+	};
+
+	FAsyncLoadTestState GAsyncLoadTest;
+
+	double ElapsedMS(uint64 StartCycles)
+	{
+		return FPlatformTime::ToMilliseconds(FPlatformTime::Cycles64() - StartCycles);
+	}
+
+	template<typename T>
+	void IssueTestRequest(const FString& InPath, EAsyncLoadPriority InPriority)
+	{
+		FAsyncLoadTestState& State = GAsyncLoadTest;
+		++State.NumRequests;
+
+		FAsyncLoadHandle Handle = RESOURCE.LoadAsync<T>(InPath, [](T* InResource)
+			{
+				++GAsyncLoadTest.NumFinished;
+				if (!InResource)
+				{
+					++GAsyncLoadTest.NumFailed;
+				}
+			}, InPriority);
+
+		if (Handle.IsDone())
+		{
+			if (Handle.GetState() == EAsyncLoadState::Completed)
+			{
+				++State.NumAlreadyResident;
+			}
+			else
+			{
+				// 지원하지 않는 요청은 콜백 없이 실패로 끝남
+				++State.NumFinished;
+				++State.NumFailed;
+			}
+			return;
+		}
+
+		if (Handle.GetResource() && Handle.GetResource() == RESOURCE.GetDefaultTexture())
+		{
+			++State.NumPlaceholders;
+		}
+
+		if (State.NumRequests % CancelTestInterval == 0)
+		{
+			FAsyncLoadHandle Duplicate = RESOURCE.LoadAsync<T>(InPath, [](T*) { ++GAsyncLoadTest.NumCancelledCallbacks; }, InPriority);
+			Duplicate.Cancel();
+			++State.NumCancelled;
+		}
+
+		State.Handles.Add(Handle);
+	}
+
+	float GetPercentile(const TArray<float>& Sorted, float InPercent)
+	{
+		if (Sorted.IsEmpty())
+		{
+			return 0.0f;
+		}
+		const int32 Index = std::min(Sorted.Num() - 1, static_cast<int32>(InPercent / 100.0f * Sorted.Num()));
+		return Sorted[Index];
+	}
+
+	void FinishTest()
+	{
+		FAsyncLoadTestState& State = GAsyncLoadTest;
+		const double WallMS = ElapsedMS(State.StartCycles);
+
+		TArray<float> Sorted = State.FrameStallMS;
+		std::sort(Sorted.begin(), Sorted.end());
+		double TotalStallMS = 0.0;
+		int32 FramesOver60Hz = 0;
+		for (float Stall : Sorted)
+		{
+			TotalStallMS += Stall;
+			if (Stall > FrameBudget60MS)
+			{
+				++FramesOver60Hz;
+			}
+		}
+
+		const FAsyncLoadStats& Stats = RESOURCE.GetAsyncLoadStats();
+		UE_LOG("[AsyncLoadTest] %d requests (%d already resident, %d failed), %d frames, wall %.1f ms (discover %.1f ms)",
+			State.NumRequests, State.NumAlreadyResident, State.NumFailed, Sorted.Num(), WallMS, State.DiscoverMS);
+		UE_LOG("[AsyncLoadTest] game thread stall per frame: avg %.3f ms, p50 %.3f, p95 %.3f, p99 %.3f, max %.3f ms (total %.1f ms)",
+			Sorted.IsEmpty() ? 0.0 : TotalStallMS / Sorted.Num(),
+			GetPercentile(Sorted, 50.0f), GetPercentile(Sorted, 95.0f), GetPercentile(Sorted, 99.0f),
+			Sorted.IsEmpty() ? 0.0f : Sorted.back(), TotalStallMS);
+		UE_LOG("[AsyncLoadTest] frames over 16.7 ms: %d, coalesced %u, placeholders %d, cancelled %d (callbacks after cancel: %d)",
+			FramesOver60Hz, Stats.CoalescedRequests, State.NumPlaceholders, State.NumCancelled, State.NumCancelledCallbacks);
+		if (State.NumAlreadyResident == State.NumRequests)
+		{
+			UE_LOG("[AsyncLoadTest] All assets were already resident. Set 'PreloadAssets = 0' in editor.ini to measure streaming.");
+		}
+
+		// 에디터 목록(메시 선택 콤보 등) 갱신
+		RESOURCE.SetStaticMeshs();
+		RESOURCE.SetSkeletalMeshs();
+
+		State.Handles.Empty();
+		State.FrameStallMS.Empty();
+		State.bRunning = false;
+	}
+}
+
+void FAsyncLoadTest::Start()
+{
+	FAsyncLoadTestState& State = GAsyncLoadTest;
+	if (State.bRunning)
+	{
+		UE_LOG("[AsyncLoadTest] Already running (%d / %d finished)", State.NumFinished, State.NumRequests);
+		return;
+	}
+
+	State = FAsyncLoadTestState();
+	State.bRunning = true;
+	State.StartCycles = FPlatformTime::Cycles64();
+
+	const FPreloadAssetList Assets = FAssetPreloader::Discover(GDataDir);
+	State.DiscoverMS = ElapsedMS(State.StartCycles);
+
+	// 메시 형태가 먼저 보이도록 OBJ를 높은 우선순위로, 스켈레탈 메시는 가장 나중에
+	for (const FString& Path : Assets.ObjFiles)
+	{
+		IssueTestRequest<UStaticMesh>(Path, EAsyncLoadPriority::High);
+	}
+	for (const FString& Path : Assets.TextureFiles)
+	{
+		IssueTestRequest<UTexture>(Path, EAsyncLoadPriority::Normal);
+	}
+	for (const FString& Path : Assets.FbxFiles)
+	{
+		IssueTestRequest<USkeletalMesh>(Path, EAsyncLoadPriority::Low);
+	}
+
+	UE_LOG("[AsyncLoadTest] Issued %d requests (%d obj, %d texture, %d fbx)",
+		State.NumRequests, Assets.ObjFiles.Num(), Assets.TextureFiles.Num(), Assets.FbxFiles.Num());
+}
+
+void FAsyncLoadTest::Tick()
+{
+	FAsyncLoadTestState& State = GAsyncLoadTest;
+	if (!State.bRunning)
+	{
+		return;
+	}
+
+	State.FrameStallMS.Add(RESOURCE.GetAsyncLoadStats().GetStallMS());
+
+	if (State.NumFinished >= State.NumRequests && !RESOURCE.GetAsyncLoader().HasPendingWork())
+	{
+		FinishTest();
+	}
+}
+
+bool FAsyncLoadTest::IsRunning()
+{
+	return GAsyncLoadTest.bRunning;
+}
@@ -0,0 +1,19 @@
+﻿#pragma once
+#include "UEContainer.h"
+
+/**
+ * 비동기 로드 테스트 하네스 (콘솔: ASYNCLOAD TEST)
+ * Data/ 아래 OBJ/FBX/텍스처 전체를 LoadAsync로 요청한 뒤, 모두 끝날 때까지 프레임마다
+ * 게임 스레드 정지 시간(LoadAsync 호출 + TickAsyncLoads)을 기록해 분포를 로그로 출력한다.
+ * 시작 프리로드가 켜져 있으면 대부분 이미 로드되어 있으므로 editor.ini에 PreloadAssets = 0을 두고 실행한다.
+ */
+class FAsyncLoadTest
+{
+public:
+	static void Start();
+
+	// 매 프레임 TickAsyncLoads 직후 호출
+	static void Tick();
+
+	static bool IsRunning();
+};
@@ -0,0 +1,66 @@
+﻿#pragma once
+
+// 콘솔 명령(BENCH <NAME>)으로 실행하는 CPU 측 벤치마크 모음
+// GPU/월드 없이 실행 가능한 항목만 포함하며, 결과는 UE_LOG로 출력합니다.
+namespace EngineBenchmarks
+{
+    // 등록된 벤치마크 이름 목록 (HELP/BENCH 출력용)
+    const TArray<FString>& GetBenchmarkNames();
+
+    // 이름으로 벤치마크 실행. 알 수 없는 이름이면 false
+    bool Run(const FString& Name);
+
+    // FRHICommandList 녹화 + Null 백엔드 재생/검증 (단일 리스트 vs 병렬 녹화)
+    void RunRHICommandList();
+
+    // FTileLightCuller CPU 컬링 (기존 타일별 스칼라 vs 화면 범위 + SIMD + 행 병렬), 라이트 64~4096개
+    void RunTileLightCulling();
+
+    // FClusterLightCuller 빌드 시간/클러스터 점유율 + 샘플 지점 검증 (2D 타일과 순회 라이트 수 비교)
+    void RunClusterLightCulling();
+
+    // FOcclusionCullingManagerCPU 래스터화/HZB/테스트 시간 + 고해상도 ID 버퍼 대비 정확도 (합성 도시 + Data/Scenes 레벨)
+    void RunOcclusionCulling();
+
+    // FObjImporter 파싱 처리량(MB/s)과 정점 용접 시간 (예전 getline + stringstream / unordered_map 경로와 결과 비교)
+    void RunObjImport();
+
+    // FMeshOptimizer 정점 캐시/오버드로/페치 최적화 전후 ACMR/ATVR + 그룹별 삼각형 집합 보존 검증 (합성 구 + Data 아래 .obj)
+    void RunMeshOptimize();
+
+    // FMeshSimplifier LOD 생성: LOD별 삼각형 감소율/오차/전환 화면 크기/시간 (합성 구 + Data 아래 .obj)
+    void RunLODGeneration();
+
+    // FVertexQuantizer 압축 정점: 정점당 바이트(64/96 → 32/40), 절감량, 대상 메시 수와 노멀/UV/가중치 최대 오차 (Data 아래 .obj/.fbx)
+    void RunVertexQuantization();
+
+    // GUObjectArray 생성/삭제 반복 (발사체 패턴): free list + O(1) 삭제 vs 예전 선형 탐색, 슬롯 증가량, 약참조 파괴 감지 검증
+    void RunObjectChurn();
+
+    // 드문 클래스 순회: UClass별 객체 목록 TObjectIterator vs GUObjectArray 전체 스캔 (10만 객체), 조상 테이블 IsChildOf vs 체인 순회
+    void RunObjectIteration();
+
+    // FNamePool: 새 이름 추가/기존 이름 조회 ns (예전 소문자 FString + unordered_map 대비), 리터럴 컴파일 타임 해시, 멀티스레드 동시 추가 검증
+    void RunNamePool();
+
+    // FMemoryManager: 크기 클래스 풀 vs 시스템 힙 (고정 크기/무작위 크기, 단일/멀티 스레드), 프레임 선형 할당, 태그별 집계 검증
+    void RunMemoryPool();
+
+    // 컨테이너: TMap/TSet(노드) vs TFlatMap/TFlatSet(open addressing) 추가/조회/순회 (포인터·FString 키, 더티 집합 패턴), TInlineAllocator 작은 배열
+    void RunContainers();
+
+    // FQuat/FTransform SSE 구현 vs 예전 스칼라 구현: 곱/회전/보간/ToMatrix/합성 ns와 최대 오차, 배열 커널(점 변환/합성/스키닝 행렬), 역변환 왕복 오차
+    void RunTransformMath();
+
+    // 깊은 씬 컴포넌트 계층에서 틱당 여러 세터: 즉시 알림 + 캐시 없는 월드 트랜스폼 vs 캐시 vs 프레임당 한 번 모아서 알림 (ms/틱, 알림 수, 캐시 오차)
+    void RunSceneHierarchy();
+
+    // 스태틱 메시 액터 1만/5만 레벨: JSON vs 바이너리 레벨 파일 크기, 저장/로드 시간, 로드 결과 검증
+    void RunLevelFormat();
+
+    // PIE 시작 월드 복제 (스태틱 메시 액터 1만/5만): 액터마다 복제+등록 vs 공유 포인터 테이블 + 일괄 등록, 소유자/위치 검증
+    void RunPIEStart();
+
+    // 델리게이트 Broadcast (리스너 1/4/16, 멤버 함수/작은 람다): 인라인 바인딩 vs 예전 std::function 목록 ns, 바인딩 힙 할당 수, Broadcast 중 추가/제거 검증
+    void RunDelegateBroadcast();
+}
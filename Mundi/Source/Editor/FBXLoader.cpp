@@ -10,6 +10,11 @@
 #include "AnimSequence.h"
 #include "AnimDataModel.h"
 #include "ResourceManager.h"
+#include "AssetPreloader.h"
+#include "DerivedDataCache.h"
+#include "MeshOptimizer.h"
+#include "VertexQuantizer.h"
+#include "PlatformTime.h"
 #include <filesystem>
 #include <functional>
 
@@ -26,6 +31,7 @@ void UFbxLoader::PreLoad()
 {
 	UFbxLoader& FbxLoader = GetInstance();
 
+	const uint64 PreloadStart = FPlatformTime::Cycles64();
 	const fs::path DataDir(GDataDir);
 
 	if (!fs::exists(DataDir) || !fs::is_directory(DataDir))
@@ -34,37 +40,34 @@ void UFbxLoader::PreLoad()
 		return;
 	}
 
-	size_t LoadedCount = 0;
-	std::unordered_set<FString> ProcessedFiles; // 중복 로딩 방지
+	FPreloadTimeline Timeline;
 
-	for (const auto& Entry : fs::recursive_directory_iterator(DataDir))
+	uint64 PhaseStart = FPlatformTime::Cycles64();
+	const FPreloadAssetList Assets = FAssetPreloader::Discover(GDataDir);
+	Timeline.AddPhase("discover", FPlatformTime::ToMilliseconds(FPlatformTime::Cycles64() - PhaseStart));
+
+	// FBX SDK(FbxManager)는 스레드 안전하지 않고 로드 중에 머티리얼을 등록하므로 게임 스레드에서 순서대로
+	PhaseStart = FPlatformTime::Cycles64();
+	for (const FString& PathStr : Assets.FbxFiles)
 	{
-		if (!Entry.is_regular_file())
-			continue;
+		const uint64 Start = FPlatformTime::Cycles64();
+		FbxLoader.LoadFbxMesh(PathStr);
+
+		FPreloadTimelineEntry Entry;
+		Entry.Path = PathStr;
+		Entry.Kind = "SkeletalMesh";
+		Entry.GpuMS = FPlatformTime::ToMilliseconds(FPlatformTime::Cycles64() - Start);
+		Timeline.AddAsset(Entry);
+	}
+	Timeline.AddPhase("fbx serial", FPlatformTime::ToMilliseconds(FPlatformTime::Cycles64() - PhaseStart));
 
-		const fs::path& Path = Entry.path();
-		FString Extension = Path.extension().string();
-		std::transform(Extension.begin(), Extension.end(), Extension.begin(), [](unsigned char c) { return static_cast<char>(std::tolower(c)); });
+	// 데칼 텍스쳐를 ui에서 고를 수 있게 하기 위해 임시로 만듬. (FObjManager::Preload에서 이미 로드한 것은 건너뜀)
+	FAssetPreloader::PreloadTextures(Assets.TextureFiles, Timeline);
 
-		if (Extension == ".fbx")
-		{
-			FString PathStr = NormalizePath(Path.string());
-
-			// 이미 처리된 파일인지 확인
-			if (ProcessedFiles.find(PathStr) == ProcessedFiles.end())
-			{
-				ProcessedFiles.insert(PathStr);
-				FbxLoader.LoadFbxMesh(PathStr);
-				++LoadedCount;
-			}
-		}
-		else if (Extension == ".dds" || Extension == ".jpg" || Extension == ".png")
-		{
-			UResourceManager::GetInstance().Load<UTexture>(Path.string()); // 데칼 텍스쳐를 ui에서 고를 수 있게 하기 위해 임시로 만듬.
-		}
-	}
 	RESOURCE.SetSkeletalMeshs();
 
+	const size_t LoadedCount = Assets.FbxFiles.size();
+	Timeline.Log("UFbxLoader::Preload", FPlatformTime::ToMilliseconds(FPlatformTime::Cycles64() - PreloadStart));
 	UE_LOG("UFbxLoader::Preload: Loaded %zu .fbx files from %s", LoadedCount, DataDir.string().c_str());
 }
 
@@ -106,111 +109,99 @@ USkeletalMesh* UFbxLoader::LoadFbxMesh(const FString& FilePath)
 	return SkeletalMesh;
 }
 
-FSkeletalMeshData* UFbxLoader::LoadFbxMeshAsset(const FString& FilePath)
+FSkeletalMeshData* UFbxLoader::LoadCachedFbxMeshData(const FString& NormalizedPath, TArray<FMaterialInfo>& OutMaterialInfos, FDerivedDataKey* OutCacheKey)
 {
-	MaterialInfos.clear();
-	FString NormalizedPath = NormalizePath(FilePath);
-	FSkeletalMeshData* MeshData = nullptr;
+	OutMaterialInfos.Empty();
 #ifdef USE_OBJ_CACHE
-	// 1. 캐시 파일 경로 설정
-	FString CachePathStr = ConvertDataPathToCachePath(NormalizedPath);
-	const FString BinPathFileName = CachePathStr + ".bin";
-
-	// 캐시를 저장할 디렉토리가 없으면 생성
-	std::filesystem::path CacheFileDirPath(BinPathFileName);
-	if (CacheFileDirPath.has_parent_path())
+	// 1. 파생 데이터 캐시 키 (FBX 내용 + 임포터 버전). 머티리얼은 메시와 같은 키의 .mat.bin에 함께 저장
+	FDerivedDataCache& DDC = FDerivedDataCache::GetInstance();
+	FDerivedDataKey CacheKey = DDC.Lookup(EDerivedDataKind::FbxMesh, NormalizedPath, {}, FVertexQuantizer::GetImportSettings(), { ".bin", ".mat.bin" });
+	if (OutCacheKey)
 	{
-		std::filesystem::create_directories(CacheFileDirPath.parent_path());
+		*OutCacheKey = CacheKey;
+	}
+	if (!CacheKey.bHit)
+	{
+		return nullptr;
 	}
 
-	bool bLoadedFromCache = false;
-	
-
-	// 2. 캐시 유효성 검사
-	bool bShouldRegenerate = true;
-	if (std::filesystem::exists(BinPathFileName))
+	// 2. 캐시에서 로드 시도
+	const FString BinPathFileName = CacheKey.GetPath(".bin");
+	const FString MatBinPathFileName = CacheKey.GetPath(".mat.bin");
+	UE_LOG("Attempting to load FBX '%s' from cache.", NormalizedPath.c_str());
+	FSkeletalMeshData* MeshData = nullptr;
+	try
 	{
-		try
-		{
-			auto binTime = std::filesystem::last_write_time(BinPathFileName);
-			auto fbxTime = std::filesystem::last_write_time(NormalizedPath);
+		MeshData = new FSkeletalMeshData();
+		MeshData->PathFileName = NormalizedPath;
 
-			// FBX 파일이 캐시보다 오래되었으면 캐시 사용
-			if (fbxTime <= binTime)
-			{
-				bShouldRegenerate = false;
-			}
-		}
-		catch (const std::filesystem::filesystem_error& e)
+		FWindowsBinReader Reader(BinPathFileName);
+		if (!Reader.IsOpen())
 		{
-			UE_LOG("Filesystem error during cache validation: %s. Forcing regeneration.", e.what());
-			bShouldRegenerate = true;
+			throw std::runtime_error("Failed to open bin file for reading.");
 		}
-	}
+		Reader << *MeshData;
+		Reader.Close();
 
-	// 3. 캐시에서 로드 시도
-	if (!bShouldRegenerate)
-	{
-		UE_LOG("Attempting to load FBX '%s' from cache.", NormalizedPath.c_str());
-		try
+		FWindowsBinReader MatReader(MatBinPathFileName);
+		if (!MatReader.IsOpen())
 		{
-			MeshData = new FSkeletalMeshData();
-			MeshData->PathFileName = NormalizedPath;
-
-			FWindowsBinReader Reader(BinPathFileName);
-			if (!Reader.IsOpen())
-			{
-				throw std::runtime_error("Failed to open bin file for reading.");
-			}
-			Reader << *MeshData;
-			Reader.Close();
-
-			for (int Index = 0; Index < MeshData->GroupInfos.Num(); Index++)
-			{
-				if (MeshData->GroupInfos[Index].InitialMaterialName.empty())
-					continue;
-				const FString& MaterialName = MeshData->GroupInfos[Index].InitialMaterialName;
-				const FString& MaterialFilePath = ConvertDataPathToCachePath(MaterialName + ".mat.bin");
-				FWindowsBinReader MatReader(MaterialFilePath);
-				if (!MatReader.IsOpen())
-				{
-					throw std::runtime_error("Failed to open material bin file for reading.");
-				}
-				// for bin Load
-				FMaterialInfo MaterialInfo{};
-				Serialization::ReadAsset<FMaterialInfo>(MatReader, &MaterialInfo);
+			throw std::runtime_error("Failed to open material bin file for reading.");
+		}
+		// for bin Load
+		Serialization::ReadArray<FMaterialInfo>(MatReader, OutMaterialInfos);
+		MatReader.Close();
 
-				UMaterial* NewMaterial = NewObject<UMaterial>();
+		MeshData->CacheFilePath = BinPathFileName;
 
-				UMaterial* Default = UResourceManager::GetInstance().GetDefaultMaterial();
-				NewMaterial->SetMaterialInfo(MaterialInfo);
-				NewMaterial->SetShader(Default->GetShader());
-				NewMaterial->SetShaderMacros(Default->GetShaderMacros());
-				UResourceManager::GetInstance().Add<UMaterial>(MaterialInfo.MaterialName, NewMaterial);
-			}
+		UE_LOG("Successfully loaded FBX '%s' from cache.", NormalizedPath.c_str());
+		return MeshData;
+	}
+	catch (const std::exception& e)
+	{
+		UE_LOG("Error loading FBX from cache: %s. Cache might be corrupt or incompatible.", e.what());
+		UE_LOG("Deleting corrupt cache and forcing regeneration for '%s'.", NormalizedPath.c_str());
 
-			MeshData->CacheFilePath = BinPathFileName;
-			bLoadedFromCache = true;
+		DDC.MarkCorrupt(EDerivedDataKind::FbxMesh, CacheKey, { ".bin", ".mat.bin" });
+		delete MeshData;
+		OutMaterialInfos.Empty();
+	}
+#endif // USE_OBJ_CACHE
+	return nullptr;
+}
 
-			UE_LOG("Successfully loaded FBX '%s' from cache.", NormalizedPath.c_str());
-			return MeshData;
-		}
-		catch (const std::exception& e)
-		{
-			UE_LOG("Error loading FBX from cache: %s. Cache might be corrupt or incompatible.", e.what());
-			UE_LOG("Deleting corrupt cache and forcing regeneration for '%s'.", NormalizedPath.c_str());
+void UFbxLoader::RegisterFbxMaterials(const TArray<FMaterialInfo>& InMaterialInfos)
+{
+	UMaterial* Default = UResourceManager::GetInstance().GetDefaultMaterial();
+	for (const FMaterialInfo& MaterialInfo : InMaterialInfos)
+	{
+		UMaterial* NewMaterial = NewObject<UMaterial>();
+		NewMaterial->SetMaterialInfo(MaterialInfo);
+		NewMaterial->SetShader(Default->GetShader());
+		NewMaterial->SetShaderMacros(Default->GetShaderMacros());
+		UResourceManager::GetInstance().Add<UMaterial>(MaterialInfo.MaterialName, NewMaterial);
+	}
+}
 
-			std::filesystem::remove(BinPathFileName);
-			if (MeshData)
-			{
-				delete MeshData;
-				MeshData = nullptr;
-			}
-			bLoadedFromCache = false;
-		}
+FSkeletalMeshData* UFbxLoader::LoadFbxMeshAsset(const FString& FilePath)
+{
+	MaterialInfos.clear();
+	FString NormalizedPath = NormalizePath(FilePath);
+	FSkeletalMeshData* MeshData = nullptr;
+#ifdef USE_OBJ_CACHE
+	// 1~2. 파생 데이터 캐시에서 로드 시도 (적중하면 머티리얼만 등록하고 반환)
+	FDerivedDataCache& DDC = FDerivedDataCache::GetInstance();
+	FDerivedDataKey CacheKey;
+	TArray<FMaterialInfo> CachedMaterialInfos;
+	MeshData = LoadCachedFbxMeshData(NormalizedPath, CachedMaterialInfos, &CacheKey);
+	if (MeshData)
+	{
+		RegisterFbxMaterials(CachedMaterialInfos);
+		return MeshData;
 	}
+	const FString BinPathFileName = CacheKey.GetPath(".bin");
 
-	// 4. 캐시 로드 실패 시 FBX 파싱
+	// 3. 캐시 로드 실패 시 FBX 파싱
 	UE_LOG("Regenerating cache for FBX '%s'...", NormalizedPath.c_str());
 #endif // USE_OBJ_CACHE
 
@@ -325,30 +316,38 @@ FSkeletalMeshData* UFbxLoader::LoadFbxMeshAsset(const FString& FilePath)
 		Count += IndexList.Num();
 	}
 
+	// 정점 캐시/오버드로/정점 페치 순서 최적화 (캐시에 최적화된 결과를 저장)
+	const FMeshOptimizeStats OptimizeStats = FMeshOptimizer::OptimizeMesh(MeshData->Vertices, MeshData->Indices, MeshData->GroupInfos, &FSkinnedVertex::Position);
+	FMeshOptimizer::LogStats(NormalizedPath, OptimizeStats);
+
+	// 압축 정점 사용 여부 (로드 시 FPackedSkinnedVertex로 변환, 본 256개 이하만)
+	MeshData->bCompactVertices = FVertexQuantizer::IsEnabled() && FVertexQuantizer::CanQuantize(*MeshData);
+
 #ifdef USE_OBJ_CACHE
-	// 5. 캐시 저장
-	try
+	// 4. 캐시 저장 (임시 파일에 쓰고 다 쓴 뒤 확정)
+	if (CacheKey.IsValid())
 	{
-		FWindowsBinWriter Writer(BinPathFileName);
-		Writer << *MeshData;
-		Writer.Close();
-
-		for (FMaterialInfo& MaterialInfo : MaterialInfos)
+		try
 		{
-			
-			const FString MaterialFilePath = ConvertDataPathToCachePath(MaterialInfo.MaterialName + ".mat.bin");
-			FWindowsBinWriter MatWriter(MaterialFilePath);
-			Serialization::WriteAsset<FMaterialInfo>(MatWriter, &MaterialInfo);
-			MatWriter.Close();
-		}
+			FWindowsBinWriter Writer(CacheKey.GetWritePath(".bin"));
+			Writer << *MeshData;
+			Writer.Close();
 
-		MeshData->CacheFilePath = BinPathFileName;
+			FWindowsBinWriter MatWriter(CacheKey.GetWritePath(".mat.bin"));
+			Serialization::WriteArray<FMaterialInfo>(MatWriter, MaterialInfos);
+			MatWriter.Close();
 
-		UE_LOG("Cache regeneration complete for FBX '%s'.", NormalizedPath.c_str());
-	}
-	catch (const std::exception& e)
-	{
-		UE_LOG("Failed to save FBX cache: %s", e.what());
+			if (DDC.Commit(CacheKey, { ".bin", ".mat.bin" }))
+			{
+				MeshData->CacheFilePath = BinPathFileName;
+				UE_LOG("Cache regeneration complete for FBX '%s'.", NormalizedPath.c_str());
+			}
+		}
+		catch (const std::exception& e)
+		{
+			UE_LOG("Failed to save FBX cache: %s", e.what());
+			DDC.Abandon(CacheKey, { ".bin", ".mat.bin" });
+		}
 	}
 #endif // USE_OBJ_CACHE
 
@@ -1207,43 +1206,21 @@ UAnimSequence* UFbxLoader::LoadFbxAnimation(const FString& FilePath, const struc
 	// 4. 바이너리 캐시 파일 처리
 	UAnimDataModel* DataModel = nullptr;
 #ifdef USE_OBJ_CACHE
-	// 4-1. 캐시 파일 경로 설정
-	FString CachePathStr = ConvertDataPathToCachePath(NormalizedPath);
-	const FString AnimCacheFileName = CachePathStr + ".anim.bin";
-
-	// 캐시를 저장할 디렉토리가 없으면 생성
-	std::filesystem::path CacheFileDirPath(AnimCacheFileName);
-	if (CacheFileDirPath.has_parent_path())
+	// 4-1. 파생 데이터 캐시 키: FBX 내용 + 대상 스켈레톤의 본 순서 (커브 배열이 본 인덱스 순서라서)
+	FString SkeletonSettings;
+	for (const FBone& Bone : TargetSkeleton->Bones)
 	{
-		std::filesystem::create_directories(CacheFileDirPath.parent_path());
+		SkeletonSettings += Bone.Name;
+		SkeletonSettings += '\n';
 	}
+	FDerivedDataCache& DDC = FDerivedDataCache::GetInstance();
+	FDerivedDataKey CacheKey = DDC.Lookup(EDerivedDataKind::FbxAnimation, NormalizedPath, {}, SkeletonSettings, { ".anim.bin" });
+	const FString AnimCacheFileName = CacheKey.GetPath(".anim.bin");
 
 	bool bLoadedFromCache = false;
 
-	// 4-2. 캐시 유효성 검사
-	bool bShouldRegenerate = true;
-	if (std::filesystem::exists(AnimCacheFileName))
-	{
-		try
-		{
-			auto binTime = std::filesystem::last_write_time(AnimCacheFileName);
-			auto fbxTime = std::filesystem::last_write_time(NormalizedPath);
-
-			// FBX 파일이 캐시보다 오래되었으면 캐시 사용
-			if (fbxTime <= binTime)
-			{
-				bShouldRegenerate = false;
-			}
-		}
-		catch (const std::filesystem::filesystem_error& e)
-		{
-			UE_LOG("UFbxLoader::LoadFbxAnimation: Filesystem error during cache validation: %s. Forcing regeneration.", e.what());
-			bShouldRegenerate = true;
-		}
-	}
-
-	// 4-3. 캐시에서 로드 시도
-	if (!bShouldRegenerate)
+	// 4-2. 캐시에서 로드 시도
+	if (CacheKey.bHit)
 	{
 		UE_LOG("UFbxLoader::LoadFbxAnimation: Attempting to load animation from cache '%s'", AnimCacheFileName.c_str());
 		try
@@ -1279,14 +1256,14 @@ UAnimSequence* UFbxLoader::LoadFbxAnimation(const FString& FilePath, const struc
 			UE_LOG("UFbxLoader::LoadFbxAnimation: Error loading animation from cache: %s. Cache might be corrupt or incompatible.", e.what());
 			UE_LOG("UFbxLoader::LoadFbxAnimation: Deleting corrupt cache and forcing regeneration.");
 
-			std::filesystem::remove(AnimCacheFileName);
+			DDC.MarkCorrupt(EDerivedDataKind::FbxAnimation, CacheKey, { ".anim.bin" });
 			// UObject는 ObjectFactory가 관리하므로 수동 delete 금지
 			DataModel = nullptr;
 			bLoadedFromCache = false;
 		}
 	}
 
-	// 4-4. 캐시 로드 실패 시 FBX 파싱
+	// 4-3. 캐시 로드 실패 시 FBX 파싱
 	if (!bLoadedFromCache)
 	{
 		UE_LOG("UFbxLoader::LoadFbxAnimation: Regenerating animation cache from FBX...");
@@ -1557,21 +1534,25 @@ UAnimSequence* UFbxLoader::LoadFbxAnimation(const FString& FilePath, const struc
 
 #ifdef USE_OBJ_CACHE
 	// 19. 바이너리 캐시 저장 (FBX 파싱으로 생성한 경우만)
-	if (!bLoadedFromCache)
+	if (!bLoadedFromCache && CacheKey.IsValid())
 	{
 		try
 		{
 			UE_LOG("UFbxLoader::LoadFbxAnimation: Saving animation to cache '%s'", AnimCacheFileName.c_str());
 
-			FWindowsBinWriter Writer(AnimCacheFileName);
+			FWindowsBinWriter Writer(CacheKey.GetWritePath(".anim.bin"));
 			Writer << *DataModel;
 			Writer.Close();
 
-			UE_LOG("UFbxLoader::LoadFbxAnimation: Successfully saved animation cache");
+			if (DDC.Commit(CacheKey, { ".anim.bin" }))
+			{
+				UE_LOG("UFbxLoader::LoadFbxAnimation: Successfully saved animation cache");
+			}
 		}
 		catch (const std::exception& e)
 		{
 			UE_LOG("UFbxLoader::LoadFbxAnimation: Error saving animation cache: %s", e.what());
+			DDC.Abandon(CacheKey, { ".anim.bin" });
 			// 캐시 저장 실패는 치명적이지 않으므로 계속 진행
 		}
 	}
@@ -16,6 +16,13 @@ public:
 
 	FSkeletalMeshData* LoadFbxMeshAsset(const FString& FilePath);
 
+	// LoadFbxMeshAsset의 캐시 적중 경로를 CPU 단계와 등록 단계로 나눈 것 (비동기 로드용)
+	// LoadCachedFbxMeshData: 파생 데이터 캐시의 .bin/.mat.bin 읽기. FBX SDK/UObject에 접근하지 않으므로 워커 스레드에서 호출 가능
+	// 캐시 미스/손상이면 nullptr (FBX 파싱은 SdkManager가 스레드 안전하지 않아 LoadFbxMeshAsset으로 게임 스레드에서)
+	static FSkeletalMeshData* LoadCachedFbxMeshData(const FString& NormalizedPath, TArray<FMaterialInfo>& OutMaterialInfos, struct FDerivedDataKey* OutCacheKey = nullptr);
+	// RegisterFbxMaterials: 캐시에서 읽은 머티리얼 정보로 UMaterial 생성/등록 (게임 스레드 전용)
+	static void RegisterFbxMaterials(const TArray<FMaterialInfo>& InMaterialInfos);
+
 	/**
 	 * FBX 파일에서 애니메이션 로드
 	 * @param FilePath FBX 파일 경로
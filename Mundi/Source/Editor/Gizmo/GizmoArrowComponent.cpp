@@ -153,7 +153,15 @@ void UGizmoArrowComponent::CollectMeshBatches(TArray<FMeshBatchElement>& OutMesh
 		// 머티리얼과 셰이더는 루프 밖에서 이미 결정되었습니다.
 		FMeshBatchElement BatchElement;
 
-		FShaderVariant* ShaderVariant = ShaderToUse->GetOrCompileShaderVariant(MaterialToUse->GetShaderMacros());
+		TArray<FShaderMacro> ShaderMacros = MaterialToUse->GetShaderMacros();
+		if (StaticMesh->HasCompactVertices())
+		{
+			FShaderMacro CompactVertexMacro;
+			CompactVertexMacro.Name = FNameLiteral("COMPACT_VERTEX");
+			CompactVertexMacro.Definition = FNameLiteral("1");
+			ShaderMacros.Add(CompactVertexMacro);
+		}
+		FShaderVariant* ShaderVariant = ShaderToUse->GetOrCompileShaderVariant(ShaderMacros);
 
 		// --- 정렬 키 ---
 		BatchElement.VertexShader = ShaderVariant->VertexShader;
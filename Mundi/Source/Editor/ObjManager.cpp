@@ -7,8 +7,18 @@
 #include "Enums.h"
 #include "WindowsBinReader.h"
 #include "WindowsBinWriter.h"
+#include "WindowsMappedFile.h"
+#include "TaskScheduler.h"
+#include "AssetPreloader.h"
+#include "DerivedDataCache.h"
+#include "MeshOptimizer.h"
+#include "MeshSimplifier.h"
+#include "VertexQuantizer.h"
+#include "PlatformTime.h"
 #include <filesystem>
 #include <unordered_set>
+#include <charconv>
+#include <cstring>
 
 namespace fs = std::filesystem;
 
@@ -89,6 +99,359 @@ namespace
 		// 옵션 플래그를 찾지 못한 경우
 		return InDefaultValue;
 	}
+
+	//====================================================================================
+	// 고속 OBJ 파서 (메모리 맵 + 청크 병렬 파싱)
+	// 기존 getline + stringstream 경로와 같은 FObjInfo를 만든다
+	//====================================================================================
+
+	constexpr size_t ObjParseChunkSize = 4 * 1024 * 1024;
+
+	// 청크 하나의 파싱 결과. 인덱스는 파일 전체 기준 (음수 상대 인덱스만 병합 때 보정)
+	struct FObjParseChunk
+	{
+		TArray<FVector> Positions;
+		TArray<FVector2D> TexCoords;
+		TArray<FVector> Normals;
+
+		TArray<uint32> PositionIndices;
+		TArray<uint32> TexCoordIndices;
+		TArray<uint32> NormalIndices;
+
+		// 음수(상대) 인덱스가 들어간 위치. 값은 청크 내 개수 기준이라 병합 때 청크 시작 개수를 더함
+		TArray<uint32> RelativePositionFixups;
+		TArray<uint32> RelativeTexCoordFixups;
+		TArray<uint32> RelativeNormalFixups;
+
+		TArray<TPair<uint32, FString>> UseMaterials;   // (청크 내 인덱스 위치, 머티리얼 이름)
+		FString MtlLib;
+		bool bHasMtlLib = false;
+
+		uint32 UnknownLineCount = 0;
+		FString FirstUnknownLine;
+
+		// 면 파싱용 작업 버퍼 (줄마다 재사용)
+		TArray<int64> FaceIndices;
+	};
+
+	inline bool IsObjSpace(char C)
+	{
+		return C == ' ' || C == '\t' || C == '\r' || C == '\v' || C == '\f';
+	}
+
+	inline bool IsObjDigit(char C)
+	{
+		return C >= '0' && C <= '9';
+	}
+
+	// 정확히 표현되는 10의 거듭제곱 (float 가수 24비트 안)
+	constexpr float ObjPow10[] = { 1e0f, 1e1f, 1e2f, 1e3f, 1e4f, 1e5f, 1e6f, 1e7f, 1e8f, 1e9f, 1e10f };
+
+	/**
+	 * 공백을 건너뛰고 float 하나를 읽습니다. (stream >> float와 같은 값, 올바른 반올림)
+	 * 유효 숫자가 2^24 이하이고 10의 지수가 ±10 이내면 float 곱/나눗셈 한 번으로 정확히 계산하고,
+	 * 나머지는 std::from_chars로 넘깁니다.
+	 */
+	bool ParseObjFloat(const char*& Cursor, const char* End, float& OutValue)
+	{
+		while (Cursor < End && IsObjSpace(*Cursor))
+		{
+			++Cursor;
+		}
+
+		const char* P = Cursor;
+		bool bNegative = false;
+		if (P < End && (*P == '-' || *P == '+'))
+		{
+			bNegative = (*P == '-');
+			++P;
+		}
+
+		uint64 Mantissa = 0;
+		int32 Exponent = 0;
+		bool bAnyDigit = false;
+		bool bTruncated = false;
+
+		while (P < End && IsObjDigit(*P))
+		{
+			if (Mantissa < 100000000000000000ull)
+			{
+				Mantissa = Mantissa * 10 + static_cast<uint64>(*P - '0');
+			}
+			else
+			{
+				++Exponent;
+				bTruncated = true;
+			}
+			bAnyDigit = true;
+			++P;
+		}
+		if (P < End && *P == '.')
+		{
+			++P;
+			while (P < End && IsObjDigit(*P))
+			{
+				if (Mantissa < 100000000000000000ull)
+				{
+					Mantissa = Mantissa * 10 + static_cast<uint64>(*P - '0');
+					--Exponent;
+				}
+				else
+				{
+					bTruncated = true;
+				}
+				bAnyDigit = true;
+				++P;
+			}
+		}
+		if (bAnyDigit && P < End && (*P == 'e' || *P == 'E'))
+		{
+			const char* ExponentStart = P + 1;
+			bool bNegativeExponent = false;
+			if (ExponentStart < End && (*ExponentStart == '-' || *ExponentStart == '+'))
+			{
+				bNegativeExponent = (*ExponentStart == '-');
+				++ExponentStart;
+			}
+			if (ExponentStart < End && IsObjDigit(*ExponentStart))
+			{
+				int32 ExplicitExponent = 0;
+				P = ExponentStart;
+				while (P < End && IsObjDigit(*P))
+				{
+					ExplicitExponent = std::min(ExplicitExponent * 10 + (*P - '0'), 100000);
+					++P;
+				}
+				Exponent += bNegativeExponent ? -ExplicitExponent : ExplicitExponent;
+			}
+		}
+
+		if (bAnyDigit && !bTruncated && Mantissa <= (1ull << 24) && Exponent >= -10 && Exponent <= 10)
+		{
+			float Value = static_cast<float>(Mantissa);
+			Value = (Exponent < 0) ? Value / ObjPow10[-Exponent] : Value * ObjPow10[Exponent];
+			OutValue = bNegative ? -Value : Value;
+			Cursor = P;
+			return true;
+		}
+
+		// 느린 경로 (긴 가수, 큰 지수, inf/nan). from_chars는 '+' 부호를 받지 않음
+		const char* NumberStart = (Cursor < End && *Cursor == '+') ? Cursor + 1 : Cursor;
+		const std::from_chars_result Result = std::from_chars(NumberStart, End, OutValue);
+		if (Result.ec != std::errc())
+		{
+			return false;
+		}
+		Cursor = Result.ptr;
+		return true;
+	}
+
+	// 면 정점 정의의 인덱스 하나 ("12", "-3"). 숫자가 없으면 false
+	bool ParseObjIndex(const char*& Cursor, const char* End, int64& OutValue)
+	{
+		const char* P = Cursor;
+		bool bNegative = false;
+		if (P < End && (*P == '-' || *P == '+'))
+		{
+			bNegative = (*P == '-');
+			++P;
+		}
+		if (P >= End || !IsObjDigit(*P))
+		{
+			return false;
+		}
+
+		int64 Value = 0;
+		while (P < End && IsObjDigit(*P))
+		{
+			Value = Value * 10 + (*P - '0');
+			++P;
+		}
+		OutValue = bNegative ? -Value : Value;
+		Cursor = P;
+		return true;
+	}
+
+	// OBJ 인덱스 → 0 기반 인덱스. 음수는 지금까지 읽은 개수 기준 상대 인덱스로 기록해 두고 병합 때 보정
+	inline void AddObjIndex(int64 RawIndex, uint32 LocalCount, TArray<uint32>& OutIndices, TArray<uint32>& OutRelativeFixups)
+	{
+		if (RawIndex < 0)
+		{
+			OutRelativeFixups.Add(static_cast<uint32>(OutIndices.Num()));
+			OutIndices.Add(static_cast<uint32>(static_cast<int64>(LocalCount) + RawIndex));
+		}
+		else
+		{
+			// 인덱스가 없거나 0이면 기존 파서처럼 0 / 0xFFFFFFFF
+			OutIndices.Add(static_cast<uint32>(RawIndex - 1));
+		}
+	}
+
+	// "f" 줄의 정점 정의들을 읽어 팬 삼각형으로 추가
+	void ParseObjFace(const char* Cursor, const char* End, bool bIsRightHanded, FObjParseChunk& Chunk)
+	{
+		// 정점 정의마다 (위치, UV, 법선) 원본 인덱스 3개. 없는 항목은 1 (= 0번 인덱스)
+		TArray<int64>& Face = Chunk.FaceIndices;
+		Face.Empty();
+
+		while (true)
+		{
+			while (Cursor < End && IsObjSpace(*Cursor))
+			{
+				++Cursor;
+			}
+			if (Cursor >= End || *Cursor == '#')
+			{
+				break;
+			}
+
+			const char* TokenEnd = Cursor;
+			while (TokenEnd < End && !IsObjSpace(*TokenEnd))
+			{
+				++TokenEnd;
+			}
+
+			int64 Parts[3] = { 1, 1, 1 };
+			for (int32 Part = 0; Part < 3 && Cursor < TokenEnd; ++Part)
+			{
+				const char* PartEnd = Cursor;
+				while (PartEnd < TokenEnd && *PartEnd != '/')
+				{
+					++PartEnd;
+				}
+				const char* NumberCursor = Cursor;
+				ParseObjIndex(NumberCursor, PartEnd, Parts[Part]);
+				Cursor = (PartEnd < TokenEnd) ? PartEnd + 1 : PartEnd;
+			}
+			Face.Add(Parts[0]);
+			Face.Add(Parts[1]);
+			Face.Add(Parts[2]);
+			Cursor = TokenEnd;
+		}
+
+		const uint32 NumFaceVertices = static_cast<uint32>(Face.Num() / 3);
+		const uint32 PositionCount = static_cast<uint32>(Chunk.Positions.Num());
+		const uint32 TexCoordCount = static_cast<uint32>(Chunk.TexCoords.Num());
+		const uint32 NormalCount = static_cast<uint32>(Chunk.Normals.Num());
+
+		auto AddCorner = [&](uint32 Corner)
+			{
+				AddObjIndex(Face[Corner * 3 + 0], PositionCount, Chunk.PositionIndices, Chunk.RelativePositionFixups);
+				AddObjIndex(Face[Corner * 3 + 1], TexCoordCount, Chunk.TexCoordIndices, Chunk.RelativeTexCoordFixups);
+				AddObjIndex(Face[Corner * 3 + 2], NormalCount, Chunk.NormalIndices, Chunk.RelativeNormalFixups);
+			};
+
+		// 4각형 이상의 폴리곤은 팬으로 분할
+		for (uint32 i = 1; i + 1 < NumFaceVertices; ++i)
+		{
+			AddCorner(0);
+			AddCorner(bIsRightHanded ? i + 1 : i);
+			AddCorner(bIsRightHanded ? i : i + 1);
+		}
+	}
+
+	// [Begin, End) 범위의 줄들을 파싱. Begin은 줄 시작이어야 함
+	void ParseObjChunk(const char* Begin, const char* End, bool bIsRightHanded, FObjParseChunk& Chunk)
+	{
+		// 대략적인 줄 수로 미리 예약 (정점 한 줄 약 30바이트)
+		const size_t EstimatedLines = static_cast<size_t>(End - Begin) / 32;
+		Chunk.Positions.reserve(EstimatedLines / 2);
+		Chunk.PositionIndices.reserve(EstimatedLines);
+		Chunk.TexCoordIndices.reserve(EstimatedLines);
+		Chunk.NormalIndices.reserve(EstimatedLines);
+
+		const char* Line = Begin;
+		while (Line < End)
+		{
+			const char* LineEnd = static_cast<const char*>(std::memchr(Line, '\n', static_cast<size_t>(End - Line)));
+			if (!LineEnd)
+			{
+				LineEnd = End;
+			}
+			const char* P = Line;
+			Line = (LineEnd < End) ? LineEnd + 1 : End;
+
+			// 텍스트 모드 읽기처럼 줄 끝의 '\r' 제거, 앞쪽 공백 제거
+			const char* ContentEnd = LineEnd;
+			if (ContentEnd > P && ContentEnd[-1] == '\r')
+			{
+				--ContentEnd;
+			}
+			while (P < ContentEnd && (*P == ' ' || *P == '\t' || *P == '\r'))
+			{
+				++P;
+			}
+			if (P == ContentEnd || *P == '#')
+			{
+				continue;
+			}
+
+			const size_t Length = static_cast<size_t>(ContentEnd - P);
+			auto StartsWith = [&](const char* Prefix, size_t PrefixLength)
+				{
+					return Length >= PrefixLength && std::memcmp(P, Prefix, PrefixLength) == 0;
+				};
+
+			if (StartsWith("v ", 2)) // 정점 좌표 (v x y z)
+			{
+				const char* Cursor = P + 2;
+				float X = 0.0f, Y = 0.0f, Z = 0.0f;
+				ParseObjFloat(Cursor, ContentEnd, X) && ParseObjFloat(Cursor, ContentEnd, Y) && ParseObjFloat(Cursor, ContentEnd, Z);
+				Chunk.Positions.Add(bIsRightHanded ? FVector(X, -Y, Z) : FVector(X, Y, Z));
+			}
+			else if (StartsWith("vt ", 3)) // 텍스처 좌표 (vt u v)
+			{
+				const char* Cursor = P + 3;
+				float U = 0.0f, V = 0.0f;
+				ParseObjFloat(Cursor, ContentEnd, U) && ParseObjFloat(Cursor, ContentEnd, V);
+				// obj의 vt는 좌하단이 (0,0) -> DirectX UV는 좌상단이 (0,0) (상하 반전으로 컨버팅)
+				Chunk.TexCoords.Add(FVector2D(U, 1.0f - V));
+			}
+			else if (StartsWith("vn ", 3)) // 법선 (vn x y z)
+			{
+				const char* Cursor = P + 3;
+				float X = 0.0f, Y = 0.0f, Z = 0.0f;
+				ParseObjFloat(Cursor, ContentEnd, X) && ParseObjFloat(Cursor, ContentEnd, Y) && ParseObjFloat(Cursor, ContentEnd, Z);
+				Chunk.Normals.Add(bIsRightHanded ? FVector(X, -Y, Z) : FVector(X, Y, Z));
+			}
+			else if (StartsWith("f ", 2)) // 면 (f v1/vt1/vn1 v2/vt2/vn2 ...)
+			{
+				ParseObjFace(P + 2, ContentEnd, bIsRightHanded, Chunk);
+			}
+			else if (StartsWith("g ", 2)) // 그룹 (g groupName)
+			{
+				// 현재 'usemtl'을 기준으로 그룹을 나누므로 'g' 태그는 무시합니다.
+			}
+			else if (StartsWith("mtllib ", 7))
+			{
+				Chunk.MtlLib.assign(P + 7, ContentEnd);
+				Chunk.bHasMtlLib = true;
+			}
+			else if (StartsWith("usemtl ", 7))
+			{
+				Chunk.UseMaterials.Add(TPair<uint32, FString>(static_cast<uint32>(Chunk.PositionIndices.Num()), FString(P + 7, ContentEnd)));
+			}
+			else
+			{
+				if (Chunk.UnknownLineCount == 0)
+				{
+					Chunk.FirstUnknownLine.assign(P, ContentEnd);
+				}
+				++Chunk.UnknownLineCount;
+			}
+		}
+	}
+
+	// 청크의 인덱스 배열을 결과 뒤에 붙이고, 상대 인덱스는 청크 시작 시점의 개수만큼 보정
+	void AppendObjIndices(TArray<uint32>& OutIndices, const TArray<uint32>& ChunkIndices, const TArray<uint32>& RelativeFixups, uint32 ElementBase)
+	{
+		const size_t IndexBase = OutIndices.size();
+		OutIndices.insert(OutIndices.end(), ChunkIndices.begin(), ChunkIndices.end());
+		for (uint32 Fixup : RelativeFixups)
+		{
+			OutIndices[IndexBase + Fixup] += ElementBase;
+		}
+	}
 }
 
 /**
@@ -123,6 +486,7 @@ static FString FindMtlFilePath(const FString& InObjPath)
 /**
  * @brief .obj 파일을 빠르게 스캔하여 참조된 모든 .mtl 파일의 전체 경로 목록을 반환합니다.
  * 이 함수는 전체 3D 데이터를 파싱하지 않고 'mtllib' 지시어만 효율적으로 찾습니다.
+ * 파생 데이터 캐시 키를 만들 때마다 호출되므로 메모리 맵으로 줄 머리만 확인합니다.
  * @param ObjPath 원본 .obj 파일의 경로입니다.
  * @param OutMtlFilePaths[out] 발견된 .mtl 파일들의 전체 경로가 저장될 배열입니다.
  * @return 스캔에 성공하면 true, 파일 열기에 실패하면 false를 반환합니다.
@@ -131,93 +495,54 @@ bool GetMtlDependencies(const FString& ObjPath, TArray<FString>& OutMtlFilePaths
 {
 	// 한글 경로 지원: UTF-8 → UTF-16 변환 후 파일 열기
 	FWideString WPath = UTF8ToWide(ObjPath);
-	std::ifstream InFile(WPath);
-	if (!InFile.is_open())
+	FWindowsMappedFile File(WPath);
+	if (!File.IsOpen())
 	{
 		UE_LOG("Failed to open .obj file for dependency scan: %s", ObjPath.c_str());
 		return false;
 	}
 
-	fs::path BaseDir = fs::path(ObjPath).parent_path();
-	FString Line;
+	fs::path BaseDir = fs::path(WPath).parent_path();
+	const char* Cursor = File.GetData();
+	const char* const End = Cursor + File.GetSize();
 
-	while (std::getline(InFile, Line))
+	while (Cursor < End)
 	{
-		// 라인 앞뒤의 공백을 제거하여 안정성을 높입니다.
-		Line.erase(0, Line.find_first_not_of(" \t\r\n"));
-		Line.erase(Line.find_last_not_of(" \t\r\n") + 1);
-
-		if (Line.rfind("mtllib ", 0) == 0) // "mtllib "으로 시작하는지 확인
+		const char* LineEnd = static_cast<const char*>(std::memchr(Cursor, '\n', End - Cursor));
+		if (!LineEnd)
 		{
-			// "mtllib " 다음의 모든 문자열을 경로로 추출합니다.
-			FString MtlFileName = Line.substr(7);
-			if (!MtlFileName.empty())
-			{
-				fs::path FullPath = fs::weakly_canonical(BaseDir / MtlFileName);
-				FString PathStr = FullPath.string();
-				std::replace(PathStr.begin(), PathStr.end(), '\\', '/');
-				OutMtlFilePaths.AddUnique(NormalizePath(PathStr));
-			}
+			LineEnd = End;
 		}
-	}
-	return true;
-}
 
-/**
- * @brief 캐시 파일이 원본(.obj) 및 모든 의존성(.mtl) 파일보다 최신인지 검사합니다.
- * @param ObjPath 원본 .obj 파일의 경로입니다.
- * @param BinPath 메쉬 데이터 캐시(.obj.bin) 파일의 경로입니다.
- * @param MatBinPath 머티리얼 데이터 캐시(.mtl.bin) 파일의 경로입니다.
- * @return 캐시를 다시 생성해야 하면 true, 캐시가 유효하면 false를 반환합니다.
- */
-bool ShouldRegenerateCache(const FString& ObjPath, const FString& BinPath, const FString& MatBinPath)
-{
-	// 캐시 파일 중 하나라도 존재하지 않으면 무조건 재생성해야 합니다.
-	if (!fs::exists(BinPath) || !fs::exists(MatBinPath))
-	{
-		return true;
-	}
-
-	try
-	{
-		auto BinTimestamp = fs::last_write_time(BinPath);
-
-		// 1. 원본 .obj 파일의 수정 시간을 캐시 파일과 비교합니다.
-		if (fs::last_write_time(ObjPath) > BinTimestamp)
+		// 라인 앞의 공백을 건너뛰고 "mtllib "으로 시작하는지 확인
+		const char* LineBegin = Cursor;
+		while (LineBegin < LineEnd && (*LineBegin == ' ' || *LineBegin == '\t'))
 		{
-			return true;
+			++LineBegin;
 		}
-
-		// 2. .obj 파일을 빠르게 스캔하여 의존하는 .mtl 파일 목록을 가져옵니다.
-		TArray<FString> MtlDependencies;
-		if (!GetMtlDependencies(ObjPath, MtlDependencies))
+		if (LineEnd - LineBegin > 7 && std::memcmp(LineBegin, "mtllib ", 7) == 0)
 		{
-			return true; // .obj 파일을 읽을 수 없으면 안전을 위해 캐시를 재생성합니다.
-		}
-
-		// 3. 각 .mtl 파일의 수정 시간을 캐시 파일과 비교합니다.
-		for (const FString& MtlPath : MtlDependencies)
-		{
-			// .mtl 파일이 존재하지 않거나 캐시보다 최신 버전이면 재생성합니다.
-			if (!fs::exists(MtlPath) || fs::last_write_time(MtlPath) > BinTimestamp)
+			// "mtllib " 다음의 모든 문자열을 경로로 추출합니다. (뒤쪽 공백/개행 제거)
+			FString MtlFileName(LineBegin + 7, LineEnd);
+			MtlFileName.erase(0, MtlFileName.find_first_not_of(" \t"));
+			MtlFileName.erase(MtlFileName.find_last_not_of(" \t\r") + 1);
+			if (!MtlFileName.empty())
 			{
-				return true;
+				fs::path FullPath = fs::weakly_canonical(BaseDir / fs::path(UTF8ToWide(MtlFileName)));
+				FString PathStr = WideToUTF8(FullPath.wstring());
+				std::replace(PathStr.begin(), PathStr.end(), '\\', '/');
+				OutMtlFilePaths.AddUnique(NormalizePath(PathStr));
 			}
 		}
-	}
-	catch (const fs::filesystem_error& e)
-	{
-		// 파일 시스템 오류(예: 접근 권한 없음) 발생 시 안전하게 캐시를 재생성합니다.
-		UE_LOG("Filesystem error during cache validation: %s. Forcing regeneration.", e.what());
-		return true;
-	}
 
-	// 모든 검사를 통과하면 캐시는 유효합니다.
-	return false;
+		Cursor = LineEnd + 1;
+	}
+	return true;
 }
 
 void FObjManager::Preload()
 {
+	const uint64 PreloadStart = FPlatformTime::Cycles64();
 	const fs::path DataDir(GDataDir);
 
 	if (!fs::exists(DataDir) || !fs::is_directory(DataDir))
@@ -226,39 +551,38 @@ void FObjManager::Preload()
 		return;
 	}
 
-	size_t LoadedCount = 0;
-	std::unordered_set<FString> ProcessedFiles; // 중복 로딩 방지
+	FPreloadTimeline Timeline;
 
-	for (const auto& Entry : fs::recursive_directory_iterator(DataDir))
-	{
-		if (!Entry.is_regular_file())
-			continue;
+	uint64 PhaseStart = FPlatformTime::Cycles64();
+	const FPreloadAssetList Assets = FAssetPreloader::Discover(GDataDir);
+	Timeline.AddPhase("discover", FPlatformTime::ToMilliseconds(FPlatformTime::Cycles64() - PhaseStart));
 
-		const fs::path& Path = Entry.path();
-		FString Extension = Path.extension().string();
-		std::transform(Extension.begin(), Extension.end(), Extension.begin(), [](unsigned char c) { return static_cast<char>(std::tolower(c)); });
+	// OBJ: 파싱/캐시 읽기는 워커에서, 등록과 버퍼 생성은 게임 스레드에서
+	FAssetPreloader::PreloadObjStaticMeshes(Assets.ObjFiles, Timeline);
 
-		if (Extension == ".obj"|| Extension == ".fbx")
-		{
-			FString PathStr = NormalizePath(Path.string());
-
-			// 이미 처리된 파일인지 확인
-			if (ProcessedFiles.find(PathStr) == ProcessedFiles.end())
-			{
-				ProcessedFiles.insert(PathStr);
-				LoadObjStaticMesh(PathStr);
-				++LoadedCount;
-			}
-		}
-		else if (Extension == ".dds" || Extension == ".jpg" || Extension == ".png")
-		{
-			UResourceManager::GetInstance().Load<UTexture>(Path.string()); // 데칼 텍스쳐를 ui에서 고를 수 있게 하기 위해 임시로 만듬.
-		}
+	// FBX 스태틱 메시: FBX SDK 임포트와 머티리얼 등록이 섞여 있어 게임 스레드에서 순서대로
+	PhaseStart = FPlatformTime::Cycles64();
+	for (const FString& PathStr : Assets.FbxFiles)
+	{
+		const uint64 Start = FPlatformTime::Cycles64();
+		LoadObjStaticMesh(PathStr);
+
+		FPreloadTimelineEntry Entry;
+		Entry.Path = PathStr;
+		Entry.Kind = "StaticMesh";
+		Entry.GpuMS = FPlatformTime::ToMilliseconds(FPlatformTime::Cycles64() - Start);
+		Timeline.AddAsset(Entry);
 	}
+	Timeline.AddPhase("fbx serial", FPlatformTime::ToMilliseconds(FPlatformTime::Cycles64() - PhaseStart));
+
+	// 데칼 텍스쳐를 ui에서 고를 수 있게 하기 위해 임시로 만듬.
+	FAssetPreloader::PreloadTextures(Assets.TextureFiles, Timeline);
 
 	// 4) 모든 StaticMeshs 가져오기
 	RESOURCE.SetStaticMeshs();
 
+	const size_t LoadedCount = Assets.ObjFiles.size() + Assets.FbxFiles.size();
+	Timeline.Log("FObjManager::Preload", FPlatformTime::ToMilliseconds(FPlatformTime::Cycles64() - PreloadStart));
 	UE_LOG("FObjManager::Preload: Loaded %zu .obj files from %s", LoadedCount, DataDir.string().c_str());
 }
 
@@ -296,29 +620,43 @@ FStaticMesh* FObjManager::LoadObjStaticMeshAsset(const FString& PathFileName)
 		return nullptr;
 	}
 
-#ifdef USE_OBJ_CACHE
-	// 2-1. 캐시 파일 경로 설정
-	FString CachePathStr = ConvertDataPathToCachePath(NormalizedPathStr);
+	UMaterial* DefaultMaterial = UResourceManager::GetInstance().GetDefaultMaterial();
+	const FString DefaultMaterialName = DefaultMaterial ? DefaultMaterial->GetMaterialInfo().MaterialName : FString();
 
-	const FString BinPathFileName = CachePathStr + ".bin";
-	const FString MatBinPathFileName = CachePathStr + ".mat.bin";
+	TArray<FMaterialInfo> MaterialInfos;
+	FStaticMesh* NewFStaticMesh = BuildObjStaticMeshData(NormalizedPathStr, DefaultMaterialName, MaterialInfos);
+	if (!NewFStaticMesh)
+	{
+		return nullptr;
+	}
+	return RegisterObjStaticMeshData(NormalizedPathStr, NewFStaticMesh, MaterialInfos);
+}
 
-	// 캐시를 저장할 디렉토리가 없으면 생성
-	fs::path CacheFileDirPath(BinPathFileName);
-	if (CacheFileDirPath.has_parent_path())
+FStaticMesh* FObjManager::BuildObjStaticMeshData(const FString& NormalizedPathStr, const FString& DefaultMaterialName, TArray<FMaterialInfo>& MaterialInfos)
+{
+#ifdef USE_OBJ_CACHE
+	// 2-1. 파생 데이터 캐시 키: .obj와 참조하는 .mtl 내용 + 기본 머티리얼 이름 (EnsureDefaultMaterial 결과가 캐시에 들어감)
+	FDerivedDataCache& DDC = FDerivedDataCache::GetInstance();
+	TArray<FString> MtlDependencies;
+	try
 	{
-		fs::create_directories(CacheFileDirPath.parent_path());
+		GetMtlDependencies(NormalizedPathStr, MtlDependencies);
 	}
+	catch (const fs::filesystem_error& e)
+	{
+		UE_LOG("Filesystem error during .mtl dependency scan: %s", e.what());
+	}
+	const FString ImportSettings = DefaultMaterialName + ";" + FVertexQuantizer::GetImportSettings();
+	FDerivedDataKey CacheKey = DDC.Lookup(EDerivedDataKind::ObjMesh, NormalizedPathStr, MtlDependencies, ImportSettings, { ".bin", ".mat.bin" });
+
+	const FString BinPathFileName = CacheKey.GetPath(".bin");
+	const FString MatBinPathFileName = CacheKey.GetPath(".mat.bin");
 
 	// 3. 캐시 데이터 로드 시도 및 실패 시 재생성 로직
 	FStaticMesh* NewFStaticMesh = new FStaticMesh();
-	TArray<FMaterialInfo> MaterialInfos;
 	bool bLoadedSuccessfully = false;
 
-	// 캐시가 오래되었는지 먼저 확인
-	bool bShouldRegenerate = ShouldRegenerateCache(NormalizedPathStr, BinPathFileName, MatBinPathFileName);
-
-	if (!bShouldRegenerate)
+	if (CacheKey.bHit)
 	{
 		UE_LOG("Attempting to load '%s' from cache.", NormalizedPathStr.c_str());
 		try
@@ -342,6 +680,8 @@ FStaticMesh* FObjManager::LoadObjStaticMeshAsset(const FString& PathFileName)
 			Serialization::ReadArray<FMaterialInfo>(MatReader, MaterialInfos);
 			MatReader.Close();
 
+			// 내용이 같은 다른 경로의 에셋이 만든 캐시일 수 있으므로 경로는 이쪽 것으로
+			NewFStaticMesh->PathFileName = NormalizedPathStr;
 			NewFStaticMesh->CacheFilePath = BinPathFileName;
 
 			// 모든 로드가 성공적으로 완료됨
@@ -356,17 +696,16 @@ FStaticMesh* FObjManager::LoadObjStaticMeshAsset(const FString& PathFileName)
 			// 실패 시 생성 중이던 객체 메모리 정리
 			delete NewFStaticMesh;
 			NewFStaticMesh = nullptr; // 포인터를 nullptr로 설정하여 이중 삭제 방지
+			MaterialInfos.Empty();
 
 			// 손상된 캐시 파일 삭제
-			fs::remove(BinPathFileName);
-			fs::remove(MatBinPathFileName);
+			DDC.MarkCorrupt(EDerivedDataKind::ObjMesh, CacheKey, { ".bin", ".mat.bin" });
 
 			bLoadedSuccessfully = false;
 		}
 	}
 #else
 	FStaticMesh* NewFStaticMesh = new FStaticMesh();
-	TArray<FMaterialInfo> MaterialInfos;
 	bool bLoadedSuccessfully = false;
 #endif // USE_OBJ_CACHE
 
@@ -378,8 +717,7 @@ FStaticMesh* FObjManager::LoadObjStaticMeshAsset(const FString& PathFileName)
 				UE_LOG("No materials found for '%s'. Assigning default 'uberlit' material.", NormalizedPathStr.c_str());
 
 				FMaterialInfo DefaultMaterialInfo;
-				UMaterial* DefaultMaterial = UResourceManager::GetInstance().GetDefaultMaterial();
-				DefaultMaterialInfo.MaterialName = DefaultMaterial->GetMaterialInfo().MaterialName;
+				DefaultMaterialInfo.MaterialName = DefaultMaterialName;
 				Materials.Add(DefaultMaterialInfo);
 
 				TArray<FGroupInfo>& GroupInfos = Mesh->GroupInfos;
@@ -410,46 +748,59 @@ FStaticMesh* FObjManager::LoadObjStaticMeshAsset(const FString& PathFileName)
 
 		FObjImporter::ConvertToStaticMesh(RawObjInfo, MaterialInfos, NewFStaticMesh);
 
+		// 정점 캐시/오버드로/정점 페치 순서 최적화 (캐시에 최적화된 결과를 저장)
+		const FMeshOptimizeStats OptimizeStats = FMeshOptimizer::OptimizeMesh(NewFStaticMesh->Vertices, NewFStaticMesh->Indices, NewFStaticMesh->GroupInfos, &FNormalVertex::pos);
+		FMeshOptimizer::LogStats(NormalizedPathStr, OptimizeStats);
+
+		// 이차 오차 단순화로 LOD1..N 생성 (LOD0 정점 버퍼를 공유하는 인덱스만 추가로 저장)
+		FMeshSimplifier::BuildStaticMeshLODs(*NewFStaticMesh);
+
+		// 압축 정점 사용 여부 (GPU 업로드 시 FPackedNormalVertex로 변환)
+		NewFStaticMesh->bCompactVertices = FVertexQuantizer::IsEnabled() && FVertexQuantizer::CanQuantize(NewFStaticMesh->Vertices);
+
 		// 캐시 저장 *직전에* 기본 머티리얼 로직을 호출합니다.
 		EnsureDefaultMaterial(NewFStaticMesh, MaterialInfos);
 
 #ifdef USE_OBJ_CACHE
-		// 새로운 캐시 파일(.bin) 저장 (이제 올바른 데이터가 저장됨)
-		FWindowsBinWriter Writer(BinPathFileName);
-		Writer << *NewFStaticMesh;
-		Writer.Close();
+		// 새로운 캐시 파일(.bin) 저장 (이제 올바른 데이터가 저장됨). 임시 파일에 쓰고 다 쓴 뒤 확정
+		if (CacheKey.IsValid())
+		{
+			FWindowsBinWriter Writer(CacheKey.GetWritePath(".bin"));
+			Writer << *NewFStaticMesh;
+			Writer.Close();
 
-		FWindowsBinWriter MatWriter(MatBinPathFileName);
-		Serialization::WriteArray<FMaterialInfo>(MatWriter, MaterialInfos);
-		MatWriter.Close();
+			FWindowsBinWriter MatWriter(CacheKey.GetWritePath(".mat.bin"));
+			Serialization::WriteArray<FMaterialInfo>(MatWriter, MaterialInfos);
+			MatWriter.Close();
 
-		UE_LOG("Cache regeneration complete for '%s'.", NormalizedPathStr.c_str());
+			if (DDC.Commit(CacheKey, { ".bin", ".mat.bin" }))
+			{
+				NewFStaticMesh->CacheFilePath = BinPathFileName;
+				UE_LOG("Cache regeneration complete for '%s'.", NormalizedPathStr.c_str());
+			}
+		}
 #endif // USE_OBJ_CACHE
 	}
 	else
 	{
 		// 캐시 로드에 성공한 경우(bLoadedSuccessfully == true)
-		// 구버전 캐시(기본 머티리얼이 없는)일 수 있으므로, 동일한 검사를 수행합니다.
-		if (EnsureDefaultMaterial(NewFStaticMesh, MaterialInfos))
+		// 기본 머티리얼 이름이 키에 들어가므로 캐시에는 이미 반영돼 있음. 캐시는 다른 에셋과 공유되므로 고쳐 쓰지 않는다
+		EnsureDefaultMaterial(NewFStaticMesh, MaterialInfos);
+	}
+
+	return NewFStaticMesh;
+}
+
+FStaticMesh* FObjManager::RegisterObjStaticMeshData(const FString& NormalizedPathStr, FStaticMesh* NewFStaticMesh, TArray<FMaterialInfo>& MaterialInfos)
+{
+	// 이미 등록된 경로면 (중복 로드) 새로 만든 데이터는 버림
+	if (FStaticMesh** It = ObjStaticMeshMap.Find(NormalizedPathStr))
+	{
+		if (*It != NewFStaticMesh)
 		{
-#ifdef USE_OBJ_CACHE
-			// 변경된 경우, 캐시를 갱신합니다.
-			UE_LOG("Updating outdated cache for '%s' with default material.", NormalizedPathStr.c_str());
-			try
-			{
-				FWindowsBinWriter Writer(BinPathFileName);
-				Writer << *NewFStaticMesh;
-				Writer.Close();
-				FWindowsBinWriter MatWriter(MatBinPathFileName);
-				Serialization::WriteArray<FMaterialInfo>(MatWriter, MaterialInfos);
-				MatWriter.Close();
-			}
-			catch (const std::exception& e)
-			{
-				UE_LOG("Failed to update cache for default material: %s", e.what());
-			}
-#endif // USE_OBJ_CACHE
+			delete NewFStaticMesh;
 		}
+		return *It;
 	}
 
 	// 4. 머티리얼 및 텍스처 경로 처리 (공통 로직)
@@ -539,6 +890,20 @@ void FObjManager::RegisterStaticMeshAsset(const FString& PathFileName, FStaticMe
 	ObjStaticMeshMap.Add(NormalizedPathStr, InStaticMesh);
 }
 
+void FObjManager::ReleaseStaticMeshAsset(const FString& PathFileName, FStaticMesh* InStaticMesh)
+{
+	FString NormalizedPathStr = NormalizePath(PathFileName);
+
+	FStaticMesh** Existing = ObjStaticMeshMap.Find(NormalizedPathStr);
+	if (!Existing || *Existing != InStaticMesh)
+	{
+		return;
+	}
+
+	delete *Existing;
+	ObjStaticMeshMap.Remove(NormalizedPathStr);
+}
+
 // 여기서 BVH 정보 담아주기 작업을 해야 함 
 UStaticMesh* FObjManager::LoadObjStaticMesh(const FString& PathFileName)
 {
@@ -552,6 +917,8 @@ UStaticMesh* FObjManager::LoadObjStaticMesh(const FString& PathFileName)
 
 		if (StaticMesh->GetFilePath() == NormalizedPathStr)
 		{
+			// 축출된 셸이면 다시 로드
+			UResourceManager::GetInstance().TouchResource(StaticMesh);
 			return StaticMesh;
 		}
 	}
@@ -569,23 +936,14 @@ bool FObjImporter::LoadObjModel(const FString& InFileName, FObjInfo* const OutOb
 	uint32 subsetCount = 0;
 	FString MtlFileName;
 
-	bool bHasTexcoord = false;
-	bool bHasNormal = false;
-	FString MaterialNameTemp;
-
-	FString Face;
-	uint32 VIndex = 0;
-	uint32 MeshTriangles = 0;
-
 	size_t pos = InFileName.find_last_of("/\\");
 	FString objDir = (pos == FString::npos) ? "" : InFileName.substr(0, pos + 1);
 
 	// [안정성] .obj 파일이 존재하지 않으면 로드 실패를 반환합니다.
 	// 이는 필수 데이터이므로 더 이상 진행할 수 없습니다.
 	// 한글 경로 지원: UTF-8 → UTF-16 변환 후 파일 열기
-	FWideString WPath = UTF8ToWide(InFileName);
-	std::ifstream FileIn(WPath);
-	if (!FileIn)
+	FWindowsMappedFile ObjFile(UTF8ToWide(InFileName));
+	if (!ObjFile.IsOpen())
 	{
 		UE_LOG("Error: The file '%s' does not exist!", InFileName.c_str());
 		return false;
@@ -593,135 +951,83 @@ bool FObjImporter::LoadObjModel(const FString& InFileName, FObjInfo* const OutOb
 
 	OutObjInfo->ObjFileName = FString(InFileName.begin(), InFileName.end());
 
-	FString line;
-	while (std::getline(FileIn, line))
+	// 줄 경계에서 청크로 나눠 병렬 파싱
+	const char* FileData = ObjFile.GetData();
+	const char* FileEnd = FileData + ObjFile.GetSize();
+	TArray<const char*> ChunkStarts;
+	for (const char* ChunkStart = FileData; ChunkStart < FileEnd; )
 	{
-		if (line.empty()) continue;
-
-		line.erase(0, line.find_first_not_of(" \t\n\r"));
-
-		if (line[0] == '#')
-			continue;
+		ChunkStarts.Add(ChunkStart);
+		const char* ChunkEnd = ChunkStart + std::min(ObjParseChunkSize, static_cast<size_t>(FileEnd - ChunkStart));
+		const char* NewLine = (ChunkEnd < FileEnd) ? static_cast<const char*>(std::memchr(ChunkEnd, '\n', static_cast<size_t>(FileEnd - ChunkEnd))) : nullptr;
+		ChunkStart = NewLine ? NewLine + 1 : FileEnd;
+	}
+	ChunkStarts.Add(FileEnd);
 
-		if (line.rfind("v ", 0) == 0) // 정점 좌표 (v x y z)
-		{
-			std::stringstream wss(line.substr(2));
-			float vx, vy, vz;
-			wss >> vx >> vy >> vz;
-			if (bIsRightHanded)
-			{
-				OutObjInfo->Positions.push_back(FVector(vx, -vy, vz));
-			}
-			else
-			{
-				OutObjInfo->Positions.push_back(FVector(vx, vy, vz));
-			}
-		}
-		else if (line.rfind("vt ", 0) == 0) // 텍스처 좌표 (vt u v)
-		{
-			std::stringstream wss(line.substr(3));
-			float u, v;
-			wss >> u >> v;
-			// obj의 vt는 좌하단이 (0,0) -> DirectX UV는 좌상단이 (0,0) (상하 반전으로 컨버팅)
-			v = 1.0f - v;
-			OutObjInfo->TexCoords.push_back(FVector2D(u, v));
-			bHasTexcoord = true;
-		}
-		else if (line.rfind("vn ", 0) == 0) // 법선 (vn x y z)
+	const int32 NumChunks = ChunkStarts.Num() - 1;
+	TArray<FObjParseChunk> Chunks(std::max(0, NumChunks));
+	FTaskScheduler::GetInstance().ParallelFor(NumChunks, 1, [&](int32 Begin, int32 End)
 		{
-			std::stringstream wss(line.substr(3));
-			float nx, ny, nz;
-			wss >> nx >> ny >> nz;
-			if (bIsRightHanded)
+			for (int32 i = Begin; i < End; ++i)
 			{
-				OutObjInfo->Normals.push_back(FVector(nx, -ny, nz));
+				ParseObjChunk(ChunkStarts[i], ChunkStarts[i + 1], bIsRightHanded, Chunks[i]);
 			}
-			else
-			{
-				OutObjInfo->Normals.push_back(FVector(nx, ny, nz));
-			}
-			bHasNormal = true;
-		}
-		else if (line.rfind("g ", 0) == 0) // 그룹 (g groupName)
-		{
-			// 현재 'usemtl'을 기준으로 그룹을 나누므로 'g' 태그는 무시합니다.
-		}
-		else if (line.rfind("f ", 0) == 0) // 면 (f v1/vt1/vn1 v2/vt2/vn2 ...)
-		{
-			Face = line.substr(2);
-			if (Face.length() <= 0)
-			{
-				continue;
-			}
-
-			// Parse face line and trim at '#' or newline
-			std::stringstream wss(Face);
-			FString VertexDef;
-
-			TArray<FFaceVertex> LineFaceVertices;
-			while (wss >> VertexDef)
-			{
-				// '#'을 만나면 주석 처리 (이후 데이터 무시)
-				if (VertexDef[0] == '#')
-				{
-					break;
-				}
-
-				FFaceVertex FaceVertex = ParseVertexDef(VertexDef);
-				LineFaceVertices.push_back(FaceVertex);
-			}
-
-			// 4각형 이상의 폴리곤도 처리하기 위해서 for문으로 처리
-			for (uint32 i = 1; i < LineFaceVertices.size() - 1; ++i)
-			{
-				if (bIsRightHanded)
-				{
-					OutObjInfo->PositionIndices.push_back(LineFaceVertices[0].PositionIndex);
-					OutObjInfo->TexCoordIndices.push_back(LineFaceVertices[0].TexCoordIndex);
-					OutObjInfo->NormalIndices.push_back(LineFaceVertices[0].NormalIndex);
+		});
 
-					OutObjInfo->PositionIndices.push_back(LineFaceVertices[i + 1].PositionIndex);
-					OutObjInfo->TexCoordIndices.push_back(LineFaceVertices[i + 1].TexCoordIndex);
-					OutObjInfo->NormalIndices.push_back(LineFaceVertices[i + 1].NormalIndex);
-
-					OutObjInfo->PositionIndices.push_back(LineFaceVertices[i].PositionIndex);
-					OutObjInfo->TexCoordIndices.push_back(LineFaceVertices[i].TexCoordIndex);
-					OutObjInfo->NormalIndices.push_back(LineFaceVertices[i].NormalIndex);
-				}
-				else
-				{
-					OutObjInfo->PositionIndices.push_back(LineFaceVertices[0].PositionIndex);
-					OutObjInfo->TexCoordIndices.push_back(LineFaceVertices[0].TexCoordIndex);
-					OutObjInfo->NormalIndices.push_back(LineFaceVertices[0].NormalIndex);
-
-					OutObjInfo->PositionIndices.push_back(LineFaceVertices[i].PositionIndex);
-					OutObjInfo->TexCoordIndices.push_back(LineFaceVertices[i].TexCoordIndex);
-					OutObjInfo->NormalIndices.push_back(LineFaceVertices[i].NormalIndex);
-
-					OutObjInfo->PositionIndices.push_back(LineFaceVertices[i + 1].PositionIndex);
-					OutObjInfo->TexCoordIndices.push_back(LineFaceVertices[i + 1].TexCoordIndex);
-					OutObjInfo->NormalIndices.push_back(LineFaceVertices[i + 1].NormalIndex);
-				}
-				VIndex += 3;
-				++MeshTriangles;
-			}
-		}
-		else if (line.rfind("mtllib ", 0) == 0)
+	// 병합 (파일 순서 유지)
+	size_t TotalPositions = 0, TotalTexCoords = 0, TotalNormals = 0, TotalIndices = 0;
+	for (const FObjParseChunk& Chunk : Chunks)
+	{
+		TotalPositions += Chunk.Positions.size();
+		TotalTexCoords += Chunk.TexCoords.size();
+		TotalNormals += Chunk.Normals.size();
+		TotalIndices += Chunk.PositionIndices.size();
+	}
+	OutObjInfo->Positions.reserve(TotalPositions);
+	OutObjInfo->TexCoords.reserve(TotalTexCoords + 1);
+	OutObjInfo->Normals.reserve(TotalNormals + 1);
+	OutObjInfo->PositionIndices.reserve(TotalIndices);
+	OutObjInfo->TexCoordIndices.reserve(TotalIndices);
+	OutObjInfo->NormalIndices.reserve(TotalIndices);
+
+	uint32 UnknownLineCount = 0;
+	FString FirstUnknownLine;
+	for (const FObjParseChunk& Chunk : Chunks)
+	{
+		const uint32 IndexBase = static_cast<uint32>(OutObjInfo->PositionIndices.size());
+		AppendObjIndices(OutObjInfo->PositionIndices, Chunk.PositionIndices, Chunk.RelativePositionFixups, static_cast<uint32>(OutObjInfo->Positions.size()));
+		AppendObjIndices(OutObjInfo->TexCoordIndices, Chunk.TexCoordIndices, Chunk.RelativeTexCoordFixups, static_cast<uint32>(OutObjInfo->TexCoords.size()));
+		AppendObjIndices(OutObjInfo->NormalIndices, Chunk.NormalIndices, Chunk.RelativeNormalFixups, static_cast<uint32>(OutObjInfo->Normals.size()));
+		OutObjInfo->Positions.insert(OutObjInfo->Positions.end(), Chunk.Positions.begin(), Chunk.Positions.end());
+		OutObjInfo->TexCoords.insert(OutObjInfo->TexCoords.end(), Chunk.TexCoords.begin(), Chunk.TexCoords.end());
+		OutObjInfo->Normals.insert(OutObjInfo->Normals.end(), Chunk.Normals.begin(), Chunk.Normals.end());
+
+		for (const TPair<uint32, FString>& UseMaterial : Chunk.UseMaterials)
 		{
-			MtlFileName = objDir + line.substr(7);
+			OutObjInfo->MaterialNames.push_back(UseMaterial.second);
+			OutObjInfo->GroupIndexStartArray.push_back(IndexBase + UseMaterial.first);
+			subsetCount++;
 		}
-		else if (line.rfind("usemtl ", 0) == 0)
+		if (Chunk.bHasMtlLib)
 		{
-			MaterialNameTemp = line.substr(7);
-			OutObjInfo->MaterialNames.push_back(MaterialNameTemp);
-			OutObjInfo->GroupIndexStartArray.push_back(VIndex);
-			subsetCount++;
+			MtlFileName = objDir + Chunk.MtlLib;
 		}
-		else
+		if (Chunk.UnknownLineCount > 0 && UnknownLineCount == 0)
 		{
-			UE_LOG("While parsing the filename %s, the following unknown symbol was encountered: \'%s\'", InFileName.c_str(), line.c_str());
+			FirstUnknownLine = Chunk.FirstUnknownLine;
 		}
+		UnknownLineCount += Chunk.UnknownLineCount;
 	}
+	Chunks.Empty();
+
+	if (UnknownLineCount > 0)
+	{
+		UE_LOG("While parsing the filename %s, %u lines with unknown symbols were skipped (first: \'%s\')", InFileName.c_str(), UnknownLineCount, FirstUnknownLine.c_str());
+	}
+
+	const bool bHasTexcoord = !OutObjInfo->TexCoords.empty();
+	const bool bHasNormal = !OutObjInfo->Normals.empty();
+	const uint32 VIndex = static_cast<uint32>(OutObjInfo->PositionIndices.size());
 
 	if (subsetCount == 0)
 	{
@@ -745,7 +1051,7 @@ bool FObjImporter::LoadObjModel(const FString& InFileName, FObjInfo* const OutOb
 		OutObjInfo->TexCoords.push_back(FVector2D(0.0f, 0.0f));
 	}
 
-	FileIn.close();
+	ObjFile.Close();
 
 	// Material 파싱 시작
 	UE_LOG("[ObjImporter::LoadObjModel] MTL file path: %s", MtlFileName.c_str());
@@ -759,7 +1065,7 @@ bool FObjImporter::LoadObjModel(const FString& InFileName, FObjInfo* const OutOb
 
 	// 한글 경로 지원: UTF-8 → UTF-16 변환 후 파일 열기
 	FWideString WMtlPath = UTF8ToWide(MtlFileName);
-	FileIn.open(WMtlPath);
+	std::ifstream FileIn(WMtlPath);
 
 	// .mtl 파일이 존재하지 않더라도 로딩을 중단하지 않습니다.
 	// 경고를 로깅하고, 머티리얼이 없는 모델로 처리를 계속합니다.
@@ -777,6 +1083,7 @@ bool FObjImporter::LoadObjModel(const FString& InFileName, FObjInfo* const OutOb
 	TArray<FString> TempOptions;
 	FString TempTexturePath;
 
+	FString line;
 	while (std::getline(FileIn, line))
 	{
 		if (line.empty()) continue;
@@ -874,6 +1181,15 @@ bool FObjImporter::LoadObjModel(const FString& InFileName, FObjInfo* const OutOb
 void FObjImporter::ConvertToStaticMesh(const FObjInfo& InObjInfo, const TArray<FMaterialInfo>& InMaterialInfos, FStaticMesh* const OutStaticMesh)
 {
 	OutStaticMesh->PathFileName = InObjInfo.ObjFileName;
+
+	// 용접 테이블(코너 수 * 2 이상의 2의 거듭제곱)을 int32 인덱스 TArray와 uint32 마스크로 다룰 수 있는 크기까지만 지원
+	constexpr uint64 MaxWeldCorners = 1ull << 29;
+	if (static_cast<uint64>(InObjInfo.PositionIndices.size()) > MaxWeldCorners)
+	{
+		UE_LOG("ConvertToStaticMesh: '%s' has too many corners (%llu, max %llu)", InObjInfo.ObjFileName.c_str(),
+			static_cast<unsigned long long>(InObjInfo.PositionIndices.size()), static_cast<unsigned long long>(MaxWeldCorners));
+		return;
+	}
 	uint32 NumDuplicatedVertex = static_cast<uint32>(InObjInfo.PositionIndices.size());
 	TArray<FVector> TangentForVertex;
 	TArray<FVector> BiTangentForVertex;
@@ -912,15 +1228,40 @@ void FObjImporter::ConvertToStaticMesh(const FObjInfo& InObjInfo, const TArray<F
 		BiTangentForVertex[Index + 2] += BiTangent;
 	}
 
-	std::unordered_map<VertexKey, uint32, VertexKeyHash> VertexMap;
+	// 정점 용접: (위치, UV, 법선) 키 → 정점 번호. 선형 탐사 오픈 어드레싱 (2의 거듭제곱 크기, 부하율 50% 이하)
+	uint64 TableSize = 16;
+	while (TableSize < static_cast<uint64>(NumDuplicatedVertex) * 2)
+	{
+		TableSize <<= 1;
+	}
+	const uint32 TableMask = static_cast<uint32>(TableSize - 1);
+	constexpr uint32 EmptySlot = 0xFFFFFFFFu;
+	TArray<uint32> VertexTable(static_cast<size_t>(TableSize), EmptySlot);  // 슬롯 = 해당 키가 처음 나온 코너 번호
+	TArray<uint32> CornerToVertex(NumDuplicatedVertex);
+
+	OutStaticMesh->Vertices.reserve(OutStaticMesh->Vertices.size() + NumDuplicatedVertex / 2);
+	OutStaticMesh->Indices.reserve(OutStaticMesh->Indices.size() + NumDuplicatedVertex);
 
 	for (uint32 CurIndex = 0; CurIndex < NumDuplicatedVertex; ++CurIndex)
 	{
 		VertexKey Key{ InObjInfo.PositionIndices[CurIndex], InObjInfo.TexCoordIndices[CurIndex], InObjInfo.NormalIndices[CurIndex] };
-		auto It = VertexMap.find(Key);
-		if (It != VertexMap.end())
+
+		uint32 Slot = static_cast<uint32>(VertexKeyHash()(Key)) & TableMask;
+		uint32 FoundCorner = EmptySlot;
+		while (VertexTable[Slot] != EmptySlot)
+		{
+			const uint32 Corner = VertexTable[Slot];
+			if (InObjInfo.PositionIndices[Corner] == Key.PosIndex && InObjInfo.TexCoordIndices[Corner] == Key.TexIndex && InObjInfo.NormalIndices[Corner] == Key.NormalIndex)
+			{
+				FoundCorner = Corner;
+				break;
+			}
+			Slot = (Slot + 1) & TableMask;
+		}
+
+		if (FoundCorner != EmptySlot)
 		{
-			OutStaticMesh->Indices.push_back(It->second);
+			OutStaticMesh->Indices.push_back(CornerToVertex[FoundCorner]);
 		}
 		else
 		{
@@ -943,7 +1284,8 @@ void FObjImporter::ConvertToStaticMesh(const FObjInfo& InObjInfo, const TArray<F
 			OutStaticMesh->Vertices.push_back(NormalVertex);
 			uint32 NewIndex = static_cast<uint32>(OutStaticMesh->Vertices.size() - 1);
 			OutStaticMesh->Indices.push_back(NewIndex);
-			VertexMap[Key] = NewIndex;
+			VertexTable[Slot] = CurIndex;
+			CornerToVertex[CurIndex] = NewIndex;
 		}
 	}
 
@@ -980,17 +1322,3 @@ void FObjImporter::ConvertToStaticMesh(const FObjInfo& InObjInfo, const TArray<F
 		// else: InitialMaterialName은 비어있게 됨 (정상)
 	}
 }
-
-FObjImporter::FFaceVertex FObjImporter::ParseVertexDef(const FString& InVertexDef)
-{
-	FFaceVertex Result{ 0, 0, 0 };
-	std::stringstream ss(InVertexDef);
-	FString part;
-	uint32 temp_val;
-
-	if (std::getline(ss, part, '/')) { if (!part.empty()) { std::stringstream conv(part); if (conv >> temp_val) Result.PositionIndex = temp_val - 1; } }
-	if (std::getline(ss, part, '/')) { if (!part.empty()) { std::stringstream conv(part); if (conv >> temp_val) Result.TexCoordIndex = temp_val - 1; } }
-	if (std::getline(ss, part, '/')) { if (!part.empty()) { std::stringstream conv(part); if (conv >> temp_val) Result.NormalIndex = temp_val - 1; } }
-
-	return Result;
-}
@@ -42,17 +42,19 @@ public:
 
 	struct VertexKeyHash
 	{
-		size_t operator()(const VertexKey& Key) const { return std::hash<uint32>()(Key.PosIndex) ^ (std::hash<uint32>()(Key.TexIndex) << 1) ^ (std::hash<uint32>()(Key.NormalIndex) << 2); }
+		// 세 인덱스를 64비트로 섞는다 (xor 조합은 인접 인덱스끼리 충돌이 잦음)
+		size_t operator()(const VertexKey& Key) const
+		{
+			uint64 Hash = (static_cast<uint64>(Key.PosIndex) << 32 | Key.TexIndex) * 0x9E3779B97F4A7C15ull;
+			Hash ^= (Hash >> 29) + static_cast<uint64>(Key.NormalIndex) * 0xC2B2AE3D27D4EB4Full;
+			Hash *= 0xBF58476D1CE4E5B9ull;
+			return static_cast<size_t>(Hash ^ (Hash >> 32));
+		}
 	};
 
 	static bool LoadObjModel(const FString& InFileName, FObjInfo* const OutObjInfo, TArray<FMaterialInfo>& OutMaterialInfos, bool bIsRightHanded = true);
 
 	static void ConvertToStaticMesh(const FObjInfo& InObjInfo, const TArray<FMaterialInfo>& InMaterialInfos, FStaticMesh* const OutStaticMesh);
-
-private:
-	struct FFaceVertex { uint32 PositionIndex, TexCoordIndex, NormalIndex; };
-
-	static FFaceVertex ParseVertexDef(const FString& InVertexDef);
 };
 
 class UStaticMesh;
@@ -67,6 +69,15 @@ public:
 	static FStaticMesh* LoadObjStaticMeshAsset(const FString& PathFileName);
 	static UStaticMesh* LoadObjStaticMesh(const FString& PathFileName);
 
+	// LoadObjStaticMeshAsset을 CPU 단계와 등록 단계로 나눈 것 (병렬 프리로드용)
+	// BuildObjStaticMeshData: 바이너리 캐시 읽기 또는 OBJ 파싱 + 캐시 저장. UObject/리소스 매니저에 접근하지 않으므로 워커 스레드에서 호출 가능
+	static FStaticMesh* BuildObjStaticMeshData(const FString& NormalizedPathStr, const FString& DefaultMaterialName, TArray<FMaterialInfo>& OutMaterialInfos);
+	// RegisterObjStaticMeshData: 텍스처 경로 해석, UMaterial 생성, 메모리 캐시 등록 (게임 스레드 전용)
+	static FStaticMesh* RegisterObjStaticMeshData(const FString& NormalizedPathStr, FStaticMesh* InStaticMesh, TArray<FMaterialInfo>& InMaterialInfos);
+
 	// FBX 등 외부에서 생성된 FStaticMesh를 캐시에 등록
 	static void RegisterStaticMeshAsset(const FString& PathFileName, FStaticMesh* InStaticMesh);
+
+	// 캐시에서 제거하고 해제 (UStaticMesh 축출). 등록된 에셋이 InStaticMesh가 아니면 아무것도 하지 않음
+	static void ReleaseStaticMeshAsset(const FString& PathFileName, FStaticMesh* InStaticMesh);
 };
@@ -0,0 +1,285 @@
+﻿#include "pch.h"
+#include "ResidencyStressTest.h"
+#include "PlatformTime.h"
+#include "StaticMesh.h"
+#include "SkeletalMesh.h"
+#include <filesystem>
+
+namespace
+{
+	constexpr int32 FramesPerLevel = 3;   // 레벨 사이에 렌더 프레임을 끼워 축출된 셸로 그리는 경우도 확인
+	constexpr double BytesToMB = 1.0 / (1024.0 * 1024.0);
+
+	struct FResidencyStressTestState
+	{
+		bool bRunning = false;
+		uint64 StartCycles = 0;
+
+		TArray<FString> ScenePaths;
+		int32 NumCycles = 0;
+		int32 NextLoad = 0;               // ScenePaths.Num() * NumCycles 중 다음 로드 순번
+		int32 FramesUntilNextLoad = 0;
+
+		// 테스트 동안 바꾼 예산 (끝나면 복원)
+		bool bOverrideBudget = false;
+		uint32 SavedCPUBudgetMB = 0;
+		uint32 SavedGPUBudgetMB = 0;
+
+		// 시작 시점 누적값 (차이로 테스트 동안의 축출/재로드 계산)
+		uint32 StartEvictions = 0;
+		uint32 StartReloads = 0;
+
+		int32 NumLoadFailures = 0;
+		int32 NumIntegrityFailures = 0;   // 스윕 후 참조되는데 상주하지 않은 리소스가 있었던 로드
+		uint64 PeakCPUBytes = 0;
+		uint64 PeakGPUBytes = 0;
+		double TotalLoadMS = 0.0;
+		float MaxSweepMS = 0.0f;
+	};
+
+	FResidencyStressTestState GResidencyStressTest;
+
+	double ElapsedMS(uint64 StartCycles)
+	{
+		return FPlatformTime::ToMilliseconds(FPlatformTime::Cycles64() - StartCycles);
+	}
+
+	TArray<FString> CollectScenePaths()
+	{
+		TArray<FString> ScenePaths;
+		const std::filesystem::path SceneDir = std::filesystem::path(GDataDir) / "Scenes";
+		std::error_code Error;
+		for (const auto& Entry : std::filesystem::directory_iterator(SceneDir, Error))
+		{
+			if (Entry.is_regular_file() && Entry.path().extension() == ".scene")
+			{
+				ScenePaths.Add(NormalizePath(Entry.path().string()));
+			}
+		}
+		std::sort(ScenePaths.begin(), ScenePaths.end());
+		return ScenePaths;
+	}
+
+	// 상주 정책별 메시 CPU 메모리 (레벨에서 참조하는 메시만)
+	struct FMeshCPUResidencySample
+	{
+		int32 NumMeshes = 0;
+		uint64 FullBytes = 0;
+		uint64 CollisionOnlyBytes = 0;
+		double RereadMS = 0.0;     // CollisionOnly → Full 전환 시 바이너리 캐시 재읽기
+	};
+
+	template<typename TMesh>
+	FMeshCPUResidencySample MeasureReferencedMeshes()
+	{
+		FMeshCPUResidencySample Sample;
+		for (TMesh* Mesh : RESOURCE.GetAll<TMesh>())
+		{
+			if (!Mesh || !Mesh->IsResident() || Mesh->GetComponentRefCount() == 0)
+			{
+				continue;
+			}
+
+			const EMeshCPUResidency SavedResidency = Mesh->GetCPUResidency();
+			Mesh->SetCPUResidency(EMeshCPUResidency::CollisionOnly);
+			Sample.CollisionOnlyBytes += Mesh->GetCPUMemoryBytes();
+
+			const uint64 RereadStart = FPlatformTime::Cycles64();
+			Mesh->SetCPUResidency(EMeshCPUResidency::Full);
+			Sample.RereadMS += ElapsedMS(RereadStart);
+			Sample.FullBytes += Mesh->GetCPUMemoryBytes();
+
+			Mesh->SetCPUResidency(SavedResidency);
+			++Sample.NumMeshes;
+		}
+		return Sample;
+	}
+
+	void LogMeshCPUResidencySample(const char* InLabel, const FMeshCPUResidencySample& InSample)
+	{
+		UE_LOG("[ResidencyMeshCPU]   %s: %d meshes, Full %.2f MB -> CollisionOnly %.2f MB (saved %.1f%%), re-read %.1f ms",
+			InLabel, InSample.NumMeshes, InSample.FullBytes * BytesToMB, InSample.CollisionOnlyBytes * BytesToMB,
+			InSample.FullBytes > 0 ? 100.0 * (InSample.FullBytes - InSample.CollisionOnlyBytes) / InSample.FullBytes : 0.0,
+			InSample.RereadMS);
+	}
+
+	void LoadNextLevel()
+	{
+		FResidencyStressTestState& State = GResidencyStressTest;
+		const FString& ScenePath = State.ScenePaths[State.NextLoad % State.ScenePaths.Num()];
+		++State.NextLoad;
+
+		const uint64 LoadStart = FPlatformTime::Cycles64();
+		if (!GWorld->LoadLevelFromFile(UTF8ToWide(ScenePath)))
+		{
+			++State.NumLoadFailures;
+		}
+		State.TotalLoadMS += ElapsedMS(LoadStart);
+
+		// 이전 레벨의 컴포넌트는 모두 삭제됐으므로 즉시 다시 세고 예산 초과분 축출
+		RESOURCE.FlushResidency();
+
+		const FResidencyStats& Stats = RESOURCE.GetResidencyStats();
+		State.PeakCPUBytes = std::max(State.PeakCPUBytes, Stats.CPUBytes);
+		State.PeakGPUBytes = std::max(State.PeakGPUBytes, Stats.GPUBytes);
+		State.MaxSweepMS = std::max(State.MaxSweepMS, Stats.LastSweepMS);
+		if (Stats.NumReferencedNotResident > 0)
+		{
+			++State.NumIntegrityFailures;
+			UE_LOG("[ResidencyStress] %u referenced resources not resident after loading %s", Stats.NumReferencedNotResident, ScenePath.c_str());
+		}
+	}
+
+	void FinishTest()
+	{
+		FResidencyStressTestState& State = GResidencyStressTest;
+		FResourceResidency& Residency = RESOURCE.GetResidency();
+		const FResidencyStats& Stats = RESOURCE.GetResidencyStats();
+
+		UE_LOG("[ResidencyStress] %d level loads (%d scenes x %d cycles, %d failed), wall %.1f ms, level load total %.1f ms",
+			State.NextLoad, State.ScenePaths.Num(), State.NumCycles, State.NumLoadFailures, ElapsedMS(State.StartCycles), State.TotalLoadMS);
+		UE_LOG("[ResidencyStress] budget CPU %.0f MB / GPU %.0f MB: peak CPU %.1f MB, GPU %.1f MB; final CPU %.1f MB, GPU %.1f MB",
+			Residency.GetCPUBudgetBytes() * BytesToMB, Residency.GetGPUBudgetBytes() * BytesToMB,
+			State.PeakCPUBytes * BytesToMB, State.PeakGPUBytes * BytesToMB, Stats.CPUBytes * BytesToMB, Stats.GPUBytes * BytesToMB);
+		UE_LOG("[ResidencyStress] evictions %u, reloads %u, max sweep %.3f ms, resident %u / %u",
+			Stats.TotalEvictions - State.StartEvictions, Stats.TotalReloads - State.StartReloads, State.MaxSweepMS,
+			Stats.NumResident, Stats.NumResources);
+		UE_LOG("[ResidencyStress] integrity: %s (%d loads with referenced resources not resident)",
+			State.NumIntegrityFailures == 0 ? "OK" : "FAILED", State.NumIntegrityFailures);
+
+		if (State.bOverrideBudget)
+		{
+			RESOURCE.SetResidencyBudgetMB(State.SavedCPUBudgetMB, State.SavedGPUBudgetMB);
+		}
+
+		State.ScenePaths.Empty();
+		State.bRunning = false;
+	}
+}
+
+void FResidencyStressTest::Start(int32 InCycles, uint32 InBudgetMB)
+{
+	FResidencyStressTestState& State = GResidencyStressTest;
+	if (State.bRunning)
+	{
+		UE_LOG("[ResidencyStress] Already running (%d / %d loads)", State.NextLoad, State.ScenePaths.Num() * State.NumCycles);
+		return;
+	}
+	if (!GWorld || GWorld->GetWorldType() != EWorldType::Editor)
+	{
+		UE_LOG("[ResidencyStress] Only available in the editor world (stop PIE first)");
+		return;
+	}
+
+	State = FResidencyStressTestState();
+
+	State.ScenePaths = CollectScenePaths();
+	if (State.ScenePaths.IsEmpty())
+	{
+		UE_LOG("[ResidencyStress] No .scene files under %s/Scenes", GDataDir.c_str());
+		return;
+	}
+
+	FResourceResidency& Residency = RESOURCE.GetResidency();
+	if (InBudgetMB > 0)
+	{
+		State.bOverrideBudget = true;
+		State.SavedCPUBudgetMB = static_cast<uint32>(Residency.GetCPUBudgetBytes() >> 20);
+		State.SavedGPUBudgetMB = static_cast<uint32>(Residency.GetGPUBudgetBytes() >> 20);
+		RESOURCE.SetResidencyBudgetMB(InBudgetMB, InBudgetMB);
+	}
+
+	State.bRunning = true;
+	State.StartCycles = FPlatformTime::Cycles64();
+	State.NumCycles = std::max(1, InCycles);
+	State.StartEvictions = Residency.GetStats().TotalEvictions;
+	State.StartReloads = Residency.GetStats().TotalReloads;
+
+	UE_LOG("[ResidencyStress] Cycling %d scenes x %d (budget CPU %.0f MB / GPU %.0f MB). The current level is replaced without saving.",
+		State.ScenePaths.Num(), State.NumCycles, Residency.GetCPUBudgetBytes() * BytesToMB, Residency.GetGPUBudgetBytes() * BytesToMB);
+}
+
+void FResidencyStressTest::Tick()
+{
+	FResidencyStressTestState& State = GResidencyStressTest;
+	if (!State.bRunning)
+	{
+		return;
+	}
+
+	if (State.FramesUntilNextLoad > 0)
+	{
+		--State.FramesUntilNextLoad;
+		return;
+	}
+
+	if (State.NextLoad >= State.ScenePaths.Num() * State.NumCycles)
+	{
+		FinishTest();
+		return;
+	}
+
+	LoadNextLevel();
+	State.FramesUntilNextLoad = FramesPerLevel;
+}
+
+void FResidencyStressTest::MeasureMeshCPUResidency()
+{
+	if (GResidencyStressTest.bRunning)
+	{
+		UE_LOG("[ResidencyMeshCPU] Residency stress test is running");
+		return;
+	}
+	if (!GWorld || GWorld->GetWorldType() != EWorldType::Editor)
+	{
+		UE_LOG("[ResidencyMeshCPU] Only available in the editor world (stop PIE first)");
+		return;
+	}
+
+	const TArray<FString> ScenePaths = CollectScenePaths();
+	if (ScenePaths.IsEmpty())
+	{
+		UE_LOG("[ResidencyMeshCPU] No .scene files under %s/Scenes", GDataDir.c_str());
+		return;
+	}
+
+	UE_LOG("[ResidencyMeshCPU] Measuring %d scenes (default policy: %s). The current level is replaced without saving.", ScenePaths.Num(),
+		UResourceBase::GetDefaultMeshCPUResidency() == EMeshCPUResidency::Full ? "Full" : "CollisionOnly");
+
+	FMeshCPUResidencySample StaticTotal;
+	FMeshCPUResidencySample SkeletalTotal;
+	for (const FString& ScenePath : ScenePaths)
+	{
+		if (!GWorld->LoadLevelFromFile(UTF8ToWide(ScenePath)))
+		{
+			UE_LOG("[ResidencyMeshCPU] %s: failed to load", ScenePath.c_str());
+			continue;
+		}
+		// 컴포넌트 참조 수를 이 레벨 기준으로 다시 셈
+		RESOURCE.FlushResidency();
+
+		const FMeshCPUResidencySample StaticSample = MeasureReferencedMeshes<UStaticMesh>();
+		const FMeshCPUResidencySample SkeletalSample = MeasureReferencedMeshes<USkeletalMesh>();
+		UE_LOG("[ResidencyMeshCPU] %s", ScenePath.c_str());
+		LogMeshCPUResidencySample("static", StaticSample);
+		LogMeshCPUResidencySample("skeletal", SkeletalSample);
+
+		StaticTotal.NumMeshes += StaticSample.NumMeshes;
+		StaticTotal.FullBytes += StaticSample.FullBytes;
+		StaticTotal.CollisionOnlyBytes += StaticSample.CollisionOnlyBytes;
+		StaticTotal.RereadMS += StaticSample.RereadMS;
+		SkeletalTotal.NumMeshes += SkeletalSample.NumMeshes;
+		SkeletalTotal.FullBytes += SkeletalSample.FullBytes;
+		SkeletalTotal.CollisionOnlyBytes += SkeletalSample.CollisionOnlyBytes;
+		SkeletalTotal.RereadMS += SkeletalSample.RereadMS;
+	}
+
+	UE_LOG("[ResidencyMeshCPU] total over %d scenes", ScenePaths.Num());
+	LogMeshCPUResidencySample("static", StaticTotal);
+	LogMeshCPUResidencySample("skeletal", SkeletalTotal);
+}
+
+bool FResidencyStressTest::IsRunning()
+{
+	return GResidencyStressTest.bRunning;
+}
@@ -0,0 +1,24 @@
+﻿#pragma once
+#include "UEContainer.h"
+
+/**
+ * 리소스 상주 스트레스 테스트 (콘솔: RESIDENCY STRESS [cycles] [budgetMB])
+ * Data/Scenes의 레벨을 cycles 바퀴 돌며 몇 프레임마다 에디터 월드에 로드하고, 로드 직후 상주 스윕을 강제해
+ * 메모리 최고치/최종값, 축출/재로드 수와 "참조 중인 리소스는 모두 상주" 여부를 로그로 출력한다.
+ * budgetMB를 주면 테스트 동안 CPU/GPU 예산을 그 값으로 낮춘다. 현재 레벨은 저장하지 않고 교체된다.
+ *
+ * RESIDENCY MESHCPU: 레벨마다 로드 후 참조 중인 메시의 CPU 메모리를 상주 정책(Full / CollisionOnly)별로 재고,
+ * 전체 데이터를 바이너리 캐시에서 다시 읽는 시간을 출력 (한 번에 끝나는 측정, 메시 정책은 원래대로 복원)
+ */
+class FResidencyStressTest
+{
+public:
+	static void Start(int32 InCycles, uint32 InBudgetMB);
+
+	static void MeasureMeshCPUResidency();
+
+	// 매 프레임 TickAsyncLoads 직후 호출
+	static void Tick();
+
+	static bool IsRunning();
+};
@@ -0,0 +1,539 @@
+﻿#include "pch.h"
+#include "AsyncResourceLoader.h"
+#include "ResourceManager.h"
+#include "ObjManager.h"
+#include "FBXLoader.h"
+#include "PlatformTime.h"
+#include "TaskScheduler.h"
+#include <filesystem>
+
+// 같은 경로(+타입)를 기다리는 요청들이 공유하는 로드 작업
+struct FAsyncLoadJob
+{
+	FString Key;
+	FString Path;           // 정규화 경로
+	EResourceType Type = EResourceType::None;
+	EAsyncLoadPriority Priority = EAsyncLoadPriority::Normal;
+	uint64 Sequence = 0;
+	bool bWorkerPhase = false;   // CPU 단계를 워커에서 수행하는지 (아니면 마무리 단계에서 동기 로드)
+	bool bDispatched = false;
+
+	TArray<std::shared_ptr<FAsyncLoadRequest>> Requests;
+
+	// 모든 요청이 취소됨. 워커는 시작 전이면 건너뛰고, 결과는 게임 스레드에서 버림
+	std::atomic<bool> bAbandoned{ false };
+
+	// 워커 입력/출력 (워커가 완료 큐에 넣은 뒤에만 게임 스레드가 읽음)
+	FString DefaultMaterialName;
+	FTextureSourceData TextureSource;
+	FStaticMesh* StaticMesh = nullptr;
+	FSkeletalMeshData* SkeletalMeshData = nullptr;   // FBX 캐시 적중 시에만 (미스면 마무리 단계에서 FBX 임포트)
+	TArray<FMaterialInfo> MaterialInfos;
+};
+
+namespace
+{
+	// 워커 스레드의 WIC 사용(DDS 변환)을 위한 COM 초기화 범위
+	struct FScopedCOMInitialize
+	{
+		FScopedCOMInitialize() : Result(CoInitializeEx(nullptr, COINIT_MULTITHREADED)) {}
+		~FScopedCOMInitialize()
+		{
+			if (SUCCEEDED(Result))
+			{
+				CoUninitialize();
+			}
+		}
+		HRESULT Result;
+	};
+
+	float ElapsedMS(uint64 StartCycles)
+	{
+		return static_cast<float>(FPlatformTime::ToMilliseconds(FPlatformTime::Cycles64() - StartCycles));
+	}
+
+	bool HasExtension(const FString& InPath, const char* InExtension)
+	{
+		FString Extension = std::filesystem::path(InPath).extension().string();
+		std::transform(Extension.begin(), Extension.end(), Extension.begin(), [](unsigned char c) { return static_cast<char>(std::tolower(c)); });
+		return Extension == InExtension;
+	}
+
+	// 우선순위가 높고 먼저 요청된 작업이 앞
+	bool IsHigherPriority(const FAsyncLoadJob& A, const FAsyncLoadJob& B)
+	{
+		if (A.Priority != B.Priority)
+		{
+			return A.Priority > B.Priority;
+		}
+		return A.Sequence < B.Sequence;
+	}
+
+	// 워커가 만든 CPU 데이터 중 소유권이 넘어가지 않은 것 해제
+	void DiscardJobOutput(FAsyncLoadJob& Job)
+	{
+		delete Job.StaticMesh;
+		Job.StaticMesh = nullptr;
+		delete Job.SkeletalMeshData;
+		Job.SkeletalMeshData = nullptr;
+		Job.MaterialInfos.Empty();
+		Job.TextureSource = FTextureSourceData();
+	}
+
+	// 로드는 됐지만 실제 데이터가 없는 리소스 (파일 없음, 디코딩 실패)
+	bool IsLoadedResourceValid(EResourceType InType, UResourceBase* InResource)
+	{
+		if (!InResource)
+		{
+			return false;
+		}
+		switch (InType)
+		{
+		case EResourceType::Texture:
+			return static_cast<UTexture*>(InResource)->GetShaderResourceView() != nullptr;
+		case EResourceType::StaticMesh:
+			return static_cast<UStaticMesh*>(InResource)->HasMeshData();
+		case EResourceType::SkeletalMesh:
+			return static_cast<USkeletalMesh*>(InResource)->GetSkeletalMeshData() != nullptr;
+		default:
+			return true;
+		}
+	}
+}
+
+void FAsyncLoadHandle::Cancel()
+{
+	if (Request)
+	{
+		UResourceManager::GetInstance().GetAsyncLoader().CancelRequest(Request);
+	}
+}
+
+FString FAsyncResourceLoader::MakeJobKey(EResourceType InType, const FString& InNormalizedPath)
+{
+	return std::to_string(static_cast<int32>(InType)) + ":" + InNormalizedPath;
+}
+
+FAsyncLoadHandle FAsyncResourceLoader::Request(EResourceType InType, const FString& InFilePath, FAsyncLoadCallback InCallback, EAsyncLoadPriority InPriority)
+{
+	assert(!FTaskScheduler::IsInWorkerThread());
+	const uint64 Start = FPlatformTime::Cycles64();
+
+	UResourceManager& RM = UResourceManager::GetInstance();
+
+	std::shared_ptr<FAsyncLoadRequest> NewRequest = std::make_shared<FAsyncLoadRequest>();
+	NewRequest->Path = NormalizePath(InFilePath);
+	NewRequest->Type = InType;
+	NewRequest->Callback = std::move(InCallback);
+	if (InType == EResourceType::Texture)
+	{
+		NewRequest->Placeholder = RM.GetDefaultTexture();
+	}
+	else if (InType == EResourceType::Material)
+	{
+		NewRequest->Placeholder = RM.GetDefaultMaterial();
+	}
+
+	const bool bSupportedType = InType == EResourceType::Texture || InType == EResourceType::StaticMesh
+		|| InType == EResourceType::SkeletalMesh || InType == EResourceType::Material || InType == EResourceType::Sound;
+	if (NewRequest->Path.empty() || !bSupportedType)
+	{
+		UE_LOG("[AsyncLoad] Unsupported request (type %d): '%s'", static_cast<int32>(InType), InFilePath.c_str());
+		NewRequest->State = EAsyncLoadState::Failed;
+		++Stats.FailedRequests;
+		FrameIssueTimeMS += ElapsedMS(Start);
+		return FAsyncLoadHandle(NewRequest);
+	}
+
+	// 이미 로드된 리소스는 바로 완료 (콜백도 즉시 호출). 축출된 셸은 다시 읽어야 하므로 일반 요청으로 처리
+	UResourceBase* Existing = RM.Find(InType, NewRequest->Path);
+	if (Existing && Existing->IsResident())
+	{
+		RM.TouchResource(Existing);
+		NewRequest->Resource = Existing;
+		NewRequest->State = EAsyncLoadState::Completed;
+		++Stats.CompletedRequests;
+		FrameIssueTimeMS += ElapsedMS(Start);
+		if (NewRequest->Callback)
+		{
+			FAsyncLoadCallback Callback = std::move(NewRequest->Callback);
+			Callback(Existing);
+		}
+		return FAsyncLoadHandle(NewRequest);
+	}
+
+	// 같은 경로를 기다리는 작업이 있으면 합침 (대기 중이면 우선순위만 올림)
+	const FString Key = MakeJobKey(InType, NewRequest->Path);
+	if (std::shared_ptr<FAsyncLoadJob>* Found = ActiveJobs.Find(Key))
+	{
+		FAsyncLoadJob& Job = **Found;
+		if (!Job.bDispatched && InPriority > Job.Priority)
+		{
+			Job.Priority = InPriority;
+		}
+		NewRequest->State = Job.bDispatched ? EAsyncLoadState::Loading : EAsyncLoadState::Queued;
+		Job.Requests.Add(NewRequest);
+		++Stats.CoalescedRequests;
+		FrameIssueTimeMS += ElapsedMS(Start);
+		return FAsyncLoadHandle(NewRequest);
+	}
+
+	std::shared_ptr<FAsyncLoadJob> Job = std::make_shared<FAsyncLoadJob>();
+	Job->Key = Key;
+	Job->Path = NewRequest->Path;
+	Job->Type = InType;
+	Job->Priority = InPriority;
+	Job->Sequence = NextSequence++;
+	Job->bWorkerPhase = InType == EResourceType::Texture || InType == EResourceType::SkeletalMesh
+		|| (InType == EResourceType::StaticMesh && HasExtension(Job->Path, ".obj"));
+	if (InType == EResourceType::StaticMesh)
+	{
+		// 워커에서 기본 머티리얼을 조회하지 않도록 이름을 미리 복사
+		UMaterial* DefaultMaterial = RM.GetDefaultMaterial();
+		Job->DefaultMaterialName = DefaultMaterial ? DefaultMaterial->GetMaterialInfo().MaterialName : FString();
+	}
+	Job->Requests.Add(NewRequest);
+
+	ActiveJobs.Add(Key, Job);
+	QueuedJobs.Add(Job);
+
+	FrameIssueTimeMS += ElapsedMS(Start);
+	return FAsyncLoadHandle(NewRequest);
+}
+
+void FAsyncResourceLoader::RunWorkerPhase(FAsyncLoadJob& Job)
+{
+	if (Job.bAbandoned.load(std::memory_order_acquire))
+	{
+		return;
+	}
+
+	if (Job.Type == EResourceType::Texture)
+	{
+		FScopedCOMInitialize COMInitialize;
+		UTexture::PrepareSource(Job.Path, true, Job.TextureSource);
+	}
+	else if (Job.Type == EResourceType::StaticMesh)
+	{
+		Job.StaticMesh = FObjManager::BuildObjStaticMeshData(Job.Path, Job.DefaultMaterialName, Job.MaterialInfos);
+	}
+	else if (Job.Type == EResourceType::SkeletalMesh)
+	{
+		Job.SkeletalMeshData = UFbxLoader::LoadCachedFbxMeshData(Job.Path, Job.MaterialInfos);
+	}
+}
+
+void FAsyncResourceLoader::DispatchQueuedJobs()
+{
+	if (MaxInFlightJobs == 0)
+	{
+		// 렌더러의 ParallelFor가 쓸 워커를 남겨 두도록 절반만 사용
+		MaxInFlightJobs = std::max<uint32>(2, FTaskScheduler::GetInstance().GetNumWorkers() / 2);
+	}
+
+	while (!QueuedJobs.IsEmpty())
+	{
+		// 마무리 대기 작업도 진행 수에 포함 (게임 스레드가 밀리면 워커 결과가 메모리에 쌓이지 않도록)
+		const uint32 Outstanding = static_cast<uint32>(InFlightJobCount.load(std::memory_order_acquire)) + static_cast<uint32>(ReadyJobs.Num());
+		if (Outstanding >= MaxInFlightJobs)
+		{
+			break;
+		}
+
+		int32 BestIndex = 0;
+		for (int32 i = 1; i < QueuedJobs.Num(); ++i)
+		{
+			if (IsHigherPriority(*QueuedJobs[i], *QueuedJobs[BestIndex]))
+			{
+				BestIndex = i;
+			}
+		}
+		std::shared_ptr<FAsyncLoadJob> Job = QueuedJobs[BestIndex];
+		QueuedJobs.RemoveAt(BestIndex);
+
+		Job->bDispatched = true;
+		for (const std::shared_ptr<FAsyncLoadRequest>& Request : Job->Requests)
+		{
+			Request->State = EAsyncLoadState::Loading;
+		}
+
+		if (!Job->bWorkerPhase)
+		{
+			ReadyJobs.Add(Job);
+			continue;
+		}
+
+		InFlightJobCount.fetch_add(1, std::memory_order_acq_rel);
+		FTaskScheduler::GetInstance().Enqueue([this, Job]()
+			{
+				RunWorkerPhase(*Job);
+				{
+					std::lock_guard<std::mutex> Lock(CompletedMutex);
+					CompletedJobs.Add(Job);
+				}
+				InFlightJobCount.fetch_sub(1, std::memory_order_acq_rel);
+			});
+	}
+}
+
+void FAsyncResourceLoader::Tick(double InBudgetMS)
+{
+	assert(!FTaskScheduler::IsInWorkerThread());
+	const uint64 Start = FPlatformTime::Cycles64();
+
+	{
+		std::lock_guard<std::mutex> Lock(CompletedMutex);
+		ReadyJobs.Append(CompletedJobs);
+		CompletedJobs.Empty();
+	}
+
+	DispatchQueuedJobs();
+
+	// 우선순위 순서로 예산 안에서 마무리 (최소 하나는 처리해 진행을 보장)
+	std::stable_sort(ReadyJobs.begin(), ReadyJobs.end(), [](const std::shared_ptr<FAsyncLoadJob>& A, const std::shared_ptr<FAsyncLoadJob>& B)
+		{
+			return IsHigherPriority(*A, *B);
+		});
+
+	uint32 NumFinalized = 0;
+	while (NumFinalized < static_cast<uint32>(ReadyJobs.Num()))
+	{
+		if (NumFinalized > 0 && FPlatformTime::ToMilliseconds(FPlatformTime::Cycles64() - Start) >= InBudgetMS)
+		{
+			break;
+		}
+		std::shared_ptr<FAsyncLoadJob> Job = ReadyJobs[NumFinalized++];
+		FinalizeJob(*Job);
+	}
+	ReadyJobs.erase(ReadyJobs.begin(), ReadyJobs.begin() + NumFinalized);
+
+	// 마무리로 자리가 비었으면 다음 작업을 바로 워커에 배정
+	DispatchQueuedJobs();
+
+	Stats.QueuedJobs = static_cast<uint32>(QueuedJobs.Num());
+	Stats.InFlightJobs = static_cast<uint32>(InFlightJobCount.load(std::memory_order_acquire)) + static_cast<uint32>(ReadyJobs.Num());
+	Stats.FinalizedJobs = NumFinalized;
+	Stats.IssueTimeMS = FrameIssueTimeMS;
+	Stats.FinalizeTimeMS = ElapsedMS(Start);
+	Stats.MaxStallMS = std::max(Stats.MaxStallMS, Stats.GetStallMS());
+	FrameIssueTimeMS = 0.0f;
+}
+
+bool FAsyncResourceLoader::HasPendingWork()
+{
+	if (!QueuedJobs.IsEmpty() || !ReadyJobs.IsEmpty() || InFlightJobCount.load(std::memory_order_acquire) > 0)
+	{
+		return true;
+	}
+
+	// 워커는 완료 큐에 넣은 뒤 진행 수를 줄이므로, 진행 수가 0이면 결과는 이미 완료 큐에 있음
+	std::lock_guard<std::mutex> Lock(CompletedMutex);
+	return !CompletedJobs.IsEmpty();
+}
+
+void FAsyncResourceLoader::FinalizeJob(FAsyncLoadJob& Job)
+{
+	if (Job.bAbandoned.load(std::memory_order_acquire))
+	{
+		DiscardJobOutput(Job);
+		return;
+	}
+
+	UResourceManager& RM = UResourceManager::GetInstance();
+	UResourceBase* Result = nullptr;
+
+	switch (Job.Type)
+	{
+	case EResourceType::Texture:
+		if (UTexture* Existing = static_cast<UTexture*>(RM.Find(EResourceType::Texture, Job.Path)))
+		{
+			// 축출된 셸이면 준비한 원본으로 GPU 리소스만 다시 생성 (워커는 sRGB로 준비하므로 Linear 텍스처는 Get에서 동기 로드)
+			if (!Existing->IsResident() && Existing->IsSRGB())
+			{
+				Existing->Load(Job.Path, RM.GetDevice(), Job.TextureSource);
+				RM.GetResidency().MarkRestored(Existing);
+			}
+			// 그 사이 동기 Load로 이미 로드됐으면 준비한 원본은 버림
+			Result = RM.Get<UTexture>(Job.Path);
+		}
+		else
+		{
+			Result = RM.Load<UTexture>(Job.Path, Job.TextureSource);
+		}
+		break;
+	case EResourceType::StaticMesh:
+		if (Job.StaticMesh)
+		{
+			// 소유권은 ObjManager 캐시로 넘어감 (이미 등록된 경로면 거기서 삭제)
+			FObjManager::RegisterObjStaticMeshData(Job.Path, Job.StaticMesh, Job.MaterialInfos);
+			Job.StaticMesh = nullptr;
+		}
+		Result = RM.Load<UStaticMesh>(Job.Path);
+		break;
+	case EResourceType::SkeletalMesh:
+		if (!Job.SkeletalMeshData)
+		{
+			// 캐시 미스: FBX SDK 임포트는 게임 스레드에서만 가능하므로 동기 로드
+			Result = RM.Load<USkeletalMesh>(Job.Path);
+			break;
+		}
+		// 워커가 읽은 캐시 데이터로 머티리얼 등록 + GPU 버퍼 생성만 수행 (메시 데이터 소유권은 USkeletalMesh로 넘어감)
+		UFbxLoader::RegisterFbxMaterials(Job.MaterialInfos);
+		if (USkeletalMesh* Existing = static_cast<USkeletalMesh*>(RM.Find(EResourceType::SkeletalMesh, Job.Path)))
+		{
+			// 축출된 셸이면 준비한 데이터로 다시 채우고, 그 사이 동기 Load로 이미 로드됐으면 버림
+			if (!Existing->IsResident())
+			{
+				Existing->Load(Job.Path, RM.GetDevice(), Job.SkeletalMeshData);
+				Job.SkeletalMeshData = nullptr;
+				RM.GetResidency().MarkRestored(Existing);
+			}
+			Result = RM.Get<USkeletalMesh>(Job.Path);
+		}
+		else
+		{
+			Result = RM.Load<USkeletalMesh>(Job.Path, Job.SkeletalMeshData);
+			Job.SkeletalMeshData = nullptr;
+		}
+		break;
+	case EResourceType::Material:
+		Result = RM.Load<UMaterial>(Job.Path);
+		break;
+	case EResourceType::Sound:
+		Result = RM.Load<USound>(Job.Path);
+		break;
+	default:
+		break;
+	}
+
+	DiscardJobOutput(Job);
+	CompleteRequests(Job, Result);
+}
+
+void FAsyncResourceLoader::CompleteRequests(FAsyncLoadJob& Job, UResourceBase* InResource)
+{
+	RemoveJob(&Job);
+
+	const bool bValid = IsLoadedResourceValid(Job.Type, InResource);
+	if (!bValid)
+	{
+		UE_LOG("[AsyncLoad] Failed to load '%s'", Job.Path.c_str());
+	}
+
+	// 콜백 안에서 새 LoadAsync/Cancel을 호출해도 안전하도록 요청 목록을 먼저 떼어 냄
+	TArray<std::shared_ptr<FAsyncLoadRequest>> Requests = std::move(Job.Requests);
+	Job.Requests.Empty();
+	for (const std::shared_ptr<FAsyncLoadRequest>& Request : Requests)
+	{
+		if (Request->State == EAsyncLoadState::Cancelled)
+		{
+			continue;
+		}
+
+		Request->Resource = InResource;
+		Request->State = bValid ? EAsyncLoadState::Completed : EAsyncLoadState::Failed;
+		if (bValid)
+		{
+			++Stats.CompletedRequests;
+		}
+		else
+		{
+			++Stats.FailedRequests;
+		}
+
+		if (Request->Callback)
+		{
+			FAsyncLoadCallback Callback = std::move(Request->Callback);
+			Callback(bValid ? InResource : nullptr);
+		}
+	}
+}
+
+void FAsyncResourceLoader::RemoveJob(const FAsyncLoadJob* InJob)
+{
+	std::shared_ptr<FAsyncLoadJob>* Found = ActiveJobs.Find(InJob->Key);
+	if (Found && Found->get() == InJob)
+	{
+		ActiveJobs.Remove(InJob->Key);
+	}
+}
+
+void FAsyncResourceLoader::CancelRequest(const std::shared_ptr<FAsyncLoadRequest>& InRequest)
+{
+	assert(!FTaskScheduler::IsInWorkerThread());
+	if (!InRequest || InRequest->State >= EAsyncLoadState::Completed)
+	{
+		return;
+	}
+
+	InRequest->State = EAsyncLoadState::Cancelled;
+	InRequest->Callback = nullptr;
+	++Stats.CancelledRequests;
+
+	std::shared_ptr<FAsyncLoadJob>* Found = ActiveJobs.Find(MakeJobKey(InRequest->Type, InRequest->Path));
+	if (!Found)
+	{
+		return;
+	}
+
+	std::shared_ptr<FAsyncLoadJob> Job = *Found;
+	for (int32 i = 0; i < Job->Requests.Num(); ++i)
+	{
+		if (Job->Requests[i] == InRequest)
+		{
+			Job->Requests.RemoveAt(i);
+			break;
+		}
+	}
+	if (!Job->Requests.IsEmpty())
+	{
+		return;
+	}
+
+	// 기다리는 요청이 없으면 작업 자체를 버림
+	// 진행 중인 워커 작업은 멈출 수 없으므로 표시만 해 두고 결과를 마무리 단계에서 해제
+	Job->bAbandoned.store(true, std::memory_order_release);
+	RemoveJob(Job.get());
+	if (!Job->bDispatched)
+	{
+		for (int32 i = 0; i < QueuedJobs.Num(); ++i)
+		{
+			if (QueuedJobs[i] == Job)
+			{
+				QueuedJobs.RemoveAt(i);
+				break;
+			}
+		}
+	}
+}
+
+void FAsyncResourceLoader::CancelAll()
+{
+	const TArray<std::shared_ptr<FAsyncLoadJob>> Jobs = ActiveJobs.GetValues();
+	for (const std::shared_ptr<FAsyncLoadJob>& Job : Jobs)
+	{
+		TArray<std::shared_ptr<FAsyncLoadRequest>> Requests = Job->Requests;
+		for (const std::shared_ptr<FAsyncLoadRequest>& Request : Requests)
+		{
+			CancelRequest(Request);
+		}
+	}
+
+	// 워커가 잡고 있는 작업이 끝날 때까지 대기한 뒤 남은 결과 해제
+	while (InFlightJobCount.load(std::memory_order_acquire) > 0)
+	{
+		std::this_thread::yield();
+	}
+	{
+		std::lock_guard<std::mutex> Lock(CompletedMutex);
+		ReadyJobs.Append(CompletedJobs);
+		CompletedJobs.Empty();
+	}
+	for (const std::shared_ptr<FAsyncLoadJob>& Job : ReadyJobs)
+	{
+		DiscardJobOutput(*Job);
+	}
+	ReadyJobs.Empty();
+	QueuedJobs.Empty();
+	ActiveJobs.Empty();
+}
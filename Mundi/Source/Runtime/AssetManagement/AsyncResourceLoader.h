@@ -0,0 +1,147 @@
+﻿#pragma once
+#include "UEContainer.h"
+#include "Enums.h"
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <atomic>
+
+class UResourceBase;
+struct FAsyncLoadJob;
+
+// 비동기 로드 우선순위 (높은 것부터, 같으면 요청 순서대로 처리)
+enum class EAsyncLoadPriority : uint8
+{
+	Low,
+	Normal,
+	High,
+};
+
+enum class EAsyncLoadState : uint8
+{
+	Queued,     // 워커 배정 대기
+	Loading,    // 워커에서 읽기/디코딩 중 또는 게임 스레드 마무리 대기
+	Completed,
+	Failed,
+	Cancelled,
+};
+
+using FAsyncLoadCallback = std::function<void(UResourceBase*)>;
+
+// LoadAsync 요청 하나의 상태 (핸들이 공유). 게임 스레드에서만 읽고 씀
+struct FAsyncLoadRequest
+{
+	FString Path;
+	EResourceType Type = EResourceType::None;
+	EAsyncLoadState State = EAsyncLoadState::Queued;
+	UResourceBase* Placeholder = nullptr;   // 완료 전 Get()이 돌려주는 기본 리소스 (없으면 nullptr)
+	UResourceBase* Resource = nullptr;
+	FAsyncLoadCallback Callback;            // 완료 시 한 번 호출 (취소되면 호출하지 않음)
+};
+
+/**
+ * LoadAsync가 돌려주는 핸들 (게임 스레드 전용)
+ * 완료 전 Get()은 플레이스홀더(기본 머티리얼/기본 텍스처)를 돌려주므로 바로 컴포넌트에 꽂아 쓸 수 있다.
+ */
+class FAsyncLoadHandle
+{
+public:
+	FAsyncLoadHandle() = default;
+	explicit FAsyncLoadHandle(std::shared_ptr<FAsyncLoadRequest> InRequest) : Request(std::move(InRequest)) {}
+
+	bool IsValid() const { return Request != nullptr; }
+	EAsyncLoadState GetState() const { return Request ? Request->State : EAsyncLoadState::Failed; }
+	bool IsDone() const { return GetState() >= EAsyncLoadState::Completed; }
+
+	// 완료되면 로드된 리소스, 아니면 플레이스홀더
+	UResourceBase* GetResource() const
+	{
+		if (!Request) return nullptr;
+		return Request->State == EAsyncLoadState::Completed ? Request->Resource : Request->Placeholder;
+	}
+
+	template<typename T>
+	T* Get() const { return static_cast<T*>(GetResource()); }
+
+	// 콜백을 호출하지 않게 한다. 같은 경로를 기다리는 다른 요청이 없으면 대기/진행 중인 로드도 버림
+	void Cancel();
+
+private:
+	std::shared_ptr<FAsyncLoadRequest> Request;
+};
+
+// 비동기 로드 통계 (프레임 단위 게임 스레드 정지 시간 포함)
+struct FAsyncLoadStats
+{
+	// 현재 상태
+	uint32 QueuedJobs = 0;
+	uint32 InFlightJobs = 0;      // 워커에서 처리 중이거나 게임 스레드 마무리 대기
+
+	// 누적
+	uint32 CompletedRequests = 0;
+	uint32 FailedRequests = 0;
+	uint32 CancelledRequests = 0;
+	uint32 CoalescedRequests = 0; // 이미 대기/진행 중인 같은 경로에 합쳐진 요청
+
+	// 직전 프레임
+	uint32 FinalizedJobs = 0;
+	float IssueTimeMS = 0.0f;     // LoadAsync 호출에 쓴 게임 스레드 시간
+	float FinalizeTimeMS = 0.0f;  // TickAsyncLoads에서 등록/GPU 생성/콜백에 쓴 시간
+	float MaxStallMS = 0.0f;      // 누적 최대 프레임 정지 시간
+
+	float GetStallMS() const { return IssueTimeMS + FinalizeTimeMS; }
+};
+
+/**
+ * UResourceManager의 비동기 스트리밍 로드 큐
+ * 1) LoadAsync: 같은 경로의 대기/진행 중 작업에 합치거나 우선순위 큐에 작업 추가
+ * 2) Tick: 우선순위 순서로 워커(FTaskScheduler::Enqueue)에 배정. 동시 진행 수는 MaxInFlightJobs로 제한
+ *    워커는 CPU 단계만 수행 (텍스처: DDS 변환 + 파일 읽기, OBJ: 파싱/바이너리 캐시, 스켈레탈 FBX: 파생 데이터 캐시 읽기)
+ * 3) Tick: 워커가 끝낸 작업을 게임 스레드에서 예산(ms) 안에서 마무리 (리소스 등록 + GPU 생성 + 콜백)
+ *    FBX 캐시 미스(SDK 임포트)/스태틱 FBX/사운드/머티리얼은 CPU 단계를 분리할 수 없어 마무리 단계에서 동기 로드 (프레임당 예산 안에서 하나씩)
+ */
+class FAsyncResourceLoader
+{
+public:
+	FAsyncLoadHandle Request(EResourceType InType, const FString& InFilePath, FAsyncLoadCallback InCallback, EAsyncLoadPriority InPriority);
+
+	// 매 프레임 게임 스레드에서 호출
+	void Tick(double InBudgetMS);
+
+	// 모든 요청 취소 + 진행 중인 워커 작업 종료 대기 (리소스 매니저 해제 전)
+	void CancelAll();
+
+	void CancelRequest(const std::shared_ptr<FAsyncLoadRequest>& InRequest);
+
+	// 대기/워커 진행/마무리 대기 중인 작업이 남아 있는지
+	bool HasPendingWork();
+	const FAsyncLoadStats& GetStats() const { return Stats; }
+
+	static constexpr double DefaultBudgetMS = 4.0;
+
+private:
+	void DispatchQueuedJobs();
+	void FinalizeJob(FAsyncLoadJob& Job);
+	void CompleteRequests(FAsyncLoadJob& Job, UResourceBase* InResource);
+	void RemoveJob(const FAsyncLoadJob* InJob);
+
+	static void RunWorkerPhase(FAsyncLoadJob& Job);
+	static FString MakeJobKey(EResourceType InType, const FString& InNormalizedPath);
+
+private:
+	TArray<std::shared_ptr<FAsyncLoadJob>> QueuedJobs;           // 우선순위 미정렬, 배정 시 최댓값 선택
+	TMap<FString, std::shared_ptr<FAsyncLoadJob>> ActiveJobs;    // 대기 + 진행 중 (같은 경로 요청 합치기)
+	uint64 NextSequence = 0;
+	uint32 MaxInFlightJobs = 0;
+
+	// 워커 → 게임 스레드 완료 큐
+	std::mutex CompletedMutex;
+	TArray<std::shared_ptr<FAsyncLoadJob>> CompletedJobs;
+	std::atomic<int32> InFlightJobCount{ 0 };
+
+	// 마무리 대기 (완료 큐에서 옮겨 왔지만 이번 프레임 예산을 넘어 남은 작업)
+	TArray<std::shared_ptr<FAsyncLoadJob>> ReadyJobs;
+
+	FAsyncLoadStats Stats;
+	float FrameIssueTimeMS = 0.0f;
+};
@@ -0,0 +1,348 @@
+﻿#include "pch.h"
+#include "DerivedDataCache.h"
+#include "Hash.h"
+#include "PathUtils.h"
+#include "PlatformTime.h"
+#include "WindowsMappedFile.h"
+#include <cstdlib>
+#include <filesystem>
+#include <fstream>
+#include <sstream>
+
+namespace fs = std::filesystem;
+
+namespace
+{
+	// 임포터 출력 형식이나 변환 로직을 바꾸면 해당 종류의 버전을 올릴 것 (기존 캐시가 모두 미스가 됨)
+	constexpr uint32 ImporterVersions[] =
+	{
+		4,  // ObjMesh (2: 정점 캐시/오버드로/페치 최적화, 3: 자동 LOD, 4: 압축 정점 플래그)
+		3,  // FbxMesh (2: 정점 캐시/오버드로/페치 최적화, 3: 압축 정점 플래그)
+		1,  // FbxAnimation
+		2,  // Texture (2: 내용 기반 BC1/BC3/BC5/BC7 자동 선택)
+	};
+	static_assert(sizeof(ImporterVersions) / sizeof(ImporterVersions[0]) == static_cast<size_t>(EDerivedDataKind::Count),
+		"ImporterVersions must cover every EDerivedDataKind");
+
+	constexpr const char* IndexHeader = "MundiDDCIndex 1";
+
+	FString ToHex(uint64 Value)
+	{
+		char Buffer[17];
+		snprintf(Buffer, sizeof(Buffer), "%016llx", static_cast<unsigned long long>(Value));
+		return FString(Buffer);
+	}
+
+	// 길이를 앞에 붙여 구분자 없이 이어 붙여도 경계가 섞이지 않게
+	void HashString(FXxHash64& Hasher, const FString& InValue)
+	{
+		const uint64 Length = InValue.size();
+		Hasher.Update(&Length, sizeof(Length));
+		Hasher.Update(InValue.data(), InValue.size());
+	}
+
+	bool StatSource(const FString& InPath, uint64& OutSize, int64& OutWriteTime)
+	{
+		const fs::path Path(UTF8ToWide(InPath));
+		std::error_code Error;
+		OutSize = static_cast<uint64>(fs::file_size(Path, Error));
+		if (Error)
+		{
+			return false;
+		}
+		OutWriteTime = static_cast<int64>(fs::last_write_time(Path, Error).time_since_epoch().count());
+		return !Error;
+	}
+}
+
+FDerivedDataCache& FDerivedDataCache::GetInstance()
+{
+	static FDerivedDataCache Instance;
+	return Instance;
+}
+
+const char* FDerivedDataCache::GetKindName(EDerivedDataKind InKind)
+{
+	switch (InKind)
+	{
+	case EDerivedDataKind::ObjMesh:      return "OBJ mesh";
+	case EDerivedDataKind::FbxMesh:      return "FBX mesh";
+	case EDerivedDataKind::FbxAnimation: return "FBX anim";
+	case EDerivedDataKind::Texture:      return "Texture";
+	default:                             return "Unknown";
+	}
+}
+
+FString FDerivedDataCache::GetIndexPath() const
+{
+	return GCacheDir + "/DDC/Index.txt";
+}
+
+void FDerivedDataCache::LoadIndexLocked()
+{
+	if (bIndexLoaded)
+	{
+		return;
+	}
+	bIndexLoaded = true;
+
+	std::ifstream File{ fs::path(UTF8ToWide(GetIndexPath())) };
+	if (!File)
+	{
+		return;
+	}
+
+	FString Line;
+	if (!std::getline(File, Line) || Line != IndexHeader)
+	{
+		UE_LOG("[DDC] Ignoring index with unknown format: %s", GetIndexPath().c_str());
+		return;
+	}
+
+	// 한 줄: <해시 16진> <크기> <수정 시간> <경로 (공백 포함 가능, 줄 끝까지)>
+	while (std::getline(File, Line))
+	{
+		std::istringstream Stream(Line);
+		FString HashHex;
+		FSourceHashEntry Entry;
+		if (!(Stream >> HashHex >> Entry.Size >> Entry.WriteTime))
+		{
+			continue;
+		}
+		FString Path;
+		std::getline(Stream >> std::ws, Path);
+		if (Path.empty())
+		{
+			continue;
+		}
+		Entry.Hash = std::strtoull(HashHex.c_str(), nullptr, 16);
+		SourceIndex[Path] = Entry;
+	}
+}
+
+void FDerivedDataCache::SaveIndex()
+{
+	std::lock_guard<std::mutex> Lock(Mutex);
+	if (!bIndexDirty)
+	{
+		return;
+	}
+
+	const FString IndexPath = GetIndexPath();
+	std::error_code Error;
+	fs::create_directories(fs::path(UTF8ToWide(IndexPath)).parent_path(), Error);
+
+	std::ofstream File{ fs::path(UTF8ToWide(IndexPath)), std::ios::trunc };
+	if (!File)
+	{
+		UE_LOG("[DDC] Failed to write index: %s", IndexPath.c_str());
+		return;
+	}
+
+	File << IndexHeader << '\n';
+	for (const auto& Pair : SourceIndex)
+	{
+		File << ToHex(Pair.second.Hash) << ' ' << Pair.second.Size << ' ' << Pair.second.WriteTime << ' ' << Pair.first << '\n';
+	}
+	bIndexDirty = false;
+}
+
+bool FDerivedDataCache::GetSourceHash(const FString& InPath, uint64& OutHash)
+{
+	uint64 Size = 0;
+	int64 WriteTime = 0;
+	if (!StatSource(InPath, Size, WriteTime))
+	{
+		return false;
+	}
+
+	{
+		std::lock_guard<std::mutex> Lock(Mutex);
+		LoadIndexLocked();
+		if (const FSourceHashEntry* Entry = SourceIndex.Find(InPath))
+		{
+			if (Entry->Size == Size && Entry->WriteTime == WriteTime)
+			{
+				OutHash = Entry->Hash;
+				++Stats.NumSourcesFromIndex;
+				return true;
+			}
+		}
+	}
+
+	// 해싱은 잠금 밖에서 (워커들이 서로 다른 파일을 동시에 해싱)
+	const uint64 HashStart = FPlatformTime::Cycles64();
+	FWindowsMappedFile File(UTF8ToWide(InPath));
+	if (!File.IsOpen())
+	{
+		return false;
+	}
+	OutHash = FXxHash64::Hash(File.GetData(), File.GetSize());
+	const uint64 HashedBytes = File.GetSize();
+	File.Close();
+	const double HashMS = FPlatformTime::ToMilliseconds(FPlatformTime::Cycles64() - HashStart);
+
+	std::lock_guard<std::mutex> Lock(Mutex);
+	FSourceHashEntry Entry;
+	Entry.Size = Size;
+	Entry.WriteTime = WriteTime;
+	Entry.Hash = OutHash;
+	SourceIndex[InPath] = Entry;
+	bIndexDirty = true;
+
+	++Stats.NumSourcesHashed;
+	Stats.BytesHashed += HashedBytes;
+	Stats.HashMS += HashMS;
+	return true;
+}
+
+FDerivedDataKey FDerivedDataCache::Lookup(EDerivedDataKind InKind, const FString& InSourcePath, const TArray<FString>& InDependencies,
+	const FString& InSettings, std::initializer_list<const char*> InSuffixes)
+{
+	FDerivedDataKey Key;
+
+	uint64 SourceHash = 0;
+	if (!GetSourceHash(NormalizePath(InSourcePath), SourceHash))
+	{
+		return Key;
+	}
+
+	FXxHash64 Hasher;
+	const uint32 KindIndex = static_cast<uint32>(InKind);
+	Hasher.Update(&KindIndex, sizeof(KindIndex));
+	Hasher.Update(&ImporterVersions[KindIndex], sizeof(uint32));
+	HashString(Hasher, InSettings);
+	Hasher.Update(&SourceHash, sizeof(SourceHash));
+
+	for (const FString& Dependency : InDependencies)
+	{
+		// 없는 의존 파일도 "없음"으로 키에 넣어, 나중에 생기면 다시 만들도록
+		uint64 DependencyHash = 0;
+		const uint8 bExists = GetSourceHash(NormalizePath(Dependency), DependencyHash) ? 1 : 0;
+		Hasher.Update(&bExists, sizeof(bExists));
+		Hasher.Update(&DependencyHash, sizeof(DependencyHash));
+	}
+
+	Key.Hash = ToHex(Hasher.Digest());
+	Key.BasePath = GCacheDir + "/DDC/" + Key.Hash.substr(0, 2) + "/" + Key.Hash;
+
+	Key.bHit = true;
+	for (const char* Suffix : InSuffixes)
+	{
+		std::error_code Error;
+		if (!fs::is_regular_file(fs::path(UTF8ToWide(Key.GetPath(Suffix))), Error))
+		{
+			Key.bHit = false;
+			break;
+		}
+	}
+
+	std::lock_guard<std::mutex> Lock(Mutex);
+	if (Key.bHit)
+	{
+		++Stats.Kinds[KindIndex].Hits;
+	}
+	else
+	{
+		++Stats.Kinds[KindIndex].Misses;
+		Key.WriteToken = ".tmp" + std::to_string(++NextWriteToken);
+
+		std::error_code Error;
+		fs::create_directories(fs::path(UTF8ToWide(Key.BasePath)).parent_path(), Error);
+	}
+	return Key;
+}
+
+bool FDerivedDataCache::Commit(const FDerivedDataKey& InKey, std::initializer_list<const char*> InSuffixes)
+{
+	if (!InKey.IsValid())
+	{
+		return false;
+	}
+
+	// 같은 키를 다른 스레드가 먼저 확정했어도 내용이 같으므로 덮어써도 됨
+	for (const char* Suffix : InSuffixes)
+	{
+		std::error_code Error;
+		fs::rename(fs::path(UTF8ToWide(InKey.GetWritePath(Suffix))), fs::path(UTF8ToWide(InKey.GetPath(Suffix))), Error);
+		if (Error)
+		{
+			UE_LOG("[DDC] Failed to commit %s%s: %s", InKey.Hash.c_str(), Suffix, Error.message().c_str());
+			Abandon(InKey, InSuffixes);
+			return false;
+		}
+	}
+	return true;
+}
+
+void FDerivedDataCache::Abandon(const FDerivedDataKey& InKey, std::initializer_list<const char*> InSuffixes)
+{
+	if (!InKey.IsValid())
+	{
+		return;
+	}
+
+	for (const char* Suffix : InSuffixes)
+	{
+		std::error_code Error;
+		fs::remove(fs::path(UTF8ToWide(InKey.GetWritePath(Suffix))), Error);
+	}
+}
+
+void FDerivedDataCache::MarkCorrupt(EDerivedDataKind InKind, FDerivedDataKey& InOutKey, std::initializer_list<const char*> InSuffixes)
+{
+	for (const char* Suffix : InSuffixes)
+	{
+		std::error_code Error;
+		fs::remove(fs::path(UTF8ToWide(InOutKey.GetPath(Suffix))), Error);
+	}
+
+	std::lock_guard<std::mutex> Lock(Mutex);
+	InOutKey.bHit = false;
+	InOutKey.WriteToken = ".tmp" + std::to_string(++NextWriteToken);
+
+	FDerivedDataKindStats& KindStats = Stats.Kinds[static_cast<int32>(InKind)];
+	if (KindStats.Hits > 0)
+	{
+		--KindStats.Hits;
+	}
+	++KindStats.Misses;
+	++KindStats.Corrupt;
+}
+
+FDerivedDataStats FDerivedDataCache::GetStats() const
+{
+	std::lock_guard<std::mutex> Lock(Mutex);
+	return Stats;
+}
+
+void FDerivedDataCache::ResetStats()
+{
+	std::lock_guard<std::mutex> Lock(Mutex);
+	Stats = FDerivedDataStats();
+}
+
+void FDerivedDataCache::LogStats(const char* InContext) const
+{
+	const FDerivedDataStats Snapshot = GetStats();
+
+	uint32 TotalHits = 0;
+	uint32 TotalLookups = 0;
+	for (int32 Index = 0; Index < static_cast<int32>(EDerivedDataKind::Count); ++Index)
+	{
+		const FDerivedDataKindStats& KindStats = Snapshot.Kinds[Index];
+		const uint32 Lookups = KindStats.Hits + KindStats.Misses;
+		TotalHits += KindStats.Hits;
+		TotalLookups += Lookups;
+		if (Lookups == 0)
+		{
+			continue;
+		}
+		UE_LOG("[DDC] %s  %-9s hit %4u / %4u (%5.1f%%), corrupt %u", InContext, GetKindName(static_cast<EDerivedDataKind>(Index)),
+			KindStats.Hits, Lookups, 100.0 * KindStats.Hits / Lookups, KindStats.Corrupt);
+	}
+
+	UE_LOG("[DDC] %s  total hit %u / %u (%.1f%%); sources hashed %u (%.1f MB, %.1f ms), reused from index %u",
+		InContext, TotalHits, TotalLookups, TotalLookups > 0 ? 100.0 * TotalHits / TotalLookups : 0.0,
+		Snapshot.NumSourcesHashed, Snapshot.BytesHashed / (1024.0 * 1024.0), Snapshot.HashMS, Snapshot.NumSourcesFromIndex);
+}
@@ -0,0 +1,113 @@
+﻿#pragma once
+#include "UEContainer.h"
+#include <mutex>
+#include <initializer_list>
+
+// 파생 데이터 종류 (임포터 버전과 통계 구분)
+enum class EDerivedDataKind : uint8
+{
+	ObjMesh,        // .obj + .mtl → .bin / .mat.bin
+	FbxMesh,        // .fbx → .bin / .mat.bin
+	FbxAnimation,   // .fbx + 대상 스켈레톤 → .anim.bin
+	Texture,        // 이미지 → .dds
+	Count
+};
+
+/**
+ * 캐시 조회 결과 (콘텐츠 주소)
+ * 출력 파일은 GetPath(".bin")처럼 확장자를 붙여 얻는다. 미스일 때는 GetWritePath로 쓰고 Commit으로 확정
+ */
+struct FDerivedDataKey
+{
+	FString Hash;           // 16진 키 (비어 있으면 소스를 읽지 못해 캐시를 쓸 수 없음)
+	FString BasePath;       // 예: DerivedDataCache/DDC/3f/3f9a0c1d2e4b5a67
+	FString WriteToken;     // 같은 키를 동시에 만드는 스레드끼리 임시 파일이 겹치지 않도록
+	bool bHit = false;
+
+	bool IsValid() const { return !Hash.empty(); }
+	FString GetPath(const char* InSuffix) const { return BasePath + InSuffix; }
+	FString GetWritePath(const char* InSuffix) const { return BasePath + InSuffix + WriteToken; }
+};
+
+struct FDerivedDataKindStats
+{
+	uint32 Hits = 0;
+	uint32 Misses = 0;
+	uint32 Corrupt = 0;     // 적중했지만 출력을 읽지 못해 다시 만든 경우 (Misses에도 포함)
+};
+
+struct FDerivedDataStats
+{
+	FDerivedDataKindStats Kinds[static_cast<int32>(EDerivedDataKind::Count)];
+
+	uint32 NumSourcesHashed = 0;        // 내용을 읽어 해싱한 소스/의존 파일
+	uint32 NumSourcesFromIndex = 0;     // 크기와 수정 시간이 같아 인덱스의 해시를 재사용
+	uint64 BytesHashed = 0;
+	double HashMS = 0.0;
+};
+
+/**
+ * 임포트 결과(.bin/.mat.bin/.anim.bin/.dds)를 공유하는 콘텐츠 주소 파생 데이터 캐시
+ * - 키: 소스와 의존 파일 내용의 xxHash64 + 임포터 버전 + 임포트 설정. 타임스탬프가 바뀌어도 내용이 같으면 적중하고,
+ *   다른 경로의 같은 에셋은 한 번만 만든다
+ * - 인덱스(DDC/Index.txt): 소스 경로별 (크기, 수정 시간, 내용 해시). 둘 다 같으면 파일을 다시 읽지 않는다
+ * - 워커 스레드에서 호출해도 됨
+ */
+class FDerivedDataCache
+{
+public:
+	static FDerivedDataCache& GetInstance();
+
+	/**
+	 * 키를 만들고 InSuffixes의 출력이 모두 저장소에 있으면 bHit. 적중/미스를 통계에 기록한다.
+	 * @param InDependencies 내용이 결과에 영향을 주는 다른 파일 (예: .mtl). 없는 파일도 키에 반영
+	 * @param InSettings 결과에 영향을 주는 임포트 설정을 문자열로 (예: 압축 포맷)
+	 */
+	FDerivedDataKey Lookup(EDerivedDataKind InKind, const FString& InSourcePath, const TArray<FString>& InDependencies,
+		const FString& InSettings, std::initializer_list<const char*> InSuffixes);
+
+	// 미스 후 GetWritePath로 쓴 출력들을 최종 경로로 옮김. 하나라도 실패하면 모두 지우고 false
+	bool Commit(const FDerivedDataKey& InKey, std::initializer_list<const char*> InSuffixes);
+
+	// 미스 후 만들기에 실패한 경우 임시 파일 정리
+	void Abandon(const FDerivedDataKey& InKey, std::initializer_list<const char*> InSuffixes);
+
+	// 적중했던 출력을 읽지 못한 경우: 출력을 지우고 미스로 다시 집계. InOutKey는 미스처럼 다시 쓸 수 있게 됨
+	void MarkCorrupt(EDerivedDataKind InKind, FDerivedDataKey& InOutKey, std::initializer_list<const char*> InSuffixes);
+
+	FDerivedDataStats GetStats() const;
+	void ResetStats();
+
+	// 종류별 적중률과 해싱 비용을 로그로 출력
+	void LogStats(const char* InContext) const;
+
+	// 바뀐 소스 해시 인덱스를 디스크에 저장
+	void SaveIndex();
+
+	static const char* GetKindName(EDerivedDataKind InKind);
+
+private:
+	FDerivedDataCache() = default;
+
+	struct FSourceHashEntry
+	{
+		uint64 Size = 0;
+		int64 WriteTime = 0;
+		uint64 Hash = 0;
+	};
+
+	// 소스 내용 해시 (인덱스가 유효하면 재사용). 파일이 없으면 false
+	bool GetSourceHash(const FString& InPath, uint64& OutHash);
+	void LoadIndexLocked();
+	FString GetIndexPath() const;
+
+private:
+	mutable std::mutex Mutex;
+
+	TMap<FString, FSourceHashEntry> SourceIndex;
+	bool bIndexLoaded = false;
+	bool bIndexDirty = false;
+
+	uint32 NextWriteToken = 0;
+	FDerivedDataStats Stats;
+};
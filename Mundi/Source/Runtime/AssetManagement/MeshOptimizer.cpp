@@ -0,0 +1,487 @@
+﻿#include "pch.h"
+#include "MeshOptimizer.h"
+#include "VertexData.h"
+#include "PlatformTime.h"
+#include <algorithm>
+#include <cmath>
+
+namespace
+{
+	// Forsyth, "Linear-Speed Vertex Cache Optimisation" 의 기본 상수
+	constexpr uint32 ForsythCacheSize = 32;
+	constexpr uint32 ForsythMaxValence = 32;   // 이보다 남은 삼각형이 많으면 같은 점수
+	constexpr float CacheDecayPower = 1.5f;
+	constexpr float LastTriangleScore = 0.75f;
+	constexpr float ValenceBoostScale = 2.0f;
+	constexpr float ValenceBoostPower = 0.5f;
+
+	constexpr uint32 InvalidIndex = 0xFFFFFFFFu;
+
+	struct FForsythScoreTable
+	{
+		float Cache[ForsythCacheSize];
+		float Valence[ForsythMaxValence + 1];
+
+		FForsythScoreTable()
+		{
+			for (uint32 Position = 0; Position < ForsythCacheSize; ++Position)
+			{
+				// 직전 삼각형의 세 정점은 같은 점수 (어느 것부터 쓰든 캐시에 있음)
+				Cache[Position] = Position < 3
+					? LastTriangleScore
+					: std::pow(1.0f - static_cast<float>(Position - 3) / (ForsythCacheSize - 3), CacheDecayPower);
+			}
+			Valence[0] = 0.0f;
+			for (uint32 Count = 1; Count <= ForsythMaxValence; ++Count)
+			{
+				// 남은 삼각형이 적은 정점을 먼저 끝내 고립된 삼각형이 생기지 않도록
+				Valence[Count] = ValenceBoostScale * std::pow(static_cast<float>(Count), -ValenceBoostPower);
+			}
+		}
+	};
+
+	const FForsythScoreTable& GetScoreTable()
+	{
+		static const FForsythScoreTable Table;
+		return Table;
+	}
+
+	float GetVertexScore(int32 InCachePosition, uint32 InRemainingTriangles)
+	{
+		if (InRemainingTriangles == 0)
+		{
+			return -1.0f;
+		}
+		const FForsythScoreTable& Table = GetScoreTable();
+		float Score = Table.Valence[std::min(InRemainingTriangles, ForsythMaxValence)];
+		if (InCachePosition >= 0)
+		{
+			Score += Table.Cache[InCachePosition];
+		}
+		return Score;
+	}
+
+	// 삼각형 하나씩 FIFO 캐시를 시뮬레이션하며 미스 수를 기록 (오버드로 클러스터 경계 판단용)
+	struct FFifoCache
+	{
+		TArray<uint32> Timestamps;  // 정점이 캐시에 들어온 시점
+		uint32 Time;
+		uint32 CacheSize;
+
+		FFifoCache(uint32 InVertexCount, uint32 InCacheSize)
+			: Timestamps(InVertexCount, 0), Time(InCacheSize + 1), CacheSize(InCacheSize)
+		{
+		}
+
+		uint32 AddTriangle(const uint32* InTriangle)
+		{
+			uint32 Misses = 0;
+			for (int32 Corner = 0; Corner < 3; ++Corner)
+			{
+				const uint32 Vertex = InTriangle[Corner];
+				if (Time - Timestamps[Vertex] > CacheSize)
+				{
+					Timestamps[Vertex] = Time++;
+					++Misses;
+				}
+			}
+			return Misses;
+		}
+
+		// 이후 모든 정점이 미스가 되도록 (재배치된 클러스터는 빈 캐시에서 시작한다고 가정)
+		void Flush()
+		{
+			Time += CacheSize + 1;
+		}
+	};
+
+	struct FOverdrawCluster
+	{
+		uint32 FirstTriangle;
+		uint32 NumTriangles;
+		float SortKey;
+	};
+}
+
+FVertexCacheStats FMeshOptimizer::AnalyzeVertexCache(const uint32* InIndices, uint32 InIndexCount, uint32 InVertexCount, uint32 InCacheSize)
+{
+	FVertexCacheStats Stats;
+	Stats.NumTriangles = InIndexCount / 3;
+
+	FFifoCache Cache(InVertexCount, InCacheSize);
+	TArray<uint8> bReferenced(InVertexCount, 0);
+	for (uint32 Triangle = 0; Triangle < Stats.NumTriangles; ++Triangle)
+	{
+		const uint32* Corners = InIndices + Triangle * 3;
+		Stats.NumMisses += Cache.AddTriangle(Corners);
+		for (int32 Corner = 0; Corner < 3; ++Corner)
+		{
+			if (!bReferenced[Corners[Corner]])
+			{
+				bReferenced[Corners[Corner]] = 1;
+				++Stats.NumVertices;
+			}
+		}
+	}
+	return Stats;
+}
+
+void FMeshOptimizer::OptimizeVertexCache(uint32* InOutIndices, uint32 InIndexCount, uint32 InVertexCount)
+{
+	const uint32 NumTriangles = InIndexCount / 3;
+	if (NumTriangles < 2)
+	{
+		return;
+	}
+
+	// 정점 → 인접 삼각형 (CSR). 앞쪽 Remaining[v]개가 아직 출력되지 않은 삼각형
+	TArray<uint32> AdjacencyStart(InVertexCount + 1, 0);
+	for (uint32 i = 0; i < NumTriangles * 3; ++i)
+	{
+		++AdjacencyStart[InOutIndices[i] + 1];
+	}
+	for (uint32 Vertex = 0; Vertex < InVertexCount; ++Vertex)
+	{
+		AdjacencyStart[Vertex + 1] += AdjacencyStart[Vertex];
+	}
+	TArray<uint32> Remaining(InVertexCount, 0);
+	TArray<uint32> Adjacency(NumTriangles * 3);
+	for (uint32 i = 0; i < NumTriangles * 3; ++i)
+	{
+		const uint32 Vertex = InOutIndices[i];
+		Adjacency[AdjacencyStart[Vertex] + Remaining[Vertex]++] = i / 3;
+	}
+
+	TArray<int32> CachePosition(InVertexCount, -1);
+	TArray<float> VertexScore(InVertexCount);
+	for (uint32 Vertex = 0; Vertex < InVertexCount; ++Vertex)
+	{
+		VertexScore[Vertex] = GetVertexScore(-1, Remaining[Vertex]);
+	}
+
+	TArray<uint8> bEmitted(NumTriangles, 0);
+	int32 BestTriangle = 0;
+	float BestScore = -1.0f;
+	for (uint32 Triangle = 0; Triangle < NumTriangles; ++Triangle)
+	{
+		const uint32* Corners = InOutIndices + Triangle * 3;
+		const float Score = VertexScore[Corners[0]] + VertexScore[Corners[1]] + VertexScore[Corners[2]];
+		if (Score > BestScore)
+		{
+			BestScore = Score;
+			BestTriangle = static_cast<int32>(Triangle);
+		}
+	}
+
+	TArray<uint32> Output;
+	Output.reserve(NumTriangles * 3);
+
+	uint32 Cache[ForsythCacheSize + 3];
+	uint32 CacheCount = 0;
+	uint32 NewCache[ForsythCacheSize + 3];
+	uint32 ScanCursor = 0;
+
+	for (uint32 NumEmitted = 0; NumEmitted < NumTriangles; ++NumEmitted)
+	{
+		if (BestTriangle < 0)
+		{
+			// 캐시 주변에 남은 삼각형이 없으면 입력 순서상 다음 삼각형에서 다시 시작
+			while (bEmitted[ScanCursor])
+			{
+				++ScanCursor;
+			}
+			BestTriangle = static_cast<int32>(ScanCursor);
+		}
+
+		const uint32 Triangle = static_cast<uint32>(BestTriangle);
+		const uint32 Corners[3] = { InOutIndices[Triangle * 3], InOutIndices[Triangle * 3 + 1], InOutIndices[Triangle * 3 + 2] };
+		bEmitted[Triangle] = 1;
+		Output.push_back(Corners[0]);
+		Output.push_back(Corners[1]);
+		Output.push_back(Corners[2]);
+
+		// 인접 목록에서 제거 (퇴화 삼각형은 같은 정점에 두 번 들어 있으므로 모서리마다 하나씩)
+		for (uint32 Vertex : Corners)
+		{
+			uint32* Begin = &Adjacency[AdjacencyStart[Vertex]];
+			uint32* Last = Begin + Remaining[Vertex] - 1;
+			for (uint32* It = Begin; It <= Last; ++It)
+			{
+				if (*It == Triangle)
+				{
+					std::swap(*It, *Last);
+					--Remaining[Vertex];
+					break;
+				}
+			}
+		}
+
+		// 새 캐시 = 방금 쓴 정점 + 이전 캐시 (중복 제외)
+		uint32 NewCount = 0;
+		for (uint32 Vertex : Corners)
+		{
+			if (std::find(NewCache, NewCache + NewCount, Vertex) == NewCache + NewCount)
+			{
+				NewCache[NewCount++] = Vertex;
+			}
+		}
+		for (uint32 i = 0; i < CacheCount; ++i)
+		{
+			const uint32 Vertex = Cache[i];
+			if (Vertex != Corners[0] && Vertex != Corners[1] && Vertex != Corners[2])
+			{
+				NewCache[NewCount++] = Vertex;
+			}
+		}
+
+		// 밀려난 정점 포함해 점수 갱신
+		for (uint32 i = 0; i < NewCount; ++i)
+		{
+			const uint32 Vertex = NewCache[i];
+			CachePosition[Vertex] = i < ForsythCacheSize ? static_cast<int32>(i) : -1;
+			VertexScore[Vertex] = GetVertexScore(CachePosition[Vertex], Remaining[Vertex]);
+		}
+
+		// 캐시 정점에 닿은 삼각형 중 최고 점수가 다음 후보
+		BestTriangle = -1;
+		BestScore = -1.0f;
+		for (uint32 i = 0; i < NewCount; ++i)
+		{
+			const uint32 Vertex = NewCache[i];
+			for (uint32 j = 0; j < Remaining[Vertex]; ++j)
+			{
+				const uint32 Candidate = Adjacency[AdjacencyStart[Vertex] + j];
+				const uint32* CandidateCorners = InOutIndices + Candidate * 3;
+				const float Score = VertexScore[CandidateCorners[0]] + VertexScore[CandidateCorners[1]] + VertexScore[CandidateCorners[2]];
+				if (Score > BestScore)
+				{
+					BestScore = Score;
+					BestTriangle = static_cast<int32>(Candidate);
+				}
+			}
+		}
+
+		CacheCount = std::min(NewCount, ForsythCacheSize);
+		std::copy(NewCache, NewCache + CacheCount, Cache);
+	}
+
+	std::copy(Output.begin(), Output.end(), InOutIndices);
+}
+
+uint32 FMeshOptimizer::OptimizeOverdraw(uint32* InOutIndices, uint32 InIndexCount, const TArray<FVector>& InPositions, float InThreshold)
+{
+	const uint32 NumTriangles = InIndexCount / 3;
+	const uint32 VertexCount = static_cast<uint32>(InPositions.size());
+	if (NumTriangles < 2)
+	{
+		return 0;
+	}
+
+	const FVertexCacheStats Original = AnalyzeVertexCache(InOutIndices, InIndexCount, VertexCount);
+	const float TargetACMR = Original.GetACMR() * InThreshold;
+
+	// 1-1. 강한 경계: 세 정점이 모두 미스인 곳 (캐시가 사실상 비워진 곳이라 잘라도 손실 없음)
+	TArray<uint32> HardBoundaries;
+	{
+		FFifoCache Cache(VertexCount, AnalyzeCacheSize);
+		for (uint32 Triangle = 0; Triangle < NumTriangles; ++Triangle)
+		{
+			if (Cache.AddTriangle(InOutIndices + Triangle * 3) == 3)
+			{
+				HardBoundaries.Add(Triangle);
+			}
+		}
+		HardBoundaries.Add(NumTriangles);
+	}
+
+	// 1-2. 약한 경계: 빈 캐시에서 시작한 클러스터의 ACMR이 목표 이하로 내려오면 자름
+	TArray<FOverdrawCluster> Clusters;
+	{
+		FFifoCache Cache(VertexCount, AnalyzeCacheSize);
+		uint32 ClusterStart = 0;
+		uint32 ClusterMisses = 0;
+		int32 NextHard = 0;
+		for (uint32 Triangle = 0; Triangle < NumTriangles; ++Triangle)
+		{
+			ClusterMisses += Cache.AddTriangle(InOutIndices + Triangle * 3);
+			const uint32 ClusterSize = Triangle + 1 - ClusterStart;
+
+			// 마지막 항목이 NumTriangles이므로 마지막 삼각형에서 항상 클러스터가 닫힘
+			while (HardBoundaries[NextHard] <= Triangle)
+			{
+				++NextHard;
+			}
+			const bool bHardBoundary = Triangle + 1 == HardBoundaries[NextHard];
+			const bool bSoftBoundary = static_cast<float>(ClusterMisses) / ClusterSize <= TargetACMR;
+			if (bHardBoundary || bSoftBoundary)
+			{
+				Clusters.Add({ ClusterStart, ClusterSize, 0.0f });
+				ClusterStart = Triangle + 1;
+				ClusterMisses = 0;
+				Cache.Flush();
+			}
+		}
+	}
+	if (Clusters.Num() < 2)
+	{
+		return 0;
+	}
+
+	// 2. 정렬 키: (클러스터 중심 - 메시 중심) · 클러스터 법선. 바깥을 향한 클러스터가 먼저 그려져 안쪽 면을 가린다
+	FVector MeshCentroid(0.0f, 0.0f, 0.0f);
+	float MeshArea = 0.0f;
+	TArray<FVector> ClusterCentroids(Clusters.Num(), FVector(0.0f, 0.0f, 0.0f));
+	TArray<FVector> ClusterNormals(Clusters.Num(), FVector(0.0f, 0.0f, 0.0f));
+	for (int32 ClusterIndex = 0; ClusterIndex < Clusters.Num(); ++ClusterIndex)
+	{
+		const FOverdrawCluster& Cluster = Clusters[ClusterIndex];
+		float ClusterArea = 0.0f;
+		for (uint32 Triangle = Cluster.FirstTriangle; Triangle < Cluster.FirstTriangle + Cluster.NumTriangles; ++Triangle)
+		{
+			const FVector& P0 = InPositions[InOutIndices[Triangle * 3]];
+			const FVector& P1 = InPositions[InOutIndices[Triangle * 3 + 1]];
+			const FVector& P2 = InPositions[InOutIndices[Triangle * 3 + 2]];
+			const FVector Normal = FVector::Cross(P1 - P0, P2 - P0);
+			const float Area = Normal.Size();
+			const FVector Center = (P0 + P1 + P2) * (1.0f / 3.0f);
+
+			ClusterCentroids[ClusterIndex] += Center * Area;
+			ClusterNormals[ClusterIndex] += Normal;
+			ClusterArea += Area;
+		}
+		MeshCentroid += ClusterCentroids[ClusterIndex];
+		MeshArea += ClusterArea;
+		if (ClusterArea > 0.0f)
+		{
+			ClusterCentroids[ClusterIndex] = ClusterCentroids[ClusterIndex] * (1.0f / ClusterArea);
+		}
+	}
+	if (MeshArea > 0.0f)
+	{
+		MeshCentroid = MeshCentroid * (1.0f / MeshArea);
+	}
+	for (int32 ClusterIndex = 0; ClusterIndex < Clusters.Num(); ++ClusterIndex)
+	{
+		const FVector Normal = ClusterNormals[ClusterIndex].GetNormalized();
+		Clusters[ClusterIndex].SortKey = FVector::Dot(ClusterCentroids[ClusterIndex] - MeshCentroid, Normal);
+	}
+	std::stable_sort(Clusters.begin(), Clusters.end(), [](const FOverdrawCluster& A, const FOverdrawCluster& B)
+		{
+			return A.SortKey > B.SortKey;
+		});
+
+	// 3. 재배치 후 캐시 효율이 허용치보다 나빠지면 되돌림
+	TArray<uint32> Reordered;
+	Reordered.reserve(NumTriangles * 3);
+	for (const FOverdrawCluster& Cluster : Clusters)
+	{
+		Reordered.insert(Reordered.end(), InOutIndices + Cluster.FirstTriangle * 3, InOutIndices + (Cluster.FirstTriangle + Cluster.NumTriangles) * 3);
+	}
+	const FVertexCacheStats Sorted = AnalyzeVertexCache(Reordered.data(), NumTriangles * 3, VertexCount);
+	if (Sorted.GetACMR() > TargetACMR)
+	{
+		return 0;
+	}
+
+	std::copy(Reordered.begin(), Reordered.end(), InOutIndices);
+	return static_cast<uint32>(Clusters.Num());
+}
+
+void FMeshOptimizer::BuildVertexFetchRemap(TArray<uint32>& InOutIndices, uint32 InVertexCount, TArray<uint32>& OutOldToNew)
+{
+	OutOldToNew.assign(InVertexCount, InvalidIndex);
+	uint32 NextIndex = 0;
+	for (uint32& Index : InOutIndices)
+	{
+		if (OutOldToNew[Index] == InvalidIndex)
+		{
+			OutOldToNew[Index] = NextIndex++;
+		}
+		Index = OutOldToNew[Index];
+	}
+	for (uint32& NewIndex : OutOldToNew)
+	{
+		if (NewIndex == InvalidIndex)
+		{
+			NewIndex = NextIndex++;
+		}
+	}
+}
+
+void FMeshOptimizer::OptimizeIndices(TArray<uint32>& InOutIndices, const TArray<FGroupInfo>& InGroups, const TArray<FVector>& InPositions,
+	FMeshOptimizeStats& OutStats, TArray<uint32>& OutOldToNew)
+{
+	const uint64 StartCycles = FPlatformTime::Cycles64();
+	const uint32 VertexCount = static_cast<uint32>(InPositions.size());
+	OutStats.Before = AnalyzeVertexCache(InOutIndices.data(), static_cast<uint32>(InOutIndices.size()), VertexCount);
+
+	// 그룹이 없으면 전체를 한 그룹으로
+	TArray<FGroupInfo> Groups = InGroups;
+	if (Groups.IsEmpty())
+	{
+		FGroupInfo Whole;
+		Whole.IndexCount = static_cast<uint32>(InOutIndices.size());
+		Groups.Add(Whole);
+	}
+
+	// 그룹 안에서만 재배치하므로 그룹이 쓰는 정점만 지역 번호로 (그룹이 많아도 전체 정점 수 크기 작업이 반복되지 않게)
+	TArray<uint32> GlobalToLocal(VertexCount, InvalidIndex);
+	TArray<uint32> LocalToGlobal;
+	TArray<uint32> LocalIndices;
+	TArray<FVector> LocalPositions;
+	for (const FGroupInfo& Group : Groups)
+	{
+		if (Group.IndexCount < 6 || Group.IndexCount % 3 != 0 || Group.StartIndex + Group.IndexCount > InOutIndices.size())
+		{
+			continue;
+		}
+
+		uint32* GroupIndices = InOutIndices.data() + Group.StartIndex;
+		LocalToGlobal.clear();
+		LocalIndices.resize(Group.IndexCount);
+		for (uint32 i = 0; i < Group.IndexCount; ++i)
+		{
+			const uint32 Global = GroupIndices[i];
+			if (GlobalToLocal[Global] == InvalidIndex)
+			{
+				GlobalToLocal[Global] = static_cast<uint32>(LocalToGlobal.size());
+				LocalToGlobal.push_back(Global);
+			}
+			LocalIndices[i] = GlobalToLocal[Global];
+		}
+		LocalPositions.resize(LocalToGlobal.size());
+		for (size_t Local = 0; Local < LocalToGlobal.size(); ++Local)
+		{
+			LocalPositions[Local] = InPositions[LocalToGlobal[Local]];
+		}
+
+		OptimizeVertexCache(LocalIndices.data(), Group.IndexCount, static_cast<uint32>(LocalToGlobal.size()));
+		if (const uint32 NumClusters = OptimizeOverdraw(LocalIndices.data(), Group.IndexCount, LocalPositions))
+		{
+			OutStats.NumOverdrawClusters += NumClusters;
+			++OutStats.NumOverdrawGroups;
+		}
+
+		for (uint32 i = 0; i < Group.IndexCount; ++i)
+		{
+			GroupIndices[i] = LocalToGlobal[LocalIndices[i]];
+		}
+		for (uint32 Global : LocalToGlobal)
+		{
+			GlobalToLocal[Global] = InvalidIndex;
+		}
+	}
+
+	BuildVertexFetchRemap(InOutIndices, VertexCount, OutOldToNew);
+
+	OutStats.After = AnalyzeVertexCache(InOutIndices.data(), static_cast<uint32>(InOutIndices.size()), VertexCount);
+	OutStats.OptimizeMS = FPlatformTime::ToMilliseconds(FPlatformTime::Cycles64() - StartCycles);
+}
+
+void FMeshOptimizer::LogStats(const FString& InMeshPath, const FMeshOptimizeStats& InStats)
+{
+	UE_LOG("[MeshOptimizer] %s: %u tris, %u verts, ACMR %.3f -> %.3f, ATVR %.3f -> %.3f, overdraw clusters %u (%u groups), %.2f ms",
+		InMeshPath.c_str(), InStats.After.NumTriangles, InStats.After.NumVertices,
+		InStats.Before.GetACMR(), InStats.After.GetACMR(), InStats.Before.GetATVR(), InStats.After.GetATVR(),
+		InStats.NumOverdrawClusters, InStats.NumOverdrawGroups, InStats.OptimizeMS);
+}
@@ -0,0 +1,91 @@
+﻿#pragma once
+#include "UEContainer.h"
+#include "Vector.h"
+
+struct FGroupInfo;
+
+// FIFO 정점 캐시 시뮬레이션 결과
+struct FVertexCacheStats
+{
+	uint32 NumTriangles = 0;
+	uint32 NumVertices = 0;     // 인덱스가 참조하는 고유 정점 수
+	uint32 NumMisses = 0;
+
+	// Average Cache Miss Ratio: 삼각형당 정점 셰이더 실행 수 (0.5 ~ 3.0, 낮을수록 좋음)
+	float GetACMR() const { return NumTriangles > 0 ? static_cast<float>(NumMisses) / NumTriangles : 0.0f; }
+	// Average Transformed Vertex Ratio: 정점당 실행 수 (1.0이 최적)
+	float GetATVR() const { return NumVertices > 0 ? static_cast<float>(NumMisses) / NumVertices : 0.0f; }
+};
+
+struct FMeshOptimizeStats
+{
+	FVertexCacheStats Before;
+	FVertexCacheStats After;
+	uint32 NumOverdrawClusters = 0;     // 오버드로 정렬에 쓴 클러스터 수 (정렬을 적용한 그룹만)
+	uint32 NumOverdrawGroups = 0;       // 오버드로 정렬을 적용한 그룹 수 (캐시 효율이 임계값 이상 나빠지면 되돌림)
+	double OptimizeMS = 0.0;
+};
+
+/**
+ * 임포트 시 메시 최적화 (캐시 저장 전에 한 번)
+ * 1. 정점 캐시: 머티리얼 그룹별로 Forsyth 알고리즘으로 삼각형 순서 재배치
+ * 2. 오버드로: 캐시 순서를 클러스터로 나눠 바깥을 향한 클러스터부터 그리도록 정렬 (Sander et al. Tipsify 방식)
+ * 3. 정점 페치: 인덱스가 처음 참조하는 순서로 정점 배열 재배치
+ * 그룹의 StartIndex/IndexCount와 삼각형 집합(감기 방향 포함)은 그대로 유지된다
+ */
+class FMeshOptimizer
+{
+public:
+	// ACMR/ATVR 측정에 쓰는 FIFO 캐시 크기 (post-transform 캐시 근사)
+	static constexpr uint32 AnalyzeCacheSize = 16;
+	// 오버드로 정렬 후 ACMR이 이 배수까지 나빠지는 것은 허용
+	static constexpr float OverdrawThreshold = 1.05f;
+
+	static FVertexCacheStats AnalyzeVertexCache(const uint32* InIndices, uint32 InIndexCount, uint32 InVertexCount, uint32 InCacheSize = AnalyzeCacheSize);
+
+	// [InIndices, InIndices + InIndexCount) 삼각형 순서를 정점 캐시 친화적으로 재배치
+	static void OptimizeVertexCache(uint32* InOutIndices, uint32 InIndexCount, uint32 InVertexCount);
+
+	// 캐시 최적화된 순서를 클러스터 단위로 오버드로가 줄도록 재정렬. 적용했으면 클러스터 수, 되돌렸으면 0
+	static uint32 OptimizeOverdraw(uint32* InOutIndices, uint32 InIndexCount, const TArray<FVector>& InPositions, float InThreshold = OverdrawThreshold);
+
+	// 처음 참조 순서대로의 정점 번호 (OutOldToNew[이전] = 새 번호). 참조되지 않는 정점은 뒤에. 인덱스도 새 번호로 바꿈
+	static void BuildVertexFetchRemap(TArray<uint32>& InOutIndices, uint32 InVertexCount, TArray<uint32>& OutOldToNew);
+
+	/**
+	 * 세 단계를 모두 적용 (FNormalVertex, FSkinnedVertex 공용)
+	 * @param InPositionMember 정점 구조체의 위치 멤버 (예: &FNormalVertex::pos)
+	 */
+	template <typename TVertex>
+	static FMeshOptimizeStats OptimizeMesh(TArray<TVertex>& InOutVertices, TArray<uint32>& InOutIndices, const TArray<FGroupInfo>& InGroups, FVector TVertex::* InPositionMember)
+	{
+		TArray<FVector> Positions;
+		Positions.resize(InOutVertices.size());
+		for (size_t i = 0; i < InOutVertices.size(); ++i)
+		{
+			Positions[i] = InOutVertices[i].*InPositionMember;
+		}
+
+		FMeshOptimizeStats Stats;
+		TArray<uint32> OldToNew;
+		OptimizeIndices(InOutIndices, InGroups, Positions, Stats, OldToNew);
+
+		TArray<TVertex> Reordered;
+		Reordered.resize(InOutVertices.size());
+		for (size_t i = 0; i < InOutVertices.size(); ++i)
+		{
+			Reordered[OldToNew[i]] = std::move(InOutVertices[i]);
+		}
+		InOutVertices = std::move(Reordered);
+		return Stats;
+	}
+
+	static void LogStats(const FString& InMeshPath, const FMeshOptimizeStats& InStats);
+
+private:
+	FMeshOptimizer() = delete;
+
+	// 인덱스만 다루는 본체 (캐시/오버드로는 그룹별, 페치 재배치는 메시 전체)
+	static void OptimizeIndices(TArray<uint32>& InOutIndices, const TArray<FGroupInfo>& InGroups, const TArray<FVector>& InPositions,
+		FMeshOptimizeStats& OutStats, TArray<uint32>& OutOldToNew);
+};
@@ -0,0 +1,444 @@
+﻿#include "pch.h"
+#include "MeshSimplifier.h"
+#include "MeshOptimizer.h"
+#include "VertexData.h"
+#include "PlatformTime.h"
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+
+namespace
+{
+	constexpr uint32 InvalidIndex = 0xFFFFFFFFu;
+
+	// 이 각도 이상 노멀이 다른 이웃으로는 붕괴하지 않음 (cos 60°)
+	constexpr float MinNormalDot = 0.5f;
+
+	// 대칭 4x4 행렬 (평면 거리 제곱의 합). 가중치로 나눈 값이 평균 거리 제곱
+	struct FQuadric
+	{
+		double A00 = 0, A01 = 0, A02 = 0, A11 = 0, A12 = 0, A22 = 0;
+		double B0 = 0, B1 = 0, B2 = 0;
+		double C = 0;
+		double Weight = 0;
+
+		static FQuadric FromPlane(const FVector& InNormal, float InDistance, float InWeight)
+		{
+			FQuadric Q;
+			const double X = InNormal.X, Y = InNormal.Y, Z = InNormal.Z, D = InDistance, W = InWeight;
+			Q.A00 = W * X * X; Q.A01 = W * X * Y; Q.A02 = W * X * Z;
+			Q.A11 = W * Y * Y; Q.A12 = W * Y * Z; Q.A22 = W * Z * Z;
+			Q.B0 = W * X * D; Q.B1 = W * Y * D; Q.B2 = W * Z * D;
+			Q.C = W * D * D;
+			Q.Weight = W;
+			return Q;
+		}
+
+		FQuadric& operator+=(const FQuadric& Other)
+		{
+			A00 += Other.A00; A01 += Other.A01; A02 += Other.A02;
+			A11 += Other.A11; A12 += Other.A12; A22 += Other.A22;
+			B0 += Other.B0; B1 += Other.B1; B2 += Other.B2;
+			C += Other.C;
+			Weight += Other.Weight;
+			return *this;
+		}
+
+		// p^T A p + 2 B·p + C (거리 제곱 × 가중치)
+		double Evaluate(const FVector& P) const
+		{
+			const double X = P.X, Y = P.Y, Z = P.Z;
+			const double Result = A00 * X * X + A11 * Y * Y + A22 * Z * Z
+				+ 2.0 * (A01 * X * Y + A02 * X * Z + A12 * Y * Z)
+				+ 2.0 * (B0 * X + B1 * Y + B2 * Z) + C;
+			return std::max(Result, 0.0);
+		}
+	};
+
+	double EvaluateCollapse(const FQuadric& InV, const FQuadric& InU, const FVector& InTarget)
+	{
+		FQuadric Combined = InV;
+		Combined += InU;
+		return Combined.Weight > 0.0 ? Combined.Evaluate(InTarget) / Combined.Weight : 0.0;
+	}
+
+	struct FCollapse
+	{
+		uint32 From;
+		uint32 To;
+		float Cost;     // 거리 제곱
+	};
+
+	bool IsSamePosition(const FVector& A, const FVector& B)
+	{
+		return std::memcmp(&A, &B, sizeof(FVector)) == 0;
+	}
+}
+
+void FMeshSimplifier::Simplify(const TArray<FVector>& InPositions, const TArray<FVector>& InNormals, const TArray<uint32>& InIndices,
+	const TArray<uint32>& InTriangleGroups, uint32 InTargetTriangles, float InMaxError, FSimplifyResult& OutResult)
+{
+	const uint32 VertexCount = static_cast<uint32>(InPositions.size());
+	OutResult.Indices = InIndices;
+	OutResult.TriangleGroups = InTriangleGroups;
+	OutResult.Error = 0.0f;
+	OutResult.NumPasses = 0;
+
+	TArray<uint32>& Indices = OutResult.Indices;
+	TArray<uint32>& TriangleGroups = OutResult.TriangleGroups;
+	if (Indices.size() / 3 <= InTargetTriangles || VertexCount == 0)
+	{
+		return;
+	}
+
+	// 1. 같은 위치의 정점 묶기 (대표 = 묶음의 첫 정점). 묶음에 둘 이상이면 UV/노멀 이음새
+	TArray<uint32> Representative(VertexCount);
+	TArray<uint8> bLocked(VertexCount, 0);
+	{
+		TArray<uint32> Sorted(VertexCount);
+		for (uint32 i = 0; i < VertexCount; ++i)
+		{
+			Sorted[i] = i;
+		}
+		std::sort(Sorted.begin(), Sorted.end(), [&](uint32 A, uint32 B)
+			{
+				const int32 Compare = std::memcmp(&InPositions[A], &InPositions[B], sizeof(FVector));
+				return Compare != 0 ? Compare < 0 : A < B;
+			});
+		for (uint32 Begin = 0; Begin < VertexCount;)
+		{
+			uint32 End = Begin + 1;
+			while (End < VertexCount && IsSamePosition(InPositions[Sorted[Begin]], InPositions[Sorted[End]]))
+			{
+				++End;
+			}
+			for (uint32 i = Begin; i < End; ++i)
+			{
+				Representative[Sorted[i]] = Sorted[Begin];
+				bLocked[Sorted[i]] = End - Begin > 1 ? 1 : 0;
+			}
+			Begin = End;
+		}
+	}
+
+	// 2. 위치 기준 열린 경계/비다양체 간선, 그룹 경계 정점 고정
+	{
+		TArray<uint64> EdgeKeys;
+		EdgeKeys.reserve(Indices.size());
+		TArray<uint32> VertexGroup(VertexCount, InvalidIndex);
+		for (size_t i = 0; i < Indices.size(); i += 3)
+		{
+			const uint32 Group = TriangleGroups[i / 3];
+			for (int32 Corner = 0; Corner < 3; ++Corner)
+			{
+				const uint32 A = Representative[Indices[i + Corner]];
+				const uint32 B = Representative[Indices[i + (Corner + 1) % 3]];
+				EdgeKeys.push_back((static_cast<uint64>(std::min(A, B)) << 32) | std::max(A, B));
+
+				if (VertexGroup[A] == InvalidIndex)
+				{
+					VertexGroup[A] = Group;
+				}
+				else if (VertexGroup[A] != Group)
+				{
+					bLocked[A] = 1;
+				}
+			}
+		}
+		std::sort(EdgeKeys.begin(), EdgeKeys.end());
+		for (size_t Begin = 0; Begin < EdgeKeys.size();)
+		{
+			size_t End = Begin + 1;
+			while (End < EdgeKeys.size() && EdgeKeys[End] == EdgeKeys[Begin])
+			{
+				++End;
+			}
+			if (End - Begin != 2)
+			{
+				bLocked[static_cast<uint32>(EdgeKeys[Begin] >> 32)] = 1;
+				bLocked[static_cast<uint32>(EdgeKeys[Begin] & 0xFFFFFFFFu)] = 1;
+			}
+			Begin = End;
+		}
+		// 대표가 고정이면 묶음 전체 고정
+		for (uint32 Vertex = 0; Vertex < VertexCount; ++Vertex)
+		{
+			bLocked[Vertex] |= bLocked[Representative[Vertex]];
+		}
+	}
+
+	// 3. 정점별 이차 오차 (삼각형 평면, 면적 가중)
+	TArray<FQuadric> Quadrics(VertexCount);
+	for (size_t i = 0; i < Indices.size(); i += 3)
+	{
+		const FVector& P0 = InPositions[Indices[i]];
+		const FVector Cross = FVector::Cross(InPositions[Indices[i + 1]] - P0, InPositions[Indices[i + 2]] - P0);
+		const float Area = Cross.Size();
+		if (Area <= 0.0f)
+		{
+			continue;
+		}
+		const FVector Normal = Cross * (1.0f / Area);
+		const FQuadric Plane = FQuadric::FromPlane(Normal, -FVector::Dot(Normal, P0), Area * 0.5f);
+		for (int32 Corner = 0; Corner < 3; ++Corner)
+		{
+			Quadrics[Indices[i + Corner]] += Plane;
+		}
+	}
+
+	const float MaxErrorSquared = InMaxError * InMaxError;
+	TArray<uint32> AdjacencyStart;
+	TArray<uint32> Adjacency;
+	TArray<FCollapse> Collapses;
+	TArray<uint8> bChanged(VertexCount);
+	TArray<uint32> Remap(VertexCount);
+
+	// 4. 패스마다: 후보 간선을 비용 순으로 정렬 → 서로 겹치지 않는 붕괴를 적용 → 인덱스 갱신
+	while (Indices.size() / 3 > InTargetTriangles)
+	{
+		const uint32 NumTriangles = static_cast<uint32>(Indices.size() / 3);
+
+		AdjacencyStart.assign(VertexCount + 1, 0);
+		for (uint32 Index : Indices)
+		{
+			++AdjacencyStart[Index + 1];
+		}
+		for (uint32 Vertex = 0; Vertex < VertexCount; ++Vertex)
+		{
+			AdjacencyStart[Vertex + 1] += AdjacencyStart[Vertex];
+		}
+		Adjacency.resize(Indices.size());
+		{
+			TArray<uint32> Fill(AdjacencyStart.begin(), AdjacencyStart.end() - 1);
+			for (uint32 i = 0; i < Indices.size(); ++i)
+			{
+				Adjacency[Fill[Indices[i]]++] = i / 3;
+			}
+		}
+
+		Collapses.clear();
+		for (uint32 i = 0; i < Indices.size(); ++i)
+		{
+			const uint32 From = Indices[i];
+			const uint32 To = Indices[i - i % 3 + (i + 1) % 3];
+			for (const auto& [V, U] : { std::pair<uint32, uint32>{ From, To }, std::pair<uint32, uint32>{ To, From } })
+			{
+				if (bLocked[V] || V == U)
+				{
+					continue;
+				}
+				if (!InNormals.empty() && FVector::Dot(InNormals[V], InNormals[U]) < MinNormalDot)
+				{
+					continue;
+				}
+				const float Cost = static_cast<float>(EvaluateCollapse(Quadrics[V], Quadrics[U], InPositions[U]));
+				if (Cost <= MaxErrorSquared)
+				{
+					Collapses.push_back({ V, U, Cost });
+				}
+			}
+		}
+		if (Collapses.empty())
+		{
+			break;
+		}
+		std::sort(Collapses.begin(), Collapses.end(), [](const FCollapse& A, const FCollapse& B) { return A.Cost < B.Cost; });
+
+		std::fill(bChanged.begin(), bChanged.end(), 0);
+		for (uint32 Vertex = 0; Vertex < VertexCount; ++Vertex)
+		{
+			Remap[Vertex] = Vertex;
+		}
+
+		// 붕괴 하나가 대략 삼각형 두 개를 없앰
+		const uint32 CollapseBudget = (NumTriangles - InTargetTriangles) / 2 + 1;
+		uint32 NumCollapsed = 0;
+		for (const FCollapse& Collapse : Collapses)
+		{
+			const uint32 V = Collapse.From;
+			const uint32 U = Collapse.To;
+			if (bChanged[V] || bChanged[U])
+			{
+				continue;
+			}
+
+			// 삼각형 뒤집힘 검사 (v를 u 위치로 옮겼을 때, u를 포함하지 않는 v의 삼각형)
+			bool bFlips = false;
+			for (uint32 j = AdjacencyStart[V]; j < AdjacencyStart[V + 1] && !bFlips; ++j)
+			{
+				const uint32* Corners = &Indices[Adjacency[j] * 3];
+				if (Corners[0] == U || Corners[1] == U || Corners[2] == U)
+				{
+					continue;
+				}
+				FVector Before[3], After[3];
+				for (int32 Corner = 0; Corner < 3; ++Corner)
+				{
+					Before[Corner] = InPositions[Corners[Corner]];
+					After[Corner] = Corners[Corner] == V ? InPositions[U] : Before[Corner];
+				}
+				const FVector NormalBefore = FVector::Cross(Before[1] - Before[0], Before[2] - Before[0]);
+				const FVector NormalAfter = FVector::Cross(After[1] - After[0], After[2] - After[0]);
+				bFlips = FVector::Dot(NormalBefore, NormalAfter) <= 0.0f;
+			}
+			if (bFlips)
+			{
+				continue;
+			}
+
+			// v의 1-링 전체를 이번 패스에서 잠금 (뒤집힘 검사가 본 위치가 바뀌지 않도록)
+			for (uint32 j = AdjacencyStart[V]; j < AdjacencyStart[V + 1]; ++j)
+			{
+				const uint32* Corners = &Indices[Adjacency[j] * 3];
+				bChanged[Corners[0]] = bChanged[Corners[1]] = bChanged[Corners[2]] = 1;
+			}
+			Remap[V] = U;
+			Quadrics[U] += Quadrics[V];
+			OutResult.Error = std::max(OutResult.Error, std::sqrt(Collapse.Cost));
+
+			if (++NumCollapsed >= CollapseBudget)
+			{
+				break;
+			}
+		}
+		++OutResult.NumPasses;
+		if (NumCollapsed == 0)
+		{
+			break;
+		}
+
+		// 인덱스 갱신 + 퇴화 삼각형 제거 (남은 삼각형 순서와 그룹 번호는 유지)
+		size_t Write = 0;
+		for (size_t i = 0; i < Indices.size(); i += 3)
+		{
+			const uint32 A = Remap[Indices[i]];
+			const uint32 B = Remap[Indices[i + 1]];
+			const uint32 C = Remap[Indices[i + 2]];
+			if (A == B || B == C || A == C)
+			{
+				continue;
+			}
+			TriangleGroups[Write / 3] = TriangleGroups[i / 3];
+			Indices[Write++] = A;
+			Indices[Write++] = B;
+			Indices[Write++] = C;
+		}
+		Indices.resize(Write);
+		TriangleGroups.resize(Write / 3);
+	}
+}
+
+float FMeshSimplifier::ComputeLODScreenSize(float InRelativeError)
+{
+	// 화면 크기 s(경계 구 지름 / 화면 높이)에서 오차의 픽셀 크기 = (오차 / 지름) * s * 화면 높이
+	if (InRelativeError <= 0.0f)
+	{
+		return 1.0f;
+	}
+	return std::min(1.0f, 2.0f * PixelErrorTolerance / (ReferenceScreenHeight * InRelativeError));
+}
+
+void FMeshSimplifier::BuildStaticMeshLODs(FStaticMesh& InOutMesh, TArray<FStaticMeshLODStats>* OutStats)
+{
+	InOutMesh.LODs.clear();
+	const uint32 NumTriangles = static_cast<uint32>(InOutMesh.Indices.size() / 3);
+	if (NumTriangles < MinTrianglesForLOD || InOutMesh.Vertices.empty())
+	{
+		return;
+	}
+
+	TArray<FVector> Positions(InOutMesh.Vertices.size());
+	TArray<FVector> Normals(InOutMesh.Vertices.size());
+	FVector Min = InOutMesh.Vertices[0].pos;
+	FVector Max = InOutMesh.Vertices[0].pos;
+	for (size_t i = 0; i < InOutMesh.Vertices.size(); ++i)
+	{
+		Positions[i] = InOutMesh.Vertices[i].pos;
+		Normals[i] = InOutMesh.Vertices[i].normal;
+		Min = Min.ComponentMin(Positions[i]);
+		Max = Max.ComponentMax(Positions[i]);
+	}
+	const float Radius = (Max - Min).Size() * 0.5f;
+	if (Radius <= 0.0f)
+	{
+		return;
+	}
+
+	// 그룹이 없으면 전체가 그룹 0
+	const TArray<FGroupInfo>& Groups = InOutMesh.GroupInfos;
+	TArray<uint32> TriangleGroups(NumTriangles, 0);
+	for (uint32 GroupIndex = 0; GroupIndex < Groups.size(); ++GroupIndex)
+	{
+		const uint32 First = Groups[GroupIndex].StartIndex / 3;
+		const uint32 Last = std::min(NumTriangles, (Groups[GroupIndex].StartIndex + Groups[GroupIndex].IndexCount) / 3);
+		for (uint32 Triangle = First; Triangle < Last; ++Triangle)
+		{
+			TriangleGroups[Triangle] = GroupIndex;
+		}
+	}
+	const uint32 NumGroups = std::max<uint32>(1, static_cast<uint32>(Groups.size()));
+
+	uint32 PreviousTriangles = NumTriangles;
+	float PreviousScreenSize = 1.0f;
+	for (int32 LODIndex = 1; LODIndex <= MaxGeneratedLODs; ++LODIndex)
+	{
+		const uint64 StartCycles = FPlatformTime::Cycles64();
+
+		FSimplifyResult Result;
+		const uint32 Target = NumTriangles >> LODIndex;
+		Simplify(Positions, Normals, InOutMesh.Indices, TriangleGroups, Target, Radius * MaxRelativeError, Result);
+
+		const uint32 ResultTriangles = static_cast<uint32>(Result.Indices.size() / 3);
+		// 이전 LOD보다 10% 이상 줄지 않으면 더 만들 의미가 없음 (이음새/경계 고정, 오차 한도)
+		if (ResultTriangles == 0 || ResultTriangles > PreviousTriangles * 9 / 10)
+		{
+			break;
+		}
+
+		// 그룹 순서로 모아 LOD0과 같은 그룹 배열 구성 + 그룹별 정점 캐시 최적화
+		FStaticMeshLOD LOD;
+		LOD.GroupInfos.resize(NumGroups);
+		LOD.Indices.reserve(Result.Indices.size());
+		for (uint32 GroupIndex = 0; GroupIndex < NumGroups; ++GroupIndex)
+		{
+			FGroupInfo& Group = LOD.GroupInfos[GroupIndex];
+			if (GroupIndex < Groups.size())
+			{
+				Group.InitialMaterialName = Groups[GroupIndex].InitialMaterialName;
+			}
+			Group.StartIndex = static_cast<uint32>(LOD.Indices.size());
+			for (uint32 Triangle = 0; Triangle < ResultTriangles; ++Triangle)
+			{
+				if (Result.TriangleGroups[Triangle] == GroupIndex)
+				{
+					LOD.Indices.insert(LOD.Indices.end(), Result.Indices.begin() + Triangle * 3, Result.Indices.begin() + Triangle * 3 + 3);
+				}
+			}
+			Group.IndexCount = static_cast<uint32>(LOD.Indices.size()) - Group.StartIndex;
+			FMeshOptimizer::OptimizeVertexCache(LOD.Indices.data() + Group.StartIndex, Group.IndexCount, static_cast<uint32>(Positions.size()));
+		}
+
+		LOD.Error = Result.Error / Radius;
+		LOD.ScreenSize = std::min(PreviousScreenSize, ComputeLODScreenSize(LOD.Error));
+
+		if (OutStats)
+		{
+			FStaticMeshLODStats Stats;
+			Stats.NumTriangles = ResultTriangles;
+			Stats.Error = LOD.Error;
+			Stats.ScreenSize = LOD.ScreenSize;
+			Stats.BuildMS = FPlatformTime::ToMilliseconds(FPlatformTime::Cycles64() - StartCycles);
+			OutStats->Add(Stats);
+		}
+
+		PreviousTriangles = ResultTriangles;
+		PreviousScreenSize = LOD.ScreenSize;
+		InOutMesh.LODs.push_back(std::move(LOD));
+
+		// 오차 한도에 막혀 목표까지 못 줄였으면 다음 LOD도 같은 결과
+		if (ResultTriangles > Target * 11 / 10)
+		{
+			break;
+		}
+	}
+}
@@ -0,0 +1,62 @@
+﻿#pragma once
+#include "UEContainer.h"
+#include "Vector.h"
+
+struct FStaticMesh;
+
+struct FSimplifyResult
+{
+	TArray<uint32> Indices;
+	TArray<uint32> TriangleGroups;  // 삼각형별 그룹 번호 (입력 순서 유지)
+	float Error = 0.0f;             // 받아들인 붕괴 중 최대 오차 (거리 단위)
+	uint32 NumPasses = 0;
+};
+
+struct FStaticMeshLODStats
+{
+	uint32 NumTriangles = 0;
+	float Error = 0.0f;             // 메시 경계 구 반지름 대비
+	float ScreenSize = 0.0f;
+	double BuildMS = 0.0;
+};
+
+/**
+ * 이차 오차(QEM) 기반 간선 붕괴 메시 단순화 (Garland & Heckbert)
+ * - 정점 v를 이웃 u로 옮기는 half-edge collapse만 사용하므로 결과 인덱스는 원본 정점 배열을 그대로 참조한다 (LOD끼리 정점 버퍼 공유)
+ * - UV/노멀 이음새(같은 위치의 정점이 여럿), 열린 경계, 머티리얼 그룹 경계에 있는 정점은 움직이지 않음
+ * - 노멀이 크게 다른 이웃으로의 붕괴와 삼각형이 뒤집히는 붕괴는 거부
+ */
+class FMeshSimplifier
+{
+public:
+	// 생성할 최대 LOD 수 (LOD0 제외)
+	static constexpr int32 MaxGeneratedLODs = 3;
+	// 이보다 삼각형이 적은 메시는 LOD를 만들지 않음
+	static constexpr uint32 MinTrianglesForLOD = 256;
+	// 허용 오차 (메시 경계 구 반지름 대비)
+	static constexpr float MaxRelativeError = 0.05f;
+	// LOD 전환 화면 크기 계산 기준: 세로 1080 화면에서 오차가 이 픽셀 수를 넘지 않도록
+	static constexpr float ReferenceScreenHeight = 1080.0f;
+	static constexpr float PixelErrorTolerance = 1.0f;
+
+	/**
+	 * @param InNormals 정점 노멀 (비어 있으면 노멀 검사 생략)
+	 * @param InTriangleGroups 삼각형별 그룹 번호 (경계 정점 고정용)
+	 * @param InTargetTriangles 목표 삼각형 수 (오차 한도에 먼저 닿으면 더 많이 남음)
+	 * @param InMaxError 허용 오차 (거리 단위)
+	 */
+	static void Simplify(const TArray<FVector>& InPositions, const TArray<FVector>& InNormals, const TArray<uint32>& InIndices,
+		const TArray<uint32>& InTriangleGroups, uint32 InTargetTriangles, float InMaxError, FSimplifyResult& OutResult);
+
+	/**
+	 * LOD0(InOutMesh의 Indices/GroupInfos)에서 LOD1..N을 만들어 InOutMesh.LODs에 저장.
+	 * 삼각형 수를 절반씩 줄이고, 줄어든 양이 작거나 오차 한도에 닿으면 중단
+	 */
+	static void BuildStaticMeshLODs(FStaticMesh& InOutMesh, TArray<FStaticMeshLODStats>* OutStats = nullptr);
+
+	// 메시 경계 구 반지름 대비 오차로 LOD를 쓸 수 있는 최대 화면 크기 (경계 구 지름 / 화면 높이)
+	static float ComputeLODScreenSize(float InRelativeError);
+
+private:
+	FMeshSimplifier() = delete;
+};
@@ -3,6 +3,13 @@
 #include <filesystem>
 #include "Object.h"
 
+// GPU 업로드 후 메시의 CPU 사본을 얼마나 남길지 (editor.ini MeshCPUResidency)
+enum class EMeshCPUResidency : uint8
+{
+	Full,           // 임포트 데이터 전체 (정점/인덱스/LOD 인덱스)
+	CollisionOnly,  // 바운드 + 피킹/BVH/오클루더용 위치·인덱스 스트림만. 전체 데이터는 필요할 때 바이너리 캐시에서 다시 읽음
+};
+
 class UResourceBase : public UObject
 {
 public:
@@ -18,7 +25,45 @@ public:
 	std::filesystem::file_time_type GetLastModifiedTime() const { return LastModifiedTime; }
 	void SetLastModifiedTime(std::filesystem::file_time_type InTime) { LastModifiedTime = InTime; }
 
+	// --- 상주(Residency) 관리 (FResourceResidency) ---
+	// 축출은 데이터만 해제하고 UObject 셸은 남기므로 들고 있는 포인터는 계속 유효 (다음 Load/Get에서 다시 로드)
+	bool IsResident() const { return bResident; }
+	bool IsStreamable() const { return bStreamable; }
+	uint64 GetLastUsedFrame() const { return LastUsedFrame; }
+
+	// 컴포넌트가 아닌 곳에서 GPU 핸들을 오래 들고 있을 때 (썸네일 캐시 등) 축출 방지용 고정 참조
+	void AddResidencyRef() { ++ResidencyPinCount; }
+	void ReleaseResidencyRef() { if (ResidencyPinCount > 0) { --ResidencyPinCount; } }
+
+	// 컴포넌트 참조 수(마지막 스윕 기준) + 고정 참조 수
+	uint32 GetRefCount() const { return ComponentRefCount + ResidencyPinCount; }
+	uint32 GetComponentRefCount() const { return ComponentRefCount; }
+
+	// 축출 가능한 타입만 재정의 (파일에서 다시 만들 수 있는 텍스처/메시)
+	virtual bool SupportsEviction() const { return false; }
+	virtual void EvictResidentData() {}
+	virtual bool ReloadResidentData(ID3D11Device* InDevice) { return true; }
+
+	// 현재 들고 있는 데이터 크기 (축출되면 0)
+	virtual uint64 GetCPUMemoryBytes() const { return 0; }
+	virtual uint64 GetGPUMemoryBytes() const { return 0; }
+
+	// 새로 로드되는 메시의 기본 CPU 상주 정책 (메시별로 SetCPUResidency로 바꿀 수 있음)
+	static void SetDefaultMeshCPUResidency(EMeshCPUResidency InResidency) { DefaultMeshCPUResidency = InResidency; }
+	static EMeshCPUResidency GetDefaultMeshCPUResidency() { return DefaultMeshCPUResidency; }
+
 protected:
 	FString FilePath;	// 원본 파일의 경로이자, UResourceManager에 등록된 Key 
 	std::filesystem::file_time_type LastModifiedTime;
+
+private:
+	friend class FResourceResidency;
+
+	bool bResident = true;
+	bool bStreamable = false;       // 월드 컴포넌트가 한 번이라도 참조한 리소스만 축출 대상 (UI 아이콘 등은 제외)
+	uint64 LastUsedFrame = 0;
+	uint32 ComponentRefCount = 0;
+	uint32 ResidencyPinCount = 0;
+
+	static inline EMeshCPUResidency DefaultMeshCPUResidency = EMeshCPUResidency::CollisionOnly;
 };
\ No newline at end of file
@@ -6,6 +6,7 @@
 #include "ObjManager.h"
 #include "Quad.h"
 #include "MeshBVH.h"
+#include "PathUtils.h"
 #include "Enums.h"
 
 #include <filesystem>
@@ -49,11 +50,15 @@ void UResourceManager::Initialize(ID3D11Device* InDevice, ID3D11DeviceContext* I
     CreateTextBillboardTexture();
     CreateDefaultShader();
     CreateDefaultMaterial();
+    CreateDefaultTexture();
 }
 
 // 전체 해제
 void UResourceManager::Clear()
 {
+    // 워커가 아직 들고 있는 로드 결과부터 정리 (콜백은 호출하지 않음)
+    AsyncLoader.CancelAll();
+
     {////////////// Deprecated //////////////
         for (auto& [Key, Data] : ResourceMap)
         {
@@ -130,20 +135,81 @@ FMeshBVH* UResourceManager::GetMeshBVH(const FString& ObjPath)
     return nullptr;
 }
 
-FMeshBVH* UResourceManager::GetOrBuildMeshBVH(const FString& ObjPath, const FStaticMesh* StaticMeshAsset)
+FMeshBVH* UResourceManager::GetOrBuildMeshBVH(const FString& ObjPath, const TArray<FVector>& Positions, const TArray<uint32>& Indices)
 {
     if (auto* Found = MeshBVHCache.Find(ObjPath))
         return *Found;
 
-    if (!StaticMeshAsset)
+    if (Positions.IsEmpty() || Indices.IsEmpty())
         return nullptr;
 
     FMeshBVH* NewBVH = new FMeshBVH();
-    NewBVH->Build(StaticMeshAsset->Vertices, StaticMeshAsset->Indices);
+    NewBVH->Build(Positions, Indices);
     MeshBVHCache.Add(ObjPath, NewBVH);
     return NewBVH;
 }
 
+uint64 UResourceManager::ReleaseMeshBVH(const FString& ObjPath)
+{
+    FMeshBVH** Found = MeshBVHCache.Find(ObjPath);
+    if (!Found)
+    {
+        return 0;
+    }
+
+    const uint64 Bytes = (*Found)->GetMemoryBytes();
+    delete *Found;
+    MeshBVHCache.Remove(ObjPath);
+    return Bytes;
+}
+
+void UResourceManager::ReleaseDeprecatedData(const FString& FilePath)
+{
+    if (FResourceData** Found = ResourceMap.Find(FilePath))
+    {
+        if (FResourceData* Data = *Found)
+        {
+            if (Data->VertexBuffer) { Data->VertexBuffer->Release(); }
+            if (Data->IndexBuffer) { Data->IndexBuffer->Release(); }
+            delete Data;
+        }
+        ResourceMap.Remove(FilePath);
+    }
+
+    const FWideString WidePath = UTF8ToWide(FilePath);
+    if (FTextureData** Found = TextureMap.Find(WidePath))
+    {
+        if (FTextureData* Data = *Found)
+        {
+            if (Data->Texture) { Data->Texture->Release(); }
+            if (Data->TextureSRV) { Data->TextureSRV->Release(); }
+            if (Data->BlendState) { Data->BlendState->Release(); }
+            delete Data;
+        }
+        TextureMap.Remove(WidePath);
+    }
+}
+
+uint64 UResourceManager::GetMeshBVHMemoryBytes() const
+{
+    uint64 Bytes = 0;
+    for (const auto& Pair : MeshBVHCache)
+    {
+        Bytes += Pair.second->GetMemoryBytes();
+    }
+    return Bytes;
+}
+
+void UResourceManager::LogResidencyReport(int32 InTopN)
+{
+    // 보고서는 최신 참조 수 기준 (예산 안이면 축출은 일어나지 않음)
+    Residency.Sweep(Resources);
+    Residency.LogReport(Resources, InTopN);
+
+    UE_LOG("[Residency] Mesh BVH cache: %d entries, %.2f MB. Deprecated maps: ResourceMap %d, TextureMap %d, MaterialMap %d",
+        MeshBVHCache.Num(), GetMeshBVHMemoryBytes() / (1024.0 * 1024.0), ResourceMap.Num(), TextureMap.Num(), MaterialMap.Num());
+}
+
 void UResourceManager::SetStaticMeshs()
 {
     StaticMeshs = GetAll<UStaticMesh>();
@@ -167,8 +233,8 @@ void UResourceManager::SetAudioFiles()
 
 void UResourceManager::CreateAxisMesh(float Length, const FString& FilePath)
 {
-    // 이미 있으면 패스
-    if (ResourceMap[FilePath])
+    // 이미 있으면 패스 (operator[]는 빈 항목을 끼워 넣으므로 Find로 조회)
+    if (ResourceMap.Find(FilePath))
     {
         return;
     }
@@ -289,7 +355,7 @@ void UResourceManager::CreateBillboardMesh()
 
 void UResourceManager::CreateGridMesh(int N, const FString& FilePath)
 {
-    if (ResourceMap[FilePath])
+    if (ResourceMap.Find(FilePath))
     {
         return;
     }
@@ -376,7 +442,7 @@ void UResourceManager::CreateGridMesh(int N, const FString& FilePath)
 void UResourceManager::CreateBoxWireframeMesh(const FVector& Min, const FVector& Max, const FString& FilePath)
 {
     // 이미 있으면 패스
-    if (ResourceMap[FilePath])
+    if (ResourceMap.Find(FilePath))
     {
         return;
     }
@@ -461,6 +527,26 @@ void UResourceManager::CreateDefaultMaterial()
     Add<UMaterial>(NewName, DefaultMaterialInstance);
 }
 
+void UResourceManager::CreateDefaultTexture()
+{
+    // 비동기 텍스처 로드가 끝나기 전까지 쓰는 흰색 1x1 텍스처
+    DefaultTextureInstance = NewObject<UTexture>();
+    DefaultTextureInstance->CreateSolidColor(Device, 0xFFFFFFFF);
+    Add<UTexture>("DefaultTexture", DefaultTextureInstance);
+}
+
+UResourceBase* UResourceManager::Find(EResourceType InType, const FString& InFilePath)
+{
+    const uint8 TypeIndex = static_cast<uint8>(InType);
+    if (TypeIndex >= Resources.size())
+    {
+        return nullptr;
+    }
+
+    UResourceBase** Found = Resources[TypeIndex].Find(NormalizePath(InFilePath));
+    return Found ? *Found : nullptr;
+}
+
 void UResourceManager::InitShaderILMap()
 {
     TArray<D3D11_INPUT_ELEMENT_DESC> layout;
@@ -486,6 +572,10 @@ void UResourceManager::InitShaderILMap()
 	ShaderToInputLayoutMap["Shaders/Materials/UberLit.hlsl"] = layout;
 	ShaderToInputLayoutMap["Shaders/Materials/Fireball.hlsl"] = layout; // Use same vertex format as UberLit
 	ShaderToInputLayoutMap["Shaders/Shadow/PointLightShadow.hlsl"] = layout;  // Shadow map rendering uses same vertex format
+    layout.clear();
+
+    // 그림자 패스는 모든 배치에 이 레이아웃을 쓰므로 위치만 읽음 (위치가 맨 앞인 FVertexDynamic/FSkinnedVertex/압축 정점 모두 호환)
+    layout.Add({ "POSITION", 0, DXGI_FORMAT_R32G32B32_FLOAT, 0, 0, D3D11_INPUT_PER_VERTEX_DATA, 0 });
 	ShaderToInputLayoutMap["Shaders/Shadows/DepthOnly_VS.hlsl"] = layout;
     layout.clear();
 
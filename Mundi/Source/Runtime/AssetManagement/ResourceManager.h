@@ -12,6 +12,9 @@
 #include "LineDynamicMesh.h"
 #include "SkeletalMesh.h"
 #include "AnimSequence.h"
+#include "TaskScheduler.h"
+#include "AsyncResourceLoader.h"
+#include "ResourceResidency.h"
 // ... 기타 include ...
 
 // --- 전방 선언 ---
@@ -57,6 +60,34 @@ public:
 	template<typename T>
 	EResourceType GetResourceType();
 
+	// 타입 버킷에서 정규화 경로로 검색 (로드하지 않음)
+	UResourceBase* Find(EResourceType InType, const FString& InFilePath);
+
+	// --- 비동기 로드 ---
+	// 읽기/디코딩은 워커, 등록/GPU 생성/콜백은 TickAsyncLoads(게임 스레드)에서 처리
+	// 완료 전 핸들의 Get()은 플레이스홀더(텍스처: 기본 텍스처, 머티리얼: 기본 머티리얼)를 돌려줌
+	// 콜백 인자는 실패 시 nullptr, 취소되면 호출되지 않음
+	template<typename T>
+	FAsyncLoadHandle LoadAsync(const FString& InFilePath, std::function<void(T*)> InCallback = nullptr,
+		EAsyncLoadPriority InPriority = EAsyncLoadPriority::Normal);
+
+	// 매 프레임 호출. 완료된 로드를 InBudgetMS 안에서 마무리 (최소 하나)
+	void TickAsyncLoads(double InBudgetMS = FAsyncResourceLoader::DefaultBudgetMS) { AsyncLoader.Tick(InBudgetMS); }
+	FAsyncResourceLoader& GetAsyncLoader() { return AsyncLoader; }
+	const FAsyncLoadStats& GetAsyncLoadStats() const { return AsyncLoader.GetStats(); }
+
+	// --- 상주 관리 (컴포넌트 참조 수 + CPU/GPU 예산 + LRU 축출) ---
+	// 매 프레임 렌더 후 호출. 일정 간격으로 참조를 다시 세고, 예산을 넘으면 참조 없는 리소스를 오래된 순서로 축출
+	void UpdateResidency(float DeltaTime) { Residency.Update(Resources, DeltaTime); }
+	// 즉시 스윕 (bTrimAll: 예산과 무관하게 참조 없는 리소스 모두 축출)
+	void FlushResidency(bool bTrimAll = false) { Residency.Sweep(Resources, bTrimAll); }
+	void SetResidencyBudgetMB(uint32 InCPUBudgetMB, uint32 InGPUBudgetMB) { Residency.SetBudgetMB(InCPUBudgetMB, InGPUBudgetMB); }
+	// Load/Get을 거치지 않고 리소스 포인터를 꺼낸 곳에서 호출 (축출된 셸이면 다시 로드)
+	void TouchResource(UResourceBase* InResource) { Residency.Touch(InResource); }
+	FResourceResidency& GetResidency() { return Residency; }
+	const FResidencyStats& GetResidencyStats() const { return Residency.GetStats(); }
+	void LogResidencyReport(int32 InTopN = 10);
+
 	// --- 헬퍼 및 유틸리티 ---
 	ID3D11Device* GetDevice() { return Device; }
 	ID3D11DeviceContext* GetDeviceContext() { return Context; }
@@ -70,10 +101,12 @@ public:
 	FTextureData* CreateOrGetTextureData(const FWideString& FilePath);
 	void UpdateDynamicVertexBuffer(const FString& name, TArray<FBillboardVertexInfo_GPU>& vertices);
 	UMaterial* GetDefaultMaterial();
+	UTexture* GetDefaultTexture() { return DefaultTextureInstance; }
 
 	// --- 디버그 및 기본 메시 생성 ---
 	void CreateDefaultShader();
 	void CreateDefaultMaterial();
+	void CreateDefaultTexture();
 	void CreateAxisMesh(float Length, const FString& FilePath);
 	void CreateGridMesh(int N, const FString& FilePath);
 	void CreateBoxWireframeMesh(const FVector& Min, const FVector& Max, const FString& FilePath);
@@ -83,7 +116,10 @@ public:
 
 	// --- 캐시 관리 ---
 	FMeshBVH* GetMeshBVH(const FString& ObjPath);
-	FMeshBVH* GetOrBuildMeshBVH(const FString& ObjPath, const struct FStaticMesh* StaticMeshAsset);
+	FMeshBVH* GetOrBuildMeshBVH(const FString& ObjPath, const TArray<FVector>& Positions, const TArray<uint32>& Indices);
+	uint64 ReleaseMeshBVH(const FString& ObjPath);	// 해제한 바이트 수 반환
+	void ReleaseDeprecatedData(const FString& FilePath);	// 같은 경로의 Deprecated 맵 항목 해제 (축출 시)
+	uint64 GetMeshBVHMemoryBytes() const;
 	void SetStaticMeshs();
 	void SetSkeletalMeshs();
 	void SetAnimations();
@@ -132,6 +168,10 @@ private:
 	TMap<FString, FMeshBVH*> MeshBVHCache;
 
 	UMaterial* DefaultMaterialInstance;
+	UTexture* DefaultTextureInstance = nullptr;
+
+	FAsyncResourceLoader AsyncLoader;
+	FResourceResidency Residency;
 
 	// Shader Hot Reload
 	float ShaderCheckTimer = 0.0f;
@@ -143,6 +183,9 @@ private:
 template<typename T>
 bool UResourceManager::Add(const FString& InFilePath, UObject* InObject)
 {
+	// 리소스 맵은 동기화되지 않으므로 게임 스레드 전용 (워커는 CPU 데이터만 만들고 등록은 게임 스레드에서)
+	assert(!FTaskScheduler::IsInWorkerThread());
+
 	// 경로 정규화: 모든 백슬래시를 슬래시로 변환하여 일관성 유지
 	FString NormalizedPath = NormalizePath(InFilePath);
 
@@ -153,6 +196,7 @@ bool UResourceManager::Add(const FString& InFilePath, UObject* InObject)
 		Resources[typeIndex][NormalizedPath] = static_cast<T*>(InObject);
 		// 경로 저장
 		Resources[typeIndex][NormalizedPath]->SetFilePath(NormalizedPath);
+		Residency.Touch(Resources[typeIndex][NormalizedPath]);
 		return true;
 	}
 	return false;
@@ -168,6 +212,8 @@ T* UResourceManager::Get(const FString& InFilePath)
 	auto iter = Resources[typeIndex].find(NormalizedPath);
 	if (iter != Resources[typeIndex].end())
 	{
+		// 축출된 셸이면 여기서 다시 로드
+		Residency.Touch(iter->second);
 		return static_cast<T*>(iter->second);
 	}
 
@@ -177,6 +223,8 @@ T* UResourceManager::Get(const FString& InFilePath)
 template<typename T, typename ...Args>
 inline T* UResourceManager::Load(const FString& InFilePath, Args && ...InArgs)
 {
+	assert(!FTaskScheduler::IsInWorkerThread());
+
 	if (InFilePath.empty())
 	{
 		return nullptr;
@@ -196,6 +244,8 @@ inline T* UResourceManager::Load(const FString& InFilePath, Args && ...InArgs)
 			return Shader;
 		}
 
+		// 축출된 셸이면 여기서 다시 로드
+		Residency.Touch((*iter).second);
 		return static_cast<T*>((*iter).second);
 	}
 	else//없으면 해당 리소스의 Load실행
@@ -204,6 +254,7 @@ inline T* UResourceManager::Load(const FString& InFilePath, Args && ...InArgs)
 		Resource->Load(NormalizedPath, Device, std::forward<Args>(InArgs)...);
 		Resource->SetFilePath(NormalizedPath);
 		Resources[typeIndex][NormalizedPath] = Resource;
+		Residency.Touch(Resource);
 		return Resource;
 	}
 }
@@ -265,6 +316,17 @@ EResourceType UResourceManager::GetResourceType()
     return EResourceType::None;
 }
 
+template<typename T>
+FAsyncLoadHandle UResourceManager::LoadAsync(const FString& InFilePath, std::function<void(T*)> InCallback, EAsyncLoadPriority InPriority)
+{
+	FAsyncLoadCallback Callback;
+	if (InCallback)
+	{
+		Callback = [InCallback = std::move(InCallback)](UResourceBase* InResource) { InCallback(static_cast<T*>(InResource)); };
+	}
+	return AsyncLoader.Request(GetResourceType<T>(), InFilePath, std::move(Callback), InPriority);
+}
+
 // Enumerate all resources of a type T
 template<typename T>
 TArray<T*> UResourceManager::GetAll()
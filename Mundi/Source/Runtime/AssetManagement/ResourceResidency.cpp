@@ -0,0 +1,320 @@
+﻿#include "pch.h"
+#include "ResourceResidency.h"
+#include "ResourceManager.h"
+#include "ActorComponent.h"
+#include "DecalComponent.h"
+#include "ObjectIterator.h"
+#include "PlatformTime.h"
+#include <algorithm>
+
+namespace
+{
+	constexpr double BytesToMB = 1.0 / (1024.0 * 1024.0);
+
+	const char* GetResourceTypeName(uint32 InTypeIndex)
+	{
+		static const char* Names[] = { "None", "StaticMesh", "SkeletalMesh", "Quad", "DynamicMesh", "Shader", "Texture", "Material", "Sound", "Animation" };
+		return InTypeIndex < std::size(Names) ? Names[InTypeIndex] : "Unknown";
+	}
+
+	// 리소스 선택 UI가 붙는 프로퍼티 (UObject* 로 읽을 수 있는 리소스 포인터)
+	bool IsResourceProperty(EPropertyType InType)
+	{
+		switch (InType)
+		{
+		case EPropertyType::Texture:
+		case EPropertyType::StaticMesh:
+		case EPropertyType::SkeletalMesh:
+		case EPropertyType::Material:
+		case EPropertyType::Sound:
+			return true;
+		default:
+			return false;
+		}
+	}
+}
+
+void FResourceResidency::Update(FResourceBuckets& InResources, float InDeltaTime)
+{
+	++Frame;
+
+	SweepTimer += InDeltaTime;
+	if (SweepTimer < SweepInterval)
+	{
+		return;
+	}
+	SweepTimer = 0.0f;
+
+	Sweep(InResources);
+}
+
+void FResourceResidency::Sweep(FResourceBuckets& InResources, bool bInTrimAll)
+{
+	const uint64 Start = FPlatformTime::Cycles64();
+
+	// 1) 참조 수 다시 세기
+	for (auto& Bucket : InResources)
+	{
+		for (auto& Pair : Bucket)
+		{
+			if (Pair.second)
+			{
+				Pair.second->ComponentRefCount = 0;
+			}
+		}
+	}
+	CollectReferences();
+
+	// 2) 합계 + 축출 후보. 스윕 사이에 포인터만 복사돼 축출된 셸을 참조하게 된 경우 여기서 다시 로드
+	FResidencyStats Current;
+	Current.CPUBytes = UResourceManager::GetInstance().GetMeshBVHMemoryBytes();
+
+	TArray<UResourceBase*> Candidates;
+	for (auto& Bucket : InResources)
+	{
+		for (auto& Pair : Bucket)
+		{
+			UResourceBase* Resource = Pair.second;
+			if (!Resource)
+			{
+				continue;
+			}
+
+			++Current.NumResources;
+			if (Resource->GetRefCount() > 0)
+			{
+				++Current.NumReferenced;
+				if (!Resource->bResident)
+				{
+					Restore(Resource);
+				}
+				if (!Resource->bResident)
+				{
+					++Current.NumReferencedNotResident;
+				}
+			}
+
+			if (Resource->bResident)
+			{
+				++Current.NumResident;
+			}
+			else
+			{
+				++Current.NumEvicted;
+			}
+
+			Current.CPUBytes += Resource->GetCPUMemoryBytes();
+			Current.GPUBytes += Resource->GetGPUMemoryBytes();
+
+			if (Resource->bResident && Resource->bStreamable && Resource->GetRefCount() == 0 && Resource->SupportsEviction()
+				&& Frame - Resource->LastUsedFrame >= MinIdleFramesBeforeEvict)
+			{
+				Candidates.Add(Resource);
+			}
+		}
+	}
+
+	// 3) 예산 초과분 LRU 축출
+	const bool bOverBudget = Current.CPUBytes > CPUBudgetBytes || Current.GPUBytes > GPUBudgetBytes;
+	if (bInTrimAll || bOverBudget)
+	{
+		std::sort(Candidates.begin(), Candidates.end(), [](const UResourceBase* A, const UResourceBase* B)
+			{
+				return A->LastUsedFrame < B->LastUsedFrame;
+			});
+
+		for (UResourceBase* Resource : Candidates)
+		{
+			if (!bInTrimAll && Current.CPUBytes <= CPUBudgetBytes && Current.GPUBytes <= GPUBudgetBytes)
+			{
+				break;
+			}
+			Evict(Resource, Current.CPUBytes, Current.GPUBytes);
+			--Current.NumResident;
+			++Current.NumEvicted;
+		}
+
+		if (!bInTrimAll && (Current.CPUBytes > CPUBudgetBytes || Current.GPUBytes > GPUBudgetBytes))
+		{
+			UE_LOG("[Residency] Over budget with only referenced resources left (CPU %.1f / %.1f MB, GPU %.1f / %.1f MB)",
+				Current.CPUBytes * BytesToMB, CPUBudgetBytes * BytesToMB, Current.GPUBytes * BytesToMB, GPUBudgetBytes * BytesToMB);
+		}
+	}
+
+	Current.PeakCPUBytes = std::max(Stats.PeakCPUBytes, Current.CPUBytes);
+	Current.PeakGPUBytes = std::max(Stats.PeakGPUBytes, Current.GPUBytes);
+	Current.NumSweeps = Stats.NumSweeps + 1;
+	Current.TotalEvictions = Stats.TotalEvictions;
+	Current.TotalReloads = Stats.TotalReloads;
+	Current.LastSweepMS = static_cast<float>(FPlatformTime::ToMilliseconds(FPlatformTime::Cycles64() - Start));
+	Stats = Current;
+}
+
+void FResourceResidency::CollectReferences()
+{
+	auto AddReference = [this](UResourceBase* InResource)
+		{
+			if (InResource)
+			{
+				++InResource->ComponentRefCount;
+				InResource->bStreamable = true;
+				InResource->LastUsedFrame = Frame;
+			}
+		};
+
+	// 머티리얼은 텍스처까지 (MID는 부모 머티리얼도, GetTexture가 덮어쓴 텍스처를 우선 반환)
+	auto AddObjectReference = [&AddReference](UObject* InObject)
+		{
+			if (UMaterialInterface* Material = Cast<UMaterialInterface>(InObject))
+			{
+				AddReference(Material);
+				if (UMaterialInstanceDynamic* MID = Cast<UMaterialInstanceDynamic>(Material))
+				{
+					AddReference(MID->GetParentMaterial());
+				}
+				for (uint8 Slot = 0; Slot < static_cast<uint8>(EMaterialTextureSlot::Max); ++Slot)
+				{
+					AddReference(Material->GetTexture(static_cast<EMaterialTextureSlot>(Slot)));
+				}
+			}
+			else
+			{
+				AddReference(Cast<UResourceBase>(InObject));
+			}
+		};
+
+	for (TObjectIterator<UActorComponent> It; It; ++It)
+	{
+		UActorComponent* Component = *It;
+		for (const FProperty& Prop : Component->GetClass()->GetAllProperties())
+		{
+			if (IsResourceProperty(Prop.Type))
+			{
+				AddObjectReference(*Prop.GetValuePtr<UObject*>(Component));
+			}
+			else if (Prop.Type == EPropertyType::Array && IsResourceProperty(Prop.InnerType))
+			{
+				for (UObject* Element : *Prop.GetValuePtr<TArray<UObject*>>(Component))
+				{
+					AddObjectReference(Element);
+				}
+			}
+		}
+
+		// 리플렉션에 노출되지 않은 리소스 참조
+		if (UDecalComponent* Decal = Cast<UDecalComponent>(Component))
+		{
+			AddReference(Decal->GetDecalTexture());
+		}
+	}
+}
+
+bool FResourceResidency::Restore(UResourceBase* InResource)
+{
+	const bool bSucceeded = InResource->ReloadResidentData(UResourceManager::GetInstance().GetDevice());
+	if (!bSucceeded)
+	{
+		UE_LOG("[Residency] Failed to reload '%s'", InResource->GetFilePath().c_str());
+	}
+
+	// 실패해도 상주로 표시 (접근할 때마다 다시 읽지 않도록. 로드 실패 리소스와 같은 상태)
+	MarkRestored(InResource);
+	return bSucceeded;
+}
+
+void FResourceResidency::MarkRestored(UResourceBase* InResource)
+{
+	InResource->bResident = true;
+	InResource->LastUsedFrame = Frame;
+	++Stats.TotalReloads;
+}
+
+void FResourceResidency::Evict(UResourceBase* InResource, uint64& InOutCPUBytes, uint64& InOutGPUBytes)
+{
+	InOutCPUBytes -= std::min(InOutCPUBytes, InResource->GetCPUMemoryBytes());
+	InOutGPUBytes -= std::min(InOutGPUBytes, InResource->GetGPUMemoryBytes());
+
+	// 메시 단위 BVH 캐시도 같이 해제 (다음 피킹 때 다시 빌드)
+	if (UStaticMesh* StaticMesh = Cast<UStaticMesh>(InResource))
+	{
+		InOutCPUBytes -= std::min(InOutCPUBytes, UResourceManager::GetInstance().ReleaseMeshBVH(StaticMesh->GetAssetPathFileName()));
+	}
+
+	// 같은 경로로 Deprecated 맵에 잡힌 버퍼/텍스처도 같이 놓아 준다 (참조 수 집계 대상이 아님)
+	UResourceManager::GetInstance().ReleaseDeprecatedData(InResource->GetFilePath());
+
+	InResource->EvictResidentData();
+	InResource->bResident = false;
+	++Stats.TotalEvictions;
+}
+
+void FResourceResidency::SetBudgetMB(uint32 InCPUBudgetMB, uint32 InGPUBudgetMB)
+{
+	CPUBudgetBytes = static_cast<uint64>(InCPUBudgetMB) << 20;
+	GPUBudgetBytes = static_cast<uint64>(InGPUBudgetMB) << 20;
+}
+
+void FResourceResidency::LogReport(const FResourceBuckets& InResources, int32 InTopN) const
+{
+	UE_LOG("[Residency] CPU %.1f / %.0f MB (peak %.1f), GPU %.1f / %.0f MB (peak %.1f)",
+		Stats.CPUBytes * BytesToMB, CPUBudgetBytes * BytesToMB, Stats.PeakCPUBytes * BytesToMB,
+		Stats.GPUBytes * BytesToMB, GPUBudgetBytes * BytesToMB, Stats.PeakGPUBytes * BytesToMB);
+	UE_LOG("[Residency] %u resources (%u resident, %u evicted, %u referenced), %u evictions, %u reloads, %u sweeps (last %.3f ms)",
+		Stats.NumResources, Stats.NumResident, Stats.NumEvicted, Stats.NumReferenced,
+		Stats.TotalEvictions, Stats.TotalReloads, Stats.NumSweeps, Stats.LastSweepMS);
+
+	struct FAssetEntry
+	{
+		const UResourceBase* Resource;
+		uint32 TypeIndex;
+		uint64 Bytes;
+	};
+	TArray<FAssetEntry> Assets;
+
+	UE_LOG("[Residency] %-12s %6s %8s %7s %9s %9s", "Type", "Count", "Resident", "Evicted", "CPU MB", "GPU MB");
+	for (uint32 TypeIndex = 0; TypeIndex < static_cast<uint32>(InResources.Num()); ++TypeIndex)
+	{
+		uint32 Count = 0;
+		uint32 Resident = 0;
+		uint64 CPUBytes = 0;
+		uint64 GPUBytes = 0;
+		for (const auto& Pair : InResources[TypeIndex])
+		{
+			const UResourceBase* Resource = Pair.second;
+			if (!Resource)
+			{
+				continue;
+			}
+			++Count;
+			Resident += Resource->bResident ? 1 : 0;
+			const uint64 ResourceCPU = Resource->GetCPUMemoryBytes();
+			const uint64 ResourceGPU = Resource->GetGPUMemoryBytes();
+			CPUBytes += ResourceCPU;
+			GPUBytes += ResourceGPU;
+			if (ResourceCPU + ResourceGPU > 0)
+			{
+				Assets.Add({ Resource, TypeIndex, ResourceCPU + ResourceGPU });
+			}
+		}
+		if (Count > 0)
+		{
+			UE_LOG("[Residency] %-12s %6u %8u %7u %9.2f %9.2f", GetResourceTypeName(TypeIndex), Count, Resident, Count - Resident,
+				CPUBytes * BytesToMB, GPUBytes * BytesToMB);
+		}
+	}
+
+	const int32 NumTop = std::min(InTopN, Assets.Num());
+	std::partial_sort(Assets.begin(), Assets.begin() + NumTop, Assets.end(), [](const FAssetEntry& A, const FAssetEntry& B)
+		{
+			return A.Bytes > B.Bytes;
+		});
+	UE_LOG("[Residency] Top %d assets by memory:", NumTop);
+	for (int32 i = 0; i < NumTop; ++i)
+	{
+		const UResourceBase* Resource = Assets[i].Resource;
+		UE_LOG("[Residency]   %8.2f MB (CPU %.2f, GPU %.2f) refs %u%s, idle %llu frames [%s] %s",
+			Assets[i].Bytes * BytesToMB, Resource->GetCPUMemoryBytes() * BytesToMB, Resource->GetGPUMemoryBytes() * BytesToMB,
+			Resource->GetRefCount(), Resource->bStreamable ? "" : " (not streamable)", Frame - Resource->LastUsedFrame,
+			GetResourceTypeName(Assets[i].TypeIndex), Resource->GetFilePath().c_str());
+	}
+}
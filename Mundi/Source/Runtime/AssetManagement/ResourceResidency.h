@@ -0,0 +1,84 @@
+﻿#pragma once
+#include "ResourceBase.h"
+
+// 리소스 상주 통계 (현재 값은 마지막 스윕 기준)
+struct FResidencyStats
+{
+	// 현재
+	uint32 NumResources = 0;
+	uint32 NumResident = 0;
+	uint32 NumEvicted = 0;                  // 데이터를 해제하고 셸만 남은 리소스
+	uint32 NumReferenced = 0;               // 컴포넌트 또는 고정 참조가 있는 리소스
+	uint32 NumReferencedNotResident = 0;    // 참조되는데 다시 로드하지 못한 리소스 (0이어야 정상)
+	uint64 CPUBytes = 0;
+	uint64 GPUBytes = 0;
+	uint64 PeakCPUBytes = 0;
+	uint64 PeakGPUBytes = 0;
+
+	// 누적
+	uint32 NumSweeps = 0;
+	uint32 TotalEvictions = 0;
+	uint32 TotalReloads = 0;
+	float LastSweepMS = 0.0f;
+};
+
+/**
+ * UResourceManager의 리소스 상주 관리 (참조 수 + CPU/GPU 메모리 예산 + LRU 축출)
+ * - 참조 수: 스윕마다 모든 컴포넌트의 리소스 프로퍼티(리플렉션) + 데칼 텍스처 + 머티리얼 텍스처를 다시 센다.
+ *   프로퍼티 렌더러/역직렬화/PIE 복제가 포인터를 직접 쓰므로 증감식 카운트 대신 스윕으로 계산
+ * - 축출: 예산을 넘으면 참조 없는 리소스를 마지막 사용 프레임이 오래된 순서로 축출. UObject 셸은 남기므로
+ *   포인터는 계속 유효하고, 다음 Load/Get(Touch)에서 투명하게 다시 로드
+ * - 월드 컴포넌트가 한 번이라도 참조한 리소스만 축출 대상 (UI 아이콘처럼 위젯이 들고 있는 리소스는 제외)
+ */
+class FResourceResidency
+{
+public:
+	using FResourceBuckets = TArray<TMap<FString, UResourceBase*>>;
+
+	// 매 프레임 렌더 후 호출. SweepInterval마다 스윕
+	void Update(FResourceBuckets& InResources, float InDeltaTime);
+
+	// 즉시 스윕. bInTrimAll이면 예산과 무관하게 참조 없는 리소스를 모두 축출
+	void Sweep(FResourceBuckets& InResources, bool bInTrimAll = false);
+
+	// Load/Get 적중 시 호출: LRU 갱신 + 축출된 셸이면 다시 로드
+	void Touch(UResourceBase* InResource)
+	{
+		InResource->LastUsedFrame = Frame;
+		if (!InResource->bResident)
+		{
+			Restore(InResource);
+		}
+	}
+
+	// 축출된 셸을 밖에서 직접 다시 채운 경우 (비동기 로더가 준비한 텍스처 원본)
+	void MarkRestored(UResourceBase* InResource);
+
+	void SetBudgetMB(uint32 InCPUBudgetMB, uint32 InGPUBudgetMB);
+	uint64 GetCPUBudgetBytes() const { return CPUBudgetBytes; }
+	uint64 GetGPUBudgetBytes() const { return GPUBudgetBytes; }
+
+	uint64 GetFrame() const { return Frame; }
+	const FResidencyStats& GetStats() const { return Stats; }
+
+	// 타입별 합계 + 메모리 상위 InTopN개 에셋을 로그로 출력
+	void LogReport(const FResourceBuckets& InResources, int32 InTopN) const;
+
+	static constexpr float SweepInterval = 1.0f;
+	static constexpr uint64 MinIdleFramesBeforeEvict = 2;  // 방금 로드/사용한 리소스는 컴포넌트에 꽂히기 전이라도 축출하지 않음
+	static constexpr uint32 DefaultBudgetMB = 1024;
+
+private:
+	void CollectReferences();
+	bool Restore(UResourceBase* InResource);
+	void Evict(UResourceBase* InResource, uint64& InOutCPUBytes, uint64& InOutGPUBytes);
+
+private:
+	uint64 Frame = 1;
+	float SweepTimer = 0.0f;
+
+	uint64 CPUBudgetBytes = static_cast<uint64>(DefaultBudgetMB) << 20;
+	uint64 GPUBudgetBytes = static_cast<uint64>(DefaultBudgetMB) << 20;
+
+	FResidencyStats Stats;
+};
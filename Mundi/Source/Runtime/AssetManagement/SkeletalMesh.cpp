@@ -20,14 +20,20 @@ USkeletalMesh::~USkeletalMesh()
 }
 
 void USkeletalMesh::Load(const FString& InFilePath, ID3D11Device* InDevice)
+{
+    // FBXLoader가 캐싱을 내부적으로 처리합니다
+    Load(InFilePath, InDevice, UFbxLoader::GetInstance().LoadFbxMeshAsset(InFilePath));
+}
+
+void USkeletalMesh::Load(const FString& InFilePath, ID3D11Device* InDevice, FSkeletalMeshData* InData)
 {
     if (Data)
     {
         ReleaseResources();
     }
+    bFileBacked = true;
 
-    // FBXLoader가 캐싱을 내부적으로 처리합니다
-    Data = UFbxLoader::GetInstance().LoadFbxMeshAsset(InFilePath);
+    Data = InData;
 
     if (!Data || Data->Vertices.empty() || Data->Indices.empty())
     {
@@ -40,6 +46,69 @@ void USkeletalMesh::Load(const FString& InFilePath, ID3D11Device* InDevice)
     VertexCount = static_cast<uint32>(Data->Vertices.size());
     IndexCount = static_cast<uint32>(Data->Indices.size());
     VertexStride = sizeof(FVertexDynamic);
+
+    if (Data->bCompactVertices)
+    {
+        PackVertices();
+    }
+
+    SetCPUResidency(CPUResidency);
+}
+
+void USkeletalMesh::SetCPUResidency(EMeshCPUResidency InResidency)
+{
+    CPUResidency = InResidency;
+    if (!Data)
+    {
+        return;
+    }
+
+    if (CPUResidency == EMeshCPUResidency::CollisionOnly)
+    {
+        // 인덱스는 GPU 버퍼에만 있으면 됨
+        Data->Indices.Empty();
+        Data->Indices.shrink_to_fit();
+    }
+    else if (Data->Indices.IsEmpty() && IndexCount > 0)
+    {
+        if (FSkeletalMeshData* Source = UFbxLoader::GetInstance().LoadFbxMeshAsset(FilePath))
+        {
+            Data->Indices = std::move(Source->Indices);
+            delete Source;
+        }
+    }
+}
+
+void USkeletalMesh::PackVertices()
+{
+    PackedVertices.SetNum(static_cast<int32>(Data->Vertices.size()));
+    for (size_t Index = 0; Index < Data->Vertices.size(); ++Index)
+    {
+        PackedVertices[Index].FillFrom(Data->Vertices[Index]);
+    }
+
+    // 전체 정밀도 정점은 더 이상 읽지 않으므로 메모리 반환
+    Data->Vertices.Empty();
+    Data->Vertices.shrink_to_fit();
+}
+
+bool USkeletalMesh::ReloadResidentData(ID3D11Device* InDevice)
+{
+    Load(FilePath, InDevice);
+    return Data != nullptr;
+}
+
+uint64 USkeletalMesh::GetCPUMemoryBytes() const
+{
+    if (!Data)
+    {
+        return 0;
+    }
+    return Data->Vertices.size() * sizeof(FSkinnedVertex)
+        + PackedVertices.size() * sizeof(FPackedSkinnedVertex)
+        + Data->Indices.size() * sizeof(uint32)
+        + Data->GroupInfos.size() * sizeof(FGroupInfo)
+        + Data->Skeleton.Bones.size() * sizeof(FBone);
 }
 
 void USkeletalMesh::ReleaseResources()
@@ -55,21 +124,41 @@ void USkeletalMesh::ReleaseResources()
         delete Data;
         Data = nullptr;
     }
+    PackedVertices.Empty();
+    PackedVertices.shrink_to_fit();
+
+    VertexCount = 0;
+    IndexCount = 0;
 }
 
 void USkeletalMesh::CreateVertexBuffer(ID3D11Buffer** InVertexBuffer)
 {
     if (!Data) { return; }
     ID3D11Device* Device = GEngine.GetRHIDevice()->GetDevice();
-    HRESULT hr = D3D11RHI::CreateVertexBuffer<FVertexDynamic>(Device, Data->Vertices, InVertexBuffer);
+    HRESULT hr;
+    if (HasCompactVertices())
+    {
+        // CPU 스키닝 결과는 FVertexDynamic으로 올리므로 초기 내용만 복원해서 채움
+        TArray<FSkinnedVertex> Decoded;
+        Decoded.reserve(PackedVertices.size());
+        for (const FPackedSkinnedVertex& Packed : PackedVertices)
+        {
+            Decoded.Add(Packed.Decode());
+        }
+        hr = D3D11RHI::CreateVertexBuffer<FVertexDynamic>(Device, Decoded, InVertexBuffer);
+    }
+    else
+    {
+        hr = D3D11RHI::CreateVertexBuffer<FVertexDynamic>(Device, Data->Vertices, InVertexBuffer);
+    }
     assert(SUCCEEDED(hr));
 }
 
-void USkeletalMesh::UpdateVertexBuffer(const TArray<FNormalVertex>& SkinnedVertices, ID3D11Buffer* InVertexBuffer)
+void USkeletalMesh::UpdateVertexBuffer(const FNormalVertex* SkinnedVertices, int32 NumVertices, ID3D11Buffer* InVertexBuffer)
 {
     if (!InVertexBuffer) { return; }
 
-    GEngine.GetRHIDevice()->VertexBufferUpdate(InVertexBuffer, SkinnedVertices);
+    GEngine.GetRHIDevice()->VertexBufferUpdate(InVertexBuffer, SkinnedVertices, static_cast<size_t>(NumVertices));
 }
 
 void USkeletalMesh::CreateGPUSkinnedVertexBuffer(ID3D11Buffer** InVertexBuffer)
@@ -77,17 +166,17 @@ void USkeletalMesh::CreateGPUSkinnedVertexBuffer(ID3D11Buffer** InVertexBuffer)
     if (!Data) { return; }
     ID3D11Device* Device = GEngine.GetRHIDevice()->GetDevice();
 
-    // FSkinnedVertex를 그대로 사용하는 버텍스 버퍼 생성
+    // FSkinnedVertex(압축 메시는 FPackedSkinnedVertex)를 그대로 사용하는 버텍스 버퍼 생성
     D3D11_BUFFER_DESC BufferDesc;
     ZeroMemory(&BufferDesc, sizeof(BufferDesc));
     BufferDesc.Usage = D3D11_USAGE_IMMUTABLE; // GPU 스키닝 모드에서는 버텍스 데이터 변경 없음
-    BufferDesc.ByteWidth = static_cast<UINT>(sizeof(FSkinnedVertex) * Data->Vertices.size());
+    BufferDesc.ByteWidth = GetGPUSkinnedVertexStride() * VertexCount;
     BufferDesc.BindFlags = D3D11_BIND_VERTEX_BUFFER;
     BufferDesc.CPUAccessFlags = 0;
 
     D3D11_SUBRESOURCE_DATA InitData;
     ZeroMemory(&InitData, sizeof(InitData));
-    InitData.pSysMem = Data->Vertices.data();
+    InitData.pSysMem = HasCompactVertices() ? static_cast<const void*>(PackedVertices.data()) : static_cast<const void*>(Data->Vertices.data());
 
     HRESULT hr = Device->CreateBuffer(&BufferDesc, &InitData, InVertexBuffer);
     assert(SUCCEEDED(hr));
@@ -10,6 +10,8 @@ public:
     virtual ~USkeletalMesh() override;
     
     void Load(const FString& InFilePath, ID3D11Device* InDevice);
+    // 워커에서 미리 읽은 메시 데이터로 GPU 버퍼만 생성 (InData 소유권을 가져감, 비동기 로드용)
+    void Load(const FString& InFilePath, ID3D11Device* InDevice, FSkeletalMeshData* InData);
     
     const FSkeletalMeshData* GetSkeletalMeshData() const { return Data; }
     const FString& GetPathFileName() const { if (Data) return Data->PathFileName; return FString(); }
@@ -23,20 +25,39 @@ public:
     uint32 GetIndexCount() const { return IndexCount; }
 
     uint32 GetVertexStride() const { return VertexStride; }
+
+    // 압축 정점 메시는 Data->Vertices를 비우고 PackedVertices만 보관 (CPU 스키닝은 정점마다 복원해서 사용)
+    bool HasCompactVertices() const { return !PackedVertices.IsEmpty(); }
+    const TArray<FPackedSkinnedVertex>& GetPackedVertices() const { return PackedVertices; }
+    // GPU 스키닝 정점 버퍼의 stride (FSkinnedVertex 또는 FPackedSkinnedVertex)
+    uint32 GetGPUSkinnedVertexStride() const { return HasCompactVertices() ? sizeof(FPackedSkinnedVertex) : sizeof(FSkinnedVertex); }
     
     const TArray<FGroupInfo>& GetMeshGroupInfo() const { static TArray<FGroupInfo> EmptyGroup; return Data ? Data->GroupInfos : EmptyGroup; }
     bool HasMaterial() const { return Data ? Data->bHasMaterial : false; }
 
     uint64 GetMeshGroupCount() const { return Data ? Data->GroupInfos.size() : 0; }
 
+    // CPU 상주 정책. 정점/스켈레톤은 CPU 스키닝과 본 계산에 쓰이므로 항상 유지하고,
+    // CollisionOnly면 인덱스 버퍼 생성 후 CPU 인덱스만 해제 (Full로 바꾸면 바이너리 캐시에서 다시 읽음)
+    void SetCPUResidency(EMeshCPUResidency InResidency);
+    EMeshCPUResidency GetCPUResidency() const { return CPUResidency; }
+
     void CreateVertexBuffer(ID3D11Buffer** InVertexBuffer);
-    void UpdateVertexBuffer(const TArray<FNormalVertex>& SkinnedVertices, ID3D11Buffer* InVertexBuffer);
+    void UpdateVertexBuffer(const FNormalVertex* SkinnedVertices, int32 NumVertices, ID3D11Buffer* InVertexBuffer);
 
-    // GPU 스키닝용 버텍스 버퍼 생성 (FSkinnedVertex 그대로 사용)
+    // GPU 스키닝용 버텍스 버퍼 생성 (FSkinnedVertex 또는 FPackedSkinnedVertex 그대로 사용)
     void CreateGPUSkinnedVertexBuffer(ID3D11Buffer** InVertexBuffer);
+
+    // 상주 관리: 정점 버퍼는 컴포넌트가 소유하므로 메시 데이터와 인덱스 버퍼만 해제하고 다시 Load
+    bool SupportsEviction() const override { return bFileBacked; }
+    void EvictResidentData() override { ReleaseResources(); }
+    bool ReloadResidentData(ID3D11Device* InDevice) override;
+    uint64 GetCPUMemoryBytes() const override;
+    uint64 GetGPUMemoryBytes() const override { return IndexBuffer ? static_cast<uint64>(IndexCount) * sizeof(uint32) : 0; }
     
 private:
     void CreateIndexBuffer(FSkeletalMeshData* InSkeletalMesh, ID3D11Device* InDevice);
+    void PackVertices();
     void ReleaseResources();
     
 private:
@@ -49,4 +70,8 @@ private:
     
     // CPU 리소스
     FSkeletalMeshData* Data = nullptr;
+    TArray<FPackedSkinnedVertex> PackedVertices;    // Data->bCompactVertices일 때만
+    EMeshCPUResidency CPUResidency = UResourceBase::GetDefaultMeshCPUResidency();
+
+    bool bFileBacked = false;
 };
\ No newline at end of file
@@ -37,9 +37,43 @@ namespace
 
         // 캐시 경로 복사
         StaticMesh->CacheFilePath = SkeletalData.CacheFilePath;
+        StaticMesh->bCompactVertices = SkeletalData.bCompactVertices;
 
         return StaticMesh;
     }
+
+    // 바이너리 캐시(없으면 원본 임포트)에서 FStaticMesh를 읽어 ObjManager 캐시에 등록
+    FStaticMesh* LoadStaticMeshAsset(const FString& InFilePath)
+    {
+        // 파일 확장자 확인
+        std::filesystem::path FilePath(InFilePath);
+        FString Extension = FilePath.extension().string();
+        std::transform(Extension.begin(), Extension.end(), Extension.begin(), ::tolower);
+
+        if (Extension != ".fbx")
+        {
+            // OBJ 파일 로드 (기존 방식)
+            return FObjManager::LoadObjStaticMeshAsset(InFilePath);
+        }
+
+        // FBX 파일 로드
+        FSkeletalMeshData* SkeletalData = UFbxLoader::GetInstance().LoadFbxMeshAsset(InFilePath);
+        if (!SkeletalData || SkeletalData->Vertices.empty() || SkeletalData->Indices.empty())
+        {
+            UE_LOG("ERROR: Failed to load FBX mesh from '%s'", InFilePath.c_str());
+            delete SkeletalData;
+            return nullptr;
+        }
+
+        // SkeletalMeshData를 StaticMesh로 변환
+        FStaticMesh* StaticMesh = ConvertSkeletalToStaticMesh(*SkeletalData);
+        StaticMesh->PathFileName = InFilePath;
+        delete SkeletalData;
+
+        // FBX 메시를 ObjManager 캐시에 등록 (메모리 관리)
+        FObjManager::RegisterStaticMeshAsset(InFilePath, StaticMesh);
+        return StaticMesh;
+    }
 }
 
 UStaticMesh::~UStaticMesh()
@@ -52,47 +86,110 @@ void UStaticMesh::Load(const FString& InFilePath, ID3D11Device* InDevice, EVerte
     assert(InDevice);
 
     SetVertexType(InVertexType);
+    bFileBacked = true;
+    // ResourceManager가 Load 뒤에 설정하지만, 아래에서 바로 ObjManager 캐시를 해제할 수 있으므로 먼저 기록
+    FilePath = InFilePath;
 
-    // 파일 확장자 확인
-    std::filesystem::path FilePath(InFilePath);
-    FString Extension = FilePath.extension().string();
-    std::transform(Extension.begin(), Extension.end(), Extension.begin(), ::tolower);
+    StaticMeshAsset = LoadStaticMeshAsset(InFilePath);
 
-    if (Extension == ".fbx")
+    // 빈 버텍스, 인덱스로 버퍼 생성 방지
+    if (StaticMeshAsset && 0 < StaticMeshAsset->Vertices.size() && 0 < StaticMeshAsset->Indices.size())
     {
-        // FBX 파일 로드
-        FSkeletalMeshData* SkeletalData = UFbxLoader::GetInstance().LoadFbxMeshAsset(InFilePath);
+        // 임포트 시 압축 정점으로 표시된 메시는 GPU 버퍼만 FPackedNormalVertex로 (다시 로드할 때 설정이 바뀌었을 수 있으므로 매번 결정)
+        if (InVertexType == EVertexLayoutType::PositionColorTexturNormal || InVertexType == EVertexLayoutType::PositionPackedNormalTexture)
+        {
+            SetVertexType(StaticMeshAsset->bCompactVertices ? EVertexLayoutType::PositionPackedNormalTexture : EVertexLayoutType::PositionColorTexturNormal);
+        }
 
-        if (SkeletalData->Vertices.empty() || SkeletalData->Indices.empty())
+        CacheFilePath = StaticMeshAsset->CacheFilePath;
+        CreateVertexBuffer(StaticMeshAsset, InDevice, VertexType);
+        CreateIndexBuffer(StaticMeshAsset, InDevice);
+        CacheResidentInfo(StaticMeshAsset);
+        CreateLocalBound(CollisionPositions);
+        VertexCount = static_cast<uint32>(StaticMeshAsset->Vertices.size());
+        IndexCount = static_cast<uint32>(StaticMeshAsset->Indices.size());
+
+        TotalIndexCount = IndexCount;
+        LODIndexOffsets.clear();
+        for (const FStaticMeshLOD& LOD : StaticMeshAsset->LODs)
         {
-            UE_LOG("ERROR: Failed to load FBX mesh from '%s'", InFilePath.c_str());
-            return;
+            LODIndexOffsets.Add(TotalIndexCount);
+            TotalIndexCount += static_cast<uint32>(LOD.Indices.size());
         }
+        bHasMeshData = true;
 
-        // SkeletalMeshData를 StaticMesh로 변환
-        StaticMeshAsset = ConvertSkeletalToStaticMesh(*SkeletalData);
-        StaticMeshAsset->PathFileName = InFilePath;
+        // 나머지(정점 속성, LOD 인덱스)는 GPU 버퍼에만 있으면 됨
+        if (CPUResidency == EMeshCPUResidency::CollisionOnly)
+        {
+            ReleaseStaticMeshAsset();
+        }
+    }
+}
 
-        // FBX 메시를 ObjManager 캐시에 등록 (메모리 관리)
-        FObjManager::RegisterStaticMeshAsset(InFilePath, StaticMeshAsset);
-        delete SkeletalData;
+FStaticMesh* UStaticMesh::AcquireStaticMeshAsset()
+{
+    if (!StaticMeshAsset && bHasMeshData)
+    {
+        StaticMeshAsset = LoadStaticMeshAsset(FilePath);
+    }
+    return StaticMeshAsset;
+}
+
+void UStaticMesh::ReleaseStaticMeshAsset()
+{
+    if (StaticMeshAsset)
+    {
+        FObjManager::ReleaseStaticMeshAsset(FilePath, StaticMeshAsset);
+        StaticMeshAsset = nullptr;
+    }
+}
+
+void UStaticMesh::SetCPUResidency(EMeshCPUResidency InResidency)
+{
+    CPUResidency = InResidency;
+    if (CPUResidency == EMeshCPUResidency::Full)
+    {
+        AcquireStaticMeshAsset();
     }
     else
     {
-        // OBJ 파일 로드 (기존 방식)
-        StaticMeshAsset = FObjManager::LoadObjStaticMeshAsset(InFilePath);
+        ReleaseStaticMeshAsset();
     }
+}
 
-    // 빈 버텍스, 인덱스로 버퍼 생성 방지
-    if (StaticMeshAsset && 0 < StaticMeshAsset->Vertices.size() && 0 < StaticMeshAsset->Indices.size())
+void UStaticMesh::CacheResidentInfo(const FStaticMesh* InStaticMesh)
+{
+    AssetPathFileName = InStaticMesh->PathFileName;
+    GroupInfos = InStaticMesh->GroupInfos;
+    bHasMaterial = InStaticMesh->bHasMaterial;
+
+    LODInfos.SetNum(static_cast<int32>(InStaticMesh->LODs.size()));
+    for (size_t Index = 0; Index < InStaticMesh->LODs.size(); ++Index)
     {
-        CacheFilePath = StaticMeshAsset->CacheFilePath;
-        CreateVertexBuffer(StaticMeshAsset, InDevice, InVertexType);
-        CreateIndexBuffer(StaticMeshAsset, InDevice);
-        CreateLocalBound(StaticMeshAsset);
-        VertexCount = static_cast<uint32>(StaticMeshAsset->Vertices.size());
-        IndexCount = static_cast<uint32>(StaticMeshAsset->Indices.size());
+        LODInfos[Index].GroupInfos = InStaticMesh->LODs[Index].GroupInfos;
+        LODInfos[Index].ScreenSize = InStaticMesh->LODs[Index].ScreenSize;
+        LODInfos[Index].Error = InStaticMesh->LODs[Index].Error;
+    }
+
+    CollisionPositions.SetNum(static_cast<int32>(InStaticMesh->Vertices.size()));
+    for (size_t Index = 0; Index < InStaticMesh->Vertices.size(); ++Index)
+    {
+        CollisionPositions[Index] = InStaticMesh->Vertices[Index].pos;
     }
+    CollisionIndices = InStaticMesh->Indices;
+}
+
+void UStaticMesh::ClearResidentInfo()
+{
+    bHasMeshData = false;
+    AssetPathFileName.clear();
+    GroupInfos.Empty();
+    LODInfos.Empty();
+    bHasMaterial = false;
+    CollisionPositions.Empty();
+    CollisionPositions.shrink_to_fit();
+    CollisionIndices.Empty();
+    CollisionIndices.shrink_to_fit();
 }
 
 void UStaticMesh::Load(FMeshData* InData, ID3D11Device* InDevice, EVertexLayoutType InVertexType)
@@ -116,6 +213,63 @@ void UStaticMesh::Load(FMeshData* InData, ID3D11Device* InDevice, EVertexLayoutT
 
     VertexCount = static_cast<uint32>(InData->Vertices.size());
     IndexCount = static_cast<uint32>(InData->Indices.size());
+    TotalIndexCount = IndexCount;
+    LODIndexOffsets.clear();
+}
+
+void UStaticMesh::EvictResidentData()
+{
+    ReleaseResources();
+    VertexCount = 0;
+    IndexCount = 0;
+    TotalIndexCount = 0;
+    LODIndexOffsets.clear();
+
+    ReleaseStaticMeshAsset();
+    ClearResidentInfo();
+}
+
+bool UStaticMesh::ReloadResidentData(ID3D11Device* InDevice)
+{
+    Load(FilePath, InDevice, VertexType);
+    return bHasMeshData;
+}
+
+uint64 UStaticMesh::GetCPUMemoryBytes() const
+{
+    uint64 Bytes = CollisionPositions.size() * sizeof(FVector)
+        + CollisionIndices.size() * sizeof(uint32)
+        + GroupInfos.size() * sizeof(FGroupInfo);
+    for (const FStaticMeshLOD& LOD : LODInfos)
+    {
+        Bytes += sizeof(FStaticMeshLOD) + LOD.GroupInfos.size() * sizeof(FGroupInfo);
+    }
+
+    if (StaticMeshAsset)
+    {
+        Bytes += StaticMeshAsset->Vertices.size() * sizeof(FNormalVertex)
+            + StaticMeshAsset->Indices.size() * sizeof(uint32)
+            + StaticMeshAsset->GroupInfos.size() * sizeof(FGroupInfo);
+        for (const FStaticMeshLOD& LOD : StaticMeshAsset->LODs)
+        {
+            Bytes += LOD.Indices.size() * sizeof(uint32) + LOD.GroupInfos.size() * sizeof(FGroupInfo);
+        }
+    }
+    return Bytes;
+}
+
+uint64 UStaticMesh::GetGPUMemoryBytes() const
+{
+    uint64 Bytes = 0;
+    if (VertexBuffer)
+    {
+        Bytes += static_cast<uint64>(VertexCount) * VertexStride;
+    }
+    if (IndexBuffer)
+    {
+        Bytes += static_cast<uint64>(TotalIndexCount) * sizeof(uint32);
+    }
+    return Bytes;
 }
 
 void UStaticMesh::SetVertexType(EVertexLayoutType InVertexType)
@@ -131,6 +285,9 @@ void UStaticMesh::SetVertexType(EVertexLayoutType InVertexType)
     case EVertexLayoutType::PositionColorTexturNormal:
         Stride = sizeof(FVertexDynamic);
         break;
+    case EVertexLayoutType::PositionPackedNormalTexture:
+        Stride = sizeof(FPackedNormalVertex);
+        break;
     case EVertexLayoutType::PositionTextBillBoard:
         Stride = sizeof(FBillboardVertexInfo_GPU);
         break;
@@ -154,7 +311,14 @@ void UStaticMesh::CreateVertexBuffer(FMeshData* InMeshData, ID3D11Device* InDevi
 void UStaticMesh::CreateVertexBuffer(FStaticMesh* InStaticMesh, ID3D11Device* InDevice, EVertexLayoutType InVertexType)
 {
     HRESULT hr;
-    hr = D3D11RHI::CreateVertexBuffer<FVertexDynamic>(InDevice, InStaticMesh->Vertices, &VertexBuffer);
+    if (InVertexType == EVertexLayoutType::PositionPackedNormalTexture)
+    {
+        hr = D3D11RHI::CreateVertexBuffer<FPackedNormalVertex>(InDevice, InStaticMesh->Vertices, &VertexBuffer);
+    }
+    else
+    {
+        hr = D3D11RHI::CreateVertexBuffer<FVertexDynamic>(InDevice, InStaticMesh->Vertices, &VertexBuffer);
+    }
     assert(SUCCEEDED(hr));
 }
 
@@ -183,16 +347,14 @@ void UStaticMesh::CreateLocalBound(const FMeshData* InMeshData)
     LocalBound = FAABB(Min, Max);
 }
 
-void UStaticMesh::CreateLocalBound(const FStaticMesh* InStaticMesh)
+void UStaticMesh::CreateLocalBound(const TArray<FVector>& InPositions)
 {
-    TArray<FNormalVertex> Verts = InStaticMesh->Vertices;
-    FVector Min = Verts[0].pos;
-    FVector Max = Verts[0].pos;
-    for (FNormalVertex Vertex : Verts)
+    FVector Min = InPositions[0];
+    FVector Max = InPositions[0];
+    for (const FVector& Position : InPositions)
     {
-        FVector Pos = Vertex.pos;
-        Min = Min.ComponentMin(Pos);
-        Max = Max.ComponentMax(Pos);
+        Min = Min.ComponentMin(Position);
+        Max = Max.ComponentMax(Position);
     }
     LocalBound = FAABB(Min, Max);
 }
@@ -24,47 +24,97 @@ public:
     EVertexLayoutType GetVertexType() const { return VertexType; }
     void SetIndexCount(uint32 Cnt) { IndexCount = Cnt; }
     uint32 GetVertexStride() const { return VertexStride; };
+    // GPU 정점 버퍼가 FPackedNormalVertex인지 (셰이더 변형에 COMPACT_VERTEX 매크로 필요)
+    bool HasCompactVertices() const { return VertexType == EVertexLayoutType::PositionPackedNormalTexture; }
 
-	const FString& GetAssetPathFileName() const { return StaticMeshAsset ? StaticMeshAsset->PathFileName : FilePath; }
+	const FString& GetAssetPathFileName() const { return AssetPathFileName.empty() ? FilePath : AssetPathFileName; }
     void SetStaticMeshAsset(FStaticMesh* InStaticMesh) { StaticMeshAsset = InStaticMesh; }
+    // 상주 중인 전체 CPU 데이터. CollisionOnly 정책이면 업로드 후 nullptr (AcquireStaticMeshAsset으로 다시 읽기)
 	FStaticMesh* GetStaticMeshAsset() const { return StaticMeshAsset; }
 
-    const TArray<FGroupInfo>& GetMeshGroupInfo() const { return StaticMeshAsset->GroupInfos; }
-    bool HasMaterial() const { return StaticMeshAsset->bHasMaterial; }
+    // 파일에서 로드한 메시 데이터(GPU 버퍼 + 아래 메타데이터/충돌 스트림)가 있는지
+    bool HasMeshData() const { return bHasMeshData; }
 
-    uint64 GetMeshGroupCount() const { return StaticMeshAsset->GroupInfos.size(); }
+    // 전체 CPU 데이터가 필요할 때 호출. 해제돼 있으면 바이너리 캐시에서 다시 읽고, ReleaseStaticMeshAsset 전까지 유지
+    FStaticMesh* AcquireStaticMeshAsset();
+    // 전체 CPU 데이터 해제 (ObjManager 캐시에서도 제거). 메타데이터와 충돌 스트림은 남음
+    void ReleaseStaticMeshAsset();
+
+    // 메시별 CPU 상주 정책. CollisionOnly로 바꾸면 즉시 해제, Full로 바꾸면 즉시 다시 읽음
+    void SetCPUResidency(EMeshCPUResidency InResidency);
+    EMeshCPUResidency GetCPUResidency() const { return CPUResidency; }
+
+    // 피킹/BVH/오클루더용 LOD0 위치·인덱스 스트림 (상주 정책과 무관하게 항상 유지)
+    const TArray<FVector>& GetCollisionPositions() const { return CollisionPositions; }
+    const TArray<uint32>& GetCollisionIndices() const { return CollisionIndices; }
+
+    const TArray<FGroupInfo>& GetMeshGroupInfo() const { return GroupInfos; }
+    bool HasMaterial() const { return bHasMaterial; }
+
+    uint64 GetMeshGroupCount() const { return GroupInfos.size(); }
+
+    // LOD0 포함 LOD 개수. LOD1..N은 LOD0과 정점 버퍼를 공유하고 인덱스 버퍼 뒤쪽에 이어 붙어 있음
+    int32 GetNumLODs() const { return 1 + static_cast<int32>(LODInfos.size()); }
+    const TArray<FGroupInfo>& GetLODGroupInfos(int32 LODIndex) const { return LODIndex <= 0 ? GroupInfos : LODInfos[LODIndex - 1].GroupInfos; }
+    // LODIndex의 그룹 StartIndex에 더할 인덱스 버퍼 내 시작 위치
+    uint32 GetLODIndexOffset(int32 LODIndex) const { return LODIndex <= 0 ? 0 : LODIndexOffsets[LODIndex - 1]; }
+    // 이 LOD를 쓸 수 있는 최대 화면 크기 (경계 구 지름 / 화면 높이). LOD0은 1
+    float GetLODScreenSize(int32 LODIndex) const { return LODIndex <= 0 ? 1.0f : LODInfos[LODIndex - 1].ScreenSize; }
     
     FAABB GetLocalBound() const {return LocalBound; }
     
     const FString& GetCacheFilePath() const { return CacheFilePath; }
 
+    // 상주 관리: 파일에서 로드한 메시만 축출 (GPU 버퍼 + ObjManager가 소유한 CPU 에셋 해제, 다시 Load)
+    bool SupportsEviction() const override { return bFileBacked; }
+    void EvictResidentData() override;
+    bool ReloadResidentData(ID3D11Device* InDevice) override;
+    uint64 GetCPUMemoryBytes() const override;
+    uint64 GetGPUMemoryBytes() const override;
+
 private:
     void CreateVertexBuffer(FMeshData* InMeshData, ID3D11Device* InDevice, EVertexLayoutType InVertexType);
 	void CreateVertexBuffer(FStaticMesh* InStaticMesh, ID3D11Device* InDevice, EVertexLayoutType InVertexType);
     void CreateIndexBuffer(FMeshData* InMeshData, ID3D11Device* InDevice);
 	void CreateIndexBuffer(FStaticMesh* InStaticMesh, ID3D11Device* InDevice);
     void CreateLocalBound(const FMeshData* InMeshData);
-    void CreateLocalBound(const FStaticMesh* InStaticMesh);
+    void CreateLocalBound(const TArray<FVector>& InPositions);
+    // 업로드 후에도 필요한 부분(그룹/LOD 정보, 충돌 스트림)만 복사
+    void CacheResidentInfo(const FStaticMesh* InStaticMesh);
+    void ClearResidentInfo();
     void ReleaseResources();
 
     FString CacheFilePath;  // 캐시된 소스 경로 (예: DerivedDataCache/cube.obj.bin)
+    bool bFileBacked = false;   // 파일 경로로 로드했는지 (FMeshData로 만든 그리드/축 등은 축출하지 않음)
 
     // GPU 리소스
     ID3D11Buffer* VertexBuffer = nullptr;
     ID3D11Buffer* IndexBuffer = nullptr;
     uint32 VertexCount = 0;     // 정점 개수
     uint32 IndexCount = 0;     // 버텍스 점의 개수 
+    uint32 TotalIndexCount = 0;     // 인덱스 버퍼 전체 (LOD0 + LOD1..N)
+    TArray<uint32> LODIndexOffsets; // LOD1..N의 인덱스 버퍼 내 시작 위치
     uint32 VertexStride = 0;
     EVertexLayoutType VertexType = EVertexLayoutType::PositionColorTexturNormal;  // Stride를 계산하기 위한 버텍스 타입
 
 	// CPU 리소스
-    FStaticMesh* StaticMeshAsset = nullptr;
+    FStaticMesh* StaticMeshAsset = nullptr;     // 전체 데이터 (ObjManager 캐시 소유). CollisionOnly면 업로드 후 해제
+    EMeshCPUResidency CPUResidency = UResourceBase::GetDefaultMeshCPUResidency();
+    bool bHasMeshData = false;
+
+    // StaticMeshAsset 해제 후에도 유지하는 정보
+    FString AssetPathFileName;
+    TArray<FGroupInfo> GroupInfos;
+    TArray<FStaticMeshLOD> LODInfos;            // GroupInfos/ScreenSize만 (Indices는 비움)
+    bool bHasMaterial = false;
+    TArray<FVector> CollisionPositions;
+    TArray<uint32> CollisionIndices;
 
     // 메시 단위 BVH (ResourceManager에서 캐싱, 소유)
     // 초기화되지 않는 멤버변수 (참조도 ResourceManager에서만 이루어짐) 
     // FMeshBVH* MeshBVH = nullptr;
 
-    // 로컬 AABB. (스태틱메시 액터 전체 경계 계산에 사용. StaticMeshAsset 로드할 때마다 갱신)
+    // 로컬 AABB. (스태틱메시 액터 전체 경계 계산에 사용. Load할 때마다 갱신)
     FAABB LocalBound;
 };
 
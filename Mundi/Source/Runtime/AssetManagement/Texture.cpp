@@ -1,17 +1,88 @@
 ﻿#include "pch.h"
 #include "Texture.h"
-#include "TextureConverter.h"
+#include "TextureCooker.h"
 #include "DDSTextureLoader.h"
 #include "WICTextureLoader.h"
 #include <filesystem>
 
 IMPLEMENT_CLASS(UTexture)
 
+namespace
+{
+	// UTF-8 -> UTF-16 (Windows) 안전 변환: 한글/비ASCII 경로 대응
+	std::wstring ToWidePath(const FString& InPath)
+	{
+		std::wstring WFilePath;
+		int needed = ::MultiByteToWideChar(CP_UTF8, 0, InPath.c_str(), -1, nullptr, 0);
+		if (needed > 0)
+		{
+			WFilePath.resize(needed - 1);
+			::MultiByteToWideChar(CP_UTF8, 0, InPath.c_str(), -1, WFilePath.data(), needed);
+		}
+		else
+		{
+			int needA = ::MultiByteToWideChar(CP_ACP, 0, InPath.c_str(), -1, nullptr, 0);
+			if (needA > 0)
+			{
+				WFilePath.resize(needA - 1);
+				::MultiByteToWideChar(CP_ACP, 0, InPath.c_str(), -1, WFilePath.data(), needA);
+			}
+		}
+		return WFilePath;
+	}
+
+	// 텍셀당 비트 수 (BC 포맷은 4x4 블록 기준 환산값)
+	uint32 GetBitsPerPixel(DXGI_FORMAT InFormat)
+	{
+		switch (InFormat)
+		{
+		case DXGI_FORMAT_R32G32B32A32_FLOAT:
+		case DXGI_FORMAT_R32G32B32A32_UINT:
+			return 128;
+		case DXGI_FORMAT_R16G16B16A16_FLOAT:
+		case DXGI_FORMAT_R16G16B16A16_UNORM:
+		case DXGI_FORMAT_R32G32_FLOAT:
+			return 64;
+		case DXGI_FORMAT_R8G8_UNORM:
+		case DXGI_FORMAT_R16_FLOAT:
+		case DXGI_FORMAT_R16_UNORM:
+			return 16;
+		case DXGI_FORMAT_R8_UNORM:
+		case DXGI_FORMAT_A8_UNORM:
+		case DXGI_FORMAT_BC2_UNORM:
+		case DXGI_FORMAT_BC2_UNORM_SRGB:
+		case DXGI_FORMAT_BC3_UNORM:
+		case DXGI_FORMAT_BC3_UNORM_SRGB:
+		case DXGI_FORMAT_BC5_UNORM:
+		case DXGI_FORMAT_BC5_SNORM:
+		case DXGI_FORMAT_BC6H_UF16:
+		case DXGI_FORMAT_BC6H_SF16:
+		case DXGI_FORMAT_BC7_UNORM:
+		case DXGI_FORMAT_BC7_UNORM_SRGB:
+			return 8;
+		case DXGI_FORMAT_BC1_UNORM:
+		case DXGI_FORMAT_BC1_UNORM_SRGB:
+		case DXGI_FORMAT_BC4_UNORM:
+		case DXGI_FORMAT_BC4_SNORM:
+			return 4;
+		default:
+			return 32;
+		}
+	}
+
+	bool IsBlockCompressed(DXGI_FORMAT InFormat)
+	{
+		return (InFormat >= DXGI_FORMAT_BC1_TYPELESS && InFormat <= DXGI_FORMAT_BC5_SNORM)
+			|| (InFormat >= DXGI_FORMAT_BC6H_TYPELESS && InFormat <= DXGI_FORMAT_BC7_UNORM_SRGB);
+	}
+}
+
 UTexture::UTexture()
 {
 	Width = 0;
 	Height = 0;
 	Format = DXGI_FORMAT_UNKNOWN;
+	GPUMemoryBytes = 0;
 }
 
 UTexture::~UTexture()
@@ -19,12 +90,12 @@ UTexture::~UTexture()
 	ReleaseResources();
 }
 
-void UTexture::Load(const FString& InFilePath, ID3D11Device* InDevice, bool bSRGB)
+bool UTexture::PrepareSource(const FString& InFilePath, bool bSRGB, FTextureSourceData& OutSource)
 {
-	assert(InDevice);
-
 	// 실제로 로드할 파일 경로 결정
-	FString ActualLoadPath = InFilePath;
+	OutSource.LoadPath = InFilePath;
+	OutSource.CacheFilePath.clear();
+	OutSource.FileBytes.Empty();
 
 #ifdef USE_DDS_CACHE
 	// DDS 캐싱 활성화 시: DDS 변환 및 캐시 사용
@@ -37,35 +108,21 @@ void UTexture::Load(const FString& InFilePath, ID3D11Device* InDevice, bool bSRG
 		// DDS가 아닌 경우 → DDS 캐시 확인 및 생성
 		if (Extension != ".dds")
 		{
-			FString DDSCachePath = FTextureConverter::GetDDSCachePath(InFilePath);
-
-			// 캐시 유효성 검사
-			if (FTextureConverter::ShouldRegenerateDDS(InFilePath, DDSCachePath))
+			// 파생 데이터 캐시 키: 원본 내용 + 쿡 설정 (포맷은 내용과 bSRGB로 자동 선택: BC1/BC3/BC7, 리니어는 BC5)
+			FString DDSCachePath;
+			if (FTextureCooker::CookToCache(InFilePath, bSRGB, DDSCachePath))
 			{
-				UE_LOG("[UTexture] Converting texture to DDS: %s", InFilePath.c_str());
-
-					// DDS 변환 시도 (bSRGB 파라미터 전달)
-				DXGI_FORMAT TargetFormat = FTextureConverter::GetRecommendedFormat(true, bSRGB); // 알파는 일단 true로 가정
-				if (FTextureConverter::ConvertToDDS(InFilePath, DDSCachePath, TargetFormat))
-				{
-					ActualLoadPath = DDSCachePath; // DDS 캐시 사용
-				}
-				else
-				{
-					UE_LOG("[UTexture] DDS conversion failed, loading original format: %s", InFilePath.c_str());
-					// 변환 실패 시 원본 포맷으로 로드 (fallback)
-				}
+				OutSource.LoadPath = DDSCachePath; // DDS 캐시 사용
 			}
 			else
 			{
-				// 기존 DDS 캐시 사용
-				ActualLoadPath = DDSCachePath;
-				UE_LOG("[UTexture] Using cached DDS: %s", DDSCachePath.c_str());
+				// 변환 실패 시 원본 포맷으로 로드 (fallback)
+				UE_LOG("[UTexture] DDS conversion failed, loading original format: %s", InFilePath.c_str());
 			}
 
 			// 경로 정규화: 모든 백슬래시를 슬래시로 변환하여 일관성 유지
 			FString NormalizedCachePath = NormalizePath(DDSCachePath);
-			CacheFilePath = NormalizedCachePath;   // 실제 로드된 경로 저장 (DDS 캐시 사용 시 DDS 경로, 정규화됨)
+			OutSource.CacheFilePath = NormalizedCachePath;   // 실제 로드된 경로 저장 (DDS 캐시 사용 시 DDS 경로, 정규화됨)
 		}
 	}
 #else
@@ -73,22 +130,41 @@ void UTexture::Load(const FString& InFilePath, ID3D11Device* InDevice, bool bSRG
 	UE_LOG("[UTexture] Loading original texture (DDS cache disabled): %s", InFilePath.c_str());
 #endif
 
-	// UTF-8 -> UTF-16 (Windows) 안전 변환: 한글/비ASCII 경로 대응
-	int needed = ::MultiByteToWideChar(CP_UTF8, 0, ActualLoadPath.c_str(), -1, nullptr, 0);
-	std::wstring WFilePath;
-	if (needed > 0)
+	// 파일 내용을 메모리로 읽어 둠 (GPU 리소스 생성은 게임 스레드에서 메모리로부터)
+	std::ifstream File{ std::filesystem::path(ToWidePath(OutSource.LoadPath)), std::ios::binary | std::ios::ate };
+	if (!File)
 	{
-		WFilePath.resize(needed - 1);
-		::MultiByteToWideChar(CP_UTF8, 0, ActualLoadPath.c_str(), -1, WFilePath.data(), needed);
+		return false;
 	}
-	else
+	const std::streamsize FileSize = File.tellg();
+	if (FileSize <= 0)
 	{
-		int needA = ::MultiByteToWideChar(CP_ACP, 0, ActualLoadPath.c_str(), -1, nullptr, 0);
-		if (needA > 0)
-		{
-			WFilePath.resize(needA - 1);
-			::MultiByteToWideChar(CP_ACP, 0, ActualLoadPath.c_str(), -1, WFilePath.data(), needA);
-		}
+		return false;
+	}
+	OutSource.FileBytes.SetNum(static_cast<int32>(FileSize));
+	File.seekg(0, std::ios::beg);
+	return static_cast<bool>(File.read(reinterpret_cast<char*>(OutSource.FileBytes.data()), FileSize));
+}
+
+void UTexture::Load(const FString& InFilePath, ID3D11Device* InDevice, bool bSRGB)
+{
+	FTextureSourceData Source;
+	PrepareSource(InFilePath, bSRGB, Source);
+	Load(InFilePath, InDevice, Source, bSRGB);
+}
+
+void UTexture::Load(const FString& InFilePath, ID3D11Device* InDevice, const FTextureSourceData& InSource, bool bSRGB)
+{
+	assert(InDevice);
+
+	// 축출 후 같은 설정으로 다시 로드하기 위해 기억
+	bLoadedAsSRGB = bSRGB;
+	bFileBacked = true;
+
+	const FString& ActualLoadPath = InSource.LoadPath.empty() ? InFilePath : InSource.LoadPath;
+	if (!InSource.CacheFilePath.empty())
+	{
+		CacheFilePath = InSource.CacheFilePath;
 	}
 
 	// 최종 로드할 파일의 확장자 재확인
@@ -96,38 +172,58 @@ void UTexture::Load(const FString& InFilePath, ID3D11Device* InDevice, bool bSRG
 	std::wstring ext = LoadPath.has_extension() ? LoadPath.extension().wstring() : L"";
 	for (auto& ch : ext) ch = static_cast<wchar_t>(::towlower(ch));
 
+	// 미리 읽어 둔 내용이 있으면 메모리에서, 없으면 (읽기 실패) 파일에서 직접 생성
+	const bool bFromMemory = !InSource.FileBytes.IsEmpty();
+	const std::wstring WFilePath = bFromMemory ? std::wstring() : ToWidePath(ActualLoadPath);
+
 	HRESULT hr = E_FAIL;
 	if (ext == L".dds")
 	{
 		// DDS 로딩: Ex 버전 사용하여 sRGB 지정
-		hr = DirectX::CreateDDSTextureFromFileEx(
-			InDevice,
-			WFilePath.c_str(),
-			0, // maxsize (0 = no limit)
-			D3D11_USAGE_DEFAULT,
-			D3D11_BIND_SHADER_RESOURCE,
-			0, // cpuAccessFlags
-			0, // miscFlags
-			bSRGB ? DirectX::DDS_LOADER_FORCE_SRGB : DirectX::DDS_LOADER_DEFAULT,
-			reinterpret_cast<ID3D11Resource**>(&Texture2D),
-			&ShaderResourceView
-		);
+		const DirectX::DDS_LOADER_FLAGS LoadFlags = bSRGB ? DirectX::DDS_LOADER_FORCE_SRGB : DirectX::DDS_LOADER_DEFAULT;
+		hr = bFromMemory
+			? DirectX::CreateDDSTextureFromMemoryEx(
+				InDevice,
+				InSource.FileBytes.data(), InSource.FileBytes.size(),
+				0, // maxsize (0 = no limit)
+				D3D11_USAGE_DEFAULT,
+				D3D11_BIND_SHADER_RESOURCE,
+				0, // cpuAccessFlags
+				0, // miscFlags
+				LoadFlags,
+				reinterpret_cast<ID3D11Resource**>(&Texture2D),
+				&ShaderResourceView)
+			: DirectX::CreateDDSTextureFromFileEx(
+				InDevice,
+				WFilePath.c_str(),
+				0, D3D11_USAGE_DEFAULT, D3D11_BIND_SHADER_RESOURCE, 0, 0,
+				LoadFlags,
+				reinterpret_cast<ID3D11Resource**>(&Texture2D),
+				&ShaderResourceView);
 	}
 	else
 	{
 		// WIC 로딩: Ex 버전 사용하여 sRGB 지정
-		hr = DirectX::CreateWICTextureFromFileEx(
-			InDevice,
-			WFilePath.c_str(),
-			0, // maxsize (0 = no limit)
-			D3D11_USAGE_DEFAULT,
-			D3D11_BIND_SHADER_RESOURCE,
-			0, // cpuAccessFlags
-			0, // miscFlags
-			bSRGB ? DirectX::WIC_LOADER_FORCE_SRGB : DirectX::WIC_LOADER_DEFAULT,
-			reinterpret_cast<ID3D11Resource**>(&Texture2D),
-			&ShaderResourceView
-		);
+		const DirectX::WIC_LOADER_FLAGS LoadFlags = bSRGB ? DirectX::WIC_LOADER_FORCE_SRGB : DirectX::WIC_LOADER_DEFAULT;
+		hr = bFromMemory
+			? DirectX::CreateWICTextureFromMemoryEx(
+				InDevice,
+				InSource.FileBytes.data(), InSource.FileBytes.size(),
+				0, // maxsize (0 = no limit)
+				D3D11_USAGE_DEFAULT,
+				D3D11_BIND_SHADER_RESOURCE,
+				0, // cpuAccessFlags
+				0, // miscFlags
+				LoadFlags,
+				reinterpret_cast<ID3D11Resource**>(&Texture2D),
+				&ShaderResourceView)
+			: DirectX::CreateWICTextureFromFileEx(
+				InDevice,
+				WFilePath.c_str(),
+				0, D3D11_USAGE_DEFAULT, D3D11_BIND_SHADER_RESOURCE, 0, 0,
+				LoadFlags,
+				reinterpret_cast<ID3D11Resource**>(&Texture2D),
+				&ShaderResourceView);
 	}
 
 	if (SUCCEEDED(hr))
@@ -140,6 +236,7 @@ void UTexture::Load(const FString& InFilePath, ID3D11Device* InDevice, bool bSRG
 			Height = desc.Height;
 			Format = desc.Format;
 		}
+		UpdateGPUMemoryBytes();
 	}
 	else
 	{
@@ -147,6 +244,78 @@ void UTexture::Load(const FString& InFilePath, ID3D11Device* InDevice, bool bSRG
 	}
 }
 
+bool UTexture::ReloadResidentData(ID3D11Device* InDevice)
+{
+	ReleaseResources();
+	Load(FilePath, InDevice, bLoadedAsSRGB);
+	return ShaderResourceView != nullptr;
+}
+
+void UTexture::UpdateGPUMemoryBytes()
+{
+	GPUMemoryBytes = 0;
+	if (!Texture2D)
+	{
+		return;
+	}
+
+	D3D11_TEXTURE2D_DESC Desc;
+	Texture2D->GetDesc(&Desc);
+
+	const uint64 BitsPerPixel = GetBitsPerPixel(Desc.Format);
+	const bool bBlockCompressed = IsBlockCompressed(Desc.Format);
+	for (uint32 Mip = 0; Mip < std::max(1u, Desc.MipLevels); ++Mip)
+	{
+		uint64 MipWidth = std::max(1u, Desc.Width >> Mip);
+		uint64 MipHeight = std::max(1u, Desc.Height >> Mip);
+		if (bBlockCompressed)
+		{
+			// 4x4 블록 단위로 올림
+			MipWidth = (MipWidth + 3) & ~3ull;
+			MipHeight = (MipHeight + 3) & ~3ull;
+		}
+		GPUMemoryBytes += MipWidth * MipHeight * BitsPerPixel / 8;
+	}
+	GPUMemoryBytes *= std::max(1u, Desc.ArraySize);
+}
+
+void UTexture::CreateSolidColor(ID3D11Device* InDevice, uint32 InColorRGBA)
+{
+	assert(InDevice);
+	ReleaseResources();
+
+	D3D11_TEXTURE2D_DESC Desc = {};
+	Desc.Width = 1;
+	Desc.Height = 1;
+	Desc.MipLevels = 1;
+	Desc.ArraySize = 1;
+	Desc.Format = DXGI_FORMAT_R8G8B8A8_UNORM_SRGB;
+	Desc.SampleDesc.Count = 1;
+	Desc.Usage = D3D11_USAGE_IMMUTABLE;
+	Desc.BindFlags = D3D11_BIND_SHADER_RESOURCE;
+
+	D3D11_SUBRESOURCE_DATA InitData = {};
+	InitData.pSysMem = &InColorRGBA;
+	InitData.SysMemPitch = sizeof(uint32);
+
+	HRESULT hr = InDevice->CreateTexture2D(&Desc, &InitData, &Texture2D);
+	if (SUCCEEDED(hr))
+	{
+		hr = InDevice->CreateShaderResourceView(Texture2D, nullptr, &ShaderResourceView);
+	}
+	if (FAILED(hr))
+	{
+		UE_LOG("[UTexture] Failed to create solid color texture (HRESULT: 0x%08X)", hr);
+		ReleaseResources();
+		return;
+	}
+
+	Width = 1;
+	Height = 1;
+	Format = Desc.Format;
+	UpdateGPUMemoryBytes();
+}
+
 void UTexture::ReleaseResources()
 {
 	if (Texture2D)
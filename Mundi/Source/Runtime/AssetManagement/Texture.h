@@ -2,6 +2,14 @@
 #include "ResourceBase.h"
 #include <d3d11.h>
 
+// 게임 스레드 밖에서 준비할 수 있는 텍스처 원본 (DDS 캐시 변환 + 파일 읽기 결과)
+struct FTextureSourceData
+{
+	FString LoadPath;          // 실제로 읽은 파일 (DDS 캐시 또는 원본)
+	FString CacheFilePath;     // DDS 캐시 경로 (캐시를 쓰지 않으면 비어 있음)
+	TArray<uint8> FileBytes;   // 파일 내용 (읽기 실패 시 비어 있음)
+};
+
 class UTexture : public UResourceBase
 {
 public:
@@ -14,6 +22,15 @@ public:
 	// bSRGB: true = sRGB 포맷 사용 (Diffuse/Albedo 텍스처), false = Linear 포맷 (Normal/Data 텍스처)
 	void Load(const FString& InFilePath, ID3D11Device* InDevice, bool bSRGB = true);
 
+	// 미리 준비한 원본으로 GPU 리소스만 생성 (게임 스레드)
+	void Load(const FString& InFilePath, ID3D11Device* InDevice, const FTextureSourceData& InSource, bool bSRGB = true);
+
+	// DDS 캐시 확인/변환 + 파일 읽기. 디바이스와 UObject에 접근하지 않으므로 워커 스레드에서 호출 가능 (WIC 변환을 위해 COM 초기화 필요)
+	static bool PrepareSource(const FString& InFilePath, bool bSRGB, FTextureSourceData& OutSource);
+
+	// 1x1 단색 텍스처 생성 (비동기 로드 플레이스홀더 등). InColorRGBA = 0xAABBGGRR
+	void CreateSolidColor(ID3D11Device* InDevice, uint32 InColorRGBA);
+
 	ID3D11ShaderResourceView* GetShaderResourceView() const { return ShaderResourceView; }
 	ID3D11Texture2D* GetTexture2D() const { return Texture2D; }
 
@@ -26,11 +43,24 @@ public:
 
 	void ReleaseResources();
 
+	bool IsSRGB() const { return bLoadedAsSRGB; }
+
+	// 상주 관리: 파일에서 로드한 텍스처만 축출 (GPU 리소스만 해제하고 같은 bSRGB로 다시 로드)
+	bool SupportsEviction() const override { return bFileBacked; }
+	void EvictResidentData() override { ReleaseResources(); }
+	bool ReloadResidentData(ID3D11Device* InDevice) override;
+	uint64 GetGPUMemoryBytes() const override { return GPUMemoryBytes; }
+
 private:
+	void UpdateGPUMemoryBytes();
+
 	FString CacheFilePath;  // 캐시된 소스 경로 (예: DerivedDataCache/cube_texture.png.dds)
+	bool bLoadedAsSRGB = true;
+	bool bFileBacked = false;
+	uint64 GPUMemoryBytes = 0;
 
-	ID3D11Texture2D* Texture2D;
-	ID3D11ShaderResourceView* ShaderResourceView;
+	ID3D11Texture2D* Texture2D = nullptr;
+	ID3D11ShaderResourceView* ShaderResourceView = nullptr;
 
 	uint32 Width = 0;
 	uint32 Height = 0;
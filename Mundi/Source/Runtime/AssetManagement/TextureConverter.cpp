@@ -5,175 +5,384 @@
 
 #include "pch.h"
 #include "TextureConverter.h"
+#include "TaskScheduler.h"
 #include <DirectXTex.h>
 #include <algorithm>
+#include <atomic>
+#include <cstring>
+#include <memory>
 
-bool FTextureConverter::ConvertToDDS(
-	const FString& SourcePath,
-	const FString& OutputPath,
-	DXGI_FORMAT Format)
+namespace
 {
-	using namespace DirectX;
-
-	// 1. 원본 이미지 로드
-	std::wstring WSourcePath = UTF8ToWide(SourcePath);
-	std::filesystem::path SourceFile(WSourcePath);
+	// 블록 압축 작업 단위 줄 수 (BC 블록 높이 4의 배수). 2K 텍스처의 밉 0이 32조각으로 나뉨
+	constexpr uint32 CompressStripRows = 64;
 
-	if (!std::filesystem::exists(SourceFile))
+	// 워커 스레드의 WIC 사용(원본 디코드)을 위한 COM 초기화 범위. 이미 다른 모드로 초기화된 스레드는 그대로 둠
+	struct FScopedCOMInitialize
 	{
-		UE_LOG("[TextureConverter] Source file not found: %s", SourcePath.c_str());
-		return false;
-	}
-
-	TexMetadata metadata;
-	ScratchImage image;
-
-	// 파일 확장자에 따라 로드
-	std::wstring ext = SourceFile.extension().wstring();
-	std::transform(ext.begin(), ext.end(), ext.begin(), ::towlower);
-
-	HRESULT hr = E_FAIL;
+		FScopedCOMInitialize() : Result(CoInitializeEx(nullptr, COINIT_MULTITHREADED)) {}
+		~FScopedCOMInitialize()
+		{
+			if (SUCCEEDED(Result))
+			{
+				CoUninitialize();
+			}
+		}
+		HRESULT Result;
+	};
 
-	if (ext == L".dds")
-	{
-		// 이미 DDS 포맷이면 변환 불필요
-		return true;
-	}
-	else if (ext == L".tga")
+	// CookBatch의 텍스처 하나 (단계 사이에 디코드/압축 결과를 들고 있음)
+	struct FTextureCookJob
 	{
-		hr = LoadFromTGAFile(WSourcePath.c_str(), &metadata, image);
-	}
-	else if (ext == L".hdr")
+		const FTextureCookRequest* Request = nullptr;
+		FTextureCookResult* Result = nullptr;
+		DirectX::ScratchImage Source;       // 디코드 + 밉 체인 (비압축)
+		DirectX::ScratchImage Cooked;       // 블록 압축 결과 (Source와 이미지 순서가 같음)
+		DXGI_FORMAT Format = DXGI_FORMAT_UNKNOWN;
+		bool bReady = false;                // 디코드 성공
+		std::atomic<bool> bCompressFailed{ false };
+	};
+
+	// 블록 압축 작업 하나: Source 이미지 ImageIndex의 [Row, Row + NumRows) 줄
+	struct FCompressStrip
 	{
-		hr = LoadFromHDRFile(WSourcePath.c_str(), &metadata, image);
-	}
-	else
+		int32 JobIndex;
+		uint32 ImageIndex;
+		uint32 Row;
+		uint32 NumRows;
+	};
+
+	DXGI_FORMAT SelectCookFormat(const DirectX::ScratchImage& InImage, bool bSRGB, ETextureCompressionQuality InQuality)
 	{
-		// 일반적인 포맷(PNG, JPG, BMP 등)은 WIC 사용
-		hr = LoadFromWICFile(WSourcePath.c_str(), WIC_FLAGS_NONE, &metadata, image);
+		// 리니어 텍스처는 노멀맵에서만 쓰므로 RG 두 채널을 따로 압축하는 BC5 (셰이더에서 Z 복원)
+		if (!bSRGB)
+		{
+			return DXGI_FORMAT_BC5_UNORM;
+		}
+		if (InQuality == ETextureCompressionQuality::High)
+		{
+			return DXGI_FORMAT_BC7_UNORM_SRGB;
+		}
+		// 알파가 모두 불투명이면 절반 크기의 BC1
+		return InImage.IsAlphaAllOpaque() ? DXGI_FORMAT_BC1_UNORM_SRGB : DXGI_FORMAT_BC3_UNORM_SRGB;
 	}
 
-	if (FAILED(hr))
+	DirectX::TEX_COMPRESS_FLAGS GetCompressFlags(DXGI_FORMAT InFormat)
 	{
-		UE_LOG("[TextureConverter] Failed to load source image: %s (HRESULT: 0x%08X)",
-		       SourcePath.c_str(), hr);
-		return false;
+		using namespace DirectX;
+		switch (InFormat)
+		{
+		case DXGI_FORMAT_BC7_UNORM:
+		case DXGI_FORMAT_BC7_UNORM_SRGB:
+			return TEX_COMPRESS_BC7_QUICK;
+		case DXGI_FORMAT_BC4_UNORM:
+		case DXGI_FORMAT_BC5_UNORM:
+			return TEX_COMPRESS_DEFAULT;
+		default:
+			return TEX_COMPRESS_DITHER;
+		}
 	}
 
-	// 2. 블록 압축 사용 시 4픽셀 정렬로 리사이즈
-	if (IsCompressed(Format))
+	// 1단계: 원본 디코드 → 4픽셀 정렬 → 밉맵 → 포맷 결정
+	void DecodeCookJob(FTextureCookJob& Job, bool bGenerateMips, ETextureCompressionQuality InQuality)
 	{
-		size_t width = metadata.width;
-		size_t height = metadata.height;
+		using namespace DirectX;
 
-		// 4의 배수로 올림
-		size_t alignedWidth = (width + 3) & ~3;
-		size_t alignedHeight = (height + 3) & ~3;
+		const FTextureCookRequest& Request = *Job.Request;
+		std::wstring WSourcePath = UTF8ToWide(Request.SourcePath);
+		std::filesystem::path SourceFile(WSourcePath);
 
-		if (width != alignedWidth || height != alignedHeight)
+		std::error_code Error;
+		const uintmax_t SourceFileBytes = std::filesystem::file_size(SourceFile, Error);
+		if (Error)
 		{
-			UE_LOG("[TextureConverter] Resizing %s from %dx%d to %dx%d for block compression",
-			       SourcePath.c_str(), (int)width, (int)height,
-			       (int)alignedWidth, (int)alignedHeight);
+			UE_LOG("[TextureConverter] Source file not found: %s", Request.SourcePath.c_str());
+			return;
+		}
+		Job.Result->SourceFileBytes = static_cast<uint64>(SourceFileBytes);
 
-			ScratchImage resized;
-			hr = Resize(image.GetImages(), image.GetImageCount(), metadata,
-			            alignedWidth, alignedHeight, TEX_FILTER_DEFAULT, resized);
+		TexMetadata metadata;
+		ScratchImage image;
 
-			if (SUCCEEDED(hr))
-			{
-				image = std::move(resized);
-				metadata = image.GetMetadata();
-			}
-			else
+		// 파일 확장자에 따라 로드
+		std::wstring ext = SourceFile.extension().wstring();
+		std::transform(ext.begin(), ext.end(), ext.begin(), ::towlower);
+
+		HRESULT hr = E_FAIL;
+
+		if (ext == L".dds")
+		{
+			UE_LOG("[TextureConverter] Already a DDS file, nothing to cook: %s", Request.SourcePath.c_str());
+			return;
+		}
+		else if (ext == L".tga")
+		{
+			hr = LoadFromTGAFile(WSourcePath.c_str(), &metadata, image);
+		}
+		else if (ext == L".hdr")
+		{
+			hr = LoadFromHDRFile(WSourcePath.c_str(), &metadata, image);
+		}
+		else
+		{
+			// 일반적인 포맷(PNG, JPG, BMP 등)은 WIC 사용
+			hr = LoadFromWICFile(WSourcePath.c_str(), WIC_FLAGS_NONE, &metadata, image);
+		}
+
+		if (FAILED(hr))
+		{
+			UE_LOG("[TextureConverter] Failed to load source image: %s (HRESULT: 0x%08X)",
+			       Request.SourcePath.c_str(), hr);
+			return;
+		}
+
+		Job.Format = Request.ForcedFormat != DXGI_FORMAT_UNKNOWN
+			? Request.ForcedFormat
+			: SelectCookFormat(image, Request.bSRGB, InQuality);
+
+		// 2. 블록 압축 사용 시 4픽셀 정렬로 리사이즈
+		if (IsCompressed(Job.Format))
+		{
+			size_t width = metadata.width;
+			size_t height = metadata.height;
+
+			// 4의 배수로 올림
+			size_t alignedWidth = (width + 3) & ~3;
+			size_t alignedHeight = (height + 3) & ~3;
+
+			if (width != alignedWidth || height != alignedHeight)
 			{
-				UE_LOG("[TextureConverter] Warning: Resize failed, continuing with original size");
+				UE_LOG("[TextureConverter] Resizing %s from %dx%d to %dx%d for block compression",
+				       Request.SourcePath.c_str(), (int)width, (int)height,
+				       (int)alignedWidth, (int)alignedHeight);
+
+				ScratchImage resized;
+				hr = Resize(image.GetImages(), image.GetImageCount(), metadata,
+				            alignedWidth, alignedHeight, TEX_FILTER_DEFAULT, resized);
+
+				if (SUCCEEDED(hr))
+				{
+					image = std::move(resized);
+					metadata = image.GetMetadata();
+				}
+				else
+				{
+					UE_LOG("[TextureConverter] Warning: Resize failed, continuing with original size");
+				}
 			}
 		}
-	}
 
-	// 3. 필요 시 밉맵 생성
-	ScratchImage mipChain;
-	if (bShouldGenerateMipmaps && metadata.mipLevels == 1)
-	{
-		hr = GenerateMipMaps(image.GetImages(), image.GetImageCount(), metadata,
-		                     TEX_FILTER_DEFAULT, 0, mipChain);
-		if (SUCCEEDED(hr))
+		// 3. 필요 시 밉맵 생성
+		ScratchImage mipChain;
+		if (bGenerateMips && metadata.mipLevels == 1)
 		{
-			image = std::move(mipChain);
-			metadata = image.GetMetadata();
+			hr = GenerateMipMaps(image.GetImages(), image.GetImageCount(), metadata,
+			                     TEX_FILTER_DEFAULT, 0, mipChain);
+			if (SUCCEEDED(hr))
+			{
+				image = std::move(mipChain);
+				metadata = image.GetMetadata();
+			}
 		}
+
+		Job.Source = std::move(image);
+		Job.Result->Width = static_cast<uint32>(metadata.width);
+		Job.Result->Height = static_cast<uint32>(metadata.height);
+		Job.Result->MipLevels = static_cast<uint32>(metadata.mipLevels);
+		Job.Result->UncompressedBytes = static_cast<uint64>(Job.Source.GetPixelsSize());
+		Job.bReady = true;
 	}
 
-	// 4. 대상 포맷으로 압축
-	ScratchImage compressed;
-	if (IsCompressed(Format))
+	// 2단계: 줄 묶음 하나를 압축해 Cooked의 같은 위치에 복사
+	void CompressStrip(FTextureCookJob& Job, const FCompressStrip& Strip)
 	{
-		// 빠른 멀티스레드 압축
-		hr = Compress(image.GetImages(), image.GetImageCount(), metadata,
-		              Format, TEX_COMPRESS_PARALLEL | TEX_COMPRESS_DITHER,
-		              TEX_THRESHOLD_DEFAULT, compressed);
+		using namespace DirectX;
+
+		Image SourceStrip = Job.Source.GetImages()[Strip.ImageIndex];
+		SourceStrip.pixels += static_cast<size_t>(Strip.Row) * SourceStrip.rowPitch;
+		SourceStrip.height = Strip.NumRows;
+		SourceStrip.slicePitch = SourceStrip.rowPitch * Strip.NumRows;
 
+		ScratchImage Compressed;
+		const HRESULT hr = Compress(SourceStrip, Job.Format, GetCompressFlags(Job.Format), TEX_THRESHOLD_DEFAULT, Compressed);
 		if (FAILED(hr))
 		{
-			UE_LOG("[TextureConverter] Compression failed: %s (HRESULT: 0x%08X)",
-			       SourcePath.c_str(), hr);
-			return false;
+			Job.bCompressFailed = true;
+			return;
 		}
-	}
-	else
-	{
-		// 비압축 포맷은 그냥 변환
-		compressed = std::move(image);
-	}
 
-	// 5. 출력 경로 결정
-	FString FinalOutputPath = OutputPath.empty() ? GetDDSCachePath(SourcePath) : OutputPath;
-	EnsureCacheDirectoryExists(FinalOutputPath);
-
-	// 6. DDS로 저장
-	std::wstring WOutputPath = UTF8ToWide(FinalOutputPath);
-	hr = SaveToDDSFile(compressed.GetImages(), compressed.GetImageCount(),
-	                   compressed.GetMetadata(), DDS_FLAGS_NONE, WOutputPath.c_str());
+		const Image& Src = *Compressed.GetImage(0, 0, 0);
+		const Image& Dst = Job.Cooked.GetImages()[Strip.ImageIndex];
+		const size_t BlockRow = Strip.Row / 4;
+		const size_t NumBlockRows = (Strip.NumRows + 3) / 4;
+		const size_t CopyBytes = std::min(Src.rowPitch, Dst.rowPitch);
+		for (size_t Row = 0; Row < NumBlockRows; ++Row)
+		{
+			std::memcpy(Dst.pixels + (BlockRow + Row) * Dst.rowPitch, Src.pixels + Row * Src.rowPitch, CopyBytes);
+		}
+	}
+}
 
-	if (FAILED(hr))
+bool FTextureConverter::ConvertToDDS(
+	const FString& SourcePath,
+	const FString& OutputPath,
+	DXGI_FORMAT Format)
+{
+	std::filesystem::path SourceFile(UTF8ToWide(SourcePath));
+	std::wstring ext = SourceFile.extension().wstring();
+	std::transform(ext.begin(), ext.end(), ext.begin(), ::towlower);
+	if (ext == L".dds")
 	{
-		UE_LOG("[TextureConverter] Failed to save DDS file: %s (HRESULT: 0x%08X)",
-		       FinalOutputPath.c_str(), hr);
-		return false;
+		// 이미 DDS 포맷이면 변환 불필요
+		return true;
 	}
 
-	UE_LOG("[TextureConverter] Successfully converted: %s -> %s",
-	       SourcePath.c_str(), FinalOutputPath.c_str());
-	return true;
+	TArray<FTextureCookRequest> Requests(1);
+	Requests[0].SourcePath = SourcePath;
+	Requests[0].OutputPath = OutputPath.empty() ? GetDDSCachePath(SourcePath) : OutputPath;
+	Requests[0].ForcedFormat = Format;
+
+	TArray<FTextureCookResult> Results;
+	CookBatch(Requests, Results);
+	return Results[0].bSuccess;
 }
 
-bool FTextureConverter::ShouldRegenerateDDS(
-	const FString& SourcePath,
-	const FString& DDSPath)
+void FTextureConverter::CookBatch(
+	const TArray<FTextureCookRequest>& InRequests,
+	TArray<FTextureCookResult>& OutResults)
 {
-	namespace fs = std::filesystem;
+	using namespace DirectX;
 
-	// DDS 캐시 존재 여부 확인
-	fs::path SourceFile(UTF8ToWide(SourcePath));
-	fs::path DDSFile(UTF8ToWide(DDSPath));
+	const int32 NumJobs = InRequests.Num();
+	OutResults.clear();
+	OutResults.resize(NumJobs);
+	if (NumJobs == 0)
+	{
+		return;
+	}
 
-	if (!fs::exists(DDSFile))
+	std::unique_ptr<FTextureCookJob[]> Jobs(new FTextureCookJob[NumJobs]);
+	for (int32 i = 0; i < NumJobs; ++i)
 	{
-		return true; // 캐시가 없으면 재생성
+		Jobs[i].Request = &InRequests[i];
+		Jobs[i].Result = &OutResults[i];
 	}
 
-	if (!fs::exists(SourceFile))
+	FTaskScheduler& Scheduler = FTaskScheduler::GetInstance();
+	const bool bGenerateMips = bShouldGenerateMipmaps;
+	const ETextureCompressionQuality Quality = CompressionQuality;
+
+	// 1. 디코드/밉맵 (텍스처 단위 병렬)
+	Scheduler.ParallelFor(NumJobs, 1, [&](int32 Begin, int32 End)
+		{
+			FScopedCOMInitialize COMInitialize;
+			for (int32 i = Begin; i < End; ++i)
+			{
+				DecodeCookJob(Jobs[i], bGenerateMips, Quality);
+			}
+		});
+
+	// 2. 블록 압축 (텍스처 × 밉 × 줄 묶음 단위 병렬)
+	TArray<FCompressStrip> Strips;
+	for (int32 i = 0; i < NumJobs; ++i)
 	{
-		return false; // 원본이 없으면 기존 캐시 사용
+		FTextureCookJob& Job = Jobs[i];
+		if (!Job.bReady)
+		{
+			continue;
+		}
+		if (!IsCompressed(Job.Format))
+		{
+			// 비압축 포맷은 그냥 변환
+			if (Job.Source.GetMetadata().format == Job.Format)
+			{
+				Job.Cooked = std::move(Job.Source);
+			}
+			else if (FAILED(Convert(Job.Source.GetImages(), Job.Source.GetImageCount(), Job.Source.GetMetadata(),
+			                        Job.Format, TEX_FILTER_DEFAULT, TEX_THRESHOLD_DEFAULT, Job.Cooked)))
+			{
+				Job.bCompressFailed = true;
+			}
+			continue;
+		}
+
+		TexMetadata CookedMetadata = Job.Source.GetMetadata();
+		CookedMetadata.format = Job.Format;
+		if (FAILED(Job.Cooked.Initialize(CookedMetadata)))
+		{
+			Job.bCompressFailed = true;
+			continue;
+		}
+
+		const Image* Images = Job.Source.GetImages();
+		for (uint32 ImageIndex = 0; ImageIndex < static_cast<uint32>(Job.Source.GetImageCount()); ++ImageIndex)
+		{
+			const uint32 Height = static_cast<uint32>(Images[ImageIndex].height);
+			for (uint32 Row = 0; Row < Height; Row += CompressStripRows)
+			{
+				Strips.Add({ i, ImageIndex, Row, std::min(CompressStripRows, Height - Row) });
+			}
+		}
 	}
 
-	// 타임스탬프 비교
-	auto SourceTime = fs::last_write_time(SourceFile);
-	auto DDSTime = fs::last_write_time(DDSFile);
+	Scheduler.ParallelFor(Strips.Num(), 1, [&](int32 Begin, int32 End)
+		{
+			for (int32 i = Begin; i < End; ++i)
+			{
+				FTextureCookJob& Job = Jobs[Strips[i].JobIndex];
+				if (!Job.bCompressFailed)
+				{
+					CompressStrip(Job, Strips[i]);
+				}
+			}
+		});
 
-	// 원본이 캐시보다 최신이면 재생성
-	return SourceTime > DDSTime;
+	// 3. DDS로 저장 (텍스처 단위 병렬)
+	Scheduler.ParallelFor(NumJobs, 1, [&](int32 Begin, int32 End)
+		{
+			for (int32 i = Begin; i < End; ++i)
+			{
+				FTextureCookJob& Job = Jobs[i];
+				const FTextureCookRequest& Request = *Job.Request;
+				if (!Job.bReady)
+				{
+					continue;
+				}
+				if (Job.bCompressFailed)
+				{
+					UE_LOG("[TextureConverter] Compression failed: %s", Request.SourcePath.c_str());
+					continue;
+				}
+
+				EnsureCacheDirectoryExists(Request.OutputPath);
+
+				std::wstring WOutputPath = UTF8ToWide(Request.OutputPath);
+				const HRESULT hr = SaveToDDSFile(Job.Cooked.GetImages(), Job.Cooked.GetImageCount(),
+				                                 Job.Cooked.GetMetadata(), DDS_FLAGS_NONE, WOutputPath.c_str());
+				if (FAILED(hr))
+				{
+					UE_LOG("[TextureConverter] Failed to save DDS file: %s (HRESULT: 0x%08X)",
+					       Request.OutputPath.c_str(), hr);
+					continue;
+				}
+
+				Job.Result->bSuccess = true;
+				Job.Result->Format = Job.Cooked.GetMetadata().format;
+				Job.Result->CookedBytes = static_cast<uint64>(Job.Cooked.GetPixelsSize());
+
+				UE_LOG("[TextureConverter] Successfully converted: %s -> %s",
+				       Request.SourcePath.c_str(), Request.OutputPath.c_str());
+			}
+		});
+}
+
+FString FTextureConverter::GetCookSettings(bool bSRGB)
+{
+	// 자동 포맷 선택 규칙이 바뀌면 DerivedDataCache의 Texture 임포터 버전을 올릴 것
+	FString Settings = bSRGB ? "auto srgb" : "auto linear";
+	Settings += bShouldGenerateMipmaps ? " mips" : " nomips";
+	Settings += CompressionQuality == ETextureCompressionQuality::High ? " bc7" : " fast";
+	return Settings;
 }
 
 FString FTextureConverter::GetDDSCachePath(const FString& SourcePath)
@@ -12,6 +12,42 @@
 #include <d3d11.h>
 #include <filesystem>
 
+/**
+ * @brief 블록 압축 품질
+ * Fast: 불투명 BC1 / 알파 BC3, High: 컬러 텍스처를 BC7(빠른 모드)로. 리니어(노멀맵)는 항상 BC5
+ */
+enum class ETextureCompressionQuality : uint8
+{
+	Fast,
+	High,
+};
+
+/**
+ * @brief CookBatch 입력 하나
+ */
+struct FTextureCookRequest
+{
+	FString SourcePath;
+	FString OutputPath;                             // 저장할 DDS 경로
+	bool bSRGB = true;                              // 컬러 텍스처면 true, 노멀맵 등 리니어 데이터면 false
+	DXGI_FORMAT ForcedFormat = DXGI_FORMAT_UNKNOWN; // UNKNOWN이면 내용과 bSRGB로 자동 선택
+};
+
+/**
+ * @brief CookBatch 결과 하나
+ */
+struct FTextureCookResult
+{
+	bool bSuccess = false;
+	DXGI_FORMAT Format = DXGI_FORMAT_UNKNOWN;
+	uint32 Width = 0;
+	uint32 Height = 0;
+	uint32 MipLevels = 0;
+	uint64 SourceFileBytes = 0;     // 원본 파일 크기
+	uint64 UncompressedBytes = 0;   // 디코드한 밉 체인 크기 (압축 전)
+	uint64 CookedBytes = 0;         // 압축한 밉 체인 크기 (DDS 헤더 제외)
+};
+
 /**
  * @class FTextureConverter
  * @brief 텍스처 포맷 변환 및 캐시 관리를 위한 정적 유틸리티 클래스
@@ -33,16 +69,23 @@ public:
 	);
 
 	/**
-	 * @brief DDS 캐시 재생성이 필요한지 확인
-	 * @param SourcePath 원본 텍스처 파일 경로
-	 * @param DDSPath 캐시된 DDS 파일 경로
-	 * @return 캐시가 유효하지 않거나 없으면 true
+	 * @brief 여러 텍스처를 모든 코어로 한 번에 변환
+	 * 디코드/밉맵 생성/저장은 텍스처 단위로, 블록 압축은 (텍스처, 밉, 줄 묶음) 단위로 나눠 워커에 분배하므로
+	 * 큰 텍스처 하나만 있어도 여러 코어를 쓴다. 호출 스레드는 끝날 때까지 대기
+	 * @param InRequests 변환할 텍스처 목록
+	 * @param OutResults InRequests와 같은 순서의 결과
 	 */
-	static bool ShouldRegenerateDDS(
-		const FString& SourcePath,
-		const FString& DDSPath
+	static void CookBatch(
+		const TArray<FTextureCookRequest>& InRequests,
+		TArray<FTextureCookResult>& OutResults
 	);
 
+	/**
+	 * @brief 자동 포맷 선택 결과에 영향을 주는 설정 문자열 (파생 데이터 캐시 키에 포함)
+	 * @param bSRGB 컬러 텍스처 여부
+	 */
+	static FString GetCookSettings(bool bSRGB);
+
 	/**
 	 * @brief 주어진 원본 텍스처에 대한 DDS 캐시 경로 생성
 	 * @param SourcePath 원본 텍스처 파일 경로
@@ -63,6 +106,17 @@ public:
 	 */
 	static void SetGenerateMipmaps(bool bGenerateMips);
 
+	/**
+	 * @brief 현재 밉맵 생성 설정 (파생 데이터 캐시 키에 포함)
+	 */
+	static bool GetGenerateMipmaps() { return bShouldGenerateMipmaps; }
+
+	/**
+	 * @brief 블록 압축 품질 설정 (editor.ini TextureCompression=BC7 이면 High)
+	 */
+	static void SetCompressionQuality(ETextureCompressionQuality InQuality) { CompressionQuality = InQuality; }
+	static ETextureCompressionQuality GetCompressionQuality() { return CompressionQuality; }
+
 	/**
 	 * @brief 이미지 특성에 따라 권장 압축 포맷 반환
 	 * @param bHasAlpha 이미지에 알파 채널이 있는지 여부
@@ -84,4 +138,5 @@ private:
 
 	// 설정
 	static inline bool bShouldGenerateMipmaps = true;
+	static inline ETextureCompressionQuality CompressionQuality = ETextureCompressionQuality::Fast;
 };
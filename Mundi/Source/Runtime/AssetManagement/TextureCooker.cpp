@@ -0,0 +1,298 @@
+﻿#include "pch.h"
+#include "TextureCooker.h"
+#include "TextureConverter.h"
+#include "DerivedDataCache.h"
+#include "PathUtils.h"
+#include "PlatformTime.h"
+#include "TaskScheduler.h"
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+
+namespace fs = std::filesystem;
+
+namespace
+{
+	double ElapsedMS(uint64 StartCycles)
+	{
+		return FPlatformTime::ToMilliseconds(FPlatformTime::Cycles64() - StartCycles);
+	}
+
+	double ToMB(uint64 Bytes)
+	{
+		return Bytes / (1024.0 * 1024.0);
+	}
+
+	bool LooksLikeNormalMap(FString InStem)
+	{
+		std::transform(InStem.begin(), InStem.end(), InStem.begin(), ::tolower);
+		auto EndsWith = [&InStem](const char* Suffix)
+			{
+				const size_t Length = std::strlen(Suffix);
+				return InStem.size() >= Length && InStem.compare(InStem.size() - Length, Length, Suffix) == 0;
+			};
+		return InStem.find("normal") != FString::npos || EndsWith("_n") || EndsWith("_nrm") || EndsWith("_nor");
+	}
+
+	// 창 없는 실행 파일이라 부모 콘솔(cmd, 빌드 스크립트)에 붙여 printf 출력을 보냄
+	void AttachCommandletConsole()
+	{
+		if (AttachConsole(ATTACH_PARENT_PROCESS) || AllocConsole())
+		{
+			FILE* Stream = nullptr;
+			freopen_s(&Stream, "CONOUT$", "w", stdout);
+			freopen_s(&Stream, "CONOUT$", "w", stderr);
+		}
+	}
+
+	// 커맨드라인의 -Key=Value 값 (없으면 빈 문자열)
+	FString GetSwitchValue(const char* InCommandLine, const char* InKey)
+	{
+		const char* Found = std::strstr(InCommandLine, InKey);
+		if (!Found)
+		{
+			return FString();
+		}
+		const char* Begin = Found + std::strlen(InKey);
+		if (*Begin == '"')
+		{
+			const char* End = std::strchr(++Begin, '"');
+			return End ? FString(Begin, End) : FString(Begin);
+		}
+		const char* End = Begin;
+		while (*End && *End != ' ')
+		{
+			++End;
+		}
+		return FString(Begin, End);
+	}
+
+	// editor.ini의 Key = Value 값 (없으면 빈 문자열). 커맨드렛은 에디터 시작 전이라 EditorINI가 비어 있음
+	FString GetEditorIniValue(const char* InKey)
+	{
+		std::ifstream File("editor.ini");
+		FString Line;
+		while (std::getline(File, Line))
+		{
+			const size_t Delimiter = Line.find('=');
+			if (Line.empty() || Line[0] == ';' || Delimiter == FString::npos)
+			{
+				continue;
+			}
+			FString Key = Line.substr(0, Delimiter);
+			FString Value = Line.substr(Delimiter + 1);
+			Key.erase(0, Key.find_first_not_of(" \t"));
+			Key.erase(Key.find_last_not_of(" \t") + 1);
+			if (Key == InKey)
+			{
+				Value.erase(0, Value.find_first_not_of(" \t"));
+				Value.erase(Value.find_last_not_of(" \t\r") + 1);
+				return Value;
+			}
+		}
+		return FString();
+	}
+}
+
+FTextureCookStats FTextureCooker::Cook(const TArray<FTextureCookSource>& InSources)
+{
+	const uint64 Start = FPlatformTime::Cycles64();
+	FDerivedDataCache& DDC = FDerivedDataCache::GetInstance();
+
+	FTextureCookStats Stats;
+	Stats.NumSources = InSources.Num();
+
+	// 1. 캐시 조회 (원본 해싱은 인덱스가 없을 때만이라 대부분 stat 두 번)
+	TArray<FDerivedDataKey> Keys;
+	Keys.resize(InSources.Num());
+	FTaskScheduler::GetInstance().ParallelFor(InSources.Num(), 8, [&](int32 Begin, int32 End)
+		{
+			for (int32 i = Begin; i < End; ++i)
+			{
+				Keys[i] = DDC.Lookup(EDerivedDataKind::Texture, InSources[i].Path, {},
+					FTextureConverter::GetCookSettings(InSources[i].bSRGB), { ".dds" });
+			}
+		});
+
+	TArray<int32> Misses;
+	for (int32 i = 0; i < InSources.Num(); ++i)
+	{
+		if (!Keys[i].IsValid())
+		{
+			++Stats.NumFailed;
+		}
+		else if (Keys[i].bHit)
+		{
+			++Stats.NumCached;
+		}
+		else
+		{
+			Misses.Add(i);
+		}
+	}
+
+	// 2. 미스만 배치 단위로 쿡 → 확정
+	TArray<FTextureCookRequest> Requests;
+	TArray<FTextureCookResult> Results;
+	for (int32 BatchStart = 0; BatchStart < Misses.Num(); BatchStart += CookBatchSize)
+	{
+		const int32 BatchCount = std::min(CookBatchSize, Misses.Num() - BatchStart);
+		Requests.clear();
+		Requests.resize(BatchCount);
+		for (int32 i = 0; i < BatchCount; ++i)
+		{
+			const int32 SourceIndex = Misses[BatchStart + i];
+			Requests[i].SourcePath = InSources[SourceIndex].Path;
+			Requests[i].OutputPath = Keys[SourceIndex].GetWritePath(".dds");
+			Requests[i].bSRGB = InSources[SourceIndex].bSRGB;
+		}
+
+		FTextureConverter::CookBatch(Requests, Results);
+
+		for (int32 i = 0; i < BatchCount; ++i)
+		{
+			const FDerivedDataKey& Key = Keys[Misses[BatchStart + i]];
+			if (Results[i].bSuccess && DDC.Commit(Key, { ".dds" }))
+			{
+				++Stats.NumCooked;
+				Stats.SourceFileBytes += Results[i].SourceFileBytes;
+				Stats.UncompressedBytes += Results[i].UncompressedBytes;
+				Stats.CookedBytes += Results[i].CookedBytes;
+			}
+			else
+			{
+				DDC.Abandon(Key, { ".dds" });
+				++Stats.NumFailed;
+			}
+		}
+	}
+
+	Stats.WallMS = ElapsedMS(Start);
+	return Stats;
+}
+
+bool FTextureCooker::CookToCache(const FString& InSourcePath, bool bSRGB, FString& OutCachePath)
+{
+	FDerivedDataCache& DDC = FDerivedDataCache::GetInstance();
+	const FDerivedDataKey Key = DDC.Lookup(EDerivedDataKind::Texture, InSourcePath, {},
+		FTextureConverter::GetCookSettings(bSRGB), { ".dds" });
+	if (!Key.IsValid())
+	{
+		return false;
+	}
+
+	if (!Key.bHit)
+	{
+		UE_LOG("[UTexture] Converting texture to DDS: %s", InSourcePath.c_str());
+
+		// 임시 파일에 쓰고 다 쓴 뒤 확정
+		TArray<FTextureCookRequest> Requests(1);
+		Requests[0].SourcePath = InSourcePath;
+		Requests[0].OutputPath = Key.GetWritePath(".dds");
+		Requests[0].bSRGB = bSRGB;
+
+		TArray<FTextureCookResult> Results;
+		FTextureConverter::CookBatch(Requests, Results);
+		if (!Results[0].bSuccess || !DDC.Commit(Key, { ".dds" }))
+		{
+			DDC.Abandon(Key, { ".dds" });
+			return false;
+		}
+	}
+
+	OutCachePath = Key.GetPath(".dds");
+	return true;
+}
+
+TArray<FTextureCookSource> FTextureCooker::DiscoverSources(const FString& InDirectory)
+{
+	TArray<FTextureCookSource> Sources;
+
+	std::error_code Error;
+	const fs::path Root(UTF8ToWide(InDirectory));
+	for (fs::recursive_directory_iterator It(Root, fs::directory_options::skip_permission_denied, Error), End; !Error && It != End; It.increment(Error))
+	{
+		if (!It->is_regular_file())
+		{
+			continue;
+		}
+
+		const fs::path& Path = It->path();
+		FString Extension = WideToUTF8(Path.extension().wstring());
+		std::transform(Extension.begin(), Extension.end(), Extension.begin(), ::tolower);
+		if (Extension == ".dds" || !FTextureConverter::IsSupportedFormat(Extension))
+		{
+			continue;
+		}
+
+		FTextureCookSource Source;
+		Source.Path = NormalizePath(WideToUTF8(Path.wstring()));
+		Sources.Add(Source);
+
+		// 머티리얼의 노멀 슬롯은 리니어로 로드하므로 그 변형도 미리 쿡
+		if (LooksLikeNormalMap(WideToUTF8(Path.stem().wstring())))
+		{
+			Source.bSRGB = false;
+			Sources.Add(Source);
+		}
+	}
+
+	return Sources;
+}
+
+void FTextureCooker::LogStats(const char* InContext, const FTextureCookStats& InStats)
+{
+	UE_LOG("[TextureCooker] %s: %u textures (%u cached, %u cooked, %u failed) in %.1f ms, %.1f textures/sec",
+		InContext, InStats.NumSources, InStats.NumCached, InStats.NumCooked, InStats.NumFailed, InStats.WallMS, InStats.GetTexturesPerSecond());
+	if (InStats.NumCooked > 0)
+	{
+		UE_LOG("[TextureCooker] %s: uncompressed %.1f MB -> cooked %.1f MB (saved %.1f MB), source files %.1f MB",
+			InContext, ToMB(InStats.UncompressedBytes), ToMB(InStats.CookedBytes),
+			ToMB(InStats.UncompressedBytes - InStats.CookedBytes), ToMB(InStats.SourceFileBytes));
+	}
+}
+
+bool FTextureCooker::IsCommandletRequested(const char* InCommandLine)
+{
+	return InCommandLine && std::strstr(InCommandLine, "-CookTextures") != nullptr;
+}
+
+int32 FTextureCooker::RunCommandlet(const char* InCommandLine)
+{
+	AttachCommandletConsole();
+
+	// 에디터와 같은 editor.ini TextureCompression 설정을 따르고, -bc7로 강제할 수 있음
+	if (std::strstr(InCommandLine, "-bc7") || GetEditorIniValue("TextureCompression") == "BC7")
+	{
+		FTextureConverter::SetCompressionQuality(ETextureCompressionQuality::High);
+	}
+	FString Directory = GetSwitchValue(InCommandLine, "-dir=");
+	if (Directory.empty())
+	{
+		Directory = GDataDir;
+	}
+
+	FTaskScheduler::GetInstance().Startup();
+
+	const TArray<FTextureCookSource> Sources = DiscoverSources(Directory);
+	printf("[TextureCooker] %s: %d sources, %u workers, quality %s\n", Directory.c_str(), Sources.Num(),
+		FTaskScheduler::GetInstance().GetNumWorkers(),
+		FTextureConverter::GetCompressionQuality() == ETextureCompressionQuality::High ? "BC7" : "BC1/BC3");
+
+	const FTextureCookStats Stats = Cook(Sources);
+
+	printf("[TextureCooker] %u cached, %u cooked, %u failed\n", Stats.NumCached, Stats.NumCooked, Stats.NumFailed);
+	printf("[TextureCooker] wall %.1f ms, %.1f textures/sec\n", Stats.WallMS, Stats.GetTexturesPerSecond());
+	printf("[TextureCooker] uncompressed %.1f MB -> cooked %.1f MB, saved %.1f MB (%.1f%%); source files %.1f MB\n",
+		ToMB(Stats.UncompressedBytes), ToMB(Stats.CookedBytes), ToMB(Stats.UncompressedBytes - Stats.CookedBytes),
+		Stats.UncompressedBytes > 0 ? 100.0 * (Stats.UncompressedBytes - Stats.CookedBytes) / Stats.UncompressedBytes : 0.0,
+		ToMB(Stats.SourceFileBytes));
+	fflush(stdout);
+
+	FTaskScheduler::GetInstance().Shutdown();
+	FDerivedDataCache::GetInstance().SaveIndex();
+
+	return Stats.NumFailed > 0 ? 1 : 0;
+}
@@ -0,0 +1,56 @@
+﻿#pragma once
+#include "UEContainer.h"
+
+// 쿡할 텍스처 하나 (같은 원본도 sRGB/리니어는 별도 캐시 항목)
+struct FTextureCookSource
+{
+	FString Path;
+	bool bSRGB = true;
+};
+
+struct FTextureCookStats
+{
+	uint32 NumSources = 0;
+	uint32 NumCached = 0;           // 파생 데이터 캐시에 이미 있던 것
+	uint32 NumCooked = 0;
+	uint32 NumFailed = 0;
+
+	uint64 SourceFileBytes = 0;     // 쿡한 텍스처의 원본 파일 크기 합
+	uint64 UncompressedBytes = 0;   // 쿡한 텍스처의 비압축 밉 체인 크기 합
+	uint64 CookedBytes = 0;         // 쿡한 텍스처의 블록 압축 밉 체인 크기 합
+	double WallMS = 0.0;
+
+	double GetTexturesPerSecond() const { return WallMS > 0.0 ? NumCooked * 1000.0 / WallMS : 0.0; }
+};
+
+/**
+ * 텍스처 → DDS 쿡을 파생 데이터 캐시와 연결하는 진입점
+ * - Cook: 캐시 미스만 모아 FTextureConverter::CookBatch로 모든 코어에서 변환 (시작 시 프리로드, 커맨드라인)
+ * - CookToCache: 텍스처 하나 (UTexture::PrepareSource의 개별 로드)
+ * - RunCommandlet: Mundi.exe -CookTextures [-bc7] [-dir=<폴더>] 로 창 없이 Data/ 전체를 쿡하고 결과를 콘솔에 출력 (editor.ini TextureCompression = BC7 이면 -bc7 없이도 BC7)
+ */
+class FTextureCooker
+{
+public:
+	// 배치 크기 (미스가 많아도 디코드한 원본이 메모리에 한꺼번에 올라오지 않도록)
+	static constexpr int32 CookBatchSize = 64;
+
+	static FTextureCookStats Cook(const TArray<FTextureCookSource>& InSources);
+
+	// 캐시된 DDS 경로를 OutCachePath에. 캐시를 쓸 수 없거나 변환에 실패하면 false
+	static bool CookToCache(const FString& InSourcePath, bool bSRGB, FString& OutCachePath);
+
+	// 폴더 아래 모든 원본 텍스처. 이름이 노멀맵 같으면(_n, _nrm, normal) 리니어 항목도 추가
+	static TArray<FTextureCookSource> DiscoverSources(const FString& InDirectory);
+
+	static void LogStats(const char* InContext, const FTextureCookStats& InStats);
+
+	// 커맨드라인에 -CookTextures가 있는지
+	static bool IsCommandletRequested(const char* InCommandLine);
+
+	// 헤드리스 쿡 실행. 반환값은 프로세스 종료 코드 (실패한 텍스처가 있으면 1)
+	static int32 RunCommandlet(const char* InCommandLine);
+
+private:
+	FTextureCooker() = delete;
+};
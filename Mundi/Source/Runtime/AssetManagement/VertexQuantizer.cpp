@@ -0,0 +1,122 @@
+﻿#include "pch.h"
+#include "VertexQuantizer.h"
+#include "VertexData.h"
+#include <algorithm>
+#include <cmath>
+
+namespace
+{
+	constexpr float RadToDeg = 57.2957795f;
+
+	bool IsUVInHalfRange(const FVector2D& InUV)
+	{
+		return std::fabs(InUV.X) <= FVertexQuantizer::MaxHalfUV && std::fabs(InUV.Y) <= FVertexQuantizer::MaxHalfUV;
+	}
+
+	// 정규화한 원본과 복원한 방향 사이의 각도 (길이가 0인 원본은 무시)
+	float AngleErrorDeg(const FVector& InOriginal, const FVector& InDecoded)
+	{
+		const float Length = InOriginal.Length();
+		if (Length < 1e-6f)
+		{
+			return 0.0f;
+		}
+		const float Cos = std::clamp(FVector::Dot(InOriginal, InDecoded) / Length, -1.0f, 1.0f);
+		return std::acos(Cos) * RadToDeg;
+	}
+
+	void MeasureCommon(const FPackedNormalVertex& InPacked, const FVector& InNormal, const FVector2D& InUV,
+		const FVector4& InTangent, FVertexQuantizeStats& OutStats)
+	{
+		OutStats.MaxNormalErrorDeg = std::max(OutStats.MaxNormalErrorDeg, AngleErrorDeg(InNormal, InPacked.GetNormal()));
+
+		const FVector4 Tangent = InPacked.GetTangent();
+		OutStats.MaxTangentErrorDeg = std::max(OutStats.MaxTangentErrorDeg,
+			AngleErrorDeg(FVector(InTangent.X, InTangent.Y, InTangent.Z), FVector(Tangent.X, Tangent.Y, Tangent.Z)));
+
+		const FVector2D UV = InPacked.GetUV();
+		OutStats.MaxUVError = std::max(OutStats.MaxUVError, std::max(std::fabs(UV.X - InUV.X), std::fabs(UV.Y - InUV.Y)));
+	}
+}
+
+FString FVertexQuantizer::GetImportSettings()
+{
+	return bEnabled ? "CompactVertices=1" : "CompactVertices=0";
+}
+
+bool FVertexQuantizer::CanQuantize(const TArray<FNormalVertex>& InVertices)
+{
+	for (const FNormalVertex& Vertex : InVertices)
+	{
+		if (!IsUVInHalfRange(Vertex.tex))
+		{
+			return false;
+		}
+	}
+	return !InVertices.IsEmpty();
+}
+
+bool FVertexQuantizer::CanQuantize(const FSkeletalMeshData& InMeshData)
+{
+	if (InMeshData.Vertices.IsEmpty() || InMeshData.Skeleton.Bones.size() > MaxPackedBones)
+	{
+		return false;
+	}
+	for (const FSkinnedVertex& Vertex : InMeshData.Vertices)
+	{
+		if (!IsUVInHalfRange(Vertex.UV))
+		{
+			return false;
+		}
+	}
+	return true;
+}
+
+void FVertexQuantizer::Measure(const TArray<FNormalVertex>& InVertices, FVertexQuantizeStats& OutStats)
+{
+	const bool bEligible = CanQuantize(InVertices);
+	++OutStats.NumMeshes;
+	OutStats.NumEligibleMeshes += bEligible ? 1 : 0;
+	OutStats.NumVertices += InVertices.size();
+	OutStats.FullBytes += InVertices.size() * sizeof(FVertexDynamic);
+	OutStats.PackedBytes += InVertices.size() * (bEligible ? sizeof(FPackedNormalVertex) : sizeof(FVertexDynamic));
+	if (!bEligible)
+	{
+		return;
+	}
+
+	for (const FNormalVertex& Vertex : InVertices)
+	{
+		FPackedNormalVertex Packed;
+		Packed.FillFrom(Vertex);
+		MeasureCommon(Packed, Vertex.normal, Vertex.tex, Vertex.Tangent, OutStats);
+	}
+}
+
+void FVertexQuantizer::Measure(const FSkeletalMeshData& InMeshData, FVertexQuantizeStats& OutStats)
+{
+	const bool bEligible = CanQuantize(InMeshData);
+	const size_t NumVertices = InMeshData.Vertices.size();
+	++OutStats.NumMeshes;
+	OutStats.NumEligibleMeshes += bEligible ? 1 : 0;
+	OutStats.NumVertices += NumVertices;
+	OutStats.FullBytes += NumVertices * sizeof(FSkinnedVertex);
+	OutStats.PackedBytes += NumVertices * (bEligible ? sizeof(FPackedSkinnedVertex) : sizeof(FSkinnedVertex));
+	if (!bEligible)
+	{
+		return;
+	}
+
+	for (const FSkinnedVertex& Vertex : InMeshData.Vertices)
+	{
+		FPackedSkinnedVertex Packed;
+		Packed.FillFrom(Vertex);
+		MeasureCommon(Packed, Vertex.Normal, Vertex.UV, Vertex.Tangent, OutStats);
+
+		const FSkinnedVertex Decoded = Packed.Decode();
+		for (int32 i = 0; i < 4; ++i)
+		{
+			OutStats.MaxWeightError = std::max(OutStats.MaxWeightError, std::fabs(Decoded.BoneWeights[i] - Vertex.BoneWeights[i]));
+		}
+	}
+}
@@ -0,0 +1,51 @@
+﻿#pragma once
+#include "UEContainer.h"
+
+struct FNormalVertex;
+struct FSkeletalMeshData;
+
+// 압축 정점으로 바꿨을 때의 크기와 복원 오차 (여러 메시에 누적)
+struct FVertexQuantizeStats
+{
+	uint32 NumMeshes = 0;
+	uint32 NumEligibleMeshes = 0;   // CanQuantize를 통과한 메시
+	uint64 NumVertices = 0;
+	uint64 FullBytes = 0;           // FVertexDynamic / FSkinnedVertex 기준
+	uint64 PackedBytes = 0;         // 통과한 메시는 압축 크기, 나머지는 그대로
+	float MaxNormalErrorDeg = 0.0f;
+	float MaxTangentErrorDeg = 0.0f;
+	float MaxUVError = 0.0f;
+	float MaxWeightError = 0.0f;
+};
+
+/**
+ * 임포트 시 메시 단위로 압축 정점(FPackedNormalVertex / FPackedSkinnedVertex) 사용 여부를 정함
+ * editor.ini CompactVertices=1 이면 켜지고, 켜져 있어도 CanQuantize를 통과한 메시만 플래그가 선다.
+ * 실제 변환은 GPU 업로드(스태틱) 또는 로드 직후(스켈레탈)에 하므로 캐시에는 전체 정밀도 정점이 남는다
+ */
+class FVertexQuantizer
+{
+public:
+	// half UV의 반올림 오차가 1024 텍스처 기준 반 텍셀 이하로 유지되는 범위
+	static constexpr float MaxHalfUV = 2.0f;
+	// 본 인덱스 8비트 (셰이더 MAX_BONES와 같음)
+	static constexpr uint32 MaxPackedBones = 256;
+
+	static void SetEnabled(bool bInEnabled) { bEnabled = bInEnabled; }
+	static bool IsEnabled() { return bEnabled; }
+
+	// 플래그 결정에 영향을 주는 설정 문자열 (파생 데이터 캐시 키에 포함)
+	static FString GetImportSettings();
+
+	static bool CanQuantize(const TArray<FNormalVertex>& InVertices);
+	static bool CanQuantize(const FSkeletalMeshData& InMeshData);
+
+	// 실제로 압축/복원해 보고 크기와 최대 오차를 OutStats에 누적
+	static void Measure(const TArray<FNormalVertex>& InVertices, FVertexQuantizeStats& OutStats);
+	static void Measure(const FSkeletalMeshData& InMeshData, FVertexQuantizeStats& OutStats);
+
+private:
+	FVertexQuantizer() = delete;
+
+	static inline bool bEnabled = false;
+};
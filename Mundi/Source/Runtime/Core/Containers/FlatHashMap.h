@@ -0,0 +1,686 @@
+﻿#pragma once
+// UEContainer.h 끝에서 include됨 (TArray 정의 이후)
+#include <stdexcept>
+
+#if defined(_M_X64) || defined(_M_AMD64) || defined(__SSE2__)
+#include <emmintrin.h>
+#define FLAT_HASH_USE_SSE2 1
+#else
+#define FLAT_HASH_USE_SSE2 0
+#endif
+
+/**
+ * Swiss table 방식의 open addressing 해시 테이블 (TFlatMap / TFlatSet 공용 구현)
+ * - 요소는 노드가 아니라 하나의 연속 배열에 저장 (요소마다 할당하지 않음)
+ * - 슬롯마다 1바이트 제어값(빈/삭제/해시 하위 7비트)을 두고 16개씩 묶어 한 번에 비교
+ * - 용량은 2의 거듭제곱, 적재율 7/8을 넘으면 2배로 재해시
+ * 주의: 삽입/재해시 때 요소가 옮겨지므로 요소 포인터/반복자는 삽입 이후 유효하지 않음 (std::unordered_map과 다름)
+ */
+template<typename ElementType, typename KeyType, typename KeyFuncs, typename Hasher, typename KeyEqual>
+class TFlatHashTable
+{
+protected:
+    using FCtrl = signed char;   // int8(char)은 플랫폼에 따라 부호가 없을 수 있음
+    static constexpr FCtrl CtrlEmpty = -128;   // 0x80
+    static constexpr FCtrl CtrlDeleted = -2;   // 0xFE
+    static constexpr uint32 GroupWidth = 16;
+    static constexpr uint32 MinCapacity = GroupWidth;
+
+public:
+    template<bool bConst>
+    class TIterator
+    {
+    public:
+        using iterator_category = std::forward_iterator_tag;
+        using value_type = ElementType;
+        using difference_type = std::ptrdiff_t;
+        using reference = std::conditional_t<bConst, const ElementType&, ElementType&>;
+        using pointer = std::conditional_t<bConst, const ElementType*, ElementType*>;
+        using TableType = std::conditional_t<bConst, const TFlatHashTable, TFlatHashTable>;
+
+        TIterator() = default;
+        TIterator(TableType* InTable, uint32 InIndex) : Table(InTable), Index(InIndex) { SkipEmpty(); }
+        // 비 const → const 변환
+        template<bool bOtherConst, typename = std::enable_if_t<bConst && !bOtherConst>>
+        TIterator(const TIterator<bOtherConst>& Other) : Table(Other.Table), Index(Other.Index) {}
+
+        reference operator*() const { return Table->Slots[Index]; }
+        pointer operator->() const { return &Table->Slots[Index]; }
+
+        TIterator& operator++()
+        {
+            ++Index;
+            SkipEmpty();
+            return *this;
+        }
+
+        TIterator operator++(int)
+        {
+            TIterator Old = *this;
+            ++(*this);
+            return Old;
+        }
+
+        bool operator==(const TIterator& Other) const { return Index == Other.Index; }
+        bool operator!=(const TIterator& Other) const { return Index != Other.Index; }
+
+    private:
+        void SkipEmpty()
+        {
+            while (Index < Table->Capacity && Table->Ctrl[Index] < 0)
+            {
+                ++Index;
+            }
+        }
+
+        TableType* Table = nullptr;
+        uint32 Index = 0;
+
+        friend class TFlatHashTable;
+        template<bool> friend class TIterator;
+    };
+
+    using iterator = TIterator<false>;
+    using const_iterator = TIterator<true>;
+    using size_type = SIZE_T;
+
+    TFlatHashTable() = default;
+
+    TFlatHashTable(const TFlatHashTable& Other)
+    {
+        CopyFrom(Other);
+    }
+
+    TFlatHashTable(TFlatHashTable&& Other) noexcept
+    {
+        StealFrom(Other);
+    }
+
+    ~TFlatHashTable()
+    {
+        DestroyAll();
+        Release();
+    }
+
+    TFlatHashTable& operator=(const TFlatHashTable& Other)
+    {
+        if (this != &Other)
+        {
+            DestroyAll();
+            Release();
+            CopyFrom(Other);
+        }
+        return *this;
+    }
+
+    TFlatHashTable& operator=(TFlatHashTable&& Other) noexcept
+    {
+        if (this != &Other)
+        {
+            DestroyAll();
+            Release();
+            StealFrom(Other);
+        }
+        return *this;
+    }
+
+    iterator begin() { return iterator(this, 0); }
+    iterator end() { return iterator(this, Capacity); }
+    const_iterator begin() const { return const_iterator(this, 0); }
+    const_iterator end() const { return const_iterator(this, Capacity); }
+
+    SIZE_T size() const { return NumElements; }
+    bool empty() const { return NumElements == 0; }
+    SIZE_T capacity() const { return Capacity; }
+
+    // 요소만 비우고 용량은 유지
+    void clear()
+    {
+        DestroyAll();
+        if (Capacity)
+        {
+            std::memset(Ctrl, CtrlEmpty, Capacity + GroupWidth);
+        }
+        NumElements = 0;
+        NumDeleted = 0;
+    }
+
+    void reserve(SIZE_T Count)
+    {
+        const SIZE_T Required = CapacityFor(Count);
+        if (Required > Capacity)
+        {
+            Rehash(static_cast<uint32>(Required));
+        }
+    }
+
+    iterator find(const KeyType& Key)
+    {
+        const uint32 Index = FindIndex(Key);
+        return iterator(this, Index == UINT32_MAX ? Capacity : Index);
+    }
+
+    const_iterator find(const KeyType& Key) const
+    {
+        const uint32 Index = FindIndex(Key);
+        return const_iterator(this, Index == UINT32_MAX ? Capacity : Index);
+    }
+
+    SIZE_T count(const KeyType& Key) const
+    {
+        return FindIndex(Key) != UINT32_MAX ? 1 : 0;
+    }
+
+    bool contains(const KeyType& Key) const
+    {
+        return FindIndex(Key) != UINT32_MAX;
+    }
+
+    SIZE_T erase(const KeyType& Key)
+    {
+        const uint32 Index = FindIndex(Key);
+        if (Index == UINT32_MAX)
+        {
+            return 0;
+        }
+        EraseIndex(Index);
+        return 1;
+    }
+
+    // 지운 요소 다음 반복자 반환 (지우는 동안 재해시하지 않으므로 순회 중 삭제 가능)
+    iterator erase(const_iterator It)
+    {
+        EraseIndex(It.Index);
+        return iterator(this, It.Index + 1);
+    }
+
+    iterator erase(iterator It)
+    {
+        EraseIndex(It.Index);
+        return iterator(this, It.Index + 1);
+    }
+
+protected:
+    static uint64 MixHash(SIZE_T InHash)
+    {
+        // 포인터처럼 하위 비트가 고정된 해시도 고르게 퍼지도록 섞음
+        uint64 H = static_cast<uint64>(InHash);
+        H ^= H >> 32;
+        H *= 0x9E3779B97F4A7C15ull;
+        H ^= H >> 29;
+        return H;
+    }
+
+    static FCtrl H2(uint64 Hash) { return static_cast<FCtrl>(Hash & 0x7F); }
+    static uint32 H1(uint64 Hash) { return static_cast<uint32>(Hash >> 7); }
+
+    static SIZE_T CapacityFor(SIZE_T Count)
+    {
+        // 적재율 7/8 이하가 되는 2의 거듭제곱
+        SIZE_T Required = MinCapacity;
+        while (Required - Required / 8 < Count)
+        {
+            Required *= 2;
+        }
+        return Required;
+    }
+
+    // 그룹(16개 제어 바이트)에서 조건에 맞는 위치의 비트마스크
+    struct FGroup
+    {
+#if FLAT_HASH_USE_SSE2
+        __m128i Ctrl;
+        explicit FGroup(const FCtrl* InCtrl) : Ctrl(_mm_loadu_si128(reinterpret_cast<const __m128i*>(InCtrl))) {}
+        uint32 Match(FCtrl InH2) const { return static_cast<uint32>(_mm_movemask_epi8(_mm_cmpeq_epi8(_mm_set1_epi8(InH2), Ctrl))); }
+        uint32 MatchEmpty() const { return static_cast<uint32>(_mm_movemask_epi8(_mm_cmpeq_epi8(_mm_set1_epi8(CtrlEmpty), Ctrl))); }
+        uint32 MatchEmptyOrDeleted() const { return static_cast<uint32>(_mm_movemask_epi8(_mm_cmpgt_epi8(_mm_set1_epi8(-1), Ctrl))); }
+#else
+        const FCtrl* Ctrl;
+        explicit FGroup(const FCtrl* InCtrl) : Ctrl(InCtrl) {}
+        uint32 Match(FCtrl InH2) const { uint32 Mask = 0; for (uint32 i = 0; i < GroupWidth; ++i) Mask |= uint32(Ctrl[i] == InH2) << i; return Mask; }
+        uint32 MatchEmpty() const { uint32 Mask = 0; for (uint32 i = 0; i < GroupWidth; ++i) Mask |= uint32(Ctrl[i] == CtrlEmpty) << i; return Mask; }
+        uint32 MatchEmptyOrDeleted() const { uint32 Mask = 0; for (uint32 i = 0; i < GroupWidth; ++i) Mask |= uint32(Ctrl[i] < -1) << i; return Mask; }
+#endif
+    };
+
+    static uint32 LowestBit(uint32 Mask)
+    {
+#if defined(_MSC_VER)
+        unsigned long Index;
+        _BitScanForward(&Index, Mask);
+        return static_cast<uint32>(Index);
+#else
+        return static_cast<uint32>(__builtin_ctz(Mask));
+#endif
+    }
+
+    uint32 FindIndex(const KeyType& Key) const
+    {
+        if (NumElements == 0)
+        {
+            return UINT32_MAX;
+        }
+
+        const uint64 Hash = MixHash(Hasher{}(Key));
+        const FCtrl Tag = H2(Hash);
+        const uint32 Mask = Capacity - 1;
+        uint32 Pos = H1(Hash) & Mask;
+        for (uint32 Probe = GroupWidth;; Probe += GroupWidth)
+        {
+            const FGroup Group(Ctrl + Pos);
+            for (uint32 Bits = Group.Match(Tag); Bits; Bits &= Bits - 1)
+            {
+                const uint32 Index = (Pos + LowestBit(Bits)) & Mask;
+                if (KeyEqual{}(KeyFuncs::GetKey(Slots[Index]), Key))
+                {
+                    return Index;
+                }
+            }
+            if (Group.MatchEmpty())
+            {
+                return UINT32_MAX;
+            }
+            Pos = (Pos + Probe) & Mask;   // 삼각수 탐사: 2의 거듭제곱 용량에서 모든 그룹을 방문
+        }
+    }
+
+    // 키가 없다고 확인된 뒤 호출: 빈(또는 삭제된) 슬롯을 찾아 제어값을 기록하고 인덱스 반환 (요소 생성은 호출자가)
+    uint32 PrepareInsert(const KeyType& Key)
+    {
+        const uint32 MaxLoad = Capacity - Capacity / 8;
+        if (Capacity == 0)
+        {
+            Rehash(MinCapacity);
+        }
+        else if (NumElements + NumDeleted + 1 > MaxLoad)
+        {
+            // 삭제 표시가 자리를 차지하고 있을 뿐이면 같은 크기로 정리, 아니면 2배
+            Rehash(NumElements + 1 <= MaxLoad / 2 ? Capacity : Capacity * 2);
+        }
+
+        const uint64 Hash = MixHash(Hasher{}(Key));
+        const uint32 Index = FindInsertSlot(Hash);
+        if (Ctrl[Index] == CtrlDeleted)
+        {
+            --NumDeleted;
+        }
+        SetCtrl(Index, H2(Hash));
+        ++NumElements;
+        return Index;
+    }
+
+    uint32 FindInsertSlot(uint64 Hash) const
+    {
+        const uint32 Mask = Capacity - 1;
+        uint32 Pos = H1(Hash) & Mask;
+        for (uint32 Probe = GroupWidth;; Probe += GroupWidth)
+        {
+            const uint32 Bits = FGroup(Ctrl + Pos).MatchEmptyOrDeleted();
+            if (Bits)
+            {
+                return (Pos + LowestBit(Bits)) & Mask;
+            }
+            Pos = (Pos + Probe) & Mask;
+        }
+    }
+
+    // 앞쪽 GroupWidth개 제어값은 배열 끝에 복제해 두어 그룹 로드가 경계를 넘어도 되게 함
+    void SetCtrl(uint32 Index, FCtrl Value)
+    {
+        Ctrl[Index] = Value;
+        if (Index < GroupWidth)
+        {
+            Ctrl[Capacity + Index] = Value;
+        }
+    }
+
+    void EraseIndex(uint32 Index)
+    {
+        std::destroy_at(&Slots[Index]);
+        SetCtrl(Index, CtrlDeleted);
+        --NumElements;
+        ++NumDeleted;
+    }
+
+    void Rehash(uint32 NewCapacity)
+    {
+        FCtrl* OldCtrl = Ctrl;
+        ElementType* OldSlots = Slots;
+        const uint32 OldCapacity = Capacity;
+
+        Allocate(NewCapacity);
+        for (uint32 i = 0; i < OldCapacity; ++i)
+        {
+            if (OldCtrl[i] >= 0)
+            {
+                const uint64 Hash = MixHash(Hasher{}(KeyFuncs::GetKey(OldSlots[i])));
+                const uint32 Index = FindInsertSlot(Hash);
+                SetCtrl(Index, H2(Hash));
+                new (&Slots[Index]) ElementType(std::move(OldSlots[i]));
+                std::destroy_at(&OldSlots[i]);
+            }
+        }
+        NumDeleted = 0;
+        FreeBlock(OldCtrl, OldCapacity);
+    }
+
+    // 제어 바이트와 슬롯을 한 블록에 할당 (슬롯이 앞, 제어 바이트가 뒤)
+    void Allocate(uint32 NewCapacity)
+    {
+        const SIZE_T SlotBytes = sizeof(ElementType) * NewCapacity;
+        unsigned char* Block = static_cast<unsigned char*>(::operator new(SlotBytes + NewCapacity + GroupWidth, std::align_val_t(alignof(ElementType))));
+        Slots = reinterpret_cast<ElementType*>(Block);
+        Ctrl = reinterpret_cast<FCtrl*>(Block + SlotBytes);
+        std::memset(Ctrl, CtrlEmpty, NewCapacity + GroupWidth);
+        Capacity = NewCapacity;
+    }
+
+    static void FreeBlock(FCtrl* InCtrl, uint32 InCapacity)
+    {
+        if (InCtrl)
+        {
+            unsigned char* Block = reinterpret_cast<unsigned char*>(InCtrl) - sizeof(ElementType) * InCapacity;
+            ::operator delete(Block, std::align_val_t(alignof(ElementType)));
+        }
+    }
+
+    void DestroyAll()
+    {
+        if constexpr (!std::is_trivially_destructible_v<ElementType>)
+        {
+            for (uint32 i = 0; i < Capacity; ++i)
+            {
+                if (Ctrl[i] >= 0)
+                {
+                    std::destroy_at(&Slots[i]);
+                }
+            }
+        }
+    }
+
+    void Release()
+    {
+        FreeBlock(Ctrl, Capacity);
+        Ctrl = nullptr;
+        Slots = nullptr;
+        Capacity = 0;
+        NumElements = 0;
+        NumDeleted = 0;
+    }
+
+    void CopyFrom(const TFlatHashTable& Other)
+    {
+        if (Other.NumElements == 0)
+        {
+            return;
+        }
+        Allocate(Other.Capacity);
+        std::memcpy(Ctrl, Other.Ctrl, Capacity + GroupWidth);
+        for (uint32 i = 0; i < Capacity; ++i)
+        {
+            if (Ctrl[i] >= 0)
+            {
+                new (&Slots[i]) ElementType(Other.Slots[i]);
+            }
+        }
+        NumElements = Other.NumElements;
+        NumDeleted = Other.NumDeleted;
+    }
+
+    void StealFrom(TFlatHashTable& Other)
+    {
+        Ctrl = Other.Ctrl;
+        Slots = Other.Slots;
+        Capacity = Other.Capacity;
+        NumElements = Other.NumElements;
+        NumDeleted = Other.NumDeleted;
+        Other.Ctrl = nullptr;
+        Other.Slots = nullptr;
+        Other.Capacity = 0;
+        Other.NumElements = 0;
+        Other.NumDeleted = 0;
+    }
+
+    FCtrl* Ctrl = nullptr;
+    ElementType* Slots = nullptr;
+    uint32 Capacity = 0;
+    uint32 NumElements = 0;
+    uint32 NumDeleted = 0;
+};
+
+template<typename KeyType, typename ValueType>
+struct TFlatMapKeyFuncs
+{
+    static const KeyType& GetKey(const std::pair<KeyType, ValueType>& Element) { return Element.first; }
+};
+
+template<typename KeyType>
+struct TFlatSetKeyFuncs
+{
+    static const KeyType& GetKey(const KeyType& Element) { return Element; }
+};
+
+/**
+ * TFlatMap - open addressing 해시 맵. TMap과 같은 API (Add/Find/Remove/Contains ..., find/end/erase/insert/operator[])
+ * 요소가 한 배열에 모여 있어 포인터 키 조회/순회가 빠름. 삽입 후에는 Find로 받은 포인터가 무효가 될 수 있음
+ * 순회 시 요소는 std::pair<KeyType, ValueType>& (키를 바꾸면 안 됨)
+ */
+template<typename KeyType, typename ValueType, typename Hasher = std::hash<KeyType>, typename KeyEqual = std::equal_to<KeyType>>
+class TFlatMap : public TFlatHashTable<std::pair<KeyType, ValueType>, KeyType, TFlatMapKeyFuncs<KeyType, ValueType>, Hasher, KeyEqual>
+{
+    using Super = TFlatHashTable<std::pair<KeyType, ValueType>, KeyType, TFlatMapKeyFuncs<KeyType, ValueType>, Hasher, KeyEqual>;
+
+public:
+    using key_type = KeyType;
+    using mapped_type = ValueType;
+    using value_type = std::pair<KeyType, ValueType>;
+    using typename Super::iterator;
+    using typename Super::const_iterator;
+
+    TFlatMap() = default;
+    TFlatMap(std::initializer_list<value_type> InList)
+    {
+        this->reserve(InList.size());
+        for (const value_type& Pair : InList)
+        {
+            insert(Pair);
+        }
+    }
+
+    template<typename... Args>
+    std::pair<iterator, bool> try_emplace(const KeyType& Key, Args&&... args)
+    {
+        uint32 Index = this->FindIndex(Key);
+        if (Index != UINT32_MAX)
+        {
+            return { iterator(this, Index), false };
+        }
+        // Key/args가 이 맵의 요소를 가리킬 수 있으므로 (insert(*It), Map[Map.begin()->first] 등) PrepareInsert의 재해시 전에 먼저 만들어 둠
+        value_type Element(std::piecewise_construct, std::forward_as_tuple(Key), std::forward_as_tuple(std::forward<Args>(args)...));
+        Index = this->PrepareInsert(Element.first);
+        new (&this->Slots[Index]) value_type(std::move(Element));
+        return { iterator(this, Index), true };
+    }
+
+    template<typename... Args>
+    std::pair<iterator, bool> emplace(const KeyType& Key, Args&&... args)
+    {
+        return try_emplace(Key, std::forward<Args>(args)...);
+    }
+
+    std::pair<iterator, bool> insert(const value_type& Pair)
+    {
+        return try_emplace(Pair.first, Pair.second);
+    }
+
+    ValueType& operator[](const KeyType& Key)
+    {
+        return try_emplace(Key).first->second;
+    }
+
+    // std::unordered_map::at처럼 없는 키면 예외
+    ValueType& at(const KeyType& Key)
+    {
+        ValueType* Value = Find(Key);
+        if (!Value)
+        {
+            throw std::out_of_range("TFlatMap::at: key not found");
+        }
+        return *Value;
+    }
+
+    const ValueType& at(const KeyType& Key) const
+    {
+        const ValueType* Value = Find(Key);
+        if (!Value)
+        {
+            throw std::out_of_range("TFlatMap::at: key not found");
+        }
+        return *Value;
+    }
+
+    /** 요소 추가/수정 */
+    void Add(const KeyType& Key, const ValueType& Value)
+    {
+        (*this)[Key] = Value;
+    }
+
+    template<typename... Args>
+    void Emplace(const KeyType& Key, Args&&... args)
+    {
+        try_emplace(Key, std::forward<Args>(args)...);
+    }
+
+    /** 제거 */
+    bool Remove(const KeyType& Key)
+    {
+        return this->erase(Key) > 0;
+    }
+
+    /** 크기 관련 */
+    int32 Num() const { return static_cast<int32>(this->size()); }
+    bool IsEmpty() const { return this->empty(); }
+    void Empty() { this->clear(); }
+
+    /** 검색 */
+    bool Contains(const KeyType& Key) const
+    {
+        return this->FindIndex(Key) != UINT32_MAX;
+    }
+
+    ValueType* Find(const KeyType& Key)
+    {
+        const uint32 Index = this->FindIndex(Key);
+        return Index != UINT32_MAX ? &this->Slots[Index].second : nullptr;
+    }
+
+    const ValueType* Find(const KeyType& Key) const
+    {
+        const uint32 Index = this->FindIndex(Key);
+        return Index != UINT32_MAX ? &this->Slots[Index].second : nullptr;
+    }
+
+    /** 찾거나 기본값 반환 */
+    ValueType FindRef(const KeyType& Key) const
+    {
+        const ValueType* Value = Find(Key);
+        return Value ? *Value : ValueType{};
+    }
+
+    /** 키/값 배열 반환 */
+    TArray<KeyType> GetKeys() const
+    {
+        TArray<KeyType> Keys;
+        Keys.Reserve(this->size());
+        for (const value_type& Pair : *this)
+        {
+            Keys.Add(Pair.first);
+        }
+        return Keys;
+    }
+
+    TArray<ValueType> GetValues() const
+    {
+        TArray<ValueType> Values;
+        Values.Reserve(this->size());
+        for (const value_type& Pair : *this)
+        {
+            Values.Add(Pair.second);
+        }
+        return Values;
+    }
+};
+
+/**
+ * TFlatSet - open addressing 해시 집합. TSet과 같은 API (Add/Remove/Contains ..., find/end/erase/insert)
+ */
+template<typename T, typename Hasher = std::hash<T>, typename KeyEqual = std::equal_to<T>>
+class TFlatSet : public TFlatHashTable<T, T, TFlatSetKeyFuncs<T>, Hasher, KeyEqual>
+{
+    using Super = TFlatHashTable<T, T, TFlatSetKeyFuncs<T>, Hasher, KeyEqual>;
+
+public:
+    using key_type = T;
+    using value_type = T;
+    using typename Super::iterator;
+    using typename Super::const_iterator;
+
+    TFlatSet() = default;
+    TFlatSet(std::initializer_list<T> InList)
+    {
+        this->reserve(InList.size());
+        for (const T& Item : InList)
+        {
+            insert(Item);
+        }
+    }
+
+    std::pair<iterator, bool> insert(const T& Item)
+    {
+        uint32 Index = this->FindIndex(Item);
+        if (Index != UINT32_MAX)
+        {
+            return { iterator(this, Index), false };
+        }
+        // Item이 이 집합의 요소를 가리킬 수 있으므로 재해시 전에 복사
+        T Element(Item);
+        Index = this->PrepareInsert(Element);
+        new (&this->Slots[Index]) T(std::move(Element));
+        return { iterator(this, Index), true };
+    }
+
+    /** 요소 추가 */
+    void Add(const T& Item)
+    {
+        insert(Item);
+    }
+
+    /** 제거 */
+    bool Remove(const T& Item)
+    {
+        return this->erase(Item) > 0;
+    }
+
+    /** 크기 관련 */
+    int32 Num() const { return static_cast<int32>(this->size()); }
+    bool IsEmpty() const { return this->empty(); }
+    void Empty() { this->clear(); }
+
+    /** 검색 */
+    bool Contains(const T& Item) const
+    {
+        return this->FindIndex(Item) != UINT32_MAX;
+    }
+
+    /** 배열로 변환 */
+    TArray<T> Array() const
+    {
+        TArray<T> Result;
+        Result.Reserve(this->size());
+        for (const T& Item : *this)
+        {
+            Result.Add(Item);
+        }
+        return Result;
+    }
+};
@@ -19,31 +19,48 @@ typedef wchar_t WIDECHAR;
 typedef std::string FString;
 typedef std::wstring FWideString;
 
+class UObject;
+namespace ObjectFactory
+{
+    uint32 GetObjectSerial(uint32 Index);
+    UObject* ResolveObject(uint32 Index, uint32 Serial);
+}
+
 // Lightweight weak object pointer compatible with engine UObject lifetime
-// - Stores a raw pointer (non-owning)
-// - Provides IsValid(), Get(), operators for containers
-// - Hash specialization provided below for unordered_map/set
+// - Stores (GUObjectArray index, slot serial) instead of a raw pointer (non-owning)
+// - IsValid()/Get() detect destroyed objects even if the slot was reused by a new object
+// - Equality/hash use (index, serial) so a key stays stable after its object is destroyed
 template<typename T>
 class TWeakObjectPtr
 {
 public:
     using ElementType = T;
 
-    TWeakObjectPtr() : Ptr(nullptr) {}
-    TWeakObjectPtr(std::nullptr_t) : Ptr(nullptr) {}
-    explicit TWeakObjectPtr(T* InPtr) : Ptr(InPtr) {}
+    TWeakObjectPtr() = default;
+    TWeakObjectPtr(std::nullptr_t) {}
+    explicit TWeakObjectPtr(T* InPtr)
+    {
+        if (InPtr)
+        {
+            ObjectIndex = InPtr->InternalIndex;
+            ObjectSerial = ObjectFactory::GetObjectSerial(ObjectIndex);
+        }
+    }
 
-    bool IsValid() const { return Ptr != nullptr; }
-    T* Get() const { return Ptr; }
+    bool IsValid() const { return ObjectFactory::ResolveObject(ObjectIndex, ObjectSerial) != nullptr; }
+    T* Get() const { return static_cast<T*>(ObjectFactory::ResolveObject(ObjectIndex, ObjectSerial)); }
 
-    T& operator*() const { return *Ptr; }
-    T* operator->() const { return Ptr; }
+    T& operator*() const { return *Get(); }
+    T* operator->() const { return Get(); }
 
-    bool operator==(const TWeakObjectPtr& Other) const { return Ptr == Other.Ptr; }
-    bool operator!=(const TWeakObjectPtr& Other) const { return Ptr != Other.Ptr; }
+    bool operator==(const TWeakObjectPtr& Other) const { return ObjectIndex == Other.ObjectIndex && ObjectSerial == Other.ObjectSerial; }
+    bool operator!=(const TWeakObjectPtr& Other) const { return !(*this == Other); }
+
+    uint64 GetKey() const { return (static_cast<uint64>(ObjectSerial) << 32) | ObjectIndex; }
 
 private:
-    T* Ptr;
+    uint32 ObjectIndex = UINT32_MAX;
+    uint32 ObjectSerial = 0;
 };
 
 namespace std {
@@ -52,7 +69,7 @@ namespace std {
     {
         size_t operator()(const TWeakObjectPtr<T>& Key) const noexcept
         {
-            return hash<const void*>()(static_cast<const void*>(Key.Get()));
+            return hash<uint64>()(Key.GetKey());
         }
     };
 }
@@ -68,12 +85,19 @@ using TPair = std::pair<T1, T2>;
 template<typename T, SIZE_T N>
 using TStaticArray = std::array<T, N>;
 
+/**
+ * TArray의 할당자 지정용 태그. TArray<T, TInlineAllocator<N>>은 N개까지 객체 안에 저장 (아래 특수화 참고)
+ * 그 외 Allocator는 std::vector에 그대로 넘어가는 STL 할당자 (예: TTaggedAllocator)
+ */
+template<uint32 NumInlineElements>
+struct TInlineAllocator {};
+
 /** TArray 구현 */
-template<typename T>
-class TArray : public std::vector<T>
+template<typename T, typename Allocator = std::allocator<T>>
+class TArray : public std::vector<T, Allocator>
 {
 public:
-    using std::vector<T>::vector; /** 생성자 상속 */
+    using std::vector<T, Allocator>::vector; /** 생성자 상속 */
 
     /** 요소 추가 */
     int32 Add(const T& Item)
@@ -100,8 +124,9 @@ public:
         return static_cast<int32>(std::distance(this->begin(), it));
     }
 
-    /** 배열 병합 */
-    void Append(const TArray<T>& Other)
+    /** 배열 병합 (할당자가 다른 TArray도 가능) */
+    template<typename OtherArray>
+    void Append(const OtherArray& Other)
     {
         this->insert(this->end(), Other.begin(), Other.end());
     }
@@ -264,6 +289,368 @@ public:
     }
 };
 
+
+/**
+ * TArray<T, TInlineAllocator<N>> - 처음 N개는 객체 안의 버퍼에 저장하고, 넘치면 힙으로 옮기는 배열
+ * 요소 몇 개짜리 임시 배열을 만들 때 힙 할당이 생기지 않음. 공개 API는 TArray와 같음 (반복자는 T*)
+ * 주의: 인라인 상태에서는 이동해도 요소가 복사/이동되므로 요소 포인터가 유지되지 않음
+ */
+template<typename T, uint32 NumInlineElements>
+class TArray<T, TInlineAllocator<NumInlineElements>>
+{
+    static_assert(NumInlineElements > 0, "TInlineAllocator<0>은 의미 없음 (기본 TArray 사용)");
+
+public:
+    using value_type = T;
+    using size_type = SIZE_T;
+    using reference = T&;
+    using const_reference = const T&;
+    using iterator = T*;
+    using const_iterator = const T*;
+
+    TArray() = default;
+
+    TArray(std::initializer_list<T> InList)
+    {
+        Reserve(static_cast<int64>(InList.size()));
+        for (const T& Item : InList)
+        {
+            Add(Item);
+        }
+    }
+
+    TArray(const TArray& Other)
+    {
+        Reserve(Other.ArrayNum);
+        for (const T& Item : Other)
+        {
+            Add(Item);
+        }
+    }
+
+    TArray(TArray&& Other) noexcept
+    {
+        MoveFrom(Other);
+    }
+
+    ~TArray()
+    {
+        Empty();
+        ReleaseHeap();
+    }
+
+    TArray& operator=(const TArray& Other)
+    {
+        if (this != &Other)
+        {
+            Empty();
+            Reserve(Other.ArrayNum);
+            for (const T& Item : Other)
+            {
+                Add(Item);
+            }
+        }
+        return *this;
+    }
+
+    TArray& operator=(TArray&& Other) noexcept
+    {
+        if (this != &Other)
+        {
+            Empty();
+            ReleaseHeap();
+            MoveFrom(Other);
+        }
+        return *this;
+    }
+
+    /** 요소 추가 */
+    int32 Add(const T& Item)
+    {
+        return Emplace(Item);
+    }
+
+    int32 Add(T&& Item)
+    {
+        return Emplace(std::move(Item));
+    }
+
+    template<typename... Args>
+    int32 Emplace(Args&&... args)
+    {
+        if (ArrayNum == ArrayMax)
+        {
+            // 인자가 자기 요소를 참조할 수 있으므로 먼저 만들어 둔 뒤 옮김
+            T Temp(std::forward<Args>(args)...);
+            Grow(ArrayNum + 1);
+            new (Data + ArrayNum) T(std::move(Temp));
+        }
+        else
+        {
+            new (Data + ArrayNum) T(std::forward<Args>(args)...);
+        }
+        return ArrayNum++;
+    }
+
+    /** 고유 요소만 추가 */
+    int32 AddUnique(const T& Item)
+    {
+        const int32 Index = Find(Item);
+        return Index != -1 ? Index : Add(Item);
+    }
+
+    /** 배열 병합 */
+    template<typename OtherArray>
+    void Append(const OtherArray& Other)
+    {
+        Reserve(static_cast<int64>(ArrayNum) + static_cast<int64>(Other.size()));
+        for (const T& Item : Other)
+        {
+            Add(Item);
+        }
+    }
+
+    /** 삽입 */
+    void Insert(const T& Item, int32 Index)
+    {
+        Add(Item);
+        std::rotate(Data + Index, Data + ArrayNum - 1, Data + ArrayNum);
+    }
+
+    /** 제거 */
+    void RemoveAt(int32 Index)
+    {
+        std::move(Data + Index + 1, Data + ArrayNum, Data + Index);
+        pop_back();
+    }
+
+    /** 빠르게 제거 (순서 보존 X) */
+    void RemoveAtSwap(int32 Index, int32 Count = 1, bool bAllowShrinking = false)
+    {
+        if (Index < 0 || Count <= 0 || Index >= ArrayNum)
+        {
+            return;
+        }
+
+        const int32 NumToRemove = std::min(Count, ArrayNum - Index);
+        for (int32 i = 0; i < NumToRemove; ++i)
+        {
+            const int32 LastIndex = ArrayNum - 1;
+            if (Index < LastIndex)
+            {
+                std::swap(Data[Index], Data[LastIndex]);
+            }
+            pop_back();
+        }
+
+        if (bAllowShrinking)
+        {
+            Shrink();
+        }
+    }
+
+    bool Remove(const T& Item)
+    {
+        const int32 Index = Find(Item);
+        if (Index == -1)
+        {
+            return false;
+        }
+        RemoveAt(Index);
+        return true;
+    }
+
+    int32 RemoveAll(const T& Item)
+    {
+        T* NewEnd = std::remove(Data, Data + ArrayNum, Item);
+        const int32 NumRemoved = static_cast<int32>((Data + ArrayNum) - NewEnd);
+        while (Data + ArrayNum != NewEnd)
+        {
+            pop_back();
+        }
+        return NumRemoved;
+    }
+
+    /** 크기 관련 */
+    int32 Num() const { return ArrayNum; }
+    bool IsEmpty() const { return ArrayNum == 0; }
+
+    void Empty()
+    {
+        std::destroy(Data, Data + ArrayNum);
+        ArrayNum = 0;
+    }
+
+    // 요소가 인라인 버퍼에 들어가면 힙을 반납
+    void Shrink()
+    {
+        if (Data != GetInlineData() && ArrayNum <= static_cast<int32>(NumInlineElements))
+        {
+            T* OldData = Data;
+            std::uninitialized_move(OldData, OldData + ArrayNum, GetInlineData());
+            std::destroy(OldData, OldData + ArrayNum);
+            ::operator delete(OldData, std::align_val_t(alignof(T)));
+            Data = GetInlineData();
+            ArrayMax = NumInlineElements;
+        }
+    }
+
+    void Reserve(int64 Capacity)
+    {
+        if (Capacity > ArrayMax)
+        {
+            Reallocate(static_cast<int32>(Capacity));
+        }
+    }
+
+    void SetNum(int32 NewSize)
+    {
+        resize(static_cast<SIZE_T>(NewSize));
+    }
+
+    void SetNum(int32 NewSize, const T& DefaultValue)
+    {
+        resize(static_cast<SIZE_T>(NewSize), DefaultValue);
+    }
+
+    /** 접근 */
+    T& Last() { return Data[ArrayNum - 1]; }
+    const T& Last() const { return Data[ArrayNum - 1]; }
+
+    /** 내부 데이터 포인터 반환 */
+    T* GetData() { return Data; }
+    const T* GetData() const { return Data; }
+
+    /** Stack 기능 */
+    void Push(const T& Item) { Add(Item); }
+
+    T Pop()
+    {
+        T Item = std::move(Last());
+        pop_back();
+        return Item;
+    }
+
+    /** 검색 */
+    int32 Find(const T& Item) const
+    {
+        const T* It = std::find(Data, Data + ArrayNum, Item);
+        return It != Data + ArrayNum ? static_cast<int32>(It - Data) : -1;
+    }
+
+    bool Contains(const T& Item) const
+    {
+        return Find(Item) != -1;
+    }
+
+    /** 정렬 */
+    void Sort()
+    {
+        std::sort(Data, Data + ArrayNum);
+    }
+
+    template<typename Predicate>
+    void Sort(Predicate Pred)
+    {
+        std::sort(Data, Data + ArrayNum, Pred);
+    }
+
+    /** 인라인 버퍼를 쓰고 있는지 (힙 할당 없음) */
+    bool IsInline() const { return Data == GetInlineData(); }
+
+    // ── std::vector 호환 (기존 TArray 사용 코드와 같은 방식으로 쓸 수 있게) ──
+    T& operator[](SIZE_T Index) { return Data[Index]; }
+    const T& operator[](SIZE_T Index) const { return Data[Index]; }
+    T* begin() { return Data; }
+    T* end() { return Data + ArrayNum; }
+    const T* begin() const { return Data; }
+    const T* end() const { return Data + ArrayNum; }
+    T* data() { return Data; }
+    const T* data() const { return Data; }
+    SIZE_T size() const { return static_cast<SIZE_T>(ArrayNum); }
+    SIZE_T capacity() const { return static_cast<SIZE_T>(ArrayMax); }
+    bool empty() const { return ArrayNum == 0; }
+    void clear() { Empty(); }
+    void reserve(SIZE_T Capacity) { Reserve(static_cast<int64>(Capacity)); }
+    void push_back(const T& Item) { Add(Item); }
+    void push_back(T&& Item) { Add(std::move(Item)); }
+    template<typename... Args>
+    T& emplace_back(Args&&... args) { return Data[Emplace(std::forward<Args>(args)...)]; }
+    void pop_back() { std::destroy_at(Data + --ArrayNum); }
+    T& back() { return Last(); }
+    const T& back() const { return Last(); }
+    T& front() { return Data[0]; }
+    const T& front() const { return Data[0]; }
+
+    void resize(SIZE_T NewSize)
+    {
+        Reserve(static_cast<int64>(NewSize));
+        while (static_cast<SIZE_T>(ArrayNum) > NewSize) pop_back();
+        while (static_cast<SIZE_T>(ArrayNum) < NewSize) new (Data + ArrayNum++) T();
+    }
+
+    void resize(SIZE_T NewSize, const T& Value)
+    {
+        Reserve(static_cast<int64>(NewSize));
+        while (static_cast<SIZE_T>(ArrayNum) > NewSize) pop_back();
+        while (static_cast<SIZE_T>(ArrayNum) < NewSize) new (Data + ArrayNum++) T(Value);
+    }
+
+private:
+    T* GetInlineData() { return reinterpret_cast<T*>(InlineStorage); }
+    const T* GetInlineData() const { return reinterpret_cast<const T*>(InlineStorage); }
+
+    void Grow(int32 MinCapacity)
+    {
+        Reallocate(std::max(MinCapacity, ArrayMax * 2));
+    }
+
+    void Reallocate(int32 NewMax)
+    {
+        T* NewData = static_cast<T*>(::operator new(sizeof(T) * NewMax, std::align_val_t(alignof(T))));
+        std::uninitialized_move(Data, Data + ArrayNum, NewData);
+        std::destroy(Data, Data + ArrayNum);
+        ReleaseHeap();
+        Data = NewData;
+        ArrayMax = NewMax;
+    }
+
+    void ReleaseHeap()
+    {
+        if (Data != GetInlineData())
+        {
+            ::operator delete(Data, std::align_val_t(alignof(T)));
+            Data = GetInlineData();
+            ArrayMax = NumInlineElements;
+        }
+    }
+
+    // Other의 요소를 가져옴 (힙이면 포인터만 가져오고, 인라인이면 하나씩 이동). 호출 시 이쪽은 비어 있고 인라인 상태
+    void MoveFrom(TArray& Other)
+    {
+        if (Other.Data != Other.GetInlineData())
+        {
+            Data = Other.Data;
+            ArrayNum = Other.ArrayNum;
+            ArrayMax = Other.ArrayMax;
+            Other.Data = Other.GetInlineData();
+            Other.ArrayNum = 0;
+            Other.ArrayMax = NumInlineElements;
+        }
+        else
+        {
+            std::uninitialized_move(Other.Data, Other.Data + Other.ArrayNum, Data);
+            ArrayNum = Other.ArrayNum;
+            Other.Empty();
+        }
+    }
+
+    alignas(T) unsigned char InlineStorage[sizeof(T) * NumInlineElements];
+    T* Data = GetInlineData();
+    int32 ArrayNum = 0;
+    int32 ArrayMax = NumInlineElements;
+};
+
 /** TSet - 해시 기반 집합 */
 template<typename T>
 class TSet : public std::unordered_set<T>
@@ -445,6 +832,9 @@ public:
     }
 };
 
+/** TFlatMap / TFlatSet - open addressing 해시 컨테이너 (요소 포인터 안정성이 필요 없는 핫 패스용) */
+#include "FlatHashMap.h"
+
 /** TOrderedMap - 키(Key) 기준 정렬 맵 (std::map 래퍼) */
 template<typename KeyType, typename ValueType, typename Compare = std::less<KeyType>>
 class TOrderedMap : public std::map<KeyType, ValueType, Compare>
@@ -186,3 +186,54 @@ FTransform::FTransform(const FMatrix& M)
 	// (행렬 -> 쿼터니언 변환)
 	this->Rotation = FQuat(RotationMatrix);
 }
+
+void FTransformBatch::TransformPositions(const FMatrix& Matrix, const FVector* InPoints, FVector* OutPoints, int32 Num)
+{
+	// 행렬 성분을 lane마다 복제해 두고, 점 4개(float 12개)를 X/Y/Z 레지스터로 풀어서 계산
+	const __m128 M00 = _mm_set1_ps(Matrix.M[0][0]), M01 = _mm_set1_ps(Matrix.M[0][1]), M02 = _mm_set1_ps(Matrix.M[0][2]);
+	const __m128 M10 = _mm_set1_ps(Matrix.M[1][0]), M11 = _mm_set1_ps(Matrix.M[1][1]), M12 = _mm_set1_ps(Matrix.M[1][2]);
+	const __m128 M20 = _mm_set1_ps(Matrix.M[2][0]), M21 = _mm_set1_ps(Matrix.M[2][1]), M22 = _mm_set1_ps(Matrix.M[2][2]);
+	const __m128 M30 = _mm_set1_ps(Matrix.M[3][0]), M31 = _mm_set1_ps(Matrix.M[3][1]), M32 = _mm_set1_ps(Matrix.M[3][2]);
+
+	static_assert(sizeof(FVector) == sizeof(float) * 3, "FVector는 float 3개로 채워져 있어야 함");
+
+	int32 Index = 0;
+	for (; Index + 4 <= Num; Index += 4)
+	{
+		const float* Src = &InPoints[Index].X;
+		const __m128 A = _mm_loadu_ps(Src);        // x0 y0 z0 x1
+		const __m128 B = _mm_loadu_ps(Src + 4);    // y1 z1 x2 y2
+		const __m128 C = _mm_loadu_ps(Src + 8);    // z2 x3 y3 z3
+
+		const __m128 X = _mm_shuffle_ps(A, _mm_shuffle_ps(B, C, _MM_SHUFFLE(1, 1, 2, 2)), _MM_SHUFFLE(2, 0, 3, 0));
+		const __m128 Y = _mm_shuffle_ps(_mm_shuffle_ps(A, B, _MM_SHUFFLE(0, 0, 1, 1)), _mm_shuffle_ps(B, C, _MM_SHUFFLE(2, 2, 3, 3)), _MM_SHUFFLE(2, 0, 2, 0));
+		const __m128 Z = _mm_shuffle_ps(_mm_shuffle_ps(A, B, _MM_SHUFFLE(1, 1, 2, 2)), C, _MM_SHUFFLE(3, 0, 2, 0));
+
+		const __m128 OutX = _mm_add_ps(_mm_add_ps(_mm_mul_ps(X, M00), _mm_mul_ps(Y, M10)), _mm_add_ps(_mm_mul_ps(Z, M20), M30));
+		const __m128 OutY = _mm_add_ps(_mm_add_ps(_mm_mul_ps(X, M01), _mm_mul_ps(Y, M11)), _mm_add_ps(_mm_mul_ps(Z, M21), M31));
+		const __m128 OutZ = _mm_add_ps(_mm_add_ps(_mm_mul_ps(X, M02), _mm_mul_ps(Y, M12)), _mm_add_ps(_mm_mul_ps(Z, M22), M32));
+
+		float* Dst = &OutPoints[Index].X;
+		_mm_storeu_ps(Dst, _mm_shuffle_ps(_mm_shuffle_ps(OutX, OutY, _MM_SHUFFLE(0, 0, 0, 0)), _mm_shuffle_ps(OutZ, OutX, _MM_SHUFFLE(1, 1, 0, 0)), _MM_SHUFFLE(2, 0, 2, 0)));
+		_mm_storeu_ps(Dst + 4, _mm_shuffle_ps(_mm_shuffle_ps(OutY, OutZ, _MM_SHUFFLE(1, 1, 1, 1)), _mm_shuffle_ps(OutX, OutY, _MM_SHUFFLE(2, 2, 2, 2)), _MM_SHUFFLE(2, 0, 2, 0)));
+		_mm_storeu_ps(Dst + 8, _mm_shuffle_ps(_mm_shuffle_ps(OutZ, OutX, _MM_SHUFFLE(3, 3, 2, 2)), _mm_shuffle_ps(OutY, OutZ, _MM_SHUFFLE(3, 3, 3, 3)), _MM_SHUFFLE(2, 0, 2, 0)));
+	}
+
+	for (; Index < Num; ++Index)
+	{
+		OutPoints[Index] = Matrix.TransformPosition(InPoints[Index]);
+	}
+}
+
+void FTransformBatch::TransformPositions(const FTransform& Transform, const FVector* InPoints, FVector* OutPoints, int32 Num)
+{
+	TransformPositions(Transform.ToMatrix(), InPoints, OutPoints, Num);
+}
+
+void FTransformBatch::ComposeTransforms(const FTransform* Parents, const FTransform* Children, FTransform* Out, int32 Num)
+{
+	for (int32 Index = 0; Index < Num; ++Index)
+	{
+		Out[Index] = Parents[Index].GetWorldTransform(Children[Index]);
+	}
+}
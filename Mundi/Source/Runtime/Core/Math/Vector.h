@@ -441,6 +441,86 @@ inline void NormalizeQuat(float& x, float& y, float& z, float& w)
 	if (w < 0.0) { x = -x; y = -y; z = -z; w = -w; } // q와 -q 동치 → 표준화
 }
 
+// ─────────────────────────────
+// SSE 보조 함수 (FQuat / FTransform 구현용)
+// 쿼터니언은 (X, Y, Z, W) 4 lane 그대로, FVector는 W lane을 0으로 채워 다룸
+// FVector는 12바이트라 16바이트 로드가 배열 끝을 넘을 수 있으므로 set/store로만 옮긴다
+// ─────────────────────────────
+namespace VectorSIMD
+{
+	inline __m128 LoadVector3(const FVector& V) { return _mm_set_ps(0.0f, V.Z, V.Y, V.X); }
+
+	inline FVector StoreVector3(__m128 V)
+	{
+		alignas(16) float Out[4];
+		_mm_store_ps(Out, V);
+		return FVector(Out[0], Out[1], Out[2]);
+	}
+
+	template<int Lane>
+	inline __m128 Splat(__m128 V) { return _mm_shuffle_ps(V, V, _MM_SHUFFLE(Lane, Lane, Lane, Lane)); }
+
+	// 모든 lane에 4성분 내적
+	inline __m128 Dot4(__m128 A, __m128 B)
+	{
+		__m128 Sum = _mm_mul_ps(A, B);
+		Sum = _mm_add_ps(Sum, _mm_shuffle_ps(Sum, Sum, _MM_SHUFFLE(2, 3, 0, 1)));
+		return _mm_add_ps(Sum, _mm_shuffle_ps(Sum, Sum, _MM_SHUFFLE(1, 0, 3, 2)));
+	}
+
+	// xyz 외적 (W lane은 0)
+	inline __m128 Cross3(__m128 A, __m128 B)
+	{
+		const __m128 AYZX = _mm_shuffle_ps(A, A, _MM_SHUFFLE(3, 0, 2, 1));
+		const __m128 BYZX = _mm_shuffle_ps(B, B, _MM_SHUFFLE(3, 0, 2, 1));
+		const __m128 C = _mm_sub_ps(_mm_mul_ps(A, BYZX), _mm_mul_ps(AYZX, B));
+		return _mm_shuffle_ps(C, C, _MM_SHUFFLE(3, 0, 2, 1));
+	}
+
+	// FQuat::operator*와 같은 해밀턴 곱 A * B
+	inline __m128 QuatMultiply(__m128 A, __m128 B)
+	{
+		// A.W*B + A.X*(Bw,-Bz,By,-Bx) + A.Y*(Bz,Bw,-Bx,-By) + A.Z*(-By,Bx,Bw,-Bz)
+		const __m128 SignX = _mm_castsi128_ps(_mm_set_epi32(int(0x80000000), 0, int(0x80000000), 0));
+		const __m128 SignY = _mm_castsi128_ps(_mm_set_epi32(int(0x80000000), int(0x80000000), 0, 0));
+		const __m128 SignZ = _mm_castsi128_ps(_mm_set_epi32(int(0x80000000), 0, 0, int(0x80000000)));
+
+		__m128 Result = _mm_mul_ps(Splat<3>(A), B);
+		Result = _mm_add_ps(Result, _mm_mul_ps(Splat<0>(A), _mm_xor_ps(_mm_shuffle_ps(B, B, _MM_SHUFFLE(0, 1, 2, 3)), SignX)));
+		Result = _mm_add_ps(Result, _mm_mul_ps(Splat<1>(A), _mm_xor_ps(_mm_shuffle_ps(B, B, _MM_SHUFFLE(1, 0, 3, 2)), SignY)));
+		Result = _mm_add_ps(Result, _mm_mul_ps(Splat<2>(A), _mm_xor_ps(_mm_shuffle_ps(B, B, _MM_SHUFFLE(2, 3, 0, 1)), SignZ)));
+		return Result;
+	}
+
+	// v' = v + w * t + cross(q.xyz, t), t = 2 * cross(q.xyz, v)  (V의 W lane은 0이어야 함)
+	inline __m128 QuatRotateVector(__m128 Q, __m128 V)
+	{
+		const __m128 T = Cross3(Q, V);
+		const __m128 T2 = _mm_add_ps(T, T);
+		return _mm_add_ps(_mm_add_ps(V, _mm_mul_ps(Splat<3>(Q), T2)), Cross3(Q, T2));
+	}
+
+	// 길이가 KINDA_SMALL_NUMBER 이하이면 단위 쿼터니언 (FQuat::Normalize와 같음)
+	inline __m128 QuatNormalize(__m128 Q)
+	{
+		const __m128 Length = _mm_sqrt_ps(Dot4(Q, Q));
+		if (_mm_cvtss_f32(Length) > KINDA_SMALL_NUMBER)
+		{
+			return _mm_div_ps(Q, Length);
+		}
+		return _mm_set_ps(1.0f, 0.0f, 0.0f, 0.0f);
+	}
+
+	// 짧은 호 방향으로 맞춘 뒤 선형 보간: A + (±B - A) * T (정규화 전)
+	inline __m128 QuatLerpShortest(__m128 A, __m128 B, float T)
+	{
+		const __m128 SignMask = _mm_castsi128_ps(_mm_set1_epi32(int(0x80000000)));
+		const __m128 DotSign = _mm_and_ps(Dot4(A, B), SignMask);
+		const __m128 End = _mm_xor_ps(B, DotSign);
+		return _mm_add_ps(A, _mm_mul_ps(_mm_sub_ps(End, A), _mm_set1_ps(T)));
+	}
+}
+
 // ─────────────────────────────
 // FQuat (Quaternion)
 // ─────────────────────────────
@@ -456,15 +536,15 @@ struct FQuat
 
 	static FQuat Identity() { return FQuat(0, 0, 0, 1); }
 
+	// SSE 레지스터와 변환 (X, Y, Z, W 순서로 연속 배치)
+	explicit FQuat(__m128 InSimd) { _mm_storeu_ps(&X, InSimd); }
+	__m128 ToSimd() const { return _mm_loadu_ps(&X); }
+
 	// 곱 (회전 누적)
+	// = (W*Q.X + X*Q.W + Y*Q.Z - Z*Q.Y, W*Q.Y - X*Q.Z + Y*Q.W + Z*Q.X, W*Q.Z + X*Q.Y - Y*Q.X + Z*Q.W, W*Q.W - X*Q.X - Y*Q.Y - Z*Q.Z)
 	FQuat operator*(const FQuat& Q) const
 	{
-		return FQuat(
-			W * Q.X + X * Q.W + Y * Q.Z - Z * Q.Y,
-			W * Q.Y - X * Q.Z + Y * Q.W + Z * Q.X,
-			W * Q.Z + X * Q.Y - Y * Q.X + Z * Q.W,
-			W * Q.W - X * Q.X - Y * Q.Y - Z * Q.Z
-		);
+		return FQuat(VectorSIMD::QuatMultiply(ToSimd(), Q.ToSimd()));
 	}
 
 	static float Dot(const FQuat& A, const FQuat& B)
@@ -477,9 +557,8 @@ struct FQuat
 
 	void Normalize()
 	{
-		float S = Size();
-		if (S > KINDA_SMALL_NUMBER) { X /= S; Y /= S; Z /= S; W /= S; }
-		else { *this = Identity(); }
+		// 길이가 KINDA_SMALL_NUMBER 이하이면 Identity
+		_mm_storeu_ps(&X, VectorSIMD::QuatNormalize(ToSimd()));
 	}
 
 	FQuat GetNormalized() const
@@ -631,14 +710,7 @@ struct FQuat
 		const float SLERP_EPS = 1e-3f;
 		if (CosTheta > 1.0f - SLERP_EPS)
 		{
-			FQuat r = FQuat(
-				A.X + (End.X - A.X) * T,
-				A.Y + (End.Y - A.Y) * T,
-				A.Z + (End.Z - A.Z) * T,
-				A.W + (End.W - A.W) * T
-			);
-			r.Normalize();
-			return r;
+			return FQuat(VectorSIMD::QuatNormalize(VectorSIMD::QuatLerpShortest(A.ToSimd(), B.ToSimd(), T)));
 		}
 
 		float Theta = std::acos(CosTheta);
@@ -646,21 +718,14 @@ struct FQuat
 		float W1 = std::sin((1.0f - T) * Theta) / SinTheta;
 		float W2 = std::sin(T * Theta) / SinTheta;
 
-		FQuat Quat = A * W1 + End * W2;
-		Quat.Normalize();
-		return Quat;
+		const __m128 Blended = _mm_add_ps(_mm_mul_ps(A.ToSimd(), _mm_set1_ps(W1)), _mm_mul_ps(End.ToSimd(), _mm_set1_ps(W2)));
+		return FQuat(VectorSIMD::QuatNormalize(Blended));
 	}
 
 	// 보조: 선형 보간 후 정규화
 	static FQuat Nlerp(const FQuat& A, const FQuat& B, float T)
 	{
-		FQuat End = (Dot(A, B) < 0.0f) ? FQuat(-B.X, -B.Y, -B.Z, -B.W) : B;
-		FQuat Quat(A.X + (End.X - A.X) * T,
-			A.Y + (End.Y - A.Y) * T,
-			A.Z + (End.Z - A.Z) * T,
-			A.W + (End.W - A.W) * T);
-		Quat.Normalize();
-		return Quat;
+		return FQuat(VectorSIMD::QuatNormalize(VectorSIMD::QuatLerpShortest(A.ToSimd(), B.ToSimd(), T)));
 	}
 
 	// 비교 연산자
@@ -1232,29 +1297,26 @@ struct FTransform
 	// Child 로컬 좌표계의 점을 부모 좌표계 변환과 합성. 호출하는 Transform의 결과 좌표계로 변환
 	FTransform GetWorldTransform(const FTransform& ChildTransform) const
 	{
+		using namespace VectorSIMD;
+
+		const __m128 ParentRotation = Rotation.ToSimd();
+		const __m128 ParentScale = LoadVector3(Scale3D);
+
 		FTransform Result;
 
 		// 회전 결합
 		// Child 회전 후 부모 회전해야 로컬회전하므로 자식 먼저 곱해져야함
-		Result.Rotation = Rotation * ChildTransform.Rotation;
-		Result.Rotation.Normalize();
+		Result.Rotation = FQuat(QuatNormalize(QuatMultiply(ParentRotation, ChildTransform.Rotation.ToSimd())));
 
 		// 스케일 결합 (component-wise)
-		Result.Scale3D = FVector(
-			Scale3D.X * ChildTransform.Scale3D.X,
-			Scale3D.Y * ChildTransform.Scale3D.Y,
-			Scale3D.Z * ChildTransform.Scale3D.Z
-		);
+		Result.Scale3D = StoreVector3(_mm_mul_ps(ParentScale, LoadVector3(ChildTransform.Scale3D)));
 
 		//
 		// 부모 로컬 To World -> SRT, 자식 로컬 To 부모 -> Other.SRT
 		// 자식 로컬 To World -> Other.SRT * SRT 
 		// 자식 로컬 To World Translation -> Other.T * SRT = Translation(Rotation(Scale(Other.T)))
-		FVector Scaled(ChildTransform.Translation.X * Scale3D.X,
-			ChildTransform.Translation.Y * Scale3D.Y,
-			ChildTransform.Translation.Z * Scale3D.Z);
-		FVector Rotated = Rotation.RotateVector(Scaled);
-		Result.Translation = Translation + Rotated;
+		const __m128 Scaled = _mm_mul_ps(LoadVector3(ChildTransform.Translation), ParentScale);
+		Result.Translation = StoreVector3(_mm_add_ps(LoadVector3(Translation), RotateBy(Rotation, Scaled)));
 
 		return Result;
 	}
@@ -1262,29 +1324,23 @@ struct FTransform
 	//
 	FTransform GetRelativeTransform(const FTransform& ChildTransform) const
 	{
+		using namespace VectorSIMD;
+
 		const FTransform& Inverse = this->Inverse();
+		const __m128 InvScale = LoadVector3(Inverse.Scale3D);
 
 		FTransform Result;
 
-		Result.Rotation = Inverse.Rotation * ChildTransform.Rotation;
-		Result.Rotation.Normalize();
+		Result.Rotation = FQuat(QuatNormalize(QuatMultiply(Inverse.Rotation.ToSimd(), ChildTransform.Rotation.ToSimd())));
 
-		Result.Scale3D = FVector(
-			Inverse.Scale3D.X * ChildTransform.Scale3D.X,
-			Inverse.Scale3D.Y * ChildTransform.Scale3D.Y,
-			Inverse.Scale3D.Z * ChildTransform.Scale3D.Z
-		);
+		Result.Scale3D = StoreVector3(_mm_mul_ps(InvScale, LoadVector3(ChildTransform.Scale3D)));
 
 		//(자식 To 부모 T) * (부모 To World SRT) = (자식 To World T)
 		//(자식 To 부모 T) = InvScale(InvRotation(InvTranslation((자식 To World T))))
 		//(자식 To 부모 T) = InvScale(InvRotation((ChildTransform.T - this->T) ))
 		//주의할 점 : this->T랑 Inverse.T는 다름. Inverse.T는 역행렬의 Translation임.
-		FVector ResultT = ChildTransform.Translation - this->Translation;
-		ResultT = Inverse.Rotation.RotateVector(ResultT);
-		Result.Translation = FVector(
-			ResultT.X * Inverse.Scale3D.X, 
-			ResultT.Y * Inverse.Scale3D.Y, 
-			ResultT.Z * Inverse.Scale3D.Z );
+		const __m128 ResultT = _mm_sub_ps(LoadVector3(ChildTransform.Translation), LoadVector3(Translation));
+		Result.Translation = StoreVector3(_mm_mul_ps(RotateBy(Inverse.Rotation, ResultT), InvScale));
 
 		return Result;
 	}
@@ -1296,15 +1352,14 @@ struct FTransform
 	FVector TransformPosition(const FVector& P) const
 	{
 		// (R*S)*P + T
-		FVector SP = FVector(P.X * Scale3D.X, P.Y * Scale3D.Y, P.Z * Scale3D.Z);
-		FVector RP = Rotation.RotateVector(SP);
-		return Translation + RP;
+		const __m128 SP = _mm_mul_ps(VectorSIMD::LoadVector3(P), VectorSIMD::LoadVector3(Scale3D));
+		return VectorSIMD::StoreVector3(_mm_add_ps(VectorSIMD::LoadVector3(Translation), RotateBy(Rotation, SP)));
 	}
 	FVector TransformVector(const FVector& V) const
 	{
 		// R*(S*V) (translation 없음)
-		FVector SV = FVector(V.X * Scale3D.X, V.Y * Scale3D.Y, V.Z * Scale3D.Z);
-		return Rotation.RotateVector(SV);
+		const __m128 SV = _mm_mul_ps(VectorSIMD::LoadVector3(V), VectorSIMD::LoadVector3(Scale3D));
+		return VectorSIMD::StoreVector3(RotateBy(Rotation, SV));
 	}
 
 	static FTransform Lerp(const FTransform& A, const FTransform& B, float T)
@@ -1323,6 +1378,18 @@ struct FTransform
 			Scale3D == Other.Scale3D;
 	}
 	bool operator!=(const FTransform& Other) const { return !(*this == Other); }
+
+private:
+	// FQuat::RotateVector와 같은 규칙 (길이가 0에 가까운 회전은 그대로 통과)
+	static __m128 RotateBy(const FQuat& Quat, __m128 V)
+	{
+		const __m128 Q = Quat.ToSimd();
+		if (_mm_cvtss_f32(VectorSIMD::Dot4(Q, Q)) <= KINDA_SMALL_NUMBER)
+		{
+			return V;
+		}
+		return VectorSIMD::QuatRotateVector(Q, V);
+	}
 };
 
 // ─────────────────────────────
@@ -1332,35 +1399,25 @@ struct FTransform
 // v' = v + 2 * cross(q.xyz, cross(q.xyz, v) + q.w * v)
 inline FVector FQuat::RotateVector(const FVector& V) const
 {
-	float n = X * X + Y * Y + Z * Z + W * W;
-	if (n <= KINDA_SMALL_NUMBER) return V;
-
-	const FVector U(X, Y, Z);
-	const FVector T(
-		2.0f * (U.Y * V.Z - U.Z * V.Y),
-		2.0f * (U.Z * V.X - U.X * V.Z),
-		2.0f * (U.X * V.Y - U.Y * V.X)
-	);
-	return FVector(
-		V.X + W * T.X + (U.Y * T.Z - U.Z * T.Y),
-		V.Y + W * T.Y + (U.Z * T.X - U.X * T.Z),
-		V.Z + W * T.Z + (U.X * T.Y - U.Y * T.X)
-	);
+	const __m128 Q = ToSimd();
+	if (_mm_cvtss_f32(VectorSIMD::Dot4(Q, Q)) <= KINDA_SMALL_NUMBER) return V;
+
+	return VectorSIMD::StoreVector3(VectorSIMD::QuatRotateVector(Q, VectorSIMD::LoadVector3(V)));
 }
 
-// FQuat → Matrix
+// FQuat → Matrix (행벡터 규약이므로 열 기준 회전 행렬의 전치를 바로 채움)
 inline FMatrix FQuat::ToMatrix() const
 {
 	float XX = X * X, YY = Y * Y, ZZ = Z * Z;
 	float XY = X * Y, XZ = X * Z, YZ = Y * Z;
 	float WX = W * X, WY = W * Y, WZ = W * Z;
 
-	return FMatrix(
-		1.0f - 2.0f * (YY + ZZ), 2.0f * (XY - WZ), 2.0f * (XZ + WY), 0.0f,
-		2.0f * (XY + WZ), 1.0f - 2.0f * (XX + ZZ), 2.0f * (YZ - WX), 0.0f,
-		2.0f * (XZ - WY), 2.0f * (YZ + WX), 1.0f - 2.0f * (XX + YY), 0.0f,
-		0.0f, 0.0f, 0.0f, 1.0f
-	).Transpose();
+	FMatrix Result;
+	Result.Rows[0] = _mm_set_ps(0.0f, 2.0f * (XZ - WY), 2.0f * (XY + WZ), 1.0f - 2.0f * (YY + ZZ));
+	Result.Rows[1] = _mm_set_ps(0.0f, 2.0f * (YZ + WX), 1.0f - 2.0f * (XX + ZZ), 2.0f * (XY - WZ));
+	Result.Rows[2] = _mm_set_ps(0.0f, 1.0f - 2.0f * (XX + YY), 2.0f * (YZ - WX), 2.0f * (XZ + WY));
+	Result.Rows[3] = _mm_set_ps(1.0f, 0.0f, 0.0f, 0.0f);
+	return Result;
 }
 
 // Row-major + 행벡터(p' = p * M), Left-Handed: X=Forward, Y=Right, Z=Up
@@ -1475,28 +1532,26 @@ inline FMatrix FTransform::ToMatrix() const
 // FTransform 역변환
 inline FTransform FTransform::Inverse() const
 {
-	// InvScale
-	FVector InvScale(
-		(std::fabs(Scale3D.X) > KINDA_SMALL_NUMBER) ? 1.0f / Scale3D.X : 0.0f,
-		(std::fabs(Scale3D.Y) > KINDA_SMALL_NUMBER) ? 1.0f / Scale3D.Y : 0.0f,
-		(std::fabs(Scale3D.Z) > KINDA_SMALL_NUMBER) ? 1.0f / Scale3D.Z : 0.0f
-	);
+	using namespace VectorSIMD;
+
+	// InvScale (|S| <= KINDA_SMALL_NUMBER 인 축은 0)
+	const __m128 Scale = LoadVector3(Scale3D);
+	const __m128 AbsMask = _mm_castsi128_ps(_mm_set1_epi32(0x7FFFFFFF));
+	const __m128 NonZero = _mm_cmpgt_ps(_mm_and_ps(Scale, AbsMask), _mm_set1_ps(KINDA_SMALL_NUMBER));
+	const __m128 InvScale = _mm_and_ps(_mm_div_ps(_mm_set1_ps(1.0f), Scale), NonZero);
 
 	// InvRot = conjugate (단위 가정)
-	FQuat InvRot(-Rotation.X, -Rotation.Y, -Rotation.Z, Rotation.W);
+	const __m128 InvRot = _mm_xor_ps(Rotation.ToSimd(), _mm_castsi128_ps(_mm_set_epi32(0, int(0x80000000), int(0x80000000), int(0x80000000))));
 
 	//(SRT)^(-1) = T^(-1)R^(-1)S^(-1). Translation Factor : (0,0,0,1)*T^(-1)R^(-1)S^(-1)
 	//InvTrans = -InvScale(InvRotation(Translation))
-	FVector Rotated = InvRot.RotateVector(Translation);
-	FVector Scaled(Translation.X * InvScale.X,
-		Translation.Y * InvScale.Y,
-		Translation.Z * InvScale.Z);
-	FVector InvTrans(-Scaled);
+	const __m128 Rotated = RotateBy(FQuat(InvRot), LoadVector3(Translation));
+	const __m128 InvTrans = _mm_sub_ps(_mm_setzero_ps(), _mm_mul_ps(Rotated, InvScale));
 
 	FTransform Out;
-	Out.Rotation = InvRot;
-	Out.Scale3D = InvScale;
-	Out.Translation = InvTrans;
+	Out.Rotation = FQuat(InvRot);
+	Out.Scale3D = StoreVector3(InvScale);
+	Out.Translation = StoreVector3(InvTrans);
 	return Out;
 }
 
@@ -1515,4 +1570,42 @@ inline void operator*= (TArray<FVector4>& Vectors, const FMatrix& Mat)
 	{
 		Vectors[i] = Vectors[i] * Mat;
 	}
-}
\ No newline at end of file
+}
+
+// ─────────────────────────────
+// 배열 단위 변환 커널 (애니메이션 / 컬링용, 구현은 Vector.cpp)
+// 입력과 출력 배열이 같아도 됨
+// ─────────────────────────────
+namespace FTransformBatch
+{
+	// OutPoints[i] = InPoints[i] * Matrix (아핀 행렬 가정, 원근 나눗셈 없음). 점 4개씩 SoA로 바꿔 처리
+	void TransformPositions(const FMatrix& Matrix, const FVector* InPoints, FVector* OutPoints, int32 Num);
+
+	// OutPoints[i] = Transform.TransformPosition(InPoints[i])
+	void TransformPositions(const FTransform& Transform, const FVector* InPoints, FVector* OutPoints, int32 Num);
+
+	// Out[i] = Parents[i].GetWorldTransform(Children[i])
+	void ComposeTransforms(const FTransform* Parents, const FTransform* Children, FTransform* Out, int32 Num);
+
+	// OutMatrices[i] = GetMatrix(i) * Transforms[i].ToMatrix() (스키닝: 역 바인드 포즈 × 컴포넌트 포즈)
+	// 행렬이 본 구조체 안에 흩어져 있어도 되도록 인덱스 → 행렬 함수로 받음
+	template<typename MatrixFunc>
+	void MultiplyByTransforms(MatrixFunc&& GetMatrix, const FTransform* Transforms, FMatrix* OutMatrices, int32 Num)
+	{
+		for (int32 Index = 0; Index < Num; ++Index)
+		{
+			const FMatrix& A = GetMatrix(Index);
+			const FMatrix B = Transforms[Index].ToMatrix();
+			__m128 Rows[4];
+			for (int32 Row = 0; Row < 4; ++Row)
+			{
+				const __m128 R = A.Rows[Row];
+				Rows[Row] = _mm_mul_ps(VectorSIMD::Splat<0>(R), B.Rows[0]);
+				Rows[Row] = _mm_add_ps(Rows[Row], _mm_mul_ps(VectorSIMD::Splat<1>(R), B.Rows[1]));
+				Rows[Row] = _mm_add_ps(Rows[Row], _mm_mul_ps(VectorSIMD::Splat<2>(R), B.Rows[2]));
+				Rows[Row] = _mm_add_ps(Rows[Row], _mm_mul_ps(VectorSIMD::Splat<3>(R), B.Rows[3]));
+			}
+			OutMatrices[Index] = FMatrix(Rows[0], Rows[1], Rows[2], Rows[3]);
+		}
+	}
+}
@@ -1,30 +1,313 @@
 ﻿#include "pch.h"
 #include "MemoryManager.h"
-#include <cstddef>
-#include <malloc.h>
+#include <cstdlib>
+#include <cstring>
 #include <algorithm>
 
-uint32 FMemoryManager::TotalAllocationBytes = 0;
-uint32 FMemoryManager::TotalAllocationCount = 0;
+namespace
+{
+	// 모든 할당의 사용자 포인터 바로 앞 16바이트
+	struct FAllocHeader
+	{
+		uint64 Size;        // 요청 크기
+		uint32 Offset;      // 큰 할당: 사용자 포인터 - malloc 포인터
+		uint8 Tag;
+		uint8 SizeClass;    // 풀 크기 클래스, LargeSizeClass면 시스템 힙
+		uint8 Padding[2];
+	};
+	static_assert(sizeof(FAllocHeader) == FMemoryManager::PoolAlignment, "헤더가 풀 정렬 크기와 같아야 사용자 포인터 정렬이 유지됨");
+
+	constexpr uint8 LargeSizeClass = 0xFF;
+
+	// 헤더 포함 블록 크기 (16의 배수)
+	constexpr uint32 SizeClassBytes[] = { 32, 48, 64, 80, 96, 128, 160, 192, 256, 320, 384, 512, 640, 768, 1024, 1280, 1536, 2048 };
+	constexpr uint32 NumSizeClasses = sizeof(SizeClassBytes) / sizeof(SizeClassBytes[0]);
+	static_assert(SizeClassBytes[NumSizeClasses - 1] == FMemoryManager::MaxPooledSize, "마지막 크기 클래스는 MaxPooledSize");
+
+	constexpr size_t PoolPageSize = 64 * 1024;
+
+	// (블록 크기 / 16) → 크기 클래스
+	struct FSizeClassTable
+	{
+		uint8 Index[FMemoryManager::MaxPooledSize / 16 + 1] = {};
+
+		constexpr FSizeClassTable()
+		{
+			uint32 Class = 0;
+			for (uint32 Units = 0; Units <= FMemoryManager::MaxPooledSize / 16; ++Units)
+			{
+				while (SizeClassBytes[Class] < Units * 16)
+				{
+					++Class;
+				}
+				Index[Units] = static_cast<uint8>(Class);
+			}
+		}
+	};
+	constexpr FSizeClassTable GSizeClassTable;
+
+	// 스레드 캐시와 전역 풀 사이에 한 번에 옮기는 블록 수
+	constexpr uint32 GetBatchCount(uint32 SizeClass)
+	{
+		return std::clamp<uint32>(16 * 1024 / SizeClassBytes[SizeClass], 4, 64);
+	}
+
+	struct FFreeBlock
+	{
+		FFreeBlock* Next;
+	};
+
+	// 크기 클래스별 전역 풀 (페이지는 시스템에 돌려주지 않음)
+	struct FSizeClassPool
+	{
+		std::mutex Mutex;
+		FFreeBlock* FreeList = nullptr;
+	};
+
+	struct FPoolData
+	{
+		FSizeClassPool Pools[NumSizeClasses];
+		std::atomic<size_t> ReservedBytes{ 0 };
+	};
+
+	// 종료 시 다른 static 객체 소멸자에서 UObject를 지워도 되도록 해제하지 않음
+	FPoolData& GetPoolData()
+	{
+		static FPoolData* Data = new FPoolData();
+		return *Data;
+	}
+
+	struct FTagCounters
+	{
+		std::atomic<int64> LiveCount{ 0 };
+		std::atomic<int64> LiveBytes{ 0 };
+		std::atomic<uint64> TotalCount{ 0 };
+	};
+	FTagCounters GTagCounters[static_cast<size_t>(EMemoryTag::Count)];
+
+	void TrackAllocation(uint8 Tag, uint64 Size)
+	{
+		FTagCounters& Counters = GTagCounters[Tag];
+		Counters.LiveCount.fetch_add(1, std::memory_order_relaxed);
+		Counters.LiveBytes.fetch_add(static_cast<int64>(Size), std::memory_order_relaxed);
+		Counters.TotalCount.fetch_add(1, std::memory_order_relaxed);
+	}
+
+	void TrackDeallocation(uint8 Tag, uint64 Size)
+	{
+		FTagCounters& Counters = GTagCounters[Tag];
+		Counters.LiveCount.fetch_sub(1, std::memory_order_relaxed);
+		Counters.LiveBytes.fetch_sub(static_cast<int64>(Size), std::memory_order_relaxed);
+	}
+
+	// 전역 풀에서 최대 Count개를 꺼내 연결 리스트로 반환 (비어 있으면 새 페이지를 잘라서 채움)
+	FFreeBlock* FetchBlocks(uint32 SizeClass, uint32 Count, uint32& OutNum)
+	{
+		FPoolData& Data = GetPoolData();
+		FSizeClassPool& Pool = Data.Pools[SizeClass];
+		std::lock_guard<std::mutex> Lock(Pool.Mutex);
+
+		if (!Pool.FreeList)
+		{
+			const uint32 BlockBytes = SizeClassBytes[SizeClass];
+			unsigned char* Page = static_cast<unsigned char*>(std::malloc(PoolPageSize));
+			if (!Page)
+			{
+				OutNum = 0;
+				return nullptr;
+			}
+			Data.ReservedBytes.fetch_add(PoolPageSize, std::memory_order_relaxed);
+
+			// malloc은 최소 16바이트 정렬을 보장 (64비트)
+			const uint32 NumBlocks = static_cast<uint32>(PoolPageSize / BlockBytes);
+			for (uint32 i = NumBlocks; i-- > 0;)
+			{
+				FFreeBlock* Block = reinterpret_cast<FFreeBlock*>(Page + size_t(i) * BlockBytes);
+				Block->Next = Pool.FreeList;
+				Pool.FreeList = Block;
+			}
+		}
+
+		FFreeBlock* Head = Pool.FreeList;
+		FFreeBlock* Tail = Head;
+		OutNum = 1;
+		while (OutNum < Count && Tail->Next)
+		{
+			Tail = Tail->Next;
+			++OutNum;
+		}
+		Pool.FreeList = Tail->Next;
+		Tail->Next = nullptr;
+		return Head;
+	}
+
+	// Head~Tail 연결 리스트를 전역 풀로 반환
+	void ReturnBlocks(uint32 SizeClass, FFreeBlock* Head, FFreeBlock* Tail)
+	{
+		FSizeClassPool& Pool = GetPoolData().Pools[SizeClass];
+		std::lock_guard<std::mutex> Lock(Pool.Mutex);
+		Tail->Next = Pool.FreeList;
+		Pool.FreeList = Head;
+	}
+
+	// 스레드별 캐시 (자명한 소멸자라 스레드 종료 중에도 접근 가능)
+	struct FThreadCache
+	{
+		FFreeBlock* Heads[NumSizeClasses];
+		uint32 Counts[NumSizeClasses];
+		bool bDestroyed;
+	};
+	thread_local FThreadCache GThreadCache = {};
+
+	// 스레드 종료 시 캐시의 블록을 전역 풀로 돌려줌. 이후 이 스레드의 해제는 전역 풀로 직접 감
+	struct FThreadCacheFlusher
+	{
+		~FThreadCacheFlusher()
+		{
+			FThreadCache& Cache = GThreadCache;
+			for (uint32 SizeClass = 0; SizeClass < NumSizeClasses; ++SizeClass)
+			{
+				if (FFreeBlock* Head = Cache.Heads[SizeClass])
+				{
+					FFreeBlock* Tail = Head;
+					while (Tail->Next)
+					{
+						Tail = Tail->Next;
+					}
+					ReturnBlocks(SizeClass, Head, Tail);
+				}
+				Cache.Heads[SizeClass] = nullptr;
+				Cache.Counts[SizeClass] = 0;
+			}
+			Cache.bDestroyed = true;
+		}
+	};
+	thread_local FThreadCacheFlusher GThreadCacheFlusher;
+
+	void* AllocatePooled(uint32 SizeClass)
+	{
+		FThreadCache& Cache = GThreadCache;
+		if (Cache.bDestroyed)
+		{
+			uint32 Num = 0;
+			return FetchBlocks(SizeClass, 1, Num);
+		}
+
+		// thread_local 소멸자 등록 (첫 접근 시)
+		(void)&GThreadCacheFlusher;
+
+		if (!Cache.Heads[SizeClass])
+		{
+			uint32 Num = 0;
+			Cache.Heads[SizeClass] = FetchBlocks(SizeClass, GetBatchCount(SizeClass), Num);
+			Cache.Counts[SizeClass] = Num;
+			if (!Cache.Heads[SizeClass])
+			{
+				return nullptr;
+			}
+		}
+
+		FFreeBlock* Block = Cache.Heads[SizeClass];
+		Cache.Heads[SizeClass] = Block->Next;
+		--Cache.Counts[SizeClass];
+		return Block;
+	}
 
-void* FMemoryManager::Allocate(SIZE_T Size, SIZE_T Alignment)
+	void DeallocatePooled(uint32 SizeClass, void* Ptr)
+	{
+		FFreeBlock* Block = static_cast<FFreeBlock*>(Ptr);
+		FThreadCache& Cache = GThreadCache;
+		if (Cache.bDestroyed)
+		{
+			Block->Next = nullptr;
+			ReturnBlocks(SizeClass, Block, Block);
+			return;
+		}
+
+		// 해제만 하는 스레드(다른 스레드의 할당을 해제하는 워커)도 종료 시 캐시를 돌려주도록 소멸자 등록
+		(void)&GThreadCacheFlusher;
+
+		Block->Next = Cache.Heads[SizeClass];
+		Cache.Heads[SizeClass] = Block;
+		++Cache.Counts[SizeClass];
+
+		// 한 스레드에 빈 블록이 너무 쌓이면 배치 하나만큼 전역 풀로 돌려줌
+		const uint32 Batch = GetBatchCount(SizeClass);
+		if (Cache.Counts[SizeClass] > Batch * 2)
+		{
+			FFreeBlock* Head = Cache.Heads[SizeClass];
+			FFreeBlock* Tail = Head;
+			for (uint32 i = 1; i < Batch; ++i)
+			{
+				Tail = Tail->Next;
+			}
+			Cache.Heads[SizeClass] = Tail->Next;
+			Cache.Counts[SizeClass] -= Batch;
+			ReturnBlocks(SizeClass, Head, Tail);
+		}
+	}
+}
+
+const char* GetMemoryTagName(EMemoryTag Tag)
 {
-	SIZE_T TotalSize = Size + sizeof(SIZE_T);
-	SIZE_T FinalAlignment = std::max(Alignment, alignof(SIZE_T));
+	switch (Tag)
+	{
+	case EMemoryTag::Default:   return "Default";
+	case EMemoryTag::Object:    return "Object";
+	case EMemoryTag::Actor:     return "Actor";
+	case EMemoryTag::Component: return "Component";
+	case EMemoryTag::Delegate:  return "Delegate";
+	case EMemoryTag::Frame:     return "Frame";
+	default:                    return "Unknown";
+	}
+}
+
+void* FMemoryManager::Allocate(size_t Size, size_t Alignment, EMemoryTag Tag)
+{
+	const size_t BlockBytes = Size + sizeof(FAllocHeader);
+	if (Alignment > PoolAlignment || BlockBytes > MaxPooledSize)
+	{
+		return AllocateUnpooled(Size, Alignment, Tag);
+	}
+
+	const uint32 SizeClass = GSizeClassTable.Index[(BlockBytes + 15) / 16];
+	void* Block = AllocatePooled(SizeClass);
+	if (!Block)
+	{
+		return nullptr;
+	}
+
+	FAllocHeader* Header = static_cast<FAllocHeader*>(Block);
+	Header->Size = Size;
+	Header->Offset = 0;
+	Header->Tag = static_cast<uint8>(Tag);
+	Header->SizeClass = static_cast<uint8>(SizeClass);
+	TrackAllocation(Header->Tag, Size);
+
+	return Header + 1;
+}
 
-#if defined(_MSC_VER) && defined(_DEBUG)
-	void* Raw = _aligned_malloc_dbg(TotalSize, FinalAlignment, nullptr, 0);
-#else
-	void* Raw = _aligned_malloc(TotalSize, FinalAlignment);
-#endif
+void* FMemoryManager::AllocateUnpooled(size_t Size, size_t Alignment, EMemoryTag Tag)
+{
+	const size_t FinalAlignment = std::max(Alignment, PoolAlignment);
+	unsigned char* Raw = static_cast<unsigned char*>(std::malloc(Size + FinalAlignment + sizeof(FAllocHeader)));
 	if (!Raw)
+	{
 		return nullptr;
+	}
+
+	// 헤더 자리를 남기고 요청 정렬로 올림
+	const uintptr_t UserAddress = (reinterpret_cast<uintptr_t>(Raw) + sizeof(FAllocHeader) + FinalAlignment - 1) & ~(uintptr_t(FinalAlignment) - 1);
+	unsigned char* UserPtr = reinterpret_cast<unsigned char*>(UserAddress);
 
-	*reinterpret_cast<SIZE_T*>(Raw) = Size;
-	TotalAllocationBytes += static_cast<uint32>(Size);
-	TotalAllocationCount++;
+	FAllocHeader* Header = reinterpret_cast<FAllocHeader*>(UserPtr) - 1;
+	Header->Size = Size;
+	Header->Offset = static_cast<uint32>(UserPtr - Raw);
+	Header->Tag = static_cast<uint8>(Tag);
+	Header->SizeClass = LargeSizeClass;
+	TrackAllocation(Header->Tag, Size);
 
-	return static_cast<void*>(static_cast<unsigned char*>(Raw) + sizeof(SIZE_T));
+	return UserPtr;
 }
 
 void FMemoryManager::Deallocate(void* Ptr)
@@ -32,16 +315,232 @@ void FMemoryManager::Deallocate(void* Ptr)
 	if (!Ptr)
 		return;
 
-	unsigned char* UserPtr = static_cast<unsigned char*>(Ptr);
-	unsigned char* Raw = UserPtr - sizeof(SIZE_T);
-	SIZE_T Size = *reinterpret_cast<SIZE_T*>(Raw);
+	FAllocHeader* Header = static_cast<FAllocHeader*>(Ptr) - 1;
+	TrackDeallocation(Header->Tag, Header->Size);
+
+	if (Header->SizeClass == LargeSizeClass)
+	{
+		std::free(static_cast<unsigned char*>(Ptr) - Header->Offset);
+	}
+	else
+	{
+		DeallocatePooled(Header->SizeClass, Header);
+	}
+}
+
+FFrameAllocator& FMemoryManager::GetFrameAllocator()
+{
+	static FFrameAllocator* FrameAllocator = new FFrameAllocator();
+	return *FrameAllocator;
+}
+
+void* FMemoryManager::AllocateFrame(size_t Size, size_t Alignment)
+{
+	return GetFrameAllocator().Allocate(Size, Alignment);
+}
 
-	TotalAllocationBytes -= static_cast<uint32>(Size);
-	TotalAllocationCount--;
+void FMemoryManager::ResetFrame()
+{
+	GetFrameAllocator().Reset();
+}
 
-#if defined(_MSC_VER) && defined(_DEBUG)
-	_aligned_free_dbg(Raw);
-#else
-	_aligned_free(Raw);
-#endif
-}
\ No newline at end of file
+FMemoryTagStats FMemoryManager::GetTagStats(EMemoryTag Tag)
+{
+	FMemoryTagStats Stats;
+	if (Tag == EMemoryTag::Frame)
+	{
+		// 프레임 할당은 개별 해제가 없으므로 이번 프레임 사용량으로 보고
+		const FFrameAllocator& FrameAllocator = GetFrameAllocator();
+		Stats.LiveCount = FrameAllocator.GetNumAllocations();
+		Stats.LiveBytes = static_cast<int64>(FrameAllocator.GetUsedBytes());
+		Stats.TotalCount = Stats.LiveCount;
+		return Stats;
+	}
+
+	const FTagCounters& Counters = GTagCounters[static_cast<size_t>(Tag)];
+	Stats.LiveCount = Counters.LiveCount.load(std::memory_order_relaxed);
+	Stats.LiveBytes = Counters.LiveBytes.load(std::memory_order_relaxed);
+	Stats.TotalCount = Counters.TotalCount.load(std::memory_order_relaxed);
+	return Stats;
+}
+
+int64 FMemoryManager::GetTotalAllocationBytes()
+{
+	int64 Total = 0;
+	for (const FTagCounters& Counters : GTagCounters)
+	{
+		Total += Counters.LiveBytes.load(std::memory_order_relaxed);
+	}
+	return Total;
+}
+
+int64 FMemoryManager::GetTotalAllocationCount()
+{
+	int64 Total = 0;
+	for (const FTagCounters& Counters : GTagCounters)
+	{
+		Total += Counters.LiveCount.load(std::memory_order_relaxed);
+	}
+	return Total;
+}
+
+size_t FMemoryManager::GetPoolReservedBytes()
+{
+	return GetPoolData().ReservedBytes.load(std::memory_order_relaxed);
+}
+
+// ──────────────────────────────
+// FFrameAllocator
+// ──────────────────────────────
+
+FFrameAllocator::FFrameAllocator(size_t InBlockSize)
+	: BlockSize(InBlockSize)
+{
+}
+
+FFrameAllocator::~FFrameAllocator()
+{
+	FBlock* Block = CurrentBlock.load(std::memory_order_relaxed);
+	while (Block)
+	{
+		FBlock* Next = Block->Next;
+		std::free(Block);
+		Block = Next;
+	}
+	Block = RetiredBlocks;
+	while (Block)
+	{
+		FBlock* Next = Block->Next;
+		std::free(Block);
+		Block = Next;
+	}
+}
+
+FFrameAllocator::FBlock* FFrameAllocator::AllocateBlock(size_t DataSize)
+{
+	void* Memory = std::malloc(sizeof(FBlock) + DataSize);
+	if (!Memory)
+	{
+		return nullptr;
+	}
+	FBlock* Block = new (Memory) FBlock();
+	Block->Size = DataSize;
+	CapacityBytes += DataSize;
+	return Block;
+}
+
+void* FFrameAllocator::TryAllocate(FBlock* Block, size_t Size, size_t Alignment)
+{
+	const uintptr_t Base = reinterpret_cast<uintptr_t>(Block->Data());
+	size_t Offset = Block->Offset.load(std::memory_order_relaxed);
+	for (;;)
+	{
+		const size_t Aligned = ((Base + Offset + Alignment - 1) & ~(uintptr_t(Alignment) - 1)) - Base;
+		if (Aligned + Size > Block->Size)
+		{
+			return nullptr;
+		}
+		if (Block->Offset.compare_exchange_weak(Offset, Aligned + Size, std::memory_order_relaxed))
+		{
+			return Block->Data() + Aligned;
+		}
+	}
+}
+
+void* FFrameAllocator::Allocate(size_t Size, size_t Alignment)
+{
+	if (FBlock* Block = CurrentBlock.load(std::memory_order_acquire))
+	{
+		if (void* Ptr = TryAllocate(Block, Size, Alignment))
+		{
+			NumAllocations.fetch_add(1, std::memory_order_relaxed);
+			return Ptr;
+		}
+	}
+	return AllocateSlow(Size, Alignment);
+}
+
+void* FFrameAllocator::AllocateSlow(size_t Size, size_t Alignment)
+{
+	std::lock_guard<std::mutex> Lock(BlockMutex);
+
+	// 락을 기다리는 동안 다른 스레드가 새 블록을 걸었을 수 있음
+	FBlock* OldBlock = CurrentBlock.load(std::memory_order_relaxed);
+	if (OldBlock)
+	{
+		if (void* Ptr = TryAllocate(OldBlock, Size, Alignment))
+		{
+			NumAllocations.fetch_add(1, std::memory_order_relaxed);
+			return Ptr;
+		}
+	}
+
+	// 새 블록에서 먼저 잘라낸 뒤 공개 (다른 스레드는 공개 이후 남은 공간만 사용)
+	FBlock* NewBlock = AllocateBlock(std::max(BlockSize, Size + Alignment));
+	if (!NewBlock)
+	{
+		return nullptr;
+	}
+	void* Ptr = TryAllocate(NewBlock, Size, Alignment);
+
+	if (OldBlock)
+	{
+		// 블록을 넘긴 뒤에도 다른 스레드가 잠깐 옛 블록에 쓸 수 있으므로 해제는 Reset까지 미룸
+		OldBlock->Next = RetiredBlocks;
+		RetiredBlocks = OldBlock;
+	}
+	CurrentBlock.store(NewBlock, std::memory_order_release);
+	NumAllocations.fetch_add(1, std::memory_order_relaxed);
+	return Ptr;
+}
+
+size_t FFrameAllocator::GetUsedBytes() const
+{
+	// 통계 오버레이 등에서 호출되는 동안 워커의 AllocateSlow가 RetiredBlocks를 바꿀 수 있으므로 락을 잡고 순회
+	std::lock_guard<std::mutex> Lock(BlockMutex);
+	return GetUsedBytesLocked();
+}
+
+size_t FFrameAllocator::GetUsedBytesLocked() const
+{
+	size_t Used = 0;
+	if (const FBlock* Block = CurrentBlock.load(std::memory_order_acquire))
+	{
+		Used += Block->Offset.load(std::memory_order_relaxed);
+	}
+	for (const FBlock* Block = RetiredBlocks; Block; Block = Block->Next)
+	{
+		Used += Block->Offset.load(std::memory_order_relaxed);
+	}
+	return Used;
+}
+
+void FFrameAllocator::Reset()
+{
+	std::lock_guard<std::mutex> Lock(BlockMutex);
+
+	PeakBytes = std::max(PeakBytes, GetUsedBytesLocked());
+	NumAllocations.store(0, std::memory_order_relaxed);
+
+	FBlock* Block = CurrentBlock.load(std::memory_order_relaxed);
+	if (!RetiredBlocks)
+	{
+		if (Block)
+		{
+			Block->Offset.store(0, std::memory_order_relaxed);
+		}
+		return;
+	}
+
+	// 블록이 여러 개 필요했던 프레임: 합친 크기의 블록 하나로 교체
+	const size_t NewSize = CapacityBytes;
+	std::free(Block);
+	while (RetiredBlocks)
+	{
+		FBlock* Next = RetiredBlocks->Next;
+		std::free(RetiredBlocks);
+		RetiredBlocks = Next;
+	}
+	CapacityBytes = 0;
+	CurrentBlock.store(AllocateBlock(NewSize), std::memory_order_release);
+}
@@ -1,15 +1,196 @@
 ﻿#pragma once
 #include <cstddef>
+#include <atomic>
+#include <mutex>
+#include <type_traits>
+#include <new>
+#include <utility>
 #include "UEContainer.h"
 
+// 할당 위치 구분 태그 (태그별 개수/바이트를 통계 오버레이에 표시)
+enum class EMemoryTag : uint8
+{
+	Default,
+	Object,       // UObject 계열 (아래 태그에 해당하지 않는 것)
+	Actor,
+	Component,
+	Delegate,
+	Frame,        // 프레임 선형 할당 (프레임 끝에 일괄 해제)
+	Count
+};
+
+const char* GetMemoryTagName(EMemoryTag Tag);
+
+// 태그별 현재 살아 있는 할당 수/바이트와 누적 할당 수
+struct FMemoryTagStats
+{
+	int64 LiveCount = 0;
+	int64 LiveBytes = 0;
+	uint64 TotalCount = 0;
+};
+
+/**
+ * 프레임 선형(bump) 할당기
+ * 프레임 안에서만 쓰는 렌더/애니메이션 임시 데이터용. 개별 해제 없이 ResetFrame()에서 한 번에 비움
+ * 여러 스레드에서 동시에 Allocate 가능 (현재 블록은 원자적 오프셋 증가, 블록 추가만 락)
+ * 한 프레임에 블록이 여러 개 필요했으면 Reset 때 합친 크기의 블록 하나로 바꿔 다음 프레임부터는 블록 하나로 끝나게 함
+ */
+class FFrameAllocator
+{
+public:
+	explicit FFrameAllocator(size_t InBlockSize = 1024 * 1024);
+	~FFrameAllocator();
+
+	FFrameAllocator(const FFrameAllocator&) = delete;
+	FFrameAllocator& operator=(const FFrameAllocator&) = delete;
+
+	void* Allocate(size_t Size, size_t Alignment = alignof(std::max_align_t));
+
+	template<typename T>
+	T* NewArray(size_t Num)
+	{
+		static_assert(std::is_trivially_destructible_v<T>, "프레임 할당은 소멸자를 호출하지 않음");
+		T* Data = static_cast<T*>(Allocate(sizeof(T) * Num, alignof(T)));
+		for (size_t i = 0; i < Num; ++i)
+		{
+			new (Data + i) T();
+		}
+		return Data;
+	}
+
+	// 이번 프레임 할당을 모두 버림 (메인 스레드, 다른 스레드의 Allocate와 동시에 호출하면 안 됨)
+	void Reset();
+
+	size_t GetUsedBytes() const;
+	size_t GetCapacityBytes() const { return CapacityBytes; }
+	size_t GetPeakBytes() const { return PeakBytes; }
+	uint32 GetNumAllocations() const { return NumAllocations.load(std::memory_order_relaxed); }
+
+private:
+	struct FBlock
+	{
+		FBlock* Next = nullptr;
+		size_t Size = 0;
+		std::atomic<size_t> Offset{ 0 };
+		unsigned char* Data() { return reinterpret_cast<unsigned char*>(this + 1); }
+	};
+
+	FBlock* AllocateBlock(size_t DataSize);
+	static void* TryAllocate(FBlock* Block, size_t Size, size_t Alignment);
+	void* AllocateSlow(size_t Size, size_t Alignment);
+	size_t GetUsedBytesLocked() const;  // BlockMutex를 잡은 상태에서 호출
+
+	std::atomic<FBlock*> CurrentBlock{ nullptr };
+	FBlock* RetiredBlocks = nullptr;  // 이번 프레임에 가득 차서 넘어간 블록들 (BlockMutex 보호)
+	size_t BlockSize = 0;
+	size_t CapacityBytes = 0;
+	size_t PeakBytes = 0;
+	std::atomic<uint32> NumAllocations{ 0 };
+	mutable std::mutex BlockMutex;
+};
+
+/**
+ * 엔진 공용 할당기
+ * - 작은 할당(헤더 포함 2KB 이하)은 크기 클래스별 풀에서 나눠 줌. 스레드별 캐시가 있어 대부분 락 없이 처리됨
+ * - 큰 할당은 시스템 힙 (malloc)으로 보냄
+ * - 태그별 개수/바이트는 원자적으로 집계 (스레드 안전)
+ * - 플랫폼 API를 쓰지 않음 (표준 라이브러리만 사용)
+ */
 class FMemoryManager
 {
 public:
 	// 인자 변수를 PascalCase로 변경
-	static void* Allocate(SIZE_T Size, SIZE_T Alignment);
+	static void* Allocate(size_t Size, size_t Alignment, EMemoryTag Tag = EMemoryTag::Default);
 	static void  Deallocate(void* Ptr);
 
-public:
-	static uint32 TotalAllocationBytes;
-	static uint32 TotalAllocationCount;
-};
\ No newline at end of file
+	// 풀을 거치지 않는 시스템 힙 할당 (풀 성능 비교용, Deallocate로 해제)
+	static void* AllocateUnpooled(size_t Size, size_t Alignment, EMemoryTag Tag = EMemoryTag::Default);
+
+	// 프레임 할당기: 메인 루프가 프레임 끝에 ResetFrame()을 호출
+	static FFrameAllocator& GetFrameAllocator();
+	static void* AllocateFrame(size_t Size, size_t Alignment = alignof(std::max_align_t));
+	static void ResetFrame();
+
+	static FMemoryTagStats GetTagStats(EMemoryTag Tag);
+	static int64 GetTotalAllocationBytes();
+	static int64 GetTotalAllocationCount();
+
+	// 풀이 시스템에서 받아 둔 페이지 바이트 (사용 중 + 빈 블록)
+	static size_t GetPoolReservedBytes();
+
+	static constexpr size_t MaxPooledSize = 2048;  // 헤더 포함 블록 크기
+	static constexpr size_t PoolAlignment = 16;    // 풀 블록이 보장하는 정렬
+};
+
+// FMemoryManager로 할당하는 STL 할당기 (컨테이너 메모리를 태그별 통계에 포함)
+template<typename T, EMemoryTag Tag = EMemoryTag::Default>
+struct TTaggedAllocator
+{
+	using value_type = T;
+
+	template<typename U>
+	struct rebind { using other = TTaggedAllocator<U, Tag>; };
+
+	TTaggedAllocator() noexcept = default;
+	template<typename U>
+	TTaggedAllocator(const TTaggedAllocator<U, Tag>&) noexcept {}
+
+	T* allocate(size_t Num)
+	{
+		void* Ptr = FMemoryManager::Allocate(sizeof(T) * Num, alignof(T), Tag);
+		if (!Ptr)
+		{
+			throw std::bad_alloc();
+		}
+		return static_cast<T*>(Ptr);
+	}
+
+	void deallocate(T* Ptr, size_t) noexcept
+	{
+		FMemoryManager::Deallocate(Ptr);
+	}
+
+	template<typename U>
+	bool operator==(const TTaggedAllocator<U, Tag>&) const noexcept { return true; }
+	template<typename U>
+	bool operator!=(const TTaggedAllocator<U, Tag>&) const noexcept { return false; }
+};
+
+// 프레임 할당기로 할당하는 STL 할당기 (TArray<T, TFrameAllocator<T>>: 프레임 안에서만 쓰는 임시 배열)
+// 해제는 하지 않고 ResetFrame()에서 일괄 회수하므로 프레임을 넘겨 보관하면 안 됨. 커질 때 이전 버퍼도 프레임 끝까지 남음
+template<typename T>
+struct TFrameAllocator
+{
+	using value_type = T;
+
+	template<typename U>
+	struct rebind { using other = TFrameAllocator<U>; };
+
+	TFrameAllocator() noexcept = default;
+	template<typename U>
+	TFrameAllocator(const TFrameAllocator<U>&) noexcept {}
+
+	T* allocate(size_t Num)
+	{
+		return static_cast<T*>(FMemoryManager::AllocateFrame(sizeof(T) * Num, alignof(T)));
+	}
+
+	void deallocate(T*, size_t) noexcept {}
+
+	template<typename U>
+	bool operator==(const TFrameAllocator<U>&) const noexcept { return true; }
+	template<typename U>
+	bool operator!=(const TFrameAllocator<U>&) const noexcept { return false; }
+};
+
+// UObject 파생 클래스에서 할당 태그를 지정 (operator delete는 UObject 것을 그대로 사용)
+#define DECLARE_MEMORY_TAG(Tag)                                                            \
+public:                                                                                    \
+	static void* operator new(size_t Size)                                                 \
+	{                                                                                      \
+		return FMemoryManager::Allocate(Size, alignof(std::max_align_t), Tag);             \
+	}                                                                                      \
+	static void* operator new(size_t Size, std::align_val_t Alignment)                     \
+	{                                                                                      \
+		return FMemoryManager::Allocate(Size, static_cast<size_t>(Alignment), Tag);        \
+	}
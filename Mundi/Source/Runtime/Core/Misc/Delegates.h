@@ -4,21 +4,257 @@
 #include <functional>
 #include <algorithm>
 #include <memory>
+#include <cstring>
+#include <type_traits>
+#include "MemoryManager.h"
 
 using FDelegateHandle = size_t;
 
+// 핸들러에 넘기는 인자 형태: 작은 값(포인터/정수 등)은 값으로, 나머지는 참조로 그대로 전달 (중간 복사 없음)
+template<typename T>
+using TDelegateParam = std::conditional_t<
+	std::is_reference_v<T> || (std::is_trivially_copyable_v<T> && sizeof(T) <= 2 * sizeof(void*)),
+	T, const std::remove_cv_t<T>&>;
+
+/**
+ * 델리게이트 바인딩 하나 (std::function 대체)
+ * - 멤버 함수 바인딩/작은 람다는 객체 안의 버퍼에 저장 (힙 할당 없음), 버퍼에 안 들어가는 호출체만 Delegate 태그로 힙 할당
+ * - 호출은 함수 포인터 하나를 거침. 복사/소멸이 자명한 호출체는 관리 함수 없이 memcpy로 복사
+ */
+template<typename... Args>
+class TDelegateBinding
+{
+public:
+	static constexpr size_t InlineSize = 4 * sizeof(void*);  // 인스턴스 + 가장 큰 멤버 함수 포인터 (MSVC 기준 24바이트)
+
+	using InvokeFunc = void (*)(void* Storage, TDelegateParam<Args>... args);
+
+	TDelegateBinding() = default;
+
+	template<typename FunctorType, typename = std::enable_if_t<!std::is_same_v<std::decay_t<FunctorType>, TDelegateBinding>>>
+	explicit TDelegateBinding(FunctorType&& Functor)
+	{
+		using F = std::decay_t<FunctorType>;
+		if constexpr (FitsInline<F>())
+		{
+			new (Storage) F(std::forward<FunctorType>(Functor));
+			Invoke = &InvokeInline<F>;
+			if constexpr (!(std::is_trivially_copyable_v<F> && std::is_trivially_destructible_v<F>))
+			{
+				Manage = &ManageInline<F>;
+			}
+		}
+		else
+		{
+			void* Memory = FMemoryManager::Allocate(sizeof(F), alignof(F), EMemoryTag::Delegate);
+			*reinterpret_cast<F**>(Storage) = new (Memory) F(std::forward<FunctorType>(Functor));
+			Invoke = &InvokeHeap<F>;
+			Manage = &ManageHeap<F>;
+		}
+	}
+
+	TDelegateBinding(const TDelegateBinding& Other) { CopyFrom(Other); }
+	TDelegateBinding(TDelegateBinding&& Other) noexcept { MoveFrom(Other); }
+	~TDelegateBinding() { Reset(); }
+
+	TDelegateBinding& operator=(const TDelegateBinding& Other)
+	{
+		if (this != &Other)
+		{
+			Reset();
+			CopyFrom(Other);
+		}
+		return *this;
+	}
+
+	TDelegateBinding& operator=(TDelegateBinding&& Other) noexcept
+	{
+		if (this != &Other)
+		{
+			Reset();
+			MoveFrom(Other);
+		}
+		return *this;
+	}
+
+	bool IsBound() const { return Invoke != nullptr; }
+
+	void Execute(TDelegateParam<Args>... args) const
+	{
+		Invoke(const_cast<unsigned char*>(Storage), args...);
+	}
+
+	void Reset()
+	{
+		if (Manage)
+		{
+			Manage(EOp::Destroy, Storage, nullptr);
+		}
+		Invoke = nullptr;
+		Manage = nullptr;
+	}
+
+private:
+	enum class EOp : uint8 { Copy, Move, Destroy };
+	using ManageFunc = void (*)(EOp Op, void* Dest, void* Source);
+
+	template<typename F>
+	static constexpr bool FitsInline()
+	{
+		return sizeof(F) <= InlineSize && alignof(F) <= alignof(void*) && std::is_nothrow_move_constructible_v<F>;
+	}
+
+	template<typename F>
+	static void InvokeInline(void* InStorage, TDelegateParam<Args>... args)
+	{
+		(*static_cast<F*>(InStorage))(args...);
+	}
+
+	template<typename F>
+	static void InvokeHeap(void* InStorage, TDelegateParam<Args>... args)
+	{
+		(**static_cast<F**>(InStorage))(args...);
+	}
+
+	template<typename F>
+	static void ManageInline(EOp Op, void* Dest, void* Source)
+	{
+		switch (Op)
+		{
+		case EOp::Copy:    new (Dest) F(*static_cast<const F*>(Source)); break;
+		case EOp::Move:    new (Dest) F(std::move(*static_cast<F*>(Source))); static_cast<F*>(Source)->~F(); break;
+		case EOp::Destroy: static_cast<F*>(Dest)->~F(); break;
+		}
+	}
+
+	template<typename F>
+	static void ManageHeap(EOp Op, void* Dest, void* Source)
+	{
+		switch (Op)
+		{
+		case EOp::Copy:
+		{
+			void* Memory = FMemoryManager::Allocate(sizeof(F), alignof(F), EMemoryTag::Delegate);
+			*static_cast<F**>(Dest) = new (Memory) F(**static_cast<F* const*>(Source));
+			break;
+		}
+		case EOp::Move:
+			*static_cast<F**>(Dest) = *static_cast<F**>(Source);
+			break;
+		case EOp::Destroy:
+		{
+			F* Functor = *static_cast<F**>(Dest);
+			Functor->~F();
+			FMemoryManager::Deallocate(Functor);
+			break;
+		}
+		}
+	}
+
+	void CopyFrom(const TDelegateBinding& Other)
+	{
+		if (Other.Manage)
+		{
+			Other.Manage(EOp::Copy, Storage, const_cast<unsigned char*>(Other.Storage));
+		}
+		else
+		{
+			std::memcpy(Storage, Other.Storage, InlineSize);
+		}
+		Invoke = Other.Invoke;
+		Manage = Other.Manage;
+	}
+
+	void MoveFrom(TDelegateBinding& Other)
+	{
+		if (Other.Manage)
+		{
+			Other.Manage(EOp::Move, Storage, Other.Storage);
+		}
+		else
+		{
+			std::memcpy(Storage, Other.Storage, InlineSize);
+		}
+		Invoke = Other.Invoke;
+		Manage = Other.Manage;
+		Other.Invoke = nullptr;
+		Other.Manage = nullptr;
+	}
+
+	InvokeFunc Invoke = nullptr;
+	ManageFunc Manage = nullptr;  // nullptr: 복사/소멸이 자명한 인라인 호출체 (memcpy로 충분)
+	alignas(void*) unsigned char Storage[InlineSize];
+};
+
+/**
+ * 멀티캐스트 델리게이트
+ * - 바인딩은 추가 순서대로 한 배열에 연속 저장 (Broadcast는 배열을 한 번 훑으며 함수 포인터 호출)
+ * - 핸들은 추가할 때마다 증가하고 배열 순서가 유지되므로 Remove는 이진 탐색
+ * - Broadcast 중 Remove: 항목만 비활성화하고 (실행 중인 호출체를 건드리지 않음) 바깥 Broadcast가 끝날 때 정리
+ * - Broadcast 중 Add: 대기 목록에 넣었다가 끝날 때 합침 (이번 Broadcast에서는 호출되지 않음)
+ * - 인자는 핸들러마다 같은 값을 넘겨야 하므로 이동하지 않고 TDelegateParam 형태로 그대로 전달
+ */
 template<typename... Args>
 class TDelegate
 {
+	static_assert((!std::is_rvalue_reference_v<Args> && ...), "멀티캐스트 인자는 여러 핸들러에 넘겨지므로 rvalue 참조를 쓸 수 없음");
+
 public:
-	using HandlerType = std::function<void(Args...)>;
+	using BindingType = TDelegateBinding<Args...>;
 
 	TDelegate() : NextHandle(1) {}
 
-	FDelegateHandle Add(const HandlerType& Handler)
+	TDelegate(const TDelegate& Other)
+		: Entries(Other.Entries), PendingEntries(Other.PendingEntries), NextHandle(Other.NextHandle)
+	{
+		bHasRemovedEntries = Other.bHasRemovedEntries;
+		Flush();
+	}
+
+	TDelegate& operator=(const TDelegate& Other)
+	{
+		if (this != &Other)
+		{
+			Clear();
+			if (BroadcastDepth > 0)
+			{
+				// 핸들러 안에서 대입: 실행 중인 Entries는 건드리지 않고 대기 목록으로 (핸들은 정렬 순서를 지키도록 새로 발급)
+				for (const std::vector<FEntry, FEntryAllocator>* List : { &Other.Entries, &Other.PendingEntries })
+				{
+					for (const FEntry& Entry : *List)
+					{
+						if (!Entry.bRemoved)
+						{
+							PendingEntries.push_back({ NextHandle++, false, Entry.Binding });
+						}
+					}
+				}
+				return *this;
+			}
+
+			Entries = Other.Entries;
+			PendingEntries = Other.PendingEntries;
+			NextHandle = std::max(NextHandle, Other.NextHandle);
+			bHasRemovedEntries = Other.bHasRemovedEntries;
+			Flush();
+		}
+		return *this;
+	}
+
+	// 람다/함수 객체/std::function 바인딩. 빈 std::function/널 함수 포인터는 등록하지 않고 0 반환
+	template<typename FunctorType>
+	FDelegateHandle Add(FunctorType&& Functor)
 	{
-		FDelegateHandle Handle = NextHandle++;
-		Handlers.push_back({ Handle, Handler });
+		if constexpr (std::is_constructible_v<bool, const std::decay_t<FunctorType>&>)
+		{
+			if (!static_cast<bool>(Functor))
+			{
+				return 0;
+			}
+		}
+
+		const FDelegateHandle Handle = NextHandle++;
+		(BroadcastDepth > 0 ? PendingEntries : Entries).push_back({ Handle, false, BindingType(std::forward<FunctorType>(Functor)) });
 		return Handle;
 	}
 
@@ -26,49 +262,133 @@ public:
 	template<typename TObj, typename TClass>
 	FDelegateHandle AddDynamic(TObj* Instance, void(TClass::* Func)(Args...))
 	{
-		FDelegateHandle Handle = NextHandle++;
-		Handlers.push_back({
-			Handle,
-			[=](Args... args) {
-			(Instance->*Func)(args...); }
-		});
-		return Handle;
+		if (!Instance || !Func)
+		{
+			return 0;
+		}
+		return Add(TMethodCaller<TObj, TClass>{ Instance, Func });
 	}
 
-	void Broadcast(Args... args) 
+	void Broadcast(TDelegateParam<Args>... args)
 	{
-		for (auto& Entry : Handlers) {
-			if (Entry.Handler)
+		if (Entries.empty())
+		{
+			return;
+		}
+
+		// 핸들러 안에서 Add가 와도 Entries는 바뀌지 않으므로 인덱스 순회가 안전
+		++BroadcastDepth;
+		const size_t NumEntries = Entries.size();
+		for (size_t Index = 0; Index < NumEntries; ++Index)
+		{
+			const FEntry& Entry = Entries[Index];
+			if (!Entry.bRemoved)
 			{
-				Entry.Handler(args...);
+				Entry.Binding.Execute(args...);
 			}
 		}
+		if (--BroadcastDepth == 0)
+		{
+			Flush();
+		}
 	}
 
 	void Remove(FDelegateHandle Handle)
 	{
-		auto it = std::remove_if(Handlers.begin(), Handlers.end(),
-		[&](const Entry& e)
+		if (Handle == 0)
 		{
-			return e.Handle == Handle;
-		});
-		Handlers.erase(it, Handlers.end());
+			return;
+		}
+
+		for (std::vector<FEntry, FEntryAllocator>* List : { &Entries, &PendingEntries })
+		{
+			auto It = std::lower_bound(List->begin(), List->end(), Handle,
+				[](const FEntry& Entry, FDelegateHandle Value) { return Entry.Handle < Value; });
+			if (It != List->end() && It->Handle == Handle && !It->bRemoved)
+			{
+				RemoveEntry(*List, It);
+				return;
+			}
+		}
 	}
 
 	void Clear()
 	{
-		Handlers.clear();
+		if (BroadcastDepth > 0)
+		{
+			for (FEntry& Entry : Entries)
+			{
+				Entry.bRemoved = true;
+			}
+			bHasRemovedEntries = !Entries.empty();
+			PendingEntries.clear();
+			return;
+		}
+		Entries.clear();
+		PendingEntries.clear();
+		bHasRemovedEntries = false;
+	}
+
+	bool IsBound() const
+	{
+		return std::any_of(Entries.begin(), Entries.end(), [](const FEntry& Entry) { return !Entry.bRemoved; }) || !PendingEntries.empty();
 	}
 
 private:
-	struct Entry
+	struct FEntry
 	{
 		FDelegateHandle Handle;
-		HandlerType Handler;
+		bool bRemoved;           // Broadcast 중에 제거되어 정리 대기 (핸들은 정렬 순서 유지를 위해 그대로 둠)
+		BindingType Binding;
+	};
+	using FEntryAllocator = TTaggedAllocator<FEntry, EMemoryTag::Delegate>;
+
+	// 멤버 함수 바인딩 (인스턴스 + 멤버 함수 포인터, 인라인 버퍼에 들어감)
+	template<typename TObj, typename TClass>
+	struct TMethodCaller
+	{
+		TObj* Instance;
+		void (TClass::* Func)(Args...);
+
+		void operator()(TDelegateParam<Args>... args) const
+		{
+			(Instance->*Func)(args...);
+		}
 	};
 
-	std::vector<Entry> Handlers;
+	void RemoveEntry(std::vector<FEntry, FEntryAllocator>& List, typename std::vector<FEntry, FEntryAllocator>::iterator It)
+	{
+		if (BroadcastDepth > 0 && &List == &Entries)
+		{
+			It->bRemoved = true;
+			bHasRemovedEntries = true;
+		}
+		else
+		{
+			List.erase(It);
+		}
+	}
+
+	// 제거 표시된 항목을 지우고 (순서 유지) 대기 중인 추가를 뒤에 붙임
+	void Flush()
+	{
+		if (bHasRemovedEntries)
+		{
+			Entries.erase(std::remove_if(Entries.begin(), Entries.end(), [](const FEntry& Entry) { return Entry.bRemoved; }), Entries.end());
+			bHasRemovedEntries = false;
+		}
+		if (!PendingEntries.empty())
+		{
+			Entries.insert(Entries.end(), std::make_move_iterator(PendingEntries.begin()), std::make_move_iterator(PendingEntries.end()));
+			PendingEntries.clear();
+		}
+	}
+
+	std::vector<FEntry, FEntryAllocator> Entries;
+	std::vector<FEntry, FEntryAllocator> PendingEntries;  // Broadcast 중에 추가된 항목
 	FDelegateHandle NextHandle;
+	uint32 BroadcastDepth = 0;
+	bool bHasRemovedEntries = false;
 };
 
 // 델리게이트 인스턴스 생성용 매크로 (실제 멤버 변수 선언)
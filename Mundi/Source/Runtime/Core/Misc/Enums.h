@@ -64,6 +64,8 @@ enum class EVertexLayoutType : uint8
 
     PositionColor,
     PositionColorTexturNormal,
+    PositionPackedNormalTexture,    // FPackedNormalVertex (COMPACT_VERTEX)
+    PackedSkinned,                  // FPackedSkinnedVertex (COMPACT_VERTEX + GPU_SKINNING)
 
     PositionTextBillBoard,
     PositionCollisionDebug,
@@ -170,10 +172,12 @@ enum class EEngineShowFlags : uint64
     SF_Shadows = 1ull << 17,
     SF_ShadowAntiAliasing = 1ull << 18,
     SF_GPUSkinning = 1ull << 19,  // Enable/disable GPU skinning (CPU skinning when disabled)
+    SF_OcclusionCulling = 1ull << 20, // Enable/disable CPU software occlusion culling
 
     // Default enabled flags
     SF_DefaultEnabled = SF_Primitives | SF_StaticMeshes | SF_SkeletalMeshes | SF_Grid | SF_Lighting | SF_Decals |
-        SF_Fog | SF_FXAA | SF_Billboard | SF_EditorIcon | SF_Shadows | SF_ShadowAntiAliasing | SF_GPUSkinning,
+        SF_Fog | SF_FXAA | SF_Billboard | SF_EditorIcon | SF_Shadows | SF_ShadowAntiAliasing | SF_GPUSkinning |
+        SF_OcclusionCulling,
 
     // All flags (for initialization/reset)
     SF_All = 0xFFFFFFFFFFFFFFFFull
@@ -191,6 +195,13 @@ enum class EShadowAATechnique : uint8
     VSM		// Variance Shadow Maps
 };
 
+// Point/Spot 라이트 컬링 방식
+enum class ELightCullingMode : uint8
+{
+    Tiled,		// 2D 화면 타일 (타일마다 near~far 전체)
+    Clustered	// 3D 클러스터 (화면 타일 × 로그 깊이 슬라이스)
+};
+
 // Bit flag operators for EEngineShowFlags
 inline EEngineShowFlags operator|(EEngineShowFlags a, EEngineShowFlags b)
 {
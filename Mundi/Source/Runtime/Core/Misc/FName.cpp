@@ -1,62 +1,237 @@
 ﻿#include "pch.h"
 #include "Name.h"
+#include <atomic>
+#include <mutex>
 
 namespace
 {
-    // NameMap을 안전하게 가져오는 getter
-    static TMap<FString, uint32>& GetNameMap()
+    constexpr uint32 NumShardBits = 4;
+    constexpr uint32 NumShards = 1u << NumShardBits;
+    constexpr uint32 InitialShardCapacity = 256;   // 2의 거듭제곱
+
+    constexpr uint32 EntriesPerChunkBits = 12;
+    constexpr uint32 EntriesPerChunk = 1u << EntriesPerChunkBits;
+    constexpr uint32 MaxChunks = 1024;             // 최대 4M 이름
+
+    // 슬롯 값: 상위 32비트 = 해시 상위 32비트(빠른 거르기), 하위 32비트 = 엔트리 인덱스 + 1. 0은 빈 슬롯
+    struct FNameTable
+    {
+        uint32 Capacity = 0;
+        std::atomic<uint64>* Slots = nullptr;
+    };
+
+    struct FNameShard
+    {
+        std::atomic<FNameTable*> Table{ nullptr };
+        std::mutex WriteMutex;
+        uint32 NumUsed = 0;                 // WriteMutex 보호
+        TArray<FNameTable*> RetiredTables;  // 락 없이 읽는 스레드가 아직 볼 수 있으므로 해제하지 않음
+    };
+
+    struct FNamePoolData
+    {
+        FNameShard Shards[NumShards];
+        std::atomic<FNameEntry*> Chunks[MaxChunks] = {};
+        std::atomic<uint32> NumEntries{ 0 };
+        std::mutex ChunkMutex;
+    };
+
+    // 종료 시 다른 static 객체의 소멸자가 FName을 써도 되도록 해제하지 않음
+    FNamePoolData& GetPoolData()
+    {
+        static FNamePoolData* Data = new FNamePoolData();
+        return *Data;
+    }
+
+    FNameTable* CreateTable(uint32 Capacity)
+    {
+        FNameTable* Table = new FNameTable();
+        Table->Capacity = Capacity;
+        Table->Slots = new std::atomic<uint64>[Capacity];
+        for (uint32 i = 0; i < Capacity; ++i)
+        {
+            Table->Slots[i].store(0, std::memory_order_relaxed);
+        }
+        return Table;
+    }
+
+    FNameEntry& GetEntry(FNamePoolData& Data, uint32 Index)
+    {
+        FNameEntry* Chunk = Data.Chunks[Index >> EntriesPerChunkBits].load(std::memory_order_acquire);
+        return Chunk[Index & (EntriesPerChunk - 1)];
+    }
+
+    // InComparison(소문자)과 InStr이 대소문자 무시로 같은지 (임시 문자열 없이 비교)
+    bool EqualsLower(const FString& InComparison, std::string_view InStr)
+    {
+        if (InComparison.size() != InStr.size())
+        {
+            return false;
+        }
+        for (size_t i = 0; i < InStr.size(); ++i)
+        {
+            if (InComparison[i] != static_cast<char>(std::tolower(static_cast<unsigned char>(InStr[i]))))
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    // 테이블에서 이름을 찾아 인덱스 반환, 없으면 UINT32_MAX. 락 없이 호출 가능
+    uint32 FindInTable(FNamePoolData& Data, const FNameTable* Table, std::string_view InStr, uint64 InHash)
+    {
+        const uint32 Mask = Table->Capacity - 1;
+        const uint32 Tag = static_cast<uint32>(InHash >> 32);
+        for (uint32 Pos = static_cast<uint32>(InHash) & Mask;; Pos = (Pos + 1) & Mask)
+        {
+            const uint64 Slot = Table->Slots[Pos].load(std::memory_order_acquire);
+            if (Slot == 0)
+            {
+                return UINT32_MAX;
+            }
+            if (static_cast<uint32>(Slot >> 32) == Tag)
+            {
+                const uint32 Index = static_cast<uint32>(Slot) - 1;
+                const FNameEntry& Entry = GetEntry(Data, Index);
+                if (Entry.Hash == InHash && EqualsLower(Entry.Comparison, InStr))
+                {
+                    return Index;
+                }
+            }
+        }
+    }
+
+    // 빈 슬롯에 기록 (WriteMutex 보유 상태)
+    void InsertSlot(FNameTable* Table, uint64 InHash, uint32 Index)
     {
-        // 함수 내의 static 변수는 처음 호출될 때 스레드에 안전하게
-        // 단 한 번만 초기화됩니다.
-        static TMap<FString, uint32> GNameMap;
-        return GNameMap;
+        const uint32 Mask = Table->Capacity - 1;
+        uint32 Pos = static_cast<uint32>(InHash) & Mask;
+        while (Table->Slots[Pos].load(std::memory_order_relaxed) != 0)
+        {
+            Pos = (Pos + 1) & Mask;
+        }
+        Table->Slots[Pos].store((static_cast<uint64>(InHash >> 32) << 32) | (static_cast<uint64>(Index) + 1), std::memory_order_release);
     }
 
-    // Entries를 안전하게 가져오는 getter
-    static TArray<FNameEntry>& GetEntries()
+    // 2배 크기 테이블로 옮긴 뒤 교체 (WriteMutex 보유 상태)
+    void GrowShard(FNamePoolData& Data, FNameShard& Shard)
     {
-        static TArray<FNameEntry> GEntries;
-        return GEntries;
+        FNameTable* OldTable = Shard.Table.load(std::memory_order_relaxed);
+        FNameTable* NewTable = CreateTable(OldTable->Capacity * 2);
+        for (uint32 i = 0; i < OldTable->Capacity; ++i)
+        {
+            const uint64 Slot = OldTable->Slots[i].load(std::memory_order_relaxed);
+            if (Slot != 0)
+            {
+                const uint32 Index = static_cast<uint32>(Slot) - 1;
+                InsertSlot(NewTable, GetEntry(Data, Index).Hash, Index);
+            }
+        }
+        Shard.Table.store(NewTable, std::memory_order_release);
+        Shard.RetiredTables.Add(OldTable);
     }
 
-    // FString을 소문자로 변환하는 헬퍼 함수
-    static FString ToLower(const FString& InStr)
+    // 새 엔트리 인덱스를 발급하고 청크가 없으면 할당
+    uint32 AllocateEntry(FNamePoolData& Data)
     {
-        FString Result = InStr;
-        std::transform(Result.begin(), Result.end(), Result.begin(),
-            [](unsigned char c) { return std::tolower(c); });
-        return Result;
+        const uint32 Index = Data.NumEntries.fetch_add(1, std::memory_order_relaxed);
+        const uint32 ChunkIndex = Index >> EntriesPerChunkBits;
+        if (ChunkIndex >= MaxChunks)
+        {
+            UE_LOG("[error] FNamePool: 이름 테이블이 가득 찼습니다 (%u)", MaxChunks * EntriesPerChunk);
+            std::abort();
+        }
+        if (!Data.Chunks[ChunkIndex].load(std::memory_order_acquire))
+        {
+            std::lock_guard<std::mutex> Lock(Data.ChunkMutex);
+            if (!Data.Chunks[ChunkIndex].load(std::memory_order_relaxed))
+            {
+                Data.Chunks[ChunkIndex].store(new FNameEntry[EntriesPerChunk], std::memory_order_release);
+            }
+        }
+        return Index;
     }
 }
 
 uint32 FNamePool::Add(const FString& InStr)
 {
-    FString Lower = ToLower(InStr);
+    return Add(std::string_view(InStr));
+}
+
+uint32 FNamePool::Add(std::string_view InStr)
+{
+    return Add(InStr, HashNameCaseInsensitive(InStr.data(), InStr.size()));
+}
+
+uint32 FNamePool::Add(std::string_view InStr, uint64 InHash)
+{
+    FNamePoolData& Data = GetPoolData();
+    FNameShard& Shard = Data.Shards[InHash >> (64 - NumShardBits)];
+
+    // 이미 있는 이름은 락 없이 찾음
+    if (const FNameTable* Table = Shard.Table.load(std::memory_order_acquire))
+    {
+        const uint32 Found = FindInTable(Data, Table, InStr, InHash);
+        if (Found != UINT32_MAX)
+        {
+            return Found;
+        }
+    }
+
+    std::lock_guard<std::mutex> Lock(Shard.WriteMutex);
 
-    // 전역 변수 대신 getter를 통해 접근
-    TMap<FString, uint32>& NameMap = GetNameMap();
-    TArray<FNameEntry>& Entries = GetEntries();
+    FNameTable* Table = Shard.Table.load(std::memory_order_relaxed);
+    if (!Table)
+    {
+        Table = CreateTable(InitialShardCapacity);
+        Shard.Table.store(Table, std::memory_order_release);
+    }
+    else
+    {
+        // 락을 기다리는 동안 다른 스레드가 같은 이름을 넣었을 수 있음
+        const uint32 Found = FindInTable(Data, Table, InStr, InHash);
+        if (Found != UINT32_MAX)
+        {
+            return Found;
+        }
+    }
 
-    auto it = NameMap.find(Lower);
-    if (it != NameMap.end())
-        return it->second;
+    // 적재율 3/4를 넘기 전에 확장
+    if ((Shard.NumUsed + 1) * 4 > Table->Capacity * 3)
+    {
+        GrowShard(Data, Shard);
+        Table = Shard.Table.load(std::memory_order_relaxed);
+    }
 
-    uint32 NewIndex = (uint32)Entries.size();
-    Entries.push_back({ InStr, Lower });
-    NameMap[Lower] = NewIndex;
+    // 엔트리를 다 채운 뒤 슬롯을 기록해야 락 없이 읽는 쪽이 완성된 엔트리만 봄
+    const uint32 NewIndex = AllocateEntry(Data);
+    FNameEntry& Entry = GetEntry(Data, NewIndex);
+    Entry.Display.assign(InStr.data(), InStr.size());
+    Entry.Comparison.resize(InStr.size());
+    std::transform(InStr.begin(), InStr.end(), Entry.Comparison.begin(),
+        [](unsigned char c) { return static_cast<char>(std::tolower(c)); });
+    Entry.Hash = InHash;
+
+    InsertSlot(Table, InHash, NewIndex);
+    ++Shard.NumUsed;
     return NewIndex;
 }
 
 const FNameEntry& FNamePool::Get(uint32 Index)
 {
-    // 전역 변수 대신 getter를 통해 접근
-    TArray<FNameEntry>& Entries = GetEntries();
+    FNamePoolData& Data = GetPoolData();
 
     // (안전성 강화) 경계 검사 추가
-    if (Index >= Entries.size())
+    if (Index >= Data.NumEntries.load(std::memory_order_acquire))
     {
-        static FNameEntry InvalidEntry = { "Invalid", "invalid" };
+        static FNameEntry InvalidEntry = { "Invalid", "invalid", HashNameCaseInsensitive("Invalid", 7) };
         return InvalidEntry;
     }
-    return Entries[Index];
-}
\ No newline at end of file
+    return GetEntry(Data, Index);
+}
+
+uint32 FNamePool::GetNumEntries()
+{
+    return GetPoolData().NumEntries.load(std::memory_order_acquire);
+}
@@ -0,0 +1,157 @@
+﻿#include "pch.h"
+#include "Hash.h"
+#include <cstring>
+
+namespace
+{
+	constexpr uint64 Prime1 = 0x9E3779B185EBCA87ULL;
+	constexpr uint64 Prime2 = 0xC2B2AE3D27D4EB4FULL;
+	constexpr uint64 Prime3 = 0x165667B19E3779F9ULL;
+	constexpr uint64 Prime4 = 0x85EBCA77C2B2AE63ULL;
+	constexpr uint64 Prime5 = 0x27D4EB2F165667C5ULL;
+
+	inline uint64 RotateLeft(uint64 Value, int32 Bits)
+	{
+		return (Value << Bits) | (Value >> (64 - Bits));
+	}
+
+	// 정렬되지 않은 주소에서 읽기 (리틀 엔디언 전제)
+	inline uint64 Read64(const uint8* Ptr)
+	{
+		uint64 Value;
+		std::memcpy(&Value, Ptr, sizeof(Value));
+		return Value;
+	}
+
+	inline uint32 Read32(const uint8* Ptr)
+	{
+		uint32 Value;
+		std::memcpy(&Value, Ptr, sizeof(Value));
+		return Value;
+	}
+
+	inline uint64 Round(uint64 Acc, uint64 Input)
+	{
+		Acc += Input * Prime2;
+		Acc = RotateLeft(Acc, 31);
+		return Acc * Prime1;
+	}
+
+	inline uint64 MergeRound(uint64 Acc, uint64 Value)
+	{
+		Acc ^= Round(0, Value);
+		return Acc * Prime1 + Prime4;
+	}
+}
+
+void FXxHash64::Reset(uint64 InSeed)
+{
+	Seed = InSeed;
+	Acc[0] = InSeed + Prime1 + Prime2;
+	Acc[1] = InSeed + Prime2;
+	Acc[2] = InSeed;
+	Acc[3] = InSeed - Prime1;
+	TotalSize = 0;
+	BufferSize = 0;
+}
+
+void FXxHash64::Update(const void* InData, size_t InSize)
+{
+	if (!InData || InSize == 0)
+	{
+		return;
+	}
+
+	const uint8* Ptr = static_cast<const uint8*>(InData);
+	const uint8* const End = Ptr + InSize;
+	TotalSize += InSize;
+
+	// 이전 호출에서 남은 바이트와 합쳐 32바이트 스트라이프 하나를 채움
+	if (BufferSize + InSize < sizeof(Buffer))
+	{
+		std::memcpy(Buffer + BufferSize, Ptr, InSize);
+		BufferSize += static_cast<uint32>(InSize);
+		return;
+	}
+	if (BufferSize > 0)
+	{
+		const size_t Fill = sizeof(Buffer) - BufferSize;
+		std::memcpy(Buffer + BufferSize, Ptr, Fill);
+		Acc[0] = Round(Acc[0], Read64(Buffer + 0));
+		Acc[1] = Round(Acc[1], Read64(Buffer + 8));
+		Acc[2] = Round(Acc[2], Read64(Buffer + 16));
+		Acc[3] = Round(Acc[3], Read64(Buffer + 24));
+		Ptr += Fill;
+		BufferSize = 0;
+	}
+
+	while (Ptr + 32 <= End)
+	{
+		Acc[0] = Round(Acc[0], Read64(Ptr + 0));
+		Acc[1] = Round(Acc[1], Read64(Ptr + 8));
+		Acc[2] = Round(Acc[2], Read64(Ptr + 16));
+		Acc[3] = Round(Acc[3], Read64(Ptr + 24));
+		Ptr += 32;
+	}
+
+	if (Ptr < End)
+	{
+		BufferSize = static_cast<uint32>(End - Ptr);
+		std::memcpy(Buffer, Ptr, BufferSize);
+	}
+}
+
+uint64 FXxHash64::Digest() const
+{
+	uint64 Result;
+	if (TotalSize >= 32)
+	{
+		Result = RotateLeft(Acc[0], 1) + RotateLeft(Acc[1], 7) + RotateLeft(Acc[2], 12) + RotateLeft(Acc[3], 18);
+		Result = MergeRound(Result, Acc[0]);
+		Result = MergeRound(Result, Acc[1]);
+		Result = MergeRound(Result, Acc[2]);
+		Result = MergeRound(Result, Acc[3]);
+	}
+	else
+	{
+		Result = Seed + Prime5;
+	}
+	Result += TotalSize;
+
+	// 남은 꼬리 바이트
+	const uint8* Ptr = Buffer;
+	const uint8* const End = Buffer + BufferSize;
+	while (Ptr + 8 <= End)
+	{
+		Result ^= Round(0, Read64(Ptr));
+		Result = RotateLeft(Result, 27) * Prime1 + Prime4;
+		Ptr += 8;
+	}
+	if (Ptr + 4 <= End)
+	{
+		Result ^= static_cast<uint64>(Read32(Ptr)) * Prime1;
+		Result = RotateLeft(Result, 23) * Prime2 + Prime3;
+		Ptr += 4;
+	}
+	while (Ptr < End)
+	{
+		Result ^= static_cast<uint64>(*Ptr) * Prime5;
+		Result = RotateLeft(Result, 11) * Prime1;
+		++Ptr;
+	}
+
+	// 애벌랜치
+	Result ^= Result >> 33;
+	Result *= Prime2;
+	Result ^= Result >> 29;
+	Result *= Prime3;
+	Result ^= Result >> 32;
+	return Result;
+}
+
+uint64 FXxHash64::Hash(const void* InData, size_t InSize, uint64 InSeed)
+{
+	FXxHash64 Hasher(InSeed);
+	Hasher.Update(InData, InSize);
+	return Hasher.Digest();
+}
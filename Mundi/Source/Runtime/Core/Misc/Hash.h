@@ -14,4 +14,28 @@ inline uint64 HashCombine(uint64 Seed, uint64 ValueToCombine)
     const uint64 GoldenRatio = 0x9e3779b97f4a7c15;
     Seed ^= ValueToCombine + GoldenRatio + (Seed << 6) + (Seed >> 2);
     return Seed;
-}
\ No newline at end of file
+}
+
+/**
+ * xxHash64 (XXH64) 스트리밍 구현
+ * 파생 데이터 캐시 키처럼 큰 파일 내용을 빠르게 해싱할 때 사용 (암호학적 해시 아님)
+ */
+class FXxHash64
+{
+public:
+    explicit FXxHash64(uint64 InSeed = 0) { Reset(InSeed); }
+
+    void Reset(uint64 InSeed = 0);
+    void Update(const void* InData, size_t InSize);
+    uint64 Digest() const;
+
+    // 한 번에 해싱
+    static uint64 Hash(const void* InData, size_t InSize, uint64 InSeed = 0);
+
+private:
+    uint64 Seed = 0;
+    uint64 Acc[4] = {};
+    uint64 TotalSize = 0;
+    uint8 Buffer[32] = {};
+    uint32 BufferSize = 0;
+};
\ No newline at end of file
@@ -2,6 +2,7 @@
 // Name.h
 #pragma once
 #include <string>
+#include <string_view>
 #include <vector>
 #include <algorithm>
 #include <unordered_map>
@@ -13,13 +14,55 @@ struct FNameEntry
 {
     FString Display;    // 원문
     FString Comparison; // lower-case
+    uint64 Hash = 0;    // HashNameCaseInsensitive(Display)
 };
 
+// 대소문자를 무시하는 FNV-1a 64 (ASCII 기준, 임시 문자열 없이 계산)
+constexpr uint64 HashNameCaseInsensitive(const char* InStr, size_t InLen)
+{
+    uint64 Hash = 14695981039346656037ull;
+    for (size_t i = 0; i < InLen; ++i)
+    {
+        char c = InStr[i];
+        if (c >= 'A' && c <= 'Z')
+        {
+            c = static_cast<char>(c - 'A' + 'a');
+        }
+        Hash ^= static_cast<uint8>(c);
+        Hash *= 1099511628211ull;
+    }
+    return Hash;
+}
+
+// 문자열 리터럴의 해시를 컴파일 타임에 계산해 두는 래퍼
+// 사용법: Macro.Name = FNameLiteral("COMPACT_VERTEX");
+struct FNameLiteral
+{
+    const char* Str;
+    size_t Len;
+    uint64 Hash;
+
+    template<size_t N>
+    consteval FNameLiteral(const char (&InStr)[N])
+        : Str(InStr), Len(N - 1), Hash(HashNameCaseInsensitive(InStr, N - 1))
+    {
+    }
+};
+
+/**
+ * 전역 이름 테이블
+ * - 해시 상위 비트로 나눈 샤드마다 open addressing 테이블을 둠. 조회는 락 없이, 새 이름 추가만 샤드 락을 잡음
+ * - 엔트리는 고정 크기 청크에 저장되어 재할당되지 않으므로 Get이 돌려준 참조는 프로그램 종료까지 유효
+ * - 여러 스레드에서 동시에 Add/Get 해도 안전함
+ */
 class FNamePool
 {
 public:
     static uint32 Add(const FString& InStr);
+    static uint32 Add(std::string_view InStr);
+    static uint32 Add(std::string_view InStr, uint64 InHash);
     static const FNameEntry& Get(uint32 Index);
+    static uint32 GetNumEntries();
 };
 
 // ──────────────────────────────
@@ -31,12 +74,12 @@ struct FName
     uint32 ComparisonIndex = -1;
 
     FName() = default;
-    FName(const char* InStr) { Init(FString(InStr)); }
-    FName(const FString& InStr) { Init(InStr); }
+    FName(const char* InStr) { Init(FNamePool::Add(std::string_view(InStr))); }
+    FName(const FString& InStr) { Init(FNamePool::Add(InStr)); }
+    FName(const FNameLiteral& InLiteral) { Init(FNamePool::Add(std::string_view(InLiteral.Str, InLiteral.Len), InLiteral.Hash)); }
 
-    void Init(const FString& InStr)
+    void Init(uint32 Index)
     {
-        int32_t Index = FNamePool::Add(InStr);
         DisplayIndex = Index;
         ComparisonIndex = Index; // 필요시 다른 규칙 적용 가능
     }
@@ -72,4 +115,4 @@ namespace std
             return hash<uint32>{}(Name.ComparisonIndex);
         }
     };
-}
\ No newline at end of file
+}
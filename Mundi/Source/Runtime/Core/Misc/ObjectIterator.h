@@ -2,19 +2,25 @@
 
 #include "ObjectFactory.h"
 
+// TObject와 그 파생 클래스의 객체만 순회 (UClass별 객체 목록 사용, GUObjectArray 전체를 훑지 않음)
+// 클래스 목록 안에서는 뒤에서부터 순회하므로 현재 객체를 삭제해도 안전함
 template<typename TObject>
 class TObjectIterator
 {
 public:
 	TObjectIterator()
+		: Classes(&TObject::StaticClass()->GetSelfAndDerivedClasses())
 	{
+		if (!Classes->IsEmpty())
+		{
+			ObjectIndex = (*Classes)[0]->GetObjects().Num();
+		}
 		++(*this); // 첫 번째 유효 객체로 이동
 	}
 
 	// 다음 객체로 이동
 	TObjectIterator& operator++()
 	{
-		++CurrentIndex;
 		AdvanceToNextValidObject();
 		return *this;
 	}
@@ -22,8 +28,8 @@ public:
 	// 현재 객체에 접근
 	TObject* operator*() const
 	{
-		// 이 시점의 CurrentIndex는 유효한 TObject를 가리키고 있어야 함
-		return static_cast<TObject*>(GUObjectArray[CurrentIndex]);
+		// 이 시점의 (ClassIndex, ObjectIndex)는 유효한 TObject를 가리키고 있어야 함
+		return static_cast<TObject*>((*Classes)[ClassIndex]->GetObjects()[ObjectIndex]);
 	}
 
 	// 현재 객체에 접근 (포인터 연산자)
@@ -35,34 +41,37 @@ public:
 	// 비교 연산자
 	bool operator!=(const TObjectIterator& Other) const
 	{
-		return CurrentIndex != Other.CurrentIndex;
+		return ClassIndex != Other.ClassIndex || ObjectIndex != Other.ObjectIndex;
 	}
 
 	// bool 변환 연산자
 	explicit operator bool() const
 	{
-		// CurrentIndex가 배열 범위 내에 있는지 확인
-		return CurrentIndex < GUObjectArray.Num();
+		// ClassIndex가 클래스 목록 범위 내에 있는지 확인
+		return ClassIndex < Classes->Num();
 	}
 
 private:
-	// 현재 인덱스부터 시작하여 다음 유효 객체를 찾는 헬퍼 함수
+	// 현재 클래스 목록의 앞쪽 객체로, 다 돌았으면 다음 파생 클래스의 마지막 객체로 이동
 	void AdvanceToNextValidObject()
 	{
-		while (CurrentIndex < GUObjectArray.Num())
+		while (ClassIndex < Classes->Num())
 		{
-			UObject* Object = GUObjectArray[CurrentIndex];
-			// 현재 객체가 유효하고, TObject 타입이면 검색 종료
-			if (Object && Object->IsA<TObject>())
+			// 순회 중 삭제로 목록이 줄었을 수 있으므로 범위를 다시 맞춤
+			ObjectIndex = std::min(ObjectIndex, (*Classes)[ClassIndex]->GetObjects().Num());
+			if (ObjectIndex > 0)
 			{
-				break;
+				--ObjectIndex;
+				return;
 			}
 
-			// 다음 인덱스로 이동
-			++CurrentIndex;
+			++ClassIndex;
+			ObjectIndex = ClassIndex < Classes->Num() ? (*Classes)[ClassIndex]->GetObjects().Num() : 0;
 		}
 	}
 
 private:
-	int32 CurrentIndex = -1;
+	const TArray<const UClass*>* Classes = nullptr;
+	int32 ClassIndex = 0;
+	int32 ObjectIndex = 0;
 };
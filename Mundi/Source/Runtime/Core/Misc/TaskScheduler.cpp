@@ -0,0 +1,181 @@
+﻿#include "pch.h"
+#include "TaskScheduler.h"
+
+namespace
+{
+	// 워커 스레드 판별용 (ParallelFor 중첩 호출 시 데드락 방지)
+	thread_local bool GIsTaskWorkerThread = false;
+
+	// ParallelFor 한 번의 호출이 공유하는 상태
+	// 늦게 시작한 헬퍼 작업이 호출자 스택을 건드리지 않도록 shared_ptr로 수명을 관리합니다.
+	struct FParallelForContext
+	{
+		const std::function<void(int32, int32)>* Body = nullptr;
+		int32 Num = 0;
+		int32 BatchSize = 1;
+		int32 NumBatches = 0;
+
+		std::atomic<int32> NextBatch{ 0 };
+		std::atomic<int32> CompletedBatches{ 0 };
+
+		std::mutex DoneMutex;
+		std::condition_variable DoneCondition;
+
+		// 남은 배치를 가져와 처리합니다. 마지막 배치를 끝낸 스레드가 대기 중인 호출자를 깨웁니다.
+		void Work()
+		{
+			for (;;)
+			{
+				const int32 Batch = NextBatch.fetch_add(1);
+				if (Batch >= NumBatches)
+				{
+					return;
+				}
+
+				const int32 Begin = Batch * BatchSize;
+				const int32 End = std::min(Begin + BatchSize, Num);
+				(*Body)(Begin, End);
+
+				if (CompletedBatches.fetch_add(1) + 1 == NumBatches)
+				{
+					std::lock_guard<std::mutex> Lock(DoneMutex);
+					DoneCondition.notify_all();
+				}
+			}
+		}
+	};
+}
+
+FTaskScheduler::~FTaskScheduler()
+{
+	Shutdown();
+}
+
+void FTaskScheduler::Startup(uint32 InNumWorkers)
+{
+	if (!Workers.IsEmpty())
+	{
+		return;
+	}
+
+	if (InNumWorkers == 0)
+	{
+		const uint32 HardwareThreads = std::thread::hardware_concurrency();
+		InNumWorkers = HardwareThreads > 1 ? HardwareThreads - 1 : 1;
+	}
+
+	bStopping = false;
+	Workers.Reserve(InNumWorkers);
+	for (uint32 i = 0; i < InNumWorkers; ++i)
+	{
+		Workers.Emplace(&FTaskScheduler::WorkerLoop, this);
+	}
+}
+
+void FTaskScheduler::Shutdown()
+{
+	{
+		std::lock_guard<std::mutex> Lock(QueueMutex);
+		bStopping = true;
+	}
+	QueueCondition.notify_all();
+
+	for (std::thread& Worker : Workers)
+	{
+		if (Worker.joinable())
+		{
+			Worker.join();
+		}
+	}
+	Workers.Empty();
+}
+
+void FTaskScheduler::Enqueue(std::function<void()> Task)
+{
+	if (!Task)
+	{
+		return;
+	}
+
+	if (Workers.IsEmpty())
+	{
+		Task();
+		return;
+	}
+
+	{
+		std::lock_guard<std::mutex> Lock(QueueMutex);
+		PendingTasks.Enqueue(std::move(Task));
+	}
+	QueueCondition.notify_one();
+}
+
+void FTaskScheduler::ParallelFor(int32 Num, int32 MinBatchSize, const std::function<void(int32 Begin, int32 End)>& Body)
+{
+	if (Num <= 0)
+	{
+		return;
+	}
+
+	MinBatchSize = std::max(MinBatchSize, 1);
+
+	// 워커가 없거나, 워커 안에서 중첩 호출되었거나, 배치가 하나뿐이면 직접 실행
+	const int32 NumThreads = static_cast<int32>(Workers.size()) + 1;
+	if (Workers.IsEmpty() || IsInWorkerThread() || Num <= MinBatchSize)
+	{
+		Body(0, Num);
+		return;
+	}
+
+	// 스레드당 여러 배치를 두어 작업량 불균형을 흡수합니다.
+	const int32 TargetBatches = NumThreads * 4;
+	const int32 BatchSize = std::max(MinBatchSize, (Num + TargetBatches - 1) / TargetBatches);
+
+	std::shared_ptr<FParallelForContext> Context = std::make_shared<FParallelForContext>();
+	Context->Body = &Body;
+	Context->Num = Num;
+	Context->BatchSize = BatchSize;
+	Context->NumBatches = (Num + BatchSize - 1) / BatchSize;
+
+	const int32 NumHelpers = std::min(Context->NumBatches - 1, static_cast<int32>(Workers.size()));
+	for (int32 i = 0; i < NumHelpers; ++i)
+	{
+		Enqueue([Context]() { Context->Work(); });
+	}
+
+	// 호출 스레드도 함께 처리
+	Context->Work();
+
+	std::unique_lock<std::mutex> Lock(Context->DoneMutex);
+	Context->DoneCondition.wait(Lock, [&Context]()
+		{
+			return Context->CompletedBatches.load() == Context->NumBatches;
+		});
+}
+
+bool FTaskScheduler::IsInWorkerThread()
+{
+	return GIsTaskWorkerThread;
+}
+
+void FTaskScheduler::WorkerLoop()
+{
+	GIsTaskWorkerThread = true;
+
+	for (;;)
+	{
+		std::function<void()> Task;
+		{
+			std::unique_lock<std::mutex> Lock(QueueMutex);
+			QueueCondition.wait(Lock, [this]() { return bStopping || !PendingTasks.IsEmpty(); });
+
+			if (!PendingTasks.Dequeue(Task))
+			{
+				// bStopping이고 큐가 비었으면 종료
+				return;
+			}
+		}
+
+		Task();
+	}
+}
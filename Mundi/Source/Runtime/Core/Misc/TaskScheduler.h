@@ -0,0 +1,62 @@
+﻿#pragma once
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <atomic>
+#include <functional>
+#include "UEContainer.h"
+
+/**
+ * @class FTaskScheduler
+ * @brief 엔진 공용 워커 스레드 풀 (싱글톤).
+ *
+ * - Enqueue: 결과를 기다리지 않는 비동기 작업 등록 (에셋 로드 등)
+ * - ParallelFor: [0, Num) 범위를 배치로 쪼개 워커와 호출 스레드가 함께 처리하고, 모두 끝날 때까지 대기
+ *
+ * 워커 스레드 안에서 다시 ParallelFor를 호출하면 데드락을 피하기 위해 호출 스레드에서 직접 실행합니다.
+ */
+class FTaskScheduler
+{
+public:
+	static FTaskScheduler& GetInstance()
+	{
+		static FTaskScheduler Instance;
+		return Instance;
+	}
+
+	/** @brief 워커 스레드를 생성합니다. InNumWorkers가 0이면 (논리 코어 수 - 1)개를 사용합니다. */
+	void Startup(uint32 InNumWorkers = 0);
+
+	/** @brief 남은 작업을 모두 처리한 뒤 워커 스레드를 종료합니다. */
+	void Shutdown();
+
+	/** @brief 비동기 작업을 큐에 추가합니다. 워커가 없으면 즉시 호출 스레드에서 실행합니다. */
+	void Enqueue(std::function<void()> Task);
+
+	/**
+	 * @brief [0, Num) 범위를 MinBatchSize 이상 크기의 구간으로 나누어 병렬 실행합니다.
+	 * @param Body 구간 [Begin, End)를 처리하는 함수. 서로 다른 구간이 동시에 호출될 수 있습니다.
+	 */
+	void ParallelFor(int32 Num, int32 MinBatchSize, const std::function<void(int32 Begin, int32 End)>& Body);
+
+	uint32 GetNumWorkers() const { return static_cast<uint32>(Workers.size()); }
+
+	/** @brief 현재 스레드가 이 스케줄러의 워커 스레드인지 확인합니다. */
+	static bool IsInWorkerThread();
+
+private:
+	FTaskScheduler() = default;
+	~FTaskScheduler();
+	FTaskScheduler(const FTaskScheduler&) = delete;
+	FTaskScheduler& operator=(const FTaskScheduler&) = delete;
+
+	void WorkerLoop();
+
+private:
+	TArray<std::thread> Workers;
+	TQueue<std::function<void()>> PendingTasks;
+
+	std::mutex QueueMutex;
+	std::condition_variable QueueCondition;
+	bool bStopping = false;
+};
@@ -1,5 +1,159 @@
 ﻿#include "pch.h"
 #include "VertexData.h"
+#include <cmath>
+#include <cstring>
+
+namespace
+{
+    int16 PackSnorm16(float Value)
+    {
+        const float Clamped = Value < -1.0f ? -1.0f : (Value > 1.0f ? 1.0f : Value);
+        return static_cast<int16>(std::lround(Clamped * 32767.0f));
+    }
+
+    float UnpackSnorm16(int16 Value)
+    {
+        // D3D 규칙: -32768과 -32767 모두 -1.0
+        const float Result = static_cast<float>(Value) / 32767.0f;
+        return Result < -1.0f ? -1.0f : Result;
+    }
+
+    uint8 PackUnorm8(float Value)
+    {
+        const float Clamped = Value < 0.0f ? 0.0f : (Value > 1.0f ? 1.0f : Value);
+        return static_cast<uint8>(std::lround(Clamped * 255.0f));
+    }
+
+    // 단위 벡터를 8면체 전개도 위의 [-1, 1]^2 좌표로
+    void EncodeOctahedral(const FVector& InDir, int16 OutXY[2])
+    {
+        const float L1 = std::fabs(InDir.X) + std::fabs(InDir.Y) + std::fabs(InDir.Z);
+        if (L1 < 1e-12f)
+        {
+            OutXY[0] = 0;
+            OutXY[1] = 0;
+            return;
+        }
+
+        float X = InDir.X / L1;
+        float Y = InDir.Y / L1;
+        if (InDir.Z < 0.0f)
+        {
+            // 아래 반구는 대각선 기준으로 접어서 바깥 삼각형에 배치
+            const float FoldedX = (1.0f - std::fabs(Y)) * (X >= 0.0f ? 1.0f : -1.0f);
+            const float FoldedY = (1.0f - std::fabs(X)) * (Y >= 0.0f ? 1.0f : -1.0f);
+            X = FoldedX;
+            Y = FoldedY;
+        }
+        OutXY[0] = PackSnorm16(X);
+        OutXY[1] = PackSnorm16(Y);
+    }
+
+    // 셰이더의 DecodeOctahedral (Shaders/Common/VertexFormat.hlsl)과 같은 식
+    FVector DecodeOctahedral(const int16 InXY[2])
+    {
+        float X = UnpackSnorm16(InXY[0]);
+        float Y = UnpackSnorm16(InXY[1]);
+        const float Z = 1.0f - std::fabs(X) - std::fabs(Y);
+        const float T = Z < 0.0f ? -Z : 0.0f;
+        X += X >= 0.0f ? -T : T;
+        Y += Y >= 0.0f ? -T : T;
+
+        const float Length = std::sqrt(X * X + Y * Y + Z * Z);
+        return Length > 0.0f ? FVector(X / Length, Y / Length, Z / Length) : FVector(0.0f, 0.0f, 1.0f);
+    }
+
+    // IEEE 754 binary16 (반올림: 가장 가까운 짝수). 비정규 수는 0으로
+    uint16 FloatToHalf(float Value)
+    {
+        uint32 Bits;
+        std::memcpy(&Bits, &Value, sizeof(Bits));
+
+        const uint32 Sign = (Bits >> 16) & 0x8000u;
+        const int32 Exponent = static_cast<int32>((Bits >> 23) & 0xFFu) - 127 + 15;
+        uint32 Mantissa = Bits & 0x7FFFFFu;
+
+        if (((Bits >> 23) & 0xFFu) == 0xFFu)
+        {
+            return static_cast<uint16>(Sign | 0x7C00u | (Mantissa ? 0x200u : 0u));
+        }
+        if (Exponent <= 0)
+        {
+            return static_cast<uint16>(Sign);
+        }
+        if (Exponent >= 31)
+        {
+            return static_cast<uint16>(Sign | 0x7C00u);
+        }
+
+        uint32 Half = Sign | (static_cast<uint32>(Exponent) << 10) | (Mantissa >> 13);
+        const uint32 Remainder = Mantissa & 0x1FFFu;
+        if (Remainder > 0x1000u || (Remainder == 0x1000u && (Half & 1u)))
+        {
+            ++Half; // 가수 올림이 지수로 넘쳐도 비트 배치상 올바른 값이 됨
+        }
+        return static_cast<uint16>(Half);
+    }
+
+    float HalfToFloat(uint16 Value)
+    {
+        const uint32 Sign = static_cast<uint32>(Value & 0x8000u) << 16;
+        const uint32 Exponent = (Value >> 10) & 0x1Fu;
+        const uint32 Mantissa = Value & 0x3FFu;
+
+        uint32 Bits;
+        if (Exponent == 0)
+        {
+            if (Mantissa == 0)
+            {
+                Bits = Sign;
+            }
+            else
+            {
+                // 비정규 half → 정규 float
+                int32 Shift = 0;
+                uint32 M = Mantissa;
+                while ((M & 0x400u) == 0)
+                {
+                    M <<= 1;
+                    ++Shift;
+                }
+                Bits = Sign | (static_cast<uint32>(127 - 15 + 1 - Shift) << 23) | ((M & 0x3FFu) << 13);
+            }
+        }
+        else if (Exponent == 0x1Fu)
+        {
+            Bits = Sign | 0x7F800000u | (Mantissa << 13);
+        }
+        else
+        {
+            Bits = Sign | ((Exponent - 15 + 127) << 23) | (Mantissa << 13);
+        }
+
+        float Result;
+        std::memcpy(&Result, &Bits, sizeof(Result));
+        return Result;
+    }
+
+    void PackCommon(FPackedNormalVertex& Out, const FVector& Position, const FVector& Normal, const FVector2D& UV,
+        const FVector4& Tangent, const FVector4& Color)
+    {
+        Out.Position = Position;
+        EncodeOctahedral(Normal, Out.Normal);
+        Out.UV[0] = FloatToHalf(UV.X);
+        Out.UV[1] = FloatToHalf(UV.Y);
+
+        EncodeOctahedral(FVector(Tangent.X, Tangent.Y, Tangent.Z), Out.Tangent);
+        Out.Tangent[2] = 0;
+        Out.Tangent[3] = Tangent.W < 0.0f ? -32767 : 32767;
+
+        // R8G8B8A8_UNORM: 메모리상 R이 첫 바이트
+        Out.Color = static_cast<uint32>(PackUnorm8(Color.X))
+            | (static_cast<uint32>(PackUnorm8(Color.Y)) << 8)
+            | (static_cast<uint32>(PackUnorm8(Color.Z)) << 16)
+            | (static_cast<uint32>(PackUnorm8(Color.W)) << 24);
+    }
+}
 
 void FBillboardVertex::FillFrom(const FMeshData& mesh, size_t i)
 {
@@ -42,6 +196,83 @@ void FVertexDynamic::FillFrom(const FNormalVertex& src)
     Normal = FVector{ src.normal.X, src.normal.Y, src.normal.Z };
 }
 
+void FPackedNormalVertex::FillFrom(const FNormalVertex& src)
+{
+    PackCommon(*this, src.pos, src.normal, src.tex, src.Tangent, src.color);
+}
+
+void FPackedNormalVertex::FillFrom(const FSkinnedVertex& src)
+{
+    PackCommon(*this, src.Position, src.Normal, src.UV, src.Tangent, src.Color);
+}
+
+FVector FPackedNormalVertex::GetNormal() const
+{
+    return DecodeOctahedral(Normal);
+}
+
+FVector2D FPackedNormalVertex::GetUV() const
+{
+    return FVector2D(HalfToFloat(UV[0]), HalfToFloat(UV[1]));
+}
+
+FVector4 FPackedNormalVertex::GetTangent() const
+{
+    const FVector Dir = DecodeOctahedral(Tangent);
+    return FVector4(Dir.X, Dir.Y, Dir.Z, Tangent[3] < 0 ? -1.0f : 1.0f);
+}
+
+FVector4 FPackedNormalVertex::GetColor() const
+{
+    return FVector4(
+        static_cast<float>(Color & 0xFFu) / 255.0f,
+        static_cast<float>((Color >> 8) & 0xFFu) / 255.0f,
+        static_cast<float>((Color >> 16) & 0xFFu) / 255.0f,
+        static_cast<float>((Color >> 24) & 0xFFu) / 255.0f);
+}
+
+void FPackedSkinnedVertex::FillFrom(const FSkinnedVertex& src)
+{
+    FPackedNormalVertex::FillFrom(src);
+
+    int32 Largest = 0;
+    int32 Sum = 0;
+    for (int32 i = 0; i < 4; ++i)
+    {
+        // 본 수가 256개를 넘는 메시는 FVertexQuantizer::CanQuantize에서 걸러짐
+        BoneIndices[i] = static_cast<uint8>(src.BoneIndices[i]);
+        BoneWeights[i] = PackUnorm8(src.BoneWeights[i]);
+        Sum += BoneWeights[i];
+        if (src.BoneWeights[i] > src.BoneWeights[Largest])
+        {
+            Largest = i;
+        }
+    }
+
+    // 8비트 반올림 오차로 합이 1에서 벗어나면 정점이 바인드 포즈 쪽으로 끌려가므로 보정
+    if (Sum > 0)
+    {
+        const int32 Fixed = static_cast<int32>(BoneWeights[Largest]) + (255 - Sum);
+        BoneWeights[Largest] = static_cast<uint8>(Fixed < 0 ? 0 : (Fixed > 255 ? 255 : Fixed));
+    }
+}
+
+FSkinnedVertex FPackedSkinnedVertex::Decode() const
+{
+    FSkinnedVertex Result;
+    Result.Position = Position;
+    Result.Normal = GetNormal();
+    Result.UV = GetUV();
+    Result.Tangent = GetTangent();
+    Result.Color = GetColor();
+    for (int32 i = 0; i < 4; ++i)
+    {
+        Result.BoneIndices[i] = BoneIndices[i];
+        Result.BoneWeights[i] = static_cast<float>(BoneWeights[i]) / 255.0f;
+    }
+    return Result;
+}
+
 void FBillboardVertexInfo_GPU::FillFrom(const FMeshData& mesh, size_t i)
 {
     Position[0] = mesh.Vertices[i].X;
@@ -146,6 +146,47 @@ namespace std
     };
 }
 
+/**
+* 압축 정점 (임포트 시 메시 단위로 선택, FVertexDynamic 64바이트 → 32바이트)
+* 노멀/탄젠트는 8면체(octahedral) 인코딩 16비트 정규화, UV는 half, 컬러는 8비트 정규화.
+* 위치는 피킹/가림 판정이 그대로 읽을 수 있게 float 유지
+*/
+struct FPackedNormalVertex
+{
+    FVector Position;
+    int16 Normal[2];    // R16G16_SNORM, 8면체 인코딩
+    uint16 UV[2];       // R16G16_FLOAT
+    int16 Tangent[4];   // R16G16B16A16_SNORM, xy: 8면체 인코딩, w: binormal 방향 (±1)
+    uint32 Color;       // R8G8B8A8_UNORM
+
+    void FillFrom(const FNormalVertex& src);
+    void FillFrom(const FSkinnedVertex& src);
+
+    FVector GetNormal() const;
+    FVector2D GetUV() const;
+    FVector4 GetTangent() const;
+    FVector4 GetColor() const;
+};
+
+/**
+* 압축 스키닝 정점 (96바이트 → 40바이트)
+* 본 인덱스는 8비트라 본이 256개 이하인 메시만 사용 (셰이더 MAX_BONES와 같음)
+* 가중치는 8비트 정규화, 합이 정확히 255가 되도록 반올림 오차를 가장 큰 가중치에 몰아줌
+*/
+struct FPackedSkinnedVertex : public FPackedNormalVertex
+{
+    uint8 BoneIndices[4];   // R8G8B8A8_UINT
+    uint8 BoneWeights[4];   // R8G8B8A8_UNORM
+
+    void FillFrom(const FSkinnedVertex& src);
+
+    // CPU 스키닝용 전체 정밀도 정점으로 복원
+    FSkinnedVertex Decode() const;
+};
+
+static_assert(sizeof(FPackedNormalVertex) == 32, "FPackedNormalVertex must match the compact input layout");
+static_assert(sizeof(FPackedSkinnedVertex) == 40, "FPackedSkinnedVertex must match the compact skinned input layout");
+
 struct FBillboardVertexInfo {
     FVector WorldPosition;
     FVector2D CharSize;//char scale
@@ -192,6 +233,36 @@ struct FGroupInfo
     }
 };
 
+// 임포트 시 자동 생성한 LOD (LOD0은 FStaticMesh의 Indices/GroupInfos). 정점 배열은 LOD0과 공유
+struct FStaticMeshLOD
+{
+    TArray<uint32> Indices;
+    TArray<FGroupInfo> GroupInfos;  // LOD0과 같은 수/순서 (머티리얼 슬롯 공유). StartIndex는 이 LOD의 Indices 기준
+    float ScreenSize = 0.0f;        // 경계 구 지름이 화면 높이에서 차지하는 비율이 이 값 이하이면 사용
+    float Error = 0.0f;             // 경계 구 반지름 대비 단순화 오차
+
+    friend FArchive& operator<<(FArchive& Ar, FStaticMeshLOD& LOD)
+    {
+        if (Ar.IsSaving())
+        {
+            Serialization::WriteArray(Ar, LOD.Indices);
+        }
+        else if (Ar.IsLoading())
+        {
+            Serialization::ReadArray(Ar, LOD.Indices);
+        }
+
+        uint32 gCount = static_cast<uint32>(LOD.GroupInfos.size());
+        Ar << gCount;
+        LOD.GroupInfos.resize(gCount);
+        for (auto& g : LOD.GroupInfos) Ar << g;
+
+        Ar << LOD.ScreenSize;
+        Ar << LOD.Error;
+        return Ar;
+    }
+};
+
 struct FStaticMesh
 {
     FString PathFileName;
@@ -203,6 +274,10 @@ struct FStaticMesh
 
     bool bHasMaterial;
 
+    TArray<FStaticMeshLOD> LODs;   // LOD1부터 (화면 크기가 큰 순)
+
+    bool bCompactVertices = false; // GPU 정점 버퍼를 FPackedNormalVertex로 업로드 (CPU 사본은 전체 정밀도 유지)
+
     friend FArchive& operator<<(FArchive& Ar, FStaticMesh& Mesh)
     {
         if (Ar.IsSaving())
@@ -216,6 +291,12 @@ struct FStaticMesh
             for (auto& g : Mesh.GroupInfos) Ar << g;
 
             Ar << Mesh.bHasMaterial;
+
+            uint32 LODCount = static_cast<uint32>(Mesh.LODs.size());
+            Ar << LODCount;
+            for (auto& LOD : Mesh.LODs) Ar << LOD;
+
+            Ar << Mesh.bCompactVertices;
         }
         else if (Ar.IsLoading())
         {
@@ -229,6 +310,13 @@ struct FStaticMesh
             for (auto& g : Mesh.GroupInfos) Ar << g;
 
             Ar << Mesh.bHasMaterial;
+
+            uint32 LODCount;
+            Ar << LODCount;
+            Mesh.LODs.resize(LODCount);
+            for (auto& LOD : Mesh.LODs) Ar << LOD;
+
+            Ar << Mesh.bCompactVertices;
         }
         return Ar;
     }
@@ -320,6 +408,7 @@ struct FSkeletalMeshData
     FSkeleton Skeleton; // 스켈레톤 정보
     TArray<FGroupInfo> GroupInfos; // 머티리얼 그룹 (기존 시스템 재사용)
     bool bHasMaterial = false;
+    bool bCompactVertices = false; // 로드 시 FPackedSkinnedVertex로 변환해 보관/업로드 (본 256개 이하일 때만)
 
     friend FArchive& operator<<(FArchive& Ar, FSkeletalMeshData& Data)
     {
@@ -347,6 +436,9 @@ struct FSkeletalMeshData
 
             // 6. CacheFilePath 저장
             Serialization::WriteString(Ar, Data.CacheFilePath);
+
+            // 7. 압축 정점 플래그 저장
+            Ar << Data.bCompactVertices;
         }
         else if (Ar.IsLoading())
         {
@@ -373,6 +465,9 @@ struct FSkeletalMeshData
 
             // 6. CacheFilePath 로드
             Serialization::ReadString(Ar, Data.CacheFilePath);
+
+            // 7. 압축 정점 플래그 로드
+            Ar << Data.bCompactVertices;
         }
         return Ar;
     }
@@ -0,0 +1,69 @@
+﻿#pragma once
+#include "UEContainer.h"
+#include <windows.h>
+
+// 읽기 전용 메모리 맵 파일 (파일 전체를 한 번에 매핑)
+// 큰 텍스트 에셋(.obj 등)을 복사 없이 바로 파싱할 때 사용
+class FWindowsMappedFile
+{
+public:
+    FWindowsMappedFile(const FWideString& Filename)
+    {
+        FileHandle = CreateFileW(Filename.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr,
+            OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL | FILE_FLAG_SEQUENTIAL_SCAN, nullptr);
+        if (FileHandle == INVALID_HANDLE_VALUE)
+        {
+            return;
+        }
+
+        LARGE_INTEGER FileSize;
+        if (!GetFileSizeEx(FileHandle, &FileSize))
+        {
+            Close();
+            return;
+        }
+
+        Size = static_cast<size_t>(FileSize.QuadPart);
+        bOpen = true;
+
+        // 크기가 0인 파일은 매핑할 수 없으므로 열린 빈 파일로 취급
+        if (Size == 0)
+        {
+            return;
+        }
+
+        MappingHandle = CreateFileMappingW(FileHandle, nullptr, PAGE_READONLY, 0, 0, nullptr);
+        if (MappingHandle)
+        {
+            Data = static_cast<const char*>(MapViewOfFile(MappingHandle, FILE_MAP_READ, 0, 0, 0));
+        }
+        if (!Data)
+        {
+            Close();
+        }
+    }
+    ~FWindowsMappedFile() { Close(); }
+
+    FWindowsMappedFile(const FWindowsMappedFile&) = delete;
+    FWindowsMappedFile& operator=(const FWindowsMappedFile&) = delete;
+
+    bool IsOpen() const { return bOpen; }
+    const char* GetData() const { return Data; }
+    size_t GetSize() const { return Size; }
+
+    void Close()
+    {
+        if (Data) { UnmapViewOfFile(Data); Data = nullptr; }
+        if (MappingHandle) { CloseHandle(MappingHandle); MappingHandle = nullptr; }
+        if (FileHandle != INVALID_HANDLE_VALUE) { CloseHandle(FileHandle); FileHandle = INVALID_HANDLE_VALUE; }
+        Size = 0;
+        bOpen = false;
+    }
+
+private:
+    HANDLE FileHandle = INVALID_HANDLE_VALUE;
+    HANDLE MappingHandle = nullptr;
+    const char* Data = nullptr;
+    size_t Size = 0;
+    bool bOpen = false;
+};
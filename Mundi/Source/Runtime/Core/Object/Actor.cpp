@@ -11,6 +11,7 @@
 #include "World.h"
 #include "PrimitiveComponent.h"
 #include "GameObject.h"
+#include "ObjectDuplication.h"
 
 	/*BEGIN_PROPERTIES(AActor)
 	ADD_PROPERTY(FName, ObjectName, "[액터]", true, "액터의 이름입니다")
@@ -575,6 +576,7 @@ void AActor::DuplicateSubObjects()
 	bIsPicked = false;
 	bIsCulled = false;
 	World = nullptr; // PIE World는 복제 프로세스의 상위 레벨에서 설정해 주어야 합니다.
+	Level = nullptr;
 
 	if (OwnedComponents.IsEmpty())
 	{
@@ -584,8 +586,24 @@ void AActor::DuplicateSubObjects()
 	// ========================================================================
 	// 1단계: 모든 컴포넌트 복제 및 '원본 -> 사본' 매핑 테이블 생성
 	// ========================================================================
-	TMap<UActorComponent*, UActorComponent*> OldToNewComponentMap;
+	// 액터당 컴포넌트는 몇 개뿐이라 쌍 배열을 선형 검색 (맵 할당 없음)
+	// PIE 시작처럼 여러 액터를 한 번에 복제하는 중이면 공유 테이블에도 기록해 액터 간 참조 재연결에 사용
+	FObjectDuplicationContext* SharedContext = FObjectDuplicationContext::Get();
+	TArray<TPair<UActorComponent*, UActorComponent*>, TInlineAllocator<8>> OldToNewComponents;
 	TSet<UActorComponent*> NewOwnedComponents;
+	NewOwnedComponents.reserve(OwnedComponents.size());
+
+	auto FindNewComponent = [&OldToNewComponents](const UActorComponent* OriginalComp) -> UActorComponent*
+	{
+		for (const TPair<UActorComponent*, UActorComponent*>& Pair : OldToNewComponents)
+		{
+			if (Pair.first == OriginalComp)
+			{
+				return Pair.second;
+			}
+		}
+		return nullptr;
+	};
 
 	for (UActorComponent* OriginalComp : OwnedComponents)
 	{
@@ -603,24 +621,28 @@ void AActor::DuplicateSubObjects()
 		NewComp->SetOwner(this);
 		
 		// 매핑 테이블에 (원본 포인터, 새 포인터) 쌍을 기록합니다.
-		OldToNewComponentMap.insert({ OriginalComp, NewComp });
+		OldToNewComponents.Add({ OriginalComp, NewComp });
+		if (SharedContext)
+		{
+			SharedContext->Record(OriginalComp, NewComp);
+		}
 
 		// 새로운 소유 컴포넌트 목록에 추가합니다.
 		NewOwnedComponents.insert(NewComp);
 	}
 
 	// 복제된 컴포넌트 목록으로 교체합니다.
-	OwnedComponents = NewOwnedComponents;
+	OwnedComponents = std::move(NewOwnedComponents);
 
 	// ========================================================================
 	// 2단계: 매핑 테이블을 이용해 씬 계층 구조 재구성
 	// ========================================================================
 
 	// 2-1. 새로운 루트 컴포넌트 설정
-	UActorComponent** FoundNewRootPtr = OldToNewComponentMap.Find(RootComponent);
-	if (FoundNewRootPtr)
+	USceneComponent* OriginalRoot = RootComponent;
+	if (UActorComponent* FoundNewRoot = FindNewComponent(OriginalRoot))
 	{
-		RootComponent = Cast<USceneComponent>(*FoundNewRootPtr);
+		RootComponent = Cast<USceneComponent>(FoundNewRoot);
 	}
 	else
 	{
@@ -631,12 +653,13 @@ void AActor::DuplicateSubObjects()
 
 	// 2-2. 모든 씬 컴포넌트의 부모-자식 관계 재연결
 	SceneComponents.Empty(); // 새 컴포넌트로 목록을 다시 채웁니다.
+	SceneComponents.Reserve(OldToNewComponents.Num());
 	if (RootComponent)
 	{
 		SceneComponents.push_back(RootComponent);
 	}
 
-	for (auto const& [OriginalComp, NewComp] : OldToNewComponentMap)
+	for (auto const& [OriginalComp, NewComp] : OldToNewComponents)
 	{
 		USceneComponent* OriginalSceneComp = Cast<USceneComponent>(OriginalComp);
 		USceneComponent* NewSceneComp = Cast<USceneComponent>(NewComp);
@@ -644,16 +667,15 @@ void AActor::DuplicateSubObjects()
 		if (OriginalSceneComp && NewSceneComp)
 		{
 			// 루트가 아닌 경우에만 부모를 찾아 연결합니다.
-			if (OriginalSceneComp != GetRootComponent()) // 여기서 비교는 원본 액터의 루트와 해야 합니다.
+			if (OriginalSceneComp != OriginalRoot) // 여기서 비교는 원본 액터의 루트와 해야 합니다.
 			{
 				USceneComponent* OriginalParent = OriginalSceneComp->GetAttachParent();
 				if (OriginalParent)
 				{
 					// 매핑 테이블에서 원본 부모에 해당하는 '새로운 부모'를 찾습니다.
-					UActorComponent** FoundNewParentPtr = OldToNewComponentMap.Find(OriginalParent);
-					if (FoundNewParentPtr)
+					if (UActorComponent* FoundNewParent = FindNewComponent(OriginalParent))
 					{
-						if (USceneComponent* ParentSceneComponent = Cast<USceneComponent>(*FoundNewParentPtr))
+						if (USceneComponent* ParentSceneComponent = Cast<USceneComponent>(FoundNewParent))
 						{
 							NewSceneComp->SetupAttachment(ParentSceneComponent, EAttachmentRule::KeepRelative);
 						}
@@ -674,6 +696,12 @@ void AActor::Serialize(const bool bInIsLoading, JSON& InOutHandle)
 {
 	Super::Serialize(bInIsLoading, InOutHandle);
 
+	if (bInIsLoading && IsLoadingFromBinaryRecord())
+	{
+		// 컴포넌트 구성과 부착은 바이너리 로더가 끝냈음
+		return;
+	}
+
 	if (bInIsLoading)
 	{
 		// 액터 생성자에서 만들어진 컴포넌트를 무시하고 저장된 컴포넌트만 다시 붙인다
@@ -714,22 +742,7 @@ void AActor::Serialize(const bool bInIsLoading, JSON& InOutHandle)
 			}
 	
 			// 2) 컴포넌트 간 부모 자식 관계 설정
-			for (auto& Component : OwnedComponents)
-			{
-				USceneComponent* SceneComp = Cast<USceneComponent>(Component);
-				if (!SceneComp)
-				{
-					continue;
-				}
-				uint32 ParentId = SceneComp->GetParentId();
-				if (ParentId != 0) // RootComponent가 아니면 부모 설정
-				{
-					USceneComponent** ParentP = SceneComp->GetSceneIdMap().Find(ParentId);
-					USceneComponent* Parent = *ParentP;
-	
-					SceneComp->SetupAttachment(Parent, EAttachmentRule::KeepRelative);
-				}
-			}
+			AttachLoadedComponents();
 		}
 	}
 	else if (RootComponent)
@@ -757,6 +770,26 @@ void AActor::Serialize(const bool bInIsLoading, JSON& InOutHandle)
 	}
 }
 
+void AActor::AttachLoadedComponents()
+{
+	for (auto& Component : OwnedComponents)
+	{
+		USceneComponent* SceneComp = Cast<USceneComponent>(Component);
+		if (!SceneComp)
+		{
+			continue;
+		}
+		uint32 ParentId = SceneComp->GetParentId();
+		if (ParentId != 0) // RootComponent가 아니면 부모 설정
+		{
+			USceneComponent** ParentP = SceneComp->GetSceneIdMap().Find(ParentId);
+			USceneComponent* Parent = *ParentP;
+
+			SceneComp->SetupAttachment(Parent, EAttachmentRule::KeepRelative);
+		}
+	}
+}
+
 void AActor::RegisterComponentTree(USceneComponent* SceneComp, UWorld* InWorld)
 {
 	if (!SceneComp)
@@ -8,6 +8,7 @@
 #include "AActor.generated.h"
 
 class UWorld;
+class ULevel;
 class USceneComponent;
 class UPrimitiveComponent;
 class UShapeComponent;
@@ -20,6 +21,7 @@ class AActor : public UObject
 {
 public:
     GENERATED_REFLECTION_BODY()
+    DECLARE_MEMORY_TAG(EMemoryTag::Actor)
 
     DECLARE_DELEGATE(OnComponentBeginOverlap, UPrimitiveComponent*, UPrimitiveComponent*);
     DECLARE_DELEGATE(OnComponentEndOverlap, UPrimitiveComponent*, UPrimitiveComponent*);
@@ -44,6 +46,10 @@ public:
     void SetWorld(UWorld* InWorld) { World = InWorld; }
     UWorld* GetWorld() const { return World; }
 
+    // 이 액터를 담고 있는 레벨 (ULevel::AddActor/RemoveActor가 관리, 에디터 전용 액터는 nullptr)
+    void SetLevel(ULevel* InLevel) { Level = InLevel; }
+    ULevel* GetLevel() const { return Level; }
+
     // 루트/컴포넌트
     void SetRootComponent(USceneComponent* InRoot);
     USceneComponent* GetRootComponent() const { return RootComponent; }
@@ -77,6 +83,9 @@ public:
     // ===== 월드가 파괴 경로에서 호출할 "좁은 공개 API" =====
     void DestroyAllComponents();   // Unregister 이후 최종 파괴
 
+    // 로드한 씬 컴포넌트를 저장된 ParentId대로 부착 (JSON/바이너리 레벨 로드 공용)
+    void AttachLoadedComponents();
+
     // ===== 파괴 재진입 가드 =====
     bool IsPendingDestroy() const { return bPendingDestroy; }
     void MarkPendingDestroy() { bPendingDestroy = true; }
@@ -174,6 +183,7 @@ public:
 
 public:
     UWorld* World = nullptr;
+    ULevel* Level = nullptr;
     USceneComponent* RootComponent = nullptr;
     UTextRenderComponent* TextComp = nullptr;
 
@@ -10,6 +10,7 @@ class UActorComponent : public UObject
 {
 public:
     GENERATED_REFLECTION_BODY()
+    DECLARE_MEMORY_TAG(EMemoryTag::Component)
     UActorComponent();
 
 protected:
@@ -13,6 +13,11 @@ FString UObject::GetComparisonName()
 // 리플렉션 기반 자동 직렬화 (현재 클래스의 프로퍼티만 처리)
 void UObject::Serialize(const bool bInIsLoading, JSON& InOutHandle)
 {
+	if (bInIsLoading && IsLoadingFromBinaryRecord())
+	{
+		return;
+	}
+
 	const TArray<FProperty>& Properties = this->GetClass()->GetAllProperties();
 
 	for (const FProperty& Prop : Properties)
@@ -29,19 +29,51 @@ struct UClass
     mutable TArray<FProperty> CachedAllProperties;  // GetAllProperties() 캐시 (성능 최적화)
     mutable bool bAllPropertiesCached = false;      // 캐시 유효성 플래그
 
-    constexpr UClass() = default;
-    constexpr UClass(const char* n, const UClass* s, SIZE_T z)
+    // 상수 시간 IsChildOf용 조상 테이블 (Ancestors[d] = 깊이 d의 조상, 자기 자신 포함)
+    static constexpr uint32 MaxClassDepth = 16;
+    uint32 ClassDepth = 0;                     // 루트(UObject)는 0
+    const UClass* Ancestors[MaxClassDepth] = {};
+
+    // 클래스별 객체 목록: 이 클래스(정확히 일치)로 등록된 객체. ObjectFactory가 생성/삭제 시 유지
+    mutable TArray<UObject*> Objects;
+    // 자기 자신과 모든 파생 클래스 (파생 클래스의 StaticClass()가 처음 불릴 때 추가됨)
+    mutable TArray<const UClass*> SelfAndDerivedClasses;
+
+    UClass() : UClass(nullptr, nullptr, 0) {}
+    UClass(const char* n, const UClass* s, SIZE_T z)
         :Name(n), Super(s), Size(z)
     {
+        // Super는 SuperClass::StaticClass()로 먼저 생성되므로 테이블이 이미 채워져 있음
+        if (Super)
+        {
+            ClassDepth = Super->ClassDepth + 1;
+            std::copy(std::begin(Super->Ancestors), std::end(Super->Ancestors), std::begin(Ancestors));
+        }
+        if (ClassDepth < MaxClassDepth)
+        {
+            Ancestors[ClassDepth] = this;
+        }
+        for (const UClass* c = this; c; c = c->Super)
+        {
+            c->SelfAndDerivedClasses.Add(this);
+        }
     }
     bool IsChildOf(const UClass* Base) const noexcept
     {
         if (!Base) return false;
+        if (Base->ClassDepth < MaxClassDepth)
+        {
+            return Base->ClassDepth <= ClassDepth && Ancestors[Base->ClassDepth] == Base;
+        }
+        // 테이블보다 깊은 계층은 체인 순회
         for (auto c = this; c; c = c->Super)
             if (c == Base) return true;
         return false;
     }
 
+    const TArray<UObject*>& GetObjects() const { return Objects; }
+    const TArray<const UClass*>& GetSelfAndDerivedClasses() const { return SelfAndDerivedClasses; }
+
     static TArray<UClass*>& GetAllClasses()
     {
         static TArray<UClass*> AllClasses;
@@ -168,14 +200,14 @@ protected:
     friend void ObjectFactory::DeleteObject(UObject* Obj);
 
 public:
-    // UObject-scoped allocation only
+    // UObject-scoped allocation only (파생 클래스는 DECLARE_MEMORY_TAG로 태그를 바꿀 수 있음)
     static void* operator new(SIZE_T Size)
     {
-        return FMemoryManager::Allocate(Size, alignof(std::max_align_t));
+        return FMemoryManager::Allocate(Size, alignof(std::max_align_t), EMemoryTag::Object);
     }
     static void* operator new(SIZE_T Size, std::align_val_t Alignment)
     {
-        return FMemoryManager::Allocate(Size, static_cast<size_t>(Alignment));
+        return FMemoryManager::Allocate(Size, static_cast<size_t>(Alignment), EMemoryTag::Object);
     }
     static void operator delete(void* Ptr) noexcept
     {
@@ -199,6 +231,10 @@ public:
 
     // 리플렉션 기반 자동 직렬화 (현재 클래스의 프로퍼티만 처리)
     virtual void Serialize(const bool bInIsLoading, JSON& InOutHandle);
+
+    // 바이너리 레벨 로드 중인 객체인지. 리플렉션 프로퍼티와 컴포넌트 구성은 FLevelBinarySerializer가 이미 채웠으므로
+    // Serialize(true)는 클래스가 직접 쓴 나머지 값만 처리함
+    bool IsLoadingFromBinaryRecord() const { return BinaryLoadTarget == this; }
 public:
     // GenerateUUID()에 의해 자동 발급
     uint32_t UUID;
@@ -206,6 +242,9 @@ public:
     // 팩토리 함수에 의해 자동 발급
     uint32_t InternalIndex;
 
+    // GetClass()->Objects 안에서의 위치 (팩토리 함수가 관리)
+    uint32_t ClassObjectIndex = UINT32_MAX;
+
     FName    ObjectName;   // 이 프로젝트에서는 고유하지 않는 라벨로 사용
 
     // 정적: 타입 메타 반환 (이름을 StaticClass로!)
@@ -239,6 +278,10 @@ public:
 private:
     // 전역 UUID 카운터(초기값 1)
     inline static uint32 GUUIDCounter = 1;
+
+    // 바이너리 로더가 Serialize(true)를 호출하는 동안의 대상 (다른 객체의 중첩 Serialize에는 영향 없음)
+    friend class FLevelBinarySerializer;
+    inline static const UObject* BinaryLoadTarget = nullptr;
 };
 
 // ── Cast 헬퍼 (UE Cast<> 와 동일 UX) ────────────────────────────
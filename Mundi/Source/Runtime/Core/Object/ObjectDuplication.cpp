@@ -0,0 +1,61 @@
+﻿#include "pch.h"
+#include "ObjectDuplication.h"
+
+FObjectDuplicationContext::FObjectDuplicationContext(int32 ExpectedObjects)
+    : Previous(Active)
+{
+    if (ExpectedObjects > 0)
+    {
+        OldToNew.reserve(static_cast<size_t>(ExpectedObjects));
+    }
+    Active = this;
+}
+
+FObjectDuplicationContext::~FObjectDuplicationContext()
+{
+    Active = Previous;
+}
+
+void FObjectDuplicationContext::Record(const UObject* Original, UObject* Copy)
+{
+    if (Original && Copy)
+    {
+        OldToNew.Add(Original, Copy);
+    }
+}
+
+UObject* FObjectDuplicationContext::FindCopy(const UObject* Original) const
+{
+    if (!Original)
+    {
+        return nullptr;
+    }
+    UObject* const* Found = OldToNew.Find(Original);
+    return Found ? *Found : nullptr;
+}
+
+int32 FObjectDuplicationContext::RemapObjectReferences(UObject* Object) const
+{
+    if (!Object)
+    {
+        return 0;
+    }
+
+    // 리소스 포인터(Texture/StaticMesh/Material 등)는 타입이 따로 있고 공유 자원이므로 대상이 아님
+    int32 NumRemapped = 0;
+    for (const FProperty& Property : Object->GetClass()->GetAllProperties())
+    {
+        if (Property.Type != EPropertyType::ObjectPtr)
+        {
+            continue;
+        }
+
+        UObject** ValuePtr = Property.GetValuePtr<UObject*>(Object);
+        if (UObject* Copy = FindCopy(*ValuePtr))
+        {
+            *ValuePtr = Copy;
+            ++NumRemapped;
+        }
+    }
+    return NumRemapped;
+}
@@ -0,0 +1,46 @@
+﻿#pragma once
+#include "UEContainer.h"
+
+class UObject;
+
+/**
+ * 여러 객체를 한 번에 복제할 때 (PIE 시작 등) 공유하는 원본 → 사본 포인터 테이블
+ * - 스택에 만들어 두는 동안 활성화되며, AActor::DuplicateSubObjects가 복제한 컴포넌트를 여기에 기록
+ * - 테이블은 처음에 예상 개수만큼 한 번 예약 (액터마다 임시 맵을 할당하지 않음)
+ * - 복제가 끝난 뒤 RemapObjectReferences로 ObjectPtr 프로퍼티가 원본을 가리키면 사본으로 바꿈
+ * 중첩 가능 (안쪽 컨텍스트가 끝나면 바깥 컨텍스트가 다시 활성화)
+ */
+class FObjectDuplicationContext
+{
+public:
+    explicit FObjectDuplicationContext(int32 ExpectedObjects = 0);
+    ~FObjectDuplicationContext();
+
+    FObjectDuplicationContext(const FObjectDuplicationContext&) = delete;
+    FObjectDuplicationContext& operator=(const FObjectDuplicationContext&) = delete;
+
+    /** 현재 활성화된 컨텍스트 (없으면 nullptr) */
+    static FObjectDuplicationContext* Get() { return Active; }
+
+    void Record(const UObject* Original, UObject* Copy);
+
+    /** 원본의 사본 (이번 복제에 포함되지 않은 객체면 nullptr) */
+    UObject* FindCopy(const UObject* Original) const;
+
+    template<typename T>
+    T* FindCopy(const T* Original) const
+    {
+        return static_cast<T*>(FindCopy(static_cast<const UObject*>(Original)));
+    }
+
+    /** Object의 ObjectPtr 프로퍼티 중 이번 복제의 원본을 가리키는 값을 사본으로 교체. 바꾼 개수 반환 */
+    int32 RemapObjectReferences(UObject* Object) const;
+
+    int32 Num() const { return OldToNew.Num(); }
+
+private:
+    TFlatMap<const UObject*, UObject*> OldToNew;
+    FObjectDuplicationContext* Previous = nullptr;
+
+    inline static FObjectDuplicationContext* Active = nullptr;
+};
@@ -3,6 +3,64 @@
 // 전역 오브젝트 배열 정의 (한 번만!)
 TArray<UObject*> GUObjectArray;
 
+namespace
+{
+    // GUObjectArray와 같은 인덱스의 세대 번호. 배열이 줄어도 유지해서 잘린 슬롯이 다시 생겨도 번호가 이어지게 함
+    TArray<uint32> GUObjectSerials;
+    // 삭제로 비워진 슬롯 (LIFO: 최근에 비운 슬롯부터 재사용)
+    TArray<uint32> GUObjectFreeIndices;
+
+    // 빈 슬롯을 재사용하거나 끝에 추가해서 Obj를 등록
+    void AllocateObjectSlot(UObject* Obj)
+    {
+        // 0번은 피킹 ID 버퍼에서 "객체 없음"이므로 비워 둠
+        if (GUObjectArray.IsEmpty())
+        {
+            GUObjectArray.Add(nullptr);
+        }
+
+        uint32 Index;
+        if (!GUObjectFreeIndices.IsEmpty())
+        {
+            Index = GUObjectFreeIndices.back();
+            GUObjectFreeIndices.pop_back();
+            GUObjectArray[Index] = Obj;
+        }
+        else
+        {
+            Index = static_cast<uint32>(GUObjectArray.Add(Obj));
+        }
+
+        if (Index >= static_cast<uint32>(GUObjectSerials.Num()))
+        {
+            GUObjectSerials.SetNum(static_cast<int32>(Index) + 1);
+            GUObjectSerials[Index] = 1;
+        }
+        Obj->InternalIndex = Index;
+
+        // 클래스별 목록 끝에 추가
+        TArray<UObject*>& ClassObjects = Obj->GetClass()->Objects;
+        Obj->ClassObjectIndex = static_cast<uint32>(ClassObjects.Add(Obj));
+    }
+
+    // 클래스별 목록에서 swap-remove (마지막 객체를 빈 자리로 옮김)
+    void UnlinkFromClassObjects(UObject* Obj)
+    {
+        TArray<UObject*>& ClassObjects = Obj->GetClass()->Objects;
+        const uint32 Index = Obj->ClassObjectIndex;
+        if (Index >= static_cast<uint32>(ClassObjects.Num()) || ClassObjects[Index] != Obj)
+        {
+            return;
+        }
+
+        UObject* Last = ClassObjects.back();
+        ClassObjects[Index] = Last;
+        Last->ClassObjectIndex = Index;
+        ClassObjects.pop_back();
+        Obj->ClassObjectIndex = UINT32_MAX;
+    }
+}
+
 namespace ObjectFactory
 {
     TMap<UClass*, ConstructFunc>& GetRegistry()
@@ -29,11 +87,7 @@ namespace ObjectFactory
         UObject* Obj = ConstructObject(Class);
         if (!Obj) return nullptr;
 
-        int32 idx = -1;
-
-        idx = GUObjectArray.Add(Obj);
-
-        Obj->InternalIndex = static_cast<uint32>(idx);
+        AllocateObjectSlot(Obj);
 
         static TMap<UClass*, int> NameCounters;
         int Count = ++NameCounters[Class];
@@ -55,11 +109,7 @@ namespace ObjectFactory
         if (!Obj) return nullptr;
 
         // 배열에 등록: 빈 슬롯 재사용
-        int32 idx = -1;
-
-        idx = GUObjectArray.Add(Obj);
-        //}
-        Obj->InternalIndex = static_cast<uint32>(idx);
+        AllocateObjectSlot(Obj);
 
         static TMap<UClass*, int> NameCounters;
         int Count = ++NameCounters[Class];
@@ -81,24 +131,20 @@ namespace ObjectFactory
     {
         if (!Obj) return;
 
-        // Important: DO NOT dereference Obj fields before verifying it is still in GUObjectArray.
-        int32 foundIndex = -1;
-        for (int32 i = 0; i < GUObjectArray.Num(); ++i)
+        // 등록 시 기록한 슬롯이 아직 이 객체를 가리키는지 확인 (등록되지 않은 객체는 무시)
+        // 이미 삭제된 객체를 다시 넘기는 것은 호출자 버그: 해제된 메모리에서 InternalIndex를 읽게 됨
+        const uint32 Index = Obj->InternalIndex;
+        if (Index >= static_cast<uint32>(GUObjectArray.Num()) || GUObjectArray[Index] != Obj)
         {
-            if (GUObjectArray[i] == Obj)
-            {
-                foundIndex = i;
-                break;
-            }
-        }
-        if (foundIndex < 0)
-        {
-            // Not managed or already deleted.
             return;
         }
 
-        GUObjectArray[foundIndex] = nullptr;
-        // Safe to delete now; Obj still valid since we found it in GUObjectArray
+        // 슬롯을 먼저 비우고 세대를 올림 (소멸자에서 생성/삭제가 일어나도 이 슬롯과 섞이지 않도록)
+        GUObjectArray[Index] = nullptr;
+        ++GUObjectSerials[Index];
+        GUObjectFreeIndices.Add(Index);
+        UnlinkFromClassObjects(Obj);
+
         Obj->DestroyInternal();
     }
 
@@ -114,26 +160,48 @@ namespace ObjectFactory
         }
         GUObjectArray.Empty();
         GUObjectArray.Shrink();
+        GUObjectFreeIndices.Empty();
+        GUObjectFreeIndices.Shrink();
     }
 
-    // (선택) null 슬롯 압축
+    // (선택) 끝쪽 null 슬롯 잘라내기
+    // 살아 있는 객체를 옮기면 InternalIndex와 약참조(인덱스, 세대)가 깨지므로 중간 빈 슬롯은 free list에 둠
     void CompactNullSlots()
     {
-        int32 write = 0;
-        for (int32 read = 0; read < GUObjectArray.Num(); ++read)
+        int32 NewNum = GUObjectArray.Num();
+        while (NewNum > 1 && GUObjectArray[NewNum - 1] == nullptr)
         {
-            if (UObject* Obj = GUObjectArray[read])
-            {
-                if (write != read)
-                {
-                    GUObjectArray[write] = Obj;
-                    Obj->InternalIndex = static_cast<uint32>(write);
-                    GUObjectArray[read] = nullptr;
-                }
-                ++write;
-            }
+            --NewNum;
+        }
+        if (NewNum == GUObjectArray.Num())
+        {
+            return;
         }
-        // 크기(Num) 축소 + 불필요한 capacity도 반환
-        GUObjectArray.SetNum(write);
+
+        GUObjectArray.SetNum(NewNum);
+        GUObjectArray.Shrink();
+        GUObjectFreeIndices.erase(
+            std::remove_if(GUObjectFreeIndices.begin(), GUObjectFreeIndices.end(),
+                [NewNum](uint32 Index) { return Index >= static_cast<uint32>(NewNum); }),
+            GUObjectFreeIndices.end());
+    }
+
+    uint32 GetObjectSerial(uint32 Index)
+    {
+        return Index < static_cast<uint32>(GUObjectSerials.Num()) ? GUObjectSerials[Index] : 0;
+    }
+
+    UObject* ResolveObject(uint32 Index, uint32 Serial)
+    {
+        if (Index >= static_cast<uint32>(GUObjectArray.Num()) || GUObjectSerials[Index] != Serial)
+        {
+            return nullptr;
+        }
+        return GUObjectArray[Index];
+    }
+
+    int32 GetNumFreeObjectSlots()
+    {
+        return GUObjectFreeIndices.Num();
     }
 }
@@ -5,6 +5,7 @@
 // ── 외부 심볼 ─────────────────────────────────────────────
 class UObject;
 struct UClass;
+// 인덱스 = UObject::InternalIndex. 삭제된 슬롯은 nullptr로 남고 free list로 재사용됨 (0번은 "객체 없음"으로 예약)
 extern TArray<UObject*> GUObjectArray;
 
 // ── ObjectFactory 네임스페이스 ─────────────────────────────
@@ -42,12 +43,20 @@ namespace ObjectFactory
         return static_cast<T*>(AddToGUObjectArray(T::StaticClass(), Dest));
     }
 
-    // 개별 삭제(단일 소유자: Factory)
+    // 개별 삭제(단일 소유자: Factory). InternalIndex로 슬롯을 바로 찾음 (O(1))
+    // Obj는 살아 있는 객체여야 함 (같은 포인터를 두 번 삭제하면 해제된 메모리를 읽음)
     void DeleteObject(UObject* Obj);
     // 종료시 일괄 정리
     void DeleteAll(bool bCallBeginDestroy = true);
-    // Null 슬롯 압축하여 배열 크기 축소
+    // 배열 끝쪽의 Null 슬롯만 잘라내 크기 축소 (중간 슬롯은 free list로 재사용되므로 옮기지 않음)
     void CompactNullSlots();
+
+    // 슬롯의 세대 번호. 슬롯의 객체가 삭제될 때마다 증가 (TWeakObjectPtr가 파괴를 감지하는 데 사용)
+    uint32 GetObjectSerial(uint32 Index);
+    // Index 슬롯에 Serial 세대의 객체가 아직 살아 있으면 반환, 아니면 nullptr
+    UObject* ResolveObject(uint32 Index, uint32 Serial);
+    // 재사용 대기 중인 빈 슬롯 수
+    int32 GetNumFreeObjectSlots();
 }
 
 // ── 등록 매크로 ─────────────────────────────────────────────
@@ -297,7 +297,7 @@ struct TPropertyTypeTraits
 		Prop.Category = CategoryName; \
 		Prop.bIsEditAnywhere = bEditAnywhere; \
 		Prop.Tooltip = "" __VA_ARGS__; \
-		Prop.Metadata.Add(FName("FileExtension"), InExtension); \
+		Prop.Metadata.Add(FName(FNameLiteral("FileExtension")), InExtension); \
 		Class->AddProperty(Prop); \
 	}
 
@@ -572,10 +572,13 @@ bool CPickingSystem::CheckGizmoComponentPicking(UStaticMeshComponent* Component,
 		GizmoComponent->SetDrawScale(ViewWidth, ViewHeight, ViewMatrix, ProjectionMatrix);
 	}
 
-	// Gizmo 메시는 FStaticMesh(쿠킹된 데이터)를 사용
-	FStaticMesh* StaticMesh = Component->GetStaticMesh()->GetStaticMeshAsset();
+	// Gizmo 메시는 UStaticMesh의 충돌용 위치/인덱스 스트림을 사용
+	UStaticMesh* StaticMesh = Component->GetStaticMesh();
 
-	if (!StaticMesh) return false;
+	if (!StaticMesh || !StaticMesh->HasMeshData()) return false;
+
+	const TArray<FVector>& Positions = StaticMesh->GetCollisionPositions();
+	const TArray<uint32>& Indices = StaticMesh->GetCollisionIndices();
 
 	// 피킹 계산에는 컴포넌트의 월드 변환 행렬 사용
 	FMatrix WorldMatrix = Component->GetWorldMatrix();
@@ -585,18 +588,14 @@ bool CPickingSystem::CheckGizmoComponentPicking(UStaticMeshComponent* Component,
 	bool bHasHit = false;
 
 	// 인덱스가 있는 경우: 인덱스 삼각형 집합 검사
-	if (StaticMesh->Indices.Num() >= 3)
+	if (Indices.Num() >= 3)
 	{
-		uint32 IndexNum = StaticMesh->Indices.Num();
+		uint32 IndexNum = Indices.Num();
 		for (uint32 Idx = 0; Idx + 2 < IndexNum; Idx += 3)
 		{
-			const FNormalVertex& V0N = StaticMesh->Vertices[StaticMesh->Indices[Idx + 0]];
-			const FNormalVertex& V1N = StaticMesh->Vertices[StaticMesh->Indices[Idx + 1]];
-			const FNormalVertex& V2N = StaticMesh->Vertices[StaticMesh->Indices[Idx + 2]];
-
-			FVector A = V0N.pos * WorldMatrix;
-			FVector B = V1N.pos * WorldMatrix;
-			FVector C = V2N.pos * WorldMatrix;
+			FVector A = Positions[Indices[Idx + 0]] * WorldMatrix;
+			FVector B = Positions[Indices[Idx + 1]] * WorldMatrix;
+			FVector C = Positions[Indices[Idx + 2]] * WorldMatrix;
 
 			float THit;
 			if (IntersectRayTriangleMT(Ray, A, B, C, THit))
@@ -611,18 +610,14 @@ bool CPickingSystem::CheckGizmoComponentPicking(UStaticMeshComponent* Component,
 		}
 	}
 	// 인덱스가 없는 경우: 정점 배열을 순차적 삼각형으로 간주
-	else if (StaticMesh->Vertices.Num() >= 3)
+	else if (Positions.Num() >= 3)
 	{
-		uint32 VertexNum = StaticMesh->Vertices.Num();
+		uint32 VertexNum = Positions.Num();
 		for (uint32 Idx = 0; Idx + 2 < VertexNum; Idx += 3)
 		{
-			const FNormalVertex& V0N = StaticMesh->Vertices[Idx + 0];
-			const FNormalVertex& V1N = StaticMesh->Vertices[Idx + 1];
-			const FNormalVertex& V2N = StaticMesh->Vertices[Idx + 2];
-
-			FVector A = V0N.pos * WorldMatrix;
-			FVector B = V1N.pos * WorldMatrix;
-			FVector C = V2N.pos * WorldMatrix;
+			FVector A = Positions[Idx + 0] * WorldMatrix;
+			FVector B = Positions[Idx + 1] * WorldMatrix;
+			FVector C = Positions[Idx + 2] * WorldMatrix;
 
 			float THit;
 			if (IntersectRayTriangleMT(Ray, A, B, C, THit))
@@ -658,10 +653,10 @@ bool CPickingSystem::CheckActorPicking(const AActor* Actor, const FRay& Ray, flo
 		if (UStaticMeshComponent* StaticMeshComponent = Cast<UStaticMeshComponent>(SceneComponent))
 		{
 			UStaticMesh* MeshRes = StaticMeshComponent->GetStaticMesh();
-			if (!MeshRes) continue;
+			if (!MeshRes || !MeshRes->HasMeshData()) continue;
 
-			FStaticMesh* StaticMesh = MeshRes->GetStaticMeshAsset();
-			if (!StaticMesh) continue;
+			const TArray<FVector>& Positions = MeshRes->GetCollisionPositions();
+			const TArray<uint32>& Indices = MeshRes->GetCollisionIndices();
 
 			// 로컬 공간에서의 레이로 변환
 			const FMatrix WorldMatrix = StaticMeshComponent->GetWorldMatrix();
@@ -673,11 +668,11 @@ bool CPickingSystem::CheckActorPicking(const AActor* Actor, const FRay& Ray, flo
 			const FRay LocalRay{ FVector(LocalOrigin4.X, LocalOrigin4.Y, LocalOrigin4.Z), FVector(LocalDir4.X, LocalDir4.Y, LocalDir4.Z) };
 
 			// 캐시된 BVH 사용 (동일 OBJ 경로는 동일 BVH 공유)
-			FMeshBVH* BVH = UResourceManager::GetInstance().GetOrBuildMeshBVH(MeshRes->GetAssetPathFileName(), StaticMesh);
+			FMeshBVH* BVH = UResourceManager::GetInstance().GetOrBuildMeshBVH(MeshRes->GetAssetPathFileName(), Positions, Indices);
 			if (BVH)
 			{
 				float THitLocal;
-				if (BVH->IntersectRay(LocalRay, StaticMesh->Vertices, StaticMesh->Indices, THitLocal))
+				if (BVH->IntersectRay(LocalRay, Positions, Indices, THitLocal))
 				{
 					const FVector HitLocal = FVector(
 						LocalOrigin4.X + LocalDir4.X * THitLocal,
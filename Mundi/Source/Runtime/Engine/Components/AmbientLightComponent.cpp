@@ -56,6 +56,7 @@ void UAmbientLightComponent::OnUnregister()
             World->GetLightManager()->DeRegisterLight(this);
         }
     }
+    Super::OnUnregister();
 }
 
 void UAmbientLightComponent::Serialize(const bool bInIsLoading, JSON& InOutHandle)
@@ -10,6 +10,9 @@ class UBoneAnchorComponent : public USceneComponent
 public:
     DECLARE_CLASS(UBoneAnchorComponent, USceneComponent)
 
+    // 기즈모 조작을 같은 프레임에 본에 되써야 하므로 변경 알림을 미루지 않음
+    UBoneAnchorComponent() { bDeferTransformUpdates = false; }
+
     void SetTarget(USkeletalMeshComponent* InTarget, int32 InBoneIndex);
     void SetBoneIndex(int32 InBoneIndex) { BoneIndex = InBoneIndex; }
     int32 GetBoneIndex() const { return BoneIndex; }
@@ -216,6 +216,7 @@ void UDirectionalLightComponent::OnUnregister()
             World->GetLightManager()->DeRegisterLight(this);
         }
     }
+    Super::OnUnregister();
 }
 
 void UDirectionalLightComponent::UpdateLightData()
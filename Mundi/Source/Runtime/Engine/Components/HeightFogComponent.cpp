@@ -47,16 +47,10 @@ void UHeightFogComponent::RenderHeightFog(URenderer* Renderer)
 void UHeightFogComponent::Serialize(const bool bInIsLoading, JSON& InOutHandle)
 {
 	Super::Serialize(bInIsLoading, InOutHandle);
+	// FogDensity, FogHeightFalloff, StartDistance, FogCutoffDistance, FogMaxOpacity, FogInscatteringColor는
+	// UPROPERTY라 Super(리플렉션)에서 처리됨
 	if (bInIsLoading)
 	{
-		// Load FogInscatteringColor
-		if (InOutHandle.hasKey("FogInscatteringColor"))
-		{
-			FVector4 ColorVec;
-			FJsonSerializer::ReadVector4(InOutHandle, "FogInscatteringColor", ColorVec);
-			FogInscatteringColor = FLinearColor(ColorVec);
-		}
-
 		// Load HeightFogShader
 		if (InOutHandle.hasKey("HeightFogShader"))
 		{
@@ -66,22 +60,9 @@ void UHeightFogComponent::Serialize(const bool bInIsLoading, JSON& InOutHandle)
 				HeightFogShader = UResourceManager::GetInstance().Load<UShader>(shaderPath.c_str());
 			}
 		}
-
-		// FogDensity, FogHeightFalloff, StartDistance, FogCutoffDistance, FogMaxOpacity도 로드
-		FJsonSerializer::ReadFloat(InOutHandle, "FogDensity", FogDensity, 0.2f);
-		FJsonSerializer::ReadFloat(InOutHandle, "FogHeightFalloff", FogHeightFalloff, 0.2f);
-		FJsonSerializer::ReadFloat(InOutHandle, "StartDistance", StartDistance, 0.0f);
-		FJsonSerializer::ReadFloat(InOutHandle, "FogCutoffDistance", FogCutoffDistance, 6000.0f);
-		FJsonSerializer::ReadFloat(InOutHandle, "FogMaxOpacity", FogMaxOpacity, 1.0f);
 	}
 	else
 	{
-		// Save FogInscatteringColor
-		if (FogInscatteringColor != FLinearColor::Zero())
-		{
-			InOutHandle["FogInscatteringColor"] = FJsonSerializer::Vector4ToJson(FogInscatteringColor.ToFVector4());
-		}
-
 		// Save HeightFogShader
 		if (HeightFogShader != nullptr)
 		{
@@ -91,13 +72,6 @@ void UHeightFogComponent::Serialize(const bool bInIsLoading, JSON& InOutHandle)
 		{
 			InOutHandle["HeightFogShader"] = "";
 		}
-
-		// FogDensity, FogHeightFalloff, StartDistance, FogCutoffDistance, FogMaxOpacity도 저장
-		InOutHandle["FogDensity"] = FogDensity;
-		InOutHandle["FogHeightFalloff"] = FogHeightFalloff;
-		InOutHandle["StartDistance"] = StartDistance;
-		InOutHandle["FogCutoffDistance"] = FogCutoffDistance;
-		InOutHandle["FogMaxOpacity"] = FogMaxOpacity;
 	}
 }
 
@@ -165,14 +165,9 @@ void UPerspectiveDecalComponent::DuplicateSubObjects()
 void UPerspectiveDecalComponent::Serialize(const bool bInIsLoading, JSON& InOutHandle)
 {
 	Super::Serialize(bInIsLoading, InOutHandle);
+	// FovY 값은 UPROPERTY라 Super(리플렉션)에서 읽고 씀. 로드 후 스케일만 다시 맞춤
 	if (bInIsLoading)
 	{
-		float FovYTemp;
-		FJsonSerializer::ReadFloat(InOutHandle, "FovY", FovYTemp);
-		SetFovY(FovYTemp);
-	}
-	else
-	{
-		InOutHandle["FovY"] = GetFovY();
+		SetFovY(FovY);
 	}
 }
@@ -6,6 +6,7 @@
 #include "PrimitiveComponent.h"
 #include "WorldPartitionManager.h"
 #include "BillboardComponent.h"
+#include "World.h"
 // IMPLEMENT_CLASS is now auto-generated in .generated.cpp
 // USceneComponent.cpp
 TMap<uint32, USceneComponent*> USceneComponent::SceneIdMap;
@@ -45,14 +46,14 @@ USceneComponent::~USceneComponent()
 }
 
 // ──────────────────────────────
-// Relative API 더티플래그 사용해서 업데이트 하도록 수정할 것임.
-// 그리고 bWantsOnUpdateTransform이 True일때만 OnTransformUpdated호출
+// Relative API
+// 월드 트랜스폼 캐시는 바로 무효화하고, OnTransformUpdated는 프레임당 한 번으로 모아서 호출
 // ──────────────────────────────
 void USceneComponent::SetRelativeLocation(const FVector& NewLocation)
 {
     RelativeLocation = NewLocation;
     UpdateRelativeTransform();
-    OnTransformUpdated();
+    RequestTransformUpdate();
 }
 FVector USceneComponent::GetRelativeLocation() const { return RelativeLocation; }
 
@@ -61,7 +62,7 @@ void USceneComponent::SetRelativeRotation(const FQuat& NewRotation)
     RelativeRotation = NewRotation;
     RelativeRotationEuler = NewRotation.ToEulerZYXDeg(); // Euler 동기화
     UpdateRelativeTransform();
-    OnTransformUpdated();
+    RequestTransformUpdate();
 }
 FQuat USceneComponent::GetRelativeRotation() const { return RelativeRotation; }
 
@@ -75,7 +76,7 @@ void USceneComponent::SetRelativeRotationEuler(const FVector& EulerDegrees)
 
     // Euler 재계산 하지 않음 - UI에서 입력한 값을 그대로 유지
     UpdateRelativeTransform();
-    OnTransformUpdated();
+    RequestTransformUpdate();
 }
 
 FVector USceneComponent::GetRelativeRotationEuler() const
@@ -88,7 +89,7 @@ void USceneComponent::SetRelativeScale(const FVector& NewScale)
 {
     RelativeScale = NewScale;
     UpdateRelativeTransform();
-    OnTransformUpdated();
+    RequestTransformUpdate();
 }
 FVector USceneComponent::GetRelativeScale() const { return RelativeScale; }
 
@@ -96,7 +97,7 @@ void USceneComponent::AddRelativeLocation(const FVector& DeltaLocation)
 {
     RelativeLocation = RelativeLocation + DeltaLocation;
     UpdateRelativeTransform();
-    OnTransformUpdated();
+    RequestTransformUpdate();
 }
 
 void USceneComponent::AddRelativeRotation(const FQuat& DeltaRotation)
@@ -104,7 +105,7 @@ void USceneComponent::AddRelativeRotation(const FQuat& DeltaRotation)
     RelativeRotation = DeltaRotation * RelativeRotation;
     RelativeRotationEuler = RelativeRotation.ToEulerZYXDeg(); // Euler 동기화
     UpdateRelativeTransform();
-    OnTransformUpdated();
+    RequestTransformUpdate();
 }
 
 void USceneComponent::AddRelativeScale3D(const FVector& DeltaScale)
@@ -113,7 +114,7 @@ void USceneComponent::AddRelativeScale3D(const FVector& DeltaScale)
         RelativeScale.Y * DeltaScale.Y,
         RelativeScale.Z * DeltaScale.Z);
     UpdateRelativeTransform();
-    OnTransformUpdated();
+    RequestTransformUpdate();
 }
 
 // ──────────────────────────────
@@ -121,13 +122,22 @@ void USceneComponent::AddRelativeScale3D(const FVector& DeltaScale)
 // ──────────────────────────────
 FTransform USceneComponent::GetWorldTransform() const
 {
-    // Dangling pointer 방지를 위한 체크 
-    if (AttachParent && !AttachParent->IsPendingDestroy())
+    // 더러운 경우에만 계산. 부모도 캐시를 쓰므로 더러운 조상까지만 올라감
+    if (bWorldTransformDirty)
     {
-        return AttachParent->GetWorldTransform().GetWorldTransform(RelativeTransform);
+        // Dangling pointer 방지를 위한 체크 
+        if (AttachParent && !AttachParent->IsPendingDestroy())
+        {
+            CachedWorldTransform = AttachParent->GetWorldTransform().GetWorldTransform(RelativeTransform);
+        }
+        else
+        {
+            CachedWorldTransform = RelativeTransform;
+        }
+        bWorldTransformDirty = false;
     }
 
-    return RelativeTransform;
+    return CachedWorldTransform;
 }
 
 void USceneComponent::SetWorldTransform(const FTransform& W)
@@ -147,7 +157,8 @@ void USceneComponent::SetWorldTransform(const FTransform& W)
     RelativeRotation = RelativeTransform.Rotation;
     RelativeRotationEuler = RelativeRotation.ToEulerZYXDeg(); // Euler 동기화
     RelativeScale = RelativeTransform.Scale3D;
-    OnTransformUpdated();
+    InvalidateWorldTransform();
+    RequestTransformUpdate();
 }
  
 void USceneComponent::SetWorldLocation(const FVector& L)
@@ -249,7 +260,7 @@ void USceneComponent::AddLocalOffset(const FVector& Delta)
     const FVector parentDelta = RelativeRotation.RotateVector(Delta);
     RelativeLocation = RelativeLocation + parentDelta;
     UpdateRelativeTransform();
-    OnTransformUpdated();
+    RequestTransformUpdate();
 }
 
 void USceneComponent::AddLocalRotation(const FQuat& DeltaRot)
@@ -257,7 +268,7 @@ void USceneComponent::AddLocalRotation(const FQuat& DeltaRot)
     RelativeRotation = (RelativeRotation * DeltaRot).GetNormalized(); // 로컬: 우측곱
     RelativeRotationEuler = RelativeRotation.ToEulerZYXDeg(); // Euler 동기화
     UpdateRelativeTransform();
-    OnTransformUpdated();
+    RequestTransformUpdate();
 }
 
 void USceneComponent::SetLocalLocationAndRotation(const FVector& L, const FQuat& R)
@@ -266,7 +277,7 @@ void USceneComponent::SetLocalLocationAndRotation(const FVector& L, const FQuat&
     RelativeRotation = R.GetNormalized();
     RelativeRotationEuler = RelativeRotation.ToEulerZYXDeg(); // Euler 동기화
     UpdateRelativeTransform();
-    OnTransformUpdated();
+    RequestTransformUpdate();
 }
 
 
@@ -318,6 +329,7 @@ void USceneComponent::SetupAttachment(USceneComponent* InParent, EAttachmentRule
     RelativeLocation = RelativeTransform.Translation;
     RelativeRotation = RelativeTransform.Rotation;
     RelativeScale = RelativeTransform.Scale3D;
+    InvalidateWorldTransform();
 }
 
 void USceneComponent::DetachFromParent(bool bKeepWorld)
@@ -337,9 +349,10 @@ void USceneComponent::DetachFromParent(bool bKeepWorld)
     RelativeLocation = RelativeTransform.Translation;
     RelativeRotation = RelativeTransform.Rotation;
     RelativeScale = RelativeTransform.Scale3D;
+    InvalidateWorldTransform();
 
     // Notify transform update so shapes can refresh overlaps
-    OnTransformUpdated();
+    PropagateTransformUpdate();
 }
 
 void USceneComponent::DuplicateSubObjects()
@@ -349,6 +362,11 @@ void USceneComponent::DuplicateSubObjects()
     AttachParent = nullptr; // 부모 컴포넌트가 이 객체의 SetupAttachment를 호출할 경우, 불필요한 로직(기존 부모에서 제거) 수행 방지
     SpriteComponent = nullptr;
     AttachChildren.clear(); // Actor에서 할당해줌
+
+    // 원본의 캐시/대기 상태가 얕은 복사됐으므로 초기화
+    bWorldTransformDirty = true;
+    bIsTransformDirty = true;
+    bTransformUpdatePending = false;
 }
 
 // ──────────────────────────────
@@ -357,6 +375,136 @@ void USceneComponent::DuplicateSubObjects()
 void USceneComponent::UpdateRelativeTransform()
 {
     RelativeTransform = FTransform(RelativeLocation, RelativeRotation, RelativeScale);
+    InvalidateWorldTransform();
+}
+
+void USceneComponent::InvalidateWorldTransform()
+{
+    if (bWorldTransformDirty)
+    {
+        // 불변식상 자손도 이미 모두 더러움
+        return;
+    }
+
+    TArray<USceneComponent*, TInlineAllocator<32>> Stack;
+    Stack.Add(this);
+    while (!Stack.IsEmpty())
+    {
+        USceneComponent* Component = Stack.Pop();
+        Component->bWorldTransformDirty = true;
+        Component->bIsTransformDirty = true;
+        for (USceneComponent* Child : Component->AttachChildren)
+        {
+            if (Child && !Child->bWorldTransformDirty)
+            {
+                Stack.Add(Child);
+            }
+        }
+    }
+}
+
+void USceneComponent::RequestTransformUpdate()
+{
+    if (bTransformUpdatePending)
+    {
+        // 이번 프레임에 이미 대기 중 (같은 프레임의 세터 여러 번 → 알림 한 번)
+        return;
+    }
+
+    UWorld* World = GetWorld();
+    if (!bDeferTransformUpdates || !IsRegistered() || IsPendingDestroy() || !World || World->IsTearingDown())
+    {
+        PropagateTransformUpdate();
+        return;
+    }
+
+    bTransformUpdatePending = true;
+    World->GetPendingTransformUpdates().Add(this);
+}
+
+void USceneComponent::PropagateTransformUpdate()
+{
+    // 부모 → 자식 순(전위 순회). 재귀 대신 명시적 스택 사용
+    // 콜백이 스택에 쌓인 다른 컴포넌트를 삭제할 수 있으므로 원시 포인터 대신 약한 참조로 보관
+    TArray<TWeakObjectPtr<USceneComponent>, TInlineAllocator<32>> Stack;
+    Stack.Add(TWeakObjectPtr<USceneComponent>(this));
+    while (!Stack.IsEmpty())
+    {
+        const TWeakObjectPtr<USceneComponent> ComponentRef = Stack.Pop();
+        USceneComponent* Component = ComponentRef.Get();
+        if (!Component || Component->IsPendingDestroy())
+        {
+            continue;
+        }
+
+        Component->OnTransformUpdated();
+
+        // 자기 콜백에서 삭제됐을 수 있음
+        Component = ComponentRef.Get();
+        if (!Component)
+        {
+            continue;
+        }
+
+        // 콜백이 자식 목록을 바꿀 수 있으므로 호출 후에 자식을 쌓음. 역순으로 쌓아 원래 순서대로 방문
+        const TArray<USceneComponent*>& Children = Component->AttachChildren;
+        for (int32 Index = Children.Num() - 1; Index >= 0; --Index)
+        {
+            if (Children[Index])
+            {
+                Stack.Add(TWeakObjectPtr<USceneComponent>(Children[Index]));
+            }
+        }
+    }
+}
+
+void USceneComponent::FlushPendingTransformUpdates(TArray<USceneComponent*>& Pending)
+{
+    constexpr int32 MaxPasses = 4;
+
+    TArray<USceneComponent*> Batch;
+    TArray<TWeakObjectPtr<USceneComponent>> Roots;
+    for (int32 Pass = 0; Pass < MaxPasses && !Pending.IsEmpty(); ++Pass)
+    {
+        // 콜백에서 새로 올라오는 요청은 Pending에 쌓여 다음 패스로 넘어감
+        Batch.swap(Pending);
+        Pending.clear();
+
+        // 조상도 대기 중이면 조상의 서브트리 순회에서 함께 알림을 받음
+        Roots.clear();
+        for (USceneComponent* Component : Batch)
+        {
+            bool bHasPendingAncestor = false;
+            for (USceneComponent* Parent = Component->AttachParent; Parent; Parent = Parent->AttachParent)
+            {
+                if (Parent->bTransformUpdatePending)
+                {
+                    bHasPendingAncestor = true;
+                    break;
+                }
+            }
+            if (!bHasPendingAncestor)
+            {
+                Roots.Add(TWeakObjectPtr<USceneComponent>(Component));
+            }
+        }
+
+        // 콜백 전에 대기 표시를 지워야 콜백 안의 변경이 다시 대기열에 올라감
+        for (USceneComponent* Component : Batch)
+        {
+            Component->bTransformUpdatePending = false;
+        }
+
+        // 앞선 루트의 콜백이 뒤 루트를 삭제하거나 등록 해제할 수 있음 (이미 대기열에서 빠져 OnUnregister가 못 지움)
+        for (const TWeakObjectPtr<USceneComponent>& RootRef : Roots)
+        {
+            USceneComponent* Root = RootRef.Get();
+            if (Root && Root->IsRegistered() && !Root->IsPendingDestroy())
+            {
+                Root->PropagateTransformUpdate();
+            }
+        }
+    }
 }
 
 void USceneComponent::Serialize(const bool bInIsLoading, JSON& InOutHandle)
@@ -376,7 +524,7 @@ void USceneComponent::Serialize(const bool bInIsLoading, JSON& InOutHandle)
 
         // 해당 객체의 Transform을 위에서 읽은 값을 기반으로 변경 후, 자식에게 전파
         UpdateRelativeTransform();
-        OnTransformUpdated();
+        PropagateTransformUpdate();
 	}
 	else
 	{
@@ -404,16 +552,32 @@ void USceneComponent::OnRegister(UWorld* InWorld)
     }
 
     // Notify transform update so shapes can refresh overlaps
-    OnTransformUpdated();
+    PropagateTransformUpdate();
 }
 
-void USceneComponent::OnTransformUpdated()
+void USceneComponent::OnUnregister()
 {
-    bIsTransformDirty = true;
-    for (USceneComponent* Child : GetAttachChildren())
+    // 대기열에 남아 있으면 삭제 후 접근하지 않도록 빼냄
+    if (bTransformUpdatePending)
     {
-        Child->OnTransformUpdated();
+        if (UWorld* World = GetWorld())
+        {
+            TArray<USceneComponent*>& Pending = World->GetPendingTransformUpdates();
+            const int32 PendingIndex = Pending.Find(this);
+            if (PendingIndex != -1)
+            {
+                Pending.RemoveAtSwap(PendingIndex);
+            }
+        }
+        bTransformUpdatePending = false;
     }
+
+    Super::OnUnregister();
+}
+
+void USceneComponent::OnTransformUpdated()
+{
+    // 캐시 무효화는 세터에서 이미 처리됨 (InvalidateWorldTransform). 파생 클래스의 알림 지점
 }
 
 UWorld* USceneComponent::GetWorld()
@@ -91,14 +91,29 @@ public:
     void SetParent(USceneComponent* InParent)
     {
         AttachParent = InParent;
+        InvalidateWorldTransform();
     }
 
     // Serialize
     void Serialize(const bool bInIsLoading, JSON& InOutHandle) override;
     void OnRegister(UWorld* InWorld) override;
+    void OnUnregister() override;
 
+    /**
+     * @brief 트랜스폼 변경 알림 (파티션 MarkDirty, 라이트 갱신 등).
+     * @note 월드에 등록된 컴포넌트는 세터마다 바로 불리지 않고 프레임당 한 번, 부모 → 자식 순으로
+     * 불립니다 (FlushPendingTransformUpdates). 자식에게 전파하지 않으므로 오버라이드에서 자식을 순회할 필요 없음.
+     */
     virtual void OnTransformUpdated();
 
+    /**
+     * @brief 월드에 쌓인 트랜스폼 변경 알림을 처리. UWorld가 틱 끝과 렌더 직전에 호출함
+     * @note 조상이 함께 대기 중인 컴포넌트는 조상의 서브트리 순회에 포함되므로 따로 처리하지 않음.
+     * 콜백에서 다시 트랜스폼을 바꾸면 다음 패스에서 처리 (서로 계속 바꾸는 경우를 막기 위해 패스 수 제한).
+     * 콜백이 대기 중인 다른 컴포넌트를 삭제/등록 해제하면 그 컴포넌트는 건너뜀 (약한 참조로 확인)
+     */
+    static void FlushPendingTransformUpdates(TArray<USceneComponent*>& Pending);
+
     // SceneId
     uint32 GetSceneId() const { return SceneId; }
     void SetSceneId(uint32 InId) { SceneId = InId; }
@@ -125,17 +140,32 @@ protected:
     //virtual void OnTransformUpdatedChildImpl();
     
     /**
-     * @brief Transform 갱신시 자식 컴포넌트의 OnTransformUpdated를 강제 호출.
+     * @brief 자신과 모든 자손의 OnTransformUpdated를 부모 → 자식 순으로 즉시 호출.
      * @note 부모 컴포넌트의 트랜스폼 변화로 인해 월드 관점에서 생길 영향을 처리하기 위한 메소드로,
      * 자식 컴포넌트들의 로컬 트랜스폼을 직접 변경시키지 않습니다. 
      */
-   // void PropagateTransformUpdate();
+    void PropagateTransformUpdate();
+
+    /**
+     * @brief 세터에서 호출. 월드에 등록돼 있으면 알림을 월드 대기열에 한 번만 올리고(프레임 끝에 처리),
+     * 아니면 PropagateTransformUpdate로 바로 알림
+     */
+    void RequestTransformUpdate();
+
+    /** @brief 자신과 자손의 월드 트랜스폼 캐시를 무효화. 이미 더러운 노드 아래는 이미 더러우므로 거기서 멈춤 */
+    void InvalidateWorldTransform();
 
     //Component 위치 나타내기 위함
     UBillboardComponent* SpriteComponent = nullptr;
 
     bool bWantsOnUpdateTransform = false;
 
+    // false면 월드에 등록돼 있어도 세터에서 바로 알림 (변경을 다른 객체에 즉시 되써야 하는 에디터 프록시 등)
+    bool bDeferTransformUpdates = true;
+
+    // 월드 트랜스폼 변경 알림이 월드 대기열에 올라가 있는지
+    bool bTransformUpdatePending = false;
+
     UPROPERTY(EditAnywhere, Category="렌더링")
     bool bIsVisible = true;
 
@@ -152,7 +182,10 @@ protected:
     UPROPERTY(EditAnywhere, Category="Transform")
     FVector RelativeRotationEuler{ 0,0,0 };
 
+    // 월드 트랜스폼/행렬 캐시. 불변식: 캐시가 깨끗한 노드의 조상은 모두 깨끗함 (더러운 노드의 자손은 모두 더러움)
+    mutable FTransform CachedWorldTransform;
     mutable FMatrix CachedWorldMatrix = FMatrix::Identity();
+    mutable bool bWorldTransformDirty = true;
     mutable bool bIsTransformDirty = true;
     
     // Hierarchy
@@ -230,13 +230,10 @@ void USkeletalMeshComponent::UpdateFinalSkinningMatrices()
     // 본 행렬 계산 시간 측정 시작
     uint64 BoneMatrixCalcStart = FWindowsPlatformTime::Cycles64();
 
-    for (int32 BoneIndex = 0; BoneIndex < NumBones; ++BoneIndex)
-    {
-        const FMatrix& InvBindPose = Skeleton.Bones[BoneIndex].InverseBindPose;
-        const FMatrix ComponentPoseMatrix = CurrentComponentSpacePose[BoneIndex].ToMatrix();
-
-        TempFinalSkinningMatrices[BoneIndex] = InvBindPose * ComponentPoseMatrix;
-    }
+    // InverseBindPose * ComponentPose.ToMatrix()
+    FTransformBatch::MultiplyByTransforms(
+        [&Skeleton](int32 BoneIndex) -> const FMatrix& { return Skeleton.Bones[BoneIndex].InverseBindPose; },
+        CurrentComponentSpacePose.GetData(), TempFinalSkinningMatrices.GetData(), NumBones);
 
     // 본 행렬 계산 시간 측정 종료
     uint64 BoneMatrixCalcEnd = FWindowsPlatformTime::Cycles64();
@@ -179,9 +179,18 @@ void USkinnedMeshComponent::CollectMeshBatches(TArray<FMeshBatchElement>& OutMes
        if (bUseGPU)
        {
           FShaderMacro GPUSkinningMacro;
-          GPUSkinningMacro.Name = FName("GPU_SKINNING");
-          GPUSkinningMacro.Definition = FName("1");
+          GPUSkinningMacro.Name = FNameLiteral("GPU_SKINNING");
+          GPUSkinningMacro.Definition = FNameLiteral("1");
           ShaderMacros.Add(GPUSkinningMacro);
+
+          // 압축 정점은 GPU 스키닝 버퍼에만 그대로 올라감 (CPU 스키닝 결과는 항상 FVertexDynamic)
+          if (SkeletalMesh->HasCompactVertices())
+          {
+             FShaderMacro CompactVertexMacro;
+             CompactVertexMacro.Name = FNameLiteral("COMPACT_VERTEX");
+             CompactVertexMacro.Definition = FNameLiteral("1");
+             ShaderMacros.Add(CompactVertexMacro);
+          }
        }
 
        FShaderVariant* ShaderVariant = ShaderToUse->GetOrCompileShaderVariant(ShaderMacros);
@@ -199,7 +208,7 @@ void USkinnedMeshComponent::CollectMeshBatches(TArray<FMeshBatchElement>& OutMes
        if (bUseGPU)
        {
           BatchElement.VertexBuffer = GPUSkinnedVertexBuffer;
-          BatchElement.VertexStride = sizeof(FSkinnedVertex);
+          BatchElement.VertexStride = SkeletalMesh->GetGPUSkinnedVertexStride();
        }
        else
        {
@@ -328,7 +337,9 @@ void USkinnedMeshComponent::PerformSkinning(bool bUseGPU)
 
    FSkinningStatManager& StatManager = FSkinningStatManager::GetInstance();
    const TArray<FSkinnedVertex>& SrcVertices = SkeletalMesh->GetSkeletalMeshData()->Vertices;
-   const int32 NumVertices = SrcVertices.Num();
+   const TArray<FPackedSkinnedVertex>& PackedVertices = SkeletalMesh->GetPackedVertices();
+   const bool bCompactVertices = SkeletalMesh->HasCompactVertices();
+   const int32 NumVertices = static_cast<int32>(SkeletalMesh->GetVertexCount());
    const int32 NumBones = FinalSkinningMatrices.Num();
 
    if (bUseGPU)
@@ -373,14 +384,22 @@ void USkinnedMeshComponent::PerformSkinning(bool bUseGPU)
          SkeletalMesh->CreateVertexBuffer(&VertexBuffer);
       }
 
+      // CPU 스키닝 결과는 버텍스 버퍼에 올리고 나면 필요 없으므로 프레임 할당기에서 받음 (컴포넌트마다 정점 배열을 들고 있지 않음)
+      TArray<FNormalVertex, TFrameAllocator<FNormalVertex>> SkinnedVertices;
       SkinnedVertices.SetNum(NumVertices);
 
       // CPU 버텍스 스키닝 계산 시간 측정
       uint64 VertexSkinningStart = FWindowsPlatformTime::Cycles64();
 
+      FSkinnedVertex DecodedVert;
       for (int32 Idx = 0; Idx < NumVertices; ++Idx)
       {
-         const FSkinnedVertex& SrcVert = SrcVertices[Idx];
+         // 압축 메시는 정점마다 전체 정밀도로 복원해서 스키닝
+         if (bCompactVertices)
+         {
+            DecodedVert = PackedVertices[Idx].Decode();
+         }
+         const FSkinnedVertex& SrcVert = bCompactVertices ? DecodedVert : SrcVertices[Idx];
          FNormalVertex& DstVert = SkinnedVertices[Idx];
 
          DstVert.pos = SkinVertexPosition(SrcVert);
@@ -397,7 +416,7 @@ void USkinnedMeshComponent::PerformSkinning(bool bUseGPU)
 
       if (VertexBuffer)
       {
-         SkeletalMesh->UpdateVertexBuffer(SkinnedVertices, VertexBuffer);
+         SkeletalMesh->UpdateVertexBuffer(SkinnedVertices.GetData(), SkinnedVertices.Num(), VertexBuffer);
       }
 
       uint64 BufferUploadEnd = FWindowsPlatformTime::Cycles64();
@@ -505,8 +524,8 @@ void USkinnedMeshComponent::UpdateBoneMatrixBuffer()
    // D3D11 상수 버퍼는 16바이트 정렬 필수
    const int32 AlignedBufferSize = ((RawBufferSize + 15) / 16) * 16;
 
-   // 동적 배열로 본 행렬 데이터 준비
-   TArray<FMatrix> BufferData;
+   // 동적 배열로 본 행렬 데이터 준비 (업로드 후 버리므로 프레임 할당)
+   TArray<FMatrix, TFrameAllocator<FMatrix>> BufferData;
    BufferData.SetNum(NumBones);
    for (int32 i = 0; i < NumBones; ++i)
    {
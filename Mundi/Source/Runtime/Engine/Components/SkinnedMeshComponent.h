@@ -58,11 +58,6 @@ protected:
     UPROPERTY(EditAnywhere, Category = "Skeletal Mesh", Tooltip = "Skeletal mesh asset to render")
     USkeletalMesh* SkeletalMesh;
 
-    /**
-     * @brief CPU 스키닝 최종 결과물. 렌더러가 이 데이터를 사용합니다.
-     */
-    TArray<FNormalVertex> SkinnedVertices;
-
 private:
     FVector SkinVertexPosition(const FSkinnedVertex& InVertex) const;
     FVector SkinVertexNormal(const FSkinnedVertex& InVertex) const;
@@ -31,12 +31,14 @@ void UStaticMeshComponent::OnStaticMeshReleased(UStaticMesh* ReleasedMesh)
 
 void UStaticMeshComponent::CollectMeshBatches(TArray<FMeshBatchElement>& OutMeshBatchElements, const FSceneView* View)
 {
-	if (!StaticMesh || !StaticMesh->GetStaticMeshAsset())
+	if (!StaticMesh || !StaticMesh->HasMeshData())
 	{
 		return;
 	}
 
-	const TArray<FGroupInfo>& MeshGroupInfos = StaticMesh->GetMeshGroupInfo();
+	const int32 LODIndex = SelectLOD(View);
+	const TArray<FGroupInfo>& MeshGroupInfos = StaticMesh->GetLODGroupInfos(LODIndex);
+	const uint32 LODIndexOffset = StaticMesh->GetLODIndexOffset(LODIndex);
 
 	auto DetermineMaterialAndShader = [&](uint32 SectionIndex) -> TPair<UMaterialInterface*, UShader*>
 		{
@@ -76,7 +78,7 @@ void UStaticMeshComponent::CollectMeshBatches(TArray<FMeshBatchElement>& OutMesh
 		{
 			const FGroupInfo& Group = MeshGroupInfos[SectionIndex];
 			IndexCount = Group.IndexCount;
-			StartIndex = Group.StartIndex;
+			StartIndex = LODIndexOffset + Group.StartIndex;
 		}
 		else
 		{
@@ -102,6 +104,14 @@ void UStaticMeshComponent::CollectMeshBatches(TArray<FMeshBatchElement>& OutMesh
 		{
 			ShaderMacros.Append(MaterialToUse->GetShaderMacros());
 		}
+		// 임포트 시 압축 정점으로 표시된 메시는 정점 입력 형식이 다름
+		if (StaticMesh->HasCompactVertices())
+		{
+			FShaderMacro CompactVertexMacro;
+			CompactVertexMacro.Name = FNameLiteral("COMPACT_VERTEX");
+			CompactVertexMacro.Definition = FNameLiteral("1");
+			ShaderMacros.Add(CompactVertexMacro);
+		}
 		FShaderVariant* ShaderVariant = ShaderToUse->GetOrCompileShaderVariant(ShaderMacros);
 
 		if (ShaderVariant)
@@ -128,6 +138,52 @@ void UStaticMeshComponent::CollectMeshBatches(TArray<FMeshBatchElement>& OutMesh
 	}
 }
 
+int32 UStaticMeshComponent::SelectLOD(const FSceneView* View) const
+{
+	const int32 NumLODs = StaticMesh->GetNumLODs();
+	if (NumLODs <= 1)
+	{
+		return 0;
+	}
+
+	const URenderSettings* Settings = View->RenderSettings;
+	if (Settings && Settings->GetForcedStaticMeshLOD() >= 0)
+	{
+		return std::min(Settings->GetForcedStaticMeshLOD(), NumLODs - 1);
+	}
+
+	// 경계 구의 투영 지름 / 화면 높이. ProjectionMatrix.M[1][1]은 세로 스케일 (원근: 1/tan(fovY/2), 직교: 2/높이)
+	const FAABB WorldBound = GetWorldAABB();
+	const float Radius = WorldBound.GetHalfExtent().Size();
+	const float YScale = View->ProjectionMatrix.M[1][1];
+	float ScreenSize = Radius * YScale;
+	if (View->ProjectionMode == ECameraProjectionMode::Perspective)
+	{
+		const float Distance = (WorldBound.GetCenter() - View->ViewLocation).Size();
+		if (Distance <= Radius)
+		{
+			return 0;
+		}
+		ScreenSize /= Distance;
+	}
+	if (Settings)
+	{
+		ScreenSize *= Settings->GetStaticMeshLODScale();
+	}
+
+	// 화면 크기가 LOD의 전환 크기 이하인 가장 거친 LOD (전환 크기는 LOD가 올라갈수록 작아짐)
+	int32 Selected = 0;
+	for (int32 Index = 1; Index < NumLODs; ++Index)
+	{
+		if (ScreenSize > StaticMesh->GetLODScreenSize(Index))
+		{
+			break;
+		}
+		Selected = Index;
+	}
+	return Selected;
+}
+
 void UStaticMeshComponent::SetStaticMesh(const FString& PathFileName)
 {
 	// 새 메시를 설정하기 전에, 기존에 생성된 모든 MID와 슬롯 정보를 정리합니다.
@@ -135,7 +191,7 @@ void UStaticMeshComponent::SetStaticMesh(const FString& PathFileName)
 
 	// 새 메시를 로드합니다.
 	StaticMesh = UResourceManager::GetInstance().Load<UStaticMesh>(PathFileName);
-	if (StaticMesh && StaticMesh->GetStaticMeshAsset())
+	if (StaticMesh && StaticMesh->HasMeshData())
 	{
 		const TArray<FGroupInfo>& GroupInfos = StaticMesh->GetMeshGroupInfo();
 
@@ -182,16 +238,14 @@ FAABB UStaticMeshComponent::GetWorldAABB() const
 		FVector(LocalMax.X, LocalMax.Y, LocalMax.Z)
 	};
 
-	FVector4 WorldMin4 = FVector4(LocalCorners[0].X, LocalCorners[0].Y, LocalCorners[0].Z, 1.0f) * WorldMatrix;
-	FVector4 WorldMax4 = WorldMin4;
+	FVector WorldCorners[8];
+	FTransformBatch::TransformPositions(WorldMatrix, LocalCorners, WorldCorners, 8);
 
+	FVector4 WorldMin4 = FVector4::FromPoint(WorldCorners[0]);
+	FVector4 WorldMax4 = WorldMin4;
 	for (int32 CornerIndex = 1; CornerIndex < 8; ++CornerIndex)
 	{
-		const FVector4 WorldPos = FVector4(LocalCorners[CornerIndex].X
-			, LocalCorners[CornerIndex].Y
-			, LocalCorners[CornerIndex].Z
-			, 1.0f)
-			* WorldMatrix;
+		const FVector4 WorldPos = FVector4::FromPoint(WorldCorners[CornerIndex]);
 		WorldMin4 = WorldMin4.ComponentMin(WorldPos);
 		WorldMax4 = WorldMax4.ComponentMax(WorldPos);
 	}
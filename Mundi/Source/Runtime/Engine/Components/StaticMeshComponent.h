@@ -46,5 +46,8 @@ public:
 protected:
 	void OnTransformUpdated() override;
 
+	// 뷰에서의 화면 크기(경계 구 지름 / 화면 높이)로 그릴 LOD 선택
+	int32 SelectLOD(const FSceneView* View) const;
+
 protected:
 };
@@ -3,8 +3,14 @@
 #include "SlateManager.h"
 #include "SelectionManager.h"
 #include "FAudioDevice.h"
+#include "TaskScheduler.h"
 #include "FbxLoader.h"
 #include <ObjManager.h>
+#include "AsyncLoadTest.h"
+#include "ResidencyStressTest.h"
+#include "DerivedDataCache.h"
+#include "TextureConverter.h"
+#include "VertexQuantizer.h"
 
 float UEditorEngine::ClientWidth = 1024.0f;
 float UEditorEngine::ClientHeight = 1024.0f;
@@ -180,6 +186,9 @@ bool UEditorEngine::Startup(HINSTANCE hInstance)
     if (!CreateMainWindow(hInstance))
         return false;
 
+    // 워커 스레드 풀 (병렬 렌더 커맨드 녹화 등)
+    FTaskScheduler::GetInstance().Startup();
+
     //디바이스 리소스 및 렌더러 생성
     RHIDevice.Initialize(HWnd);
     Renderer = std::make_unique<URenderer>(&RHIDevice);
@@ -191,11 +200,41 @@ bool UEditorEngine::Startup(HINSTANCE hInstance)
     UI.Initialize(HWnd, RHIDevice.GetDevice(), RHIDevice.GetDeviceContext());
     INPUT.Initialize(HWnd);
 
-    FObjManager::Preload(); 
-    UFbxLoader::PreLoad();
+    // editor.ini의 TextureCompression = BC7 이면 컬러 텍스처를 BC7로 쿡 (기본은 BC1/BC3)
+    if (EditorINI.count("TextureCompression") && EditorINI["TextureCompression"] == "BC7")
+    {
+        FTextureConverter::SetCompressionQuality(ETextureCompressionQuality::High);
+    }
+    // editor.ini의 CompactVertices = 1 이면 조건을 만족하는 메시를 압축 정점(32/40바이트)으로 임포트
+    if (EditorINI.count("CompactVertices") && EditorINI["CompactVertices"] == "1")
+    {
+        FVertexQuantizer::SetEnabled(true);
+    }
+    // editor.ini의 MeshCPUResidency = Full 이면 업로드 후에도 메시의 CPU 사본 전체를 유지 (기본은 충돌/피킹용 스트림만)
+    if (EditorINI.count("MeshCPUResidency") && EditorINI["MeshCPUResidency"] == "Full")
+    {
+        UResourceBase::SetDefaultMeshCPUResidency(EMeshCPUResidency::Full);
+    }
+
+    // editor.ini의 PreloadAssets = 0 이면 시작 시 일괄 로드를 건너뜀 (ASYNCLOAD TEST로 실제 스트리밍을 측정할 때)
+    const bool bPreloadAssets = !(EditorINI.count("PreloadAssets") && EditorINI["PreloadAssets"] == "0");
+    if (bPreloadAssets)
+    {
+        FObjManager::Preload();
+        UFbxLoader::PreLoad();
+
+        // 시작 시 임포트 캐시 적중률 (타임스탬프가 아니라 소스 내용 해시로 검증)
+        FDerivedDataCache::GetInstance().LogStats("Startup");
+        FDerivedDataCache::GetInstance().SaveIndex();
+    }
 
     FAudioDevice::Preload();
 
+    // editor.ini의 ResidencyCPUBudgetMB / ResidencyGPUBudgetMB로 리소스 상주 예산 지정 (넘으면 참조 없는 리소스부터 축출)
+    const uint32 CPUBudgetMB = EditorINI.count("ResidencyCPUBudgetMB") ? std::atoi(EditorINI["ResidencyCPUBudgetMB"].c_str()) : FResourceResidency::DefaultBudgetMB;
+    const uint32 GPUBudgetMB = EditorINI.count("ResidencyGPUBudgetMB") ? std::atoi(EditorINI["ResidencyGPUBudgetMB"].c_str()) : FResourceResidency::DefaultBudgetMB;
+    RESOURCE.SetResidencyBudgetMB(CPUBudgetMB, GPUBudgetMB);
+
     ///////////////////////////////////
     WorldContexts.Add(FWorldContext(NewObject<UWorld>(), EWorldType::Editor));
     GWorld = WorldContexts[0].World;
@@ -215,6 +254,14 @@ bool UEditorEngine::Startup(HINSTANCE hInstance)
 
 void UEditorEngine::Tick(float DeltaSeconds)
 {
+    // 워커 스레드(에셋 로드 등)에서 남긴 로그를 콘솔로 옮김
+    UGlobalConsole::FlushPendingLogs();
+
+    // 비동기 로드 마무리 (등록 + GPU 생성 + 완료 콜백)
+    RESOURCE.TickAsyncLoads();
+    FAsyncLoadTest::Tick();
+    FResidencyStressTest::Tick();
+
     //@TODO UV 스크롤 입력 처리 로직 이동
     HandleUVInput(DeltaSeconds);
     
@@ -325,11 +372,23 @@ void UEditorEngine::MainLoop()
         // Shader Hot Reloading - Call AFTER render to avoid mid-frame resource conflicts
         // This ensures all GPU commands are submitted before we check for shader updates
         UResourceManager::GetInstance().CheckAndReloadShaders(DeltaSeconds);
+
+        // 리소스 상주 관리도 렌더 이후 (이번 프레임 드로우가 참조한 리소스를 축출하지 않도록)
+        UResourceManager::GetInstance().UpdateResidency(DeltaSeconds);
+
+        // 이번 프레임의 선형 할당 일괄 해제 (프레임 할당 포인터는 여기서 모두 무효)
+        FMemoryManager::ResetFrame();
     }
 }
 
 void UEditorEngine::Shutdown()
 {
+    // 진행 중인 비동기 작업을 마무리하고 워커 스레드 종료 (UObject 삭제 전에 수행)
+    FTaskScheduler::GetInstance().Shutdown();
+
+    // 시작 이후 새로 해싱한 소스가 있으면 인덱스 저장 (다음 실행에서 다시 읽지 않도록)
+    FDerivedDataCache::GetInstance().SaveIndex();
+
     // 월드부터 삭제해야 DeleteAll 때 문제가 없음
     for (FWorldContext WorldContext : WorldContexts)
     {
@@ -6,6 +6,8 @@
 #include "PlayerCameraManager.h"
 #include <ObjManager.h>
 #include "FAudioDevice.h"
+#include "TaskScheduler.h"
+#include "DerivedDataCache.h"
 #include <sol/sol.hpp>
 
 float UGameEngine::ClientWidth = 1024.0f;
@@ -176,6 +178,9 @@ bool UGameEngine::Startup(HINSTANCE hInstance)
     if (!CreateMainWindow(hInstance))
         return false;
 
+    // 워커 스레드 풀 (병렬 렌더 커맨드 녹화 등)
+    FTaskScheduler::GetInstance().Startup();
+
     // 디바이스 리소스 및 렌더러 생성
     RHIDevice.Initialize(HWnd);
     Renderer = std::make_unique<URenderer>(&RHIDevice);
@@ -196,6 +201,10 @@ bool UGameEngine::Startup(HINSTANCE hInstance)
 
     FObjManager::Preload();
 
+    // 시작 시 임포트 캐시 적중률 (타임스탬프가 아니라 소스 내용 해시로 검증)
+    FDerivedDataCache::GetInstance().LogStats("Startup");
+    FDerivedDataCache::GetInstance().SaveIndex();
+
     // Preload audio assets
     FAudioDevice::Preload();
 
@@ -228,6 +237,9 @@ bool UGameEngine::Startup(HINSTANCE hInstance)
 
 void UGameEngine::Tick(float DeltaSeconds)
 {
+    // 비동기 로드 마무리 (등록 + GPU 생성 + 완료 콜백)
+    RESOURCE.TickAsyncLoads();
+
     //@TODO UV 스크롤 입력 처리 로직 이동
     HandleUVInput(DeltaSeconds);
 
@@ -319,11 +331,23 @@ void UGameEngine::MainLoop()
         // Shader Hot Reloading - Call AFTER render to avoid mid-frame resource conflicts
         // This ensures all GPU commands are submitted before we check for shader updates
         UResourceManager::GetInstance().CheckAndReloadShaders(DeltaSeconds);
+
+        // 리소스 상주 관리도 렌더 이후 (이번 프레임 드로우가 참조한 리소스를 축출하지 않도록)
+        UResourceManager::GetInstance().UpdateResidency(DeltaSeconds);
+
+        // 이번 프레임의 선형 할당 일괄 해제 (프레임 할당 포인터는 여기서 모두 무효)
+        FMemoryManager::ResetFrame();
     }
 }
 
 void UGameEngine::Shutdown()
 {
+    // 진행 중인 비동기 작업을 마무리하고 워커 스레드 종료 (UObject 삭제 전에 수행)
+    FTaskScheduler::GetInstance().Shutdown();
+
+    // 시작 이후 새로 해싱한 소스가 있으면 인덱스 저장 (다음 실행에서 다시 읽지 않도록)
+    FDerivedDataCache::GetInstance().SaveIndex();
+
     // 월드부터 삭제해야 DeleteAll 때 문제가 없음
     for (FWorldContext WorldContext : WorldContexts)
     {
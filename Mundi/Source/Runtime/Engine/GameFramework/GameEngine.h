@@ -30,6 +30,13 @@ public:
         WorldContexts.push_back(InWorldContext);
     }
 
+    // 월드를 삭제하기 전에 호출 (월드 자체는 삭제하지 않음)
+    void RemoveWorldContext(UWorld* InWorld)
+    {
+        WorldContexts.erase(std::remove_if(WorldContexts.begin(), WorldContexts.end(),
+            [InWorld](const FWorldContext& Context) { return Context.World == InWorld; }), WorldContexts.end());
+    }
+
 private:
     bool CreateMainWindow(HINSTANCE hInstance);
     static LRESULT CALLBACK WndProc(HWND hWnd, UINT message, WPARAM wParam, LPARAM lParam);
@@ -49,18 +49,45 @@ void ULevel::SpawnDefaultActors()
    
 }
 
-void ULevel::Serialize(const bool bInIsLoading, JSON& InOutHandle)
+bool ULevel::CaptureEditorCamera(FLevelEditorCameraData& OutData)
 {
-    Super::Serialize(bInIsLoading, InOutHandle);
+    const ACameraActor* Camera = GWorld ? GWorld->GetEditorCameraActor() : nullptr;
+    if (!Camera || !Camera->GetCameraComponent())
+    {
+        return false;
+    }
+
+    const UCameraComponent* Cam = Camera->GetCameraComponent();
+    OutData.Location = Camera->GetActorLocation();
+    OutData.Rotation.X = 0.0f;
+    OutData.Rotation.Y = Camera->GetCameraPitch();
+    OutData.Rotation.Z = Camera->GetCameraYaw();
+    OutData.FOV = Cam->GetFOV();
+    OutData.NearClip = Cam->GetNearClip();
+    OutData.FarClip = Cam->GetFarClip();
+    return true;
+}
 
-    struct FPerspectiveCameraData
+void ULevel::ApplyEditorCamera(const FLevelEditorCameraData& InData)
+{
+    ACameraActor* CamActor = GWorld ? GWorld->GetEditorCameraActor() : nullptr;
+    if (!CamActor)
     {
-        FVector Location;
-        FVector Rotation;
-        float FOV;
-        float NearClip;
-        float FarClip;
-    };
+        return;
+    }
+
+    CamActor->SetActorLocation(InData.Location);
+    CamActor->SetRotationFromEulerAngles(InData.Rotation);
+    if (auto* CamComp = CamActor->GetCameraComponent())
+    {
+        CamComp->SetFOV(InData.FOV);
+        CamComp->SetClipPlanes(InData.NearClip, InData.FarClip);
+    }
+}
+
+void ULevel::Serialize(const bool bInIsLoading, JSON& InOutHandle)
+{
+    Super::Serialize(bInIsLoading, InOutHandle);
 
     if (bInIsLoading)
     {
@@ -68,28 +95,16 @@ void ULevel::Serialize(const bool bInIsLoading, JSON& InOutHandle)
         JSON PerspectiveCameraData;
         if (FJsonSerializer::ReadObject(InOutHandle, "PerspectiveCamera", PerspectiveCameraData))
         {
-            // 카메라 정보
-            ACameraActor* CamActor = GWorld->GetEditorCameraActor();
-            FPerspectiveCameraData CamData;
-            if (CamActor)
-            {
-                // ReadObject 유틸리티 함수로 해당 뷰포트의 JSON 데이터를 안전하게 가져옴
-                // 유틸리티 함수를 사용하여 반복적인 검사 없이 간결하게 데이터 파싱
-                // 실패 시 각 함수 내부에서 로그를 남기고 기본값을 할당함
-                FJsonSerializer::ReadVector(PerspectiveCameraData, "Location", CamData.Location);
-                FJsonSerializer::ReadVector(PerspectiveCameraData, "Rotation", CamData.Rotation);
-                FJsonSerializer::ReadArrayFloat(PerspectiveCameraData, "FOV", CamData.FOV);
-                FJsonSerializer::ReadArrayFloat(PerspectiveCameraData, "NearClip", CamData.NearClip);
-                FJsonSerializer::ReadArrayFloat(PerspectiveCameraData, "FarClip", CamData.FarClip);
-
-                CamActor->SetActorLocation(CamData.Location);
-                CamActor->SetRotationFromEulerAngles(CamData.Rotation);
-                if (auto* CamComp = CamActor->GetCameraComponent())
-                {
-                    CamComp->SetFOV(CamData.FOV);
-                    CamComp->SetClipPlanes(CamData.NearClip, CamData.FarClip);
-                }
-            }
+            // ReadObject 유틸리티 함수로 해당 뷰포트의 JSON 데이터를 안전하게 가져옴
+            // 유틸리티 함수를 사용하여 반복적인 검사 없이 간결하게 데이터 파싱
+            // 실패 시 각 함수 내부에서 로그를 남기고 기본값을 할당함
+            FLevelEditorCameraData CamData;
+            FJsonSerializer::ReadVector(PerspectiveCameraData, "Location", CamData.Location);
+            FJsonSerializer::ReadVector(PerspectiveCameraData, "Rotation", CamData.Rotation);
+            FJsonSerializer::ReadArrayFloat(PerspectiveCameraData, "FOV", CamData.FOV);
+            FJsonSerializer::ReadArrayFloat(PerspectiveCameraData, "NearClip", CamData.NearClip);
+            FJsonSerializer::ReadArrayFloat(PerspectiveCameraData, "FarClip", CamData.FarClip);
+            ApplyEditorCamera(CamData);
         }
 
         // Actors 정보
@@ -142,19 +157,8 @@ void ULevel::Serialize(const bool bInIsLoading, JSON& InOutHandle)
         InOutHandle["NextUUID"] = UObject::PeekNextUUID();
 
         // 카메라 정보
-        const ACameraActor* Camera = GWorld->GetEditorCameraActor();
-        FPerspectiveCameraData CamData;
-        if (Camera && Camera->GetCameraComponent())
-        {
-            const UCameraComponent* Cam = Camera->GetCameraComponent();
-            CamData.Location = Camera->GetActorLocation();
-            CamData.Rotation.X = 0.0f;
-            CamData.Rotation.Y = Camera->GetCameraPitch();
-            CamData.Rotation.Z = Camera->GetCameraYaw();
-            CamData.FOV = Cam->GetFOV();
-            CamData.NearClip = Cam->GetNearClip();
-            CamData.FarClip = Cam->GetFarClip();
-        }
+        FLevelEditorCameraData CamData;
+        CaptureEditorCamera(CamData);
 
         JSON CamreaJson = json::Object();
         CamreaJson["Location"] = FJsonSerializer::VectorToJson(CamData.Location);
@@ -4,6 +4,16 @@
 #include "Actor.h"
 #include <algorithm>
 
+// 레벨 파일에 함께 저장하는 에디터 원근 카메라 상태
+struct FLevelEditorCameraData
+{
+    FVector Location;
+    FVector Rotation;   // (0, Pitch, Yaw) 도 단위
+    float FOV = 60.0f;
+    float NearClip = 0.1f;
+    float FarClip = 1000.0f;
+};
+
 class ULevel : public UObject
 {
 public:
@@ -12,17 +22,33 @@ public:
     ~ULevel() override = default;
 
     const TArray<AActor*>& GetActors() const { return Actors; }
-    void AddActor(AActor* Actor) { if (Actor) Actors.Add(Actor); }
+    void AddActor(AActor* Actor) { if (Actor) { Actors.Add(Actor); Actor->SetLevel(this); } }
     void SpawnDefaultActors();
     bool RemoveActor(AActor* Actor)
     {
         auto it = std::find(Actors.begin(), Actors.end(), Actor);
-        if (it != Actors.end()) { Actors.erase(it); return true; }
+        if (it != Actors.end())
+        {
+            if (Actor->GetLevel() == this) Actor->SetLevel(nullptr);
+            Actors.erase(it);
+            return true;
+        }
         return false;
     }
-    void Clear() { Actors.Empty(); }
+    void Clear()
+    {
+        for (AActor* Actor : Actors)
+        {
+            if (Actor && Actor->GetLevel() == this) Actor->SetLevel(nullptr);
+        }
+        Actors.Empty();
+    }
 
     void Serialize(const bool bInIsLoading, JSON& InOutHandle);
+
+    // GWorld 에디터 카메라 상태 읽기/적용 (JSON/바이너리 레벨 포맷 공용)
+    static bool CaptureEditorCamera(FLevelEditorCameraData& OutData);
+    static void ApplyEditorCamera(const FLevelEditorCameraData& InData);
 private:
     TArray<AActor*> Actors;
 };
@@ -0,0 +1,1102 @@
+﻿#include "pch.h"
+#include "LevelBinarySerializer.h"
+#include "Level.h"
+#include "Actor.h"
+#include "ActorComponent.h"
+#include "SceneComponent.h"
+#include "ResourceManager.h"
+#include "StaticMesh.h"
+#include "SkeletalMesh.h"
+#include "Texture.h"
+#include "Material.h"
+#include "Sound.h"
+#include "JsonSerializer.h"
+#include "WindowsMappedFile.h"
+#include "PlatformTime.h"
+#include <fstream>
+
+namespace
+{
+    // 객체 스트림의 확장 데이터(JSON 트리) 값 태그
+    enum class EExtraTag : uint8
+    {
+        Null,
+        Object,
+        Array,
+        String,
+        Float,
+        Int,
+        Bool,
+    };
+
+    // 레벨/액터 구조를 나타내는 키는 객체 스트림에 따로 저장하므로 확장 데이터에서 뺌
+    const TSet<FString> ActorStructureKeys = { "RootComponentId", "OwnedComponents" };
+    const TSet<FString> ComponentStructureKeys = { "Type" };
+
+    // 이보다 큰 개수는 손상된 파일로 간주 (잘못된 값으로 거대한 할당을 하지 않도록)
+    constexpr uint32 MaxReasonableCount = 50'000'000;
+
+    // 프로퍼티 레코드 안에서 차지하는 크기 (0이면 레코드 대상 아님 = JSON 직렬화도 하지 않는 타입)
+    uint32 GetRecordValueSize(EPropertyType Type, EPropertyType InnerType)
+    {
+        switch (Type)
+        {
+        case EPropertyType::Bool:
+            return 1;
+        case EPropertyType::Int32:
+        case EPropertyType::Float:
+            return 4;
+        case EPropertyType::FVector:
+            return sizeof(float) * 3;
+        case EPropertyType::FLinearColor:
+        case EPropertyType::Curve:
+            return sizeof(float) * 4;
+        case EPropertyType::FString:
+        case EPropertyType::ScriptFile:
+        case EPropertyType::FName:
+        case EPropertyType::Texture:
+        case EPropertyType::StaticMesh:
+        case EPropertyType::SkeletalMesh:
+        case EPropertyType::Material:
+            return sizeof(uint32);  // 문자열 테이블 인덱스
+        case EPropertyType::Array:
+            switch (InnerType)
+            {
+            case EPropertyType::Int32:
+            case EPropertyType::Float:
+            case EPropertyType::Bool:
+            case EPropertyType::FString:
+            case EPropertyType::Sound:
+                return sizeof(uint32) * 2;  // 배열 풀 오프셋 + 개수
+            default:
+                return 0;
+            }
+        default:
+            return 0;
+        }
+    }
+
+    // 배열 풀 원소 크기 (문자열/사운드는 문자열 테이블 인덱스)
+    uint32 GetArrayElementSize(EPropertyType InnerType)
+    {
+        return InnerType == EPropertyType::Bool ? 1 : 4;
+    }
+
+    // JSON::ToString()은 json_escape된 문자열을 돌려주므로 원래 문자열로 되돌림
+    FString UnescapeJsonString(const FString& InEscaped)
+    {
+        if (InEscaped.find('\\') == FString::npos)
+        {
+            return InEscaped;
+        }
+
+        FString Result;
+        Result.reserve(InEscaped.size());
+        for (SIZE_T Index = 0; Index < InEscaped.size(); ++Index)
+        {
+            const char C = InEscaped[Index];
+            if (C != '\\' || Index + 1 >= InEscaped.size())
+            {
+                Result += C;
+                continue;
+            }
+
+            switch (InEscaped[++Index])
+            {
+            case '"':  Result += '"';  break;
+            case '\\': Result += '\\'; break;
+            case 'b':  Result += '\b'; break;
+            case 'f':  Result += '\f'; break;
+            case 'n':  Result += '\n'; break;
+            case 'r':  Result += '\r'; break;
+            case 't':  Result += '\t'; break;
+            default:   Result += '\\'; Result += InEscaped[Index]; break;
+            }
+        }
+        return Result;
+    }
+
+    class FBinaryWriter
+    {
+    public:
+        template<typename T>
+        void Write(const T& Value)
+        {
+            static_assert(std::is_trivially_copyable_v<T>, "POD만 그대로 쓸 수 있음");
+            WriteBytes(&Value, sizeof(T));
+        }
+
+        void WriteBytes(const void* Data, SIZE_T Size)
+        {
+            const uint8* Bytes = static_cast<const uint8*>(Data);
+            Buffer.insert(Buffer.end(), Bytes, Bytes + Size);
+        }
+
+        uint32 Tell() const { return static_cast<uint32>(Buffer.size()); }
+
+        TArray<uint8> Buffer;
+    };
+
+    // 매핑된 파일 위를 움직이는 커서. 범위를 넘으면 에러 상태가 되고 이후 읽기는 0을 돌려줌
+    class FBinaryReader
+    {
+    public:
+        FBinaryReader(const uint8* InData, SIZE_T InSize)
+            : Cursor(InData), End(InData + InSize)
+        {
+        }
+
+        template<typename T>
+        T Read()
+        {
+            T Value{};
+            if (const uint8* Bytes = Skip(sizeof(T)))
+            {
+                memcpy(&Value, Bytes, sizeof(T));
+            }
+            return Value;
+        }
+
+        // Size 바이트를 건너뛰고 그 시작 위치를 돌려줌
+        const uint8* Skip(SIZE_T Size)
+        {
+            if (bError || static_cast<SIZE_T>(End - Cursor) < Size)
+            {
+                bError = true;
+                return nullptr;
+            }
+            const uint8* Start = Cursor;
+            Cursor += Size;
+            return Start;
+        }
+
+        bool HasError() const { return bError; }
+
+    private:
+        const uint8* Cursor;
+        const uint8* End;
+        bool bError = false;
+    };
+
+    // ───── 저장 ──────────────────────────────────────
+
+    struct FSaveClassEntry
+    {
+        const UClass* Class = nullptr;
+        TArray<const FProperty*> Properties;
+        TArray<uint32> Offsets;
+        uint32 RecordSize = 0;
+        uint32 NumRecords = 0;
+        TSet<FString> RecordKeys;   // 레코드로 옮겨서 확장 데이터에서 빼는 JSON 키
+        FBinaryWriter Records;
+    };
+
+    class FLevelSaveContext
+    {
+    public:
+        FLevelSaveContext()
+        {
+            AddString(FString());   // 0번은 빈 문자열 (nullptr 리소스)
+        }
+
+        uint32 AddString(const FString& InString)
+        {
+            if (const uint32* Found = StringIndices.Find(InString))
+            {
+                return *Found;
+            }
+            const uint32 Index = static_cast<uint32>(Strings.Num());
+            Strings.Add(InString);
+            StringIndices.Add(InString, Index);
+            return Index;
+        }
+
+        uint32 GetClassIndex(const UClass* Class)
+        {
+            if (const uint32* Found = ClassIndices.Find(Class))
+            {
+                return *Found;
+            }
+
+            FSaveClassEntry Entry;
+            Entry.Class = Class;
+            AddString(Class->Name);
+            for (const FProperty& Prop : Class->GetAllProperties())
+            {
+                const uint32 ValueSize = GetRecordValueSize(Prop.Type, Prop.InnerType);
+                if (ValueSize == 0)
+                {
+                    continue;
+                }
+                AddString(Prop.Name);
+                Entry.Properties.Add(&Prop);
+                Entry.Offsets.Add(Entry.RecordSize);
+                Entry.RecordKeys.Add(Prop.Name);
+                Entry.RecordSize += ValueSize;
+            }
+
+            const uint32 Index = static_cast<uint32>(Classes.Num());
+            Classes.Add(std::move(Entry));
+            ClassIndices.Add(Class, Index);
+            return Index;
+        }
+
+        void WriteRecord(uint32 ClassIndex, const UObject* Object)
+        {
+            FSaveClassEntry& Entry = Classes[ClassIndex];
+            FBinaryWriter& Out = Entry.Records;
+            for (const FProperty* Prop : Entry.Properties)
+            {
+                switch (Prop->Type)
+                {
+                case EPropertyType::Bool:
+                    Out.Write<uint8>(*Prop->GetValuePtr<bool>(Object) ? 1 : 0);
+                    break;
+                case EPropertyType::Int32:
+                    Out.Write<int32>(*Prop->GetValuePtr<int32>(Object));
+                    break;
+                case EPropertyType::Float:
+                    Out.Write<float>(*Prop->GetValuePtr<float>(Object));
+                    break;
+                case EPropertyType::FVector:
+                    Out.WriteBytes(Prop->GetValuePtr<FVector>(Object), sizeof(float) * 3);
+                    break;
+                case EPropertyType::FLinearColor:
+                {
+                    const FLinearColor& Color = *Prop->GetValuePtr<FLinearColor>(Object);
+                    const float Values[4] = { Color.R, Color.G, Color.B, Color.A };
+                    Out.WriteBytes(Values, sizeof(Values));
+                    break;
+                }
+                case EPropertyType::Curve:
+                    Out.WriteBytes(Prop->GetValuePtr<float>(Object), sizeof(float) * 4);
+                    break;
+                case EPropertyType::FString:
+                case EPropertyType::ScriptFile:
+                    Out.Write<uint32>(AddString(*Prop->GetValuePtr<FString>(Object)));
+                    break;
+                case EPropertyType::FName:
+                    Out.Write<uint32>(AddString(Prop->GetValuePtr<FName>(Object)->ToString()));
+                    break;
+                case EPropertyType::Texture:
+                {
+                    const UTexture* Texture = *Prop->GetValuePtr<UTexture*>(Object);
+                    Out.Write<uint32>(Texture ? AddString(Texture->GetFilePath()) : 0);
+                    break;
+                }
+                case EPropertyType::StaticMesh:
+                {
+                    const UStaticMesh* Mesh = *Prop->GetValuePtr<UStaticMesh*>(Object);
+                    Out.Write<uint32>(Mesh ? AddString(Mesh->GetAssetPathFileName()) : 0);
+                    break;
+                }
+                case EPropertyType::SkeletalMesh:
+                {
+                    const USkeletalMesh* Mesh = *Prop->GetValuePtr<USkeletalMesh*>(Object);
+                    Out.Write<uint32>(Mesh ? AddString(Mesh->GetPathFileName()) : 0);
+                    break;
+                }
+                case EPropertyType::Material:
+                {
+                    const UMaterial* Material = *Prop->GetValuePtr<UMaterial*>(Object);
+                    Out.Write<uint32>(Material ? AddString(Material->GetFilePath()) : 0);
+                    break;
+                }
+                case EPropertyType::Array:
+                    WriteArray(*Prop, Object, Out);
+                    break;
+                default:
+                    break;
+                }
+            }
+            ++Entry.NumRecords;
+        }
+
+        // 확장 데이터: 레코드/객체 스트림에 이미 들어간 키를 뺀 나머지 JSON
+        void WriteExtras(FBinaryWriter& Out, const JSON& Json, uint32 ClassIndex, const TSet<FString>& StructureKeys)
+        {
+            if (Json.JSONType() != JSON::Class::Object)
+            {
+                WriteJsonValue(Out, Json);
+                return;
+            }
+
+            const TSet<FString>& RecordKeys = Classes[ClassIndex].RecordKeys;
+            uint32 NumKeys = 0;
+            for (const auto& Pair : Json.ObjectRange())
+            {
+                if (!RecordKeys.Contains(Pair.first) && !StructureKeys.Contains(Pair.first))
+                {
+                    ++NumKeys;
+                }
+            }
+
+            Out.Write<uint8>(static_cast<uint8>(EExtraTag::Object));
+            Out.Write<uint32>(NumKeys);
+            for (const auto& Pair : Json.ObjectRange())
+            {
+                if (!RecordKeys.Contains(Pair.first) && !StructureKeys.Contains(Pair.first))
+                {
+                    Out.Write<uint32>(AddString(Pair.first));
+                    WriteJsonValue(Out, Pair.second);
+                }
+            }
+        }
+
+        void WriteJsonValue(FBinaryWriter& Out, const JSON& Json)
+        {
+            switch (Json.JSONType())
+            {
+            case JSON::Class::Object:
+                Out.Write<uint8>(static_cast<uint8>(EExtraTag::Object));
+                Out.Write<uint32>(static_cast<uint32>(Json.size()));
+                for (const auto& Pair : Json.ObjectRange())
+                {
+                    Out.Write<uint32>(AddString(Pair.first));
+                    WriteJsonValue(Out, Pair.second);
+                }
+                break;
+            case JSON::Class::Array:
+                Out.Write<uint8>(static_cast<uint8>(EExtraTag::Array));
+                Out.Write<uint32>(static_cast<uint32>(Json.size()));
+                for (const JSON& Element : Json.ArrayRange())
+                {
+                    WriteJsonValue(Out, Element);
+                }
+                break;
+            case JSON::Class::String:
+                Out.Write<uint8>(static_cast<uint8>(EExtraTag::String));
+                Out.Write<uint32>(AddString(UnescapeJsonString(Json.ToString())));
+                break;
+            case JSON::Class::Floating:
+                Out.Write<uint8>(static_cast<uint8>(EExtraTag::Float));
+                Out.Write<double>(Json.ToFloat());
+                break;
+            case JSON::Class::Integral:
+                Out.Write<uint8>(static_cast<uint8>(EExtraTag::Int));
+                Out.Write<int64>(static_cast<int64>(Json.ToInt()));
+                break;
+            case JSON::Class::Boolean:
+                Out.Write<uint8>(static_cast<uint8>(EExtraTag::Bool));
+                Out.Write<uint8>(Json.ToBool() ? 1 : 0);
+                break;
+            default:
+                Out.Write<uint8>(static_cast<uint8>(EExtraTag::Null));
+                break;
+            }
+        }
+
+        // [헤더 이후] 문자열 테이블 → 스키마 → 레코드 → 배열 풀 → 객체 스트림
+        void WriteTables(FBinaryWriter& Out) const
+        {
+            Out.Write<uint32>(static_cast<uint32>(Strings.Num()));
+            for (const FString& String : Strings)
+            {
+                Out.Write<uint32>(static_cast<uint32>(String.size()));
+                Out.WriteBytes(String.data(), String.size());
+            }
+
+            Out.Write<uint32>(static_cast<uint32>(Classes.Num()));
+            for (const FSaveClassEntry& Entry : Classes)
+            {
+                Out.Write<uint32>(*StringIndices.Find(Entry.Class->Name));
+                Out.Write<uint32>(static_cast<uint32>(Entry.Properties.Num()));
+                for (const FProperty* Prop : Entry.Properties)
+                {
+                    Out.Write<uint32>(*StringIndices.Find(Prop->Name));
+                    Out.Write<uint8>(static_cast<uint8>(Prop->Type));
+                    Out.Write<uint8>(static_cast<uint8>(Prop->InnerType));
+                    Out.Write<uint16>(static_cast<uint16>(GetRecordValueSize(Prop->Type, Prop->InnerType)));
+                }
+            }
+
+            for (const FSaveClassEntry& Entry : Classes)
+            {
+                Out.Write<uint32>(Entry.NumRecords);
+                Out.WriteBytes(Entry.Records.Buffer.data(), Entry.Records.Buffer.size());
+            }
+
+            Out.Write<uint32>(ArrayPool.Tell());
+            Out.WriteBytes(ArrayPool.Buffer.data(), ArrayPool.Buffer.size());
+
+            Out.WriteBytes(Objects.Buffer.data(), Objects.Buffer.size());
+        }
+
+        TArray<FString> Strings;
+        TArray<FSaveClassEntry> Classes;
+        FBinaryWriter ArrayPool;
+        FBinaryWriter Objects;
+
+    private:
+        void WriteArray(const FProperty& Prop, const UObject* Object, FBinaryWriter& Out)
+        {
+            const uint32 PoolOffset = ArrayPool.Tell();
+            uint32 Count = 0;
+            switch (Prop.InnerType)
+            {
+            case EPropertyType::Int32:
+            {
+                const TArray<int32>& Array = *Prop.GetValuePtr<TArray<int32>>(Object);
+                Count = static_cast<uint32>(Array.Num());
+                ArrayPool.WriteBytes(Array.data(), sizeof(int32) * Count);
+                break;
+            }
+            case EPropertyType::Float:
+            {
+                const TArray<float>& Array = *Prop.GetValuePtr<TArray<float>>(Object);
+                Count = static_cast<uint32>(Array.Num());
+                ArrayPool.WriteBytes(Array.data(), sizeof(float) * Count);
+                break;
+            }
+            case EPropertyType::Bool:
+            {
+                // TArray<bool>은 비트 압축 벡터라 원소별로 씀
+                const TArray<bool>& Array = *Prop.GetValuePtr<TArray<bool>>(Object);
+                Count = static_cast<uint32>(Array.size());
+                for (const bool bValue : Array)
+                {
+                    ArrayPool.Write<uint8>(bValue ? 1 : 0);
+                }
+                break;
+            }
+            case EPropertyType::FString:
+            {
+                const TArray<FString>& Array = *Prop.GetValuePtr<TArray<FString>>(Object);
+                Count = static_cast<uint32>(Array.Num());
+                for (const FString& Value : Array)
+                {
+                    ArrayPool.Write<uint32>(AddString(Value));
+                }
+                break;
+            }
+            case EPropertyType::Sound:
+            {
+                const TArray<USound*>& Array = *Prop.GetValuePtr<TArray<USound*>>(Object);
+                Count = static_cast<uint32>(Array.Num());
+                for (const USound* Sound : Array)
+                {
+                    ArrayPool.Write<uint32>(Sound ? AddString(Sound->GetFilePath()) : 0);
+                }
+                break;
+            }
+            default:
+                break;
+            }
+            Out.Write<uint32>(PoolOffset);
+            Out.Write<uint32>(Count);
+        }
+
+        TMap<FString, uint32> StringIndices;
+        TMap<const UClass*, uint32> ClassIndices;
+    };
+
+    // ───── 로드 ──────────────────────────────────────
+
+    struct FLoadPropertyStep
+    {
+        const FProperty* Property = nullptr;
+        uint32 RecordOffset = 0;
+    };
+
+    // 파일 스키마의 클래스 하나를 현재 UClass에 맞춘 적용 계획
+    struct FLoadClassPlan
+    {
+        UClass* Class = nullptr;                // 현재 빌드에 없는 클래스면 nullptr
+        uint32 RecordSize = 0;
+        TArray<FLoadPropertyStep> Steps;        // 이름+타입이 일치하는 프로퍼티만
+        const uint8* Records = nullptr;
+        uint32 NumRecords = 0;
+        uint32 NextRecord = 0;
+    };
+
+    class FLevelLoadContext
+    {
+    public:
+        bool ReadTables(FBinaryReader& Reader)
+        {
+            const uint32 NumStrings = Reader.Read<uint32>();
+            if (NumStrings > MaxReasonableCount)
+            {
+                return false;
+            }
+            Strings.Reserve(NumStrings);
+            for (uint32 Index = 0; Index < NumStrings && !Reader.HasError(); ++Index)
+            {
+                const uint32 Length = Reader.Read<uint32>();
+                const uint8* Chars = Reader.Skip(Length);
+                Strings.Add(Chars ? FString(reinterpret_cast<const char*>(Chars), Length) : FString());
+            }
+            if (Reader.HasError() || Strings.IsEmpty())
+            {
+                return false;
+            }
+            Names.SetNum(Strings.Num());
+            NameResolved.SetNum(Strings.Num(), false);
+
+            const uint32 NumClasses = Reader.Read<uint32>();
+            if (NumClasses > MaxReasonableCount)
+            {
+                return false;
+            }
+            Plans.SetNum(NumClasses);
+            for (uint32 ClassIndex = 0; ClassIndex < NumClasses && !Reader.HasError(); ++ClassIndex)
+            {
+                FLoadClassPlan& Plan = Plans[ClassIndex];
+                const FString& ClassName = GetString(Reader.Read<uint32>());
+                Plan.Class = UClass::FindClass(ClassName);
+                if (!Plan.Class)
+                {
+                    UE_LOG("[LevelBinary] Unknown class '%s' in level file, its objects will be skipped.", ClassName.c_str());
+                }
+
+                const uint32 NumProperties = Reader.Read<uint32>();
+                for (uint32 PropIndex = 0; PropIndex < NumProperties && !Reader.HasError(); ++PropIndex)
+                {
+                    const FString& PropName = GetString(Reader.Read<uint32>());
+                    const EPropertyType Type = static_cast<EPropertyType>(Reader.Read<uint8>());
+                    const EPropertyType InnerType = static_cast<EPropertyType>(Reader.Read<uint8>());
+                    const uint32 ValueSize = Reader.Read<uint16>();
+
+                    if (const FProperty* Target = FindMatchingProperty(Plan.Class, PropName, Type, InnerType, ValueSize))
+                    {
+                        Plan.Steps.Add({ Target, Plan.RecordSize });
+                    }
+                    Plan.RecordSize += ValueSize;
+                }
+            }
+
+            for (FLoadClassPlan& Plan : Plans)
+            {
+                Plan.NumRecords = Reader.Read<uint32>();
+                Plan.Records = Reader.Skip(static_cast<SIZE_T>(Plan.NumRecords) * Plan.RecordSize);
+            }
+
+            ArrayPoolSize = Reader.Read<uint32>();
+            ArrayPool = Reader.Skip(ArrayPoolSize);
+            return !Reader.HasError();
+        }
+
+        FLoadClassPlan* GetPlan(uint32 ClassIndex)
+        {
+            return ClassIndex < static_cast<uint32>(Plans.Num()) ? &Plans[ClassIndex] : nullptr;
+        }
+
+        // 같은 클래스의 레코드는 객체 스트림 순서대로 저장되어 있음
+        const uint8* TakeRecord(FLoadClassPlan& Plan)
+        {
+            if (Plan.NextRecord >= Plan.NumRecords)
+            {
+                return nullptr;
+            }
+            return Plan.Records + static_cast<SIZE_T>(Plan.NextRecord++) * Plan.RecordSize;
+        }
+
+        void ApplyRecord(const FLoadClassPlan& Plan, const uint8* Record, UObject* Object)
+        {
+            for (const FLoadPropertyStep& Step : Plan.Steps)
+            {
+                const FProperty& Prop = *Step.Property;
+                const uint8* Value = Record + Step.RecordOffset;
+                switch (Prop.Type)
+                {
+                case EPropertyType::Bool:
+                    *Prop.GetValuePtr<bool>(Object) = *Value != 0;
+                    break;
+                case EPropertyType::Int32:
+                    memcpy(Prop.GetValuePtr<int32>(Object), Value, sizeof(int32));
+                    break;
+                case EPropertyType::Float:
+                    memcpy(Prop.GetValuePtr<float>(Object), Value, sizeof(float));
+                    break;
+                case EPropertyType::FVector:
+                    memcpy(Prop.GetValuePtr<FVector>(Object), Value, sizeof(float) * 3);
+                    break;
+                case EPropertyType::FLinearColor:
+                {
+                    float Color[4];
+                    memcpy(Color, Value, sizeof(Color));
+                    *Prop.GetValuePtr<FLinearColor>(Object) = FLinearColor(Color[0], Color[1], Color[2], Color[3]);
+                    break;
+                }
+                case EPropertyType::Curve:
+                    memcpy(Prop.GetValuePtr<float>(Object), Value, sizeof(float) * 4);
+                    break;
+                case EPropertyType::FString:
+                case EPropertyType::ScriptFile:
+                    *Prop.GetValuePtr<FString>(Object) = GetString(ReadIndex(Value));
+                    break;
+                case EPropertyType::FName:
+                    *Prop.GetValuePtr<FName>(Object) = GetName(ReadIndex(Value));
+                    break;
+                case EPropertyType::Texture:
+                    *Prop.GetValuePtr<UTexture*>(Object) = LoadResource<UTexture>(ReadIndex(Value), Prop.Type);
+                    break;
+                case EPropertyType::StaticMesh:
+                    *Prop.GetValuePtr<UStaticMesh*>(Object) = LoadResource<UStaticMesh>(ReadIndex(Value), Prop.Type);
+                    break;
+                case EPropertyType::SkeletalMesh:
+                    *Prop.GetValuePtr<USkeletalMesh*>(Object) = LoadResource<USkeletalMesh>(ReadIndex(Value), Prop.Type);
+                    break;
+                case EPropertyType::Material:
+                    *Prop.GetValuePtr<UMaterial*>(Object) = LoadResource<UMaterial>(ReadIndex(Value), Prop.Type);
+                    break;
+                case EPropertyType::Array:
+                    ApplyArray(Prop, Value, Object);
+                    break;
+                default:
+                    break;
+                }
+            }
+        }
+
+        JSON ReadJsonValue(FBinaryReader& Reader)
+        {
+            switch (static_cast<EExtraTag>(Reader.Read<uint8>()))
+            {
+            case EExtraTag::Object:
+            {
+                JSON Object = JSON::Make(JSON::Class::Object);
+                const uint32 NumKeys = Reader.Read<uint32>();
+                for (uint32 Index = 0; Index < NumKeys && !Reader.HasError(); ++Index)
+                {
+                    const FString& Key = GetString(Reader.Read<uint32>());
+                    Object[Key] = ReadJsonValue(Reader);
+                }
+                return Object;
+            }
+            case EExtraTag::Array:
+            {
+                JSON Array = JSON::Make(JSON::Class::Array);
+                const uint32 NumElements = Reader.Read<uint32>();
+                for (uint32 Index = 0; Index < NumElements && !Reader.HasError(); ++Index)
+                {
+                    Array.append(ReadJsonValue(Reader));
+                }
+                return Array;
+            }
+            case EExtraTag::String:
+                return JSON(GetString(Reader.Read<uint32>()));
+            case EExtraTag::Float:
+                return JSON(Reader.Read<double>());
+            case EExtraTag::Int:
+                return JSON(static_cast<long>(Reader.Read<int64>()));
+            case EExtraTag::Bool:
+                return JSON(Reader.Read<uint8>() != 0);
+            default:
+                return JSON();
+            }
+        }
+
+        uint32 GetNumClasses() const { return static_cast<uint32>(Plans.Num()); }
+
+        const FString& GetString(uint32 Index) const
+        {
+            return Index < static_cast<uint32>(Strings.Num()) ? Strings[Index] : Strings[0];
+        }
+
+        TArray<FString> Strings;
+
+    private:
+        static uint32 ReadIndex(const uint8* Value)
+        {
+            uint32 Index;
+            memcpy(&Index, Value, sizeof(Index));
+            return Index;
+        }
+
+        static const FProperty* FindMatchingProperty(const UClass* Class, const FString& Name, EPropertyType Type, EPropertyType InnerType, uint32 ValueSize)
+        {
+            if (!Class || ValueSize != GetRecordValueSize(Type, InnerType))
+            {
+                return nullptr;
+            }
+            for (const FProperty& Prop : Class->GetAllProperties())
+            {
+                if (Prop.Type == Type && Prop.InnerType == InnerType && Name == Prop.Name)
+                {
+                    return &Prop;
+                }
+            }
+            return nullptr;
+        }
+
+        // FName 생성은 이름 풀 조회가 필요하므로 문자열 인덱스마다 한 번만
+        const FName& GetName(uint32 Index)
+        {
+            if (Index >= static_cast<uint32>(Names.Num()))
+            {
+                Index = 0;
+            }
+            if (!NameResolved[Index])
+            {
+                Names[Index] = FName(Strings[Index]);
+                NameResolved[Index] = true;
+            }
+            return Names[Index];
+        }
+
+        // 같은 경로는 리소스 매니저 조회도 한 번만 (0번 = 빈 경로 = nullptr)
+        template<typename T>
+        T* LoadResource(uint32 StringIndex, EPropertyType Type)
+        {
+            if (StringIndex == 0 || StringIndex >= static_cast<uint32>(Strings.Num()))
+            {
+                return nullptr;
+            }
+            const uint64 Key = (static_cast<uint64>(Type) << 32) | StringIndex;
+            if (UObject** Found = ResourceCache.Find(Key))
+            {
+                return static_cast<T*>(*Found);
+            }
+            T* Resource = UResourceManager::GetInstance().Load<T>(Strings[StringIndex]);
+            ResourceCache.Add(Key, Resource);
+            return Resource;
+        }
+
+        void ApplyArray(const FProperty& Prop, const uint8* Value, UObject* Object)
+        {
+            uint32 PoolOffset;
+            uint32 Count;
+            memcpy(&PoolOffset, Value, sizeof(PoolOffset));
+            memcpy(&Count, Value + sizeof(PoolOffset), sizeof(Count));
+
+            const uint64 ByteSize = static_cast<uint64>(Count) * GetArrayElementSize(Prop.InnerType);
+            if (static_cast<uint64>(PoolOffset) + ByteSize > ArrayPoolSize)
+            {
+                UE_LOG("[LevelBinary] Array property '%s' is out of range, skipping.", Prop.Name);
+                return;
+            }
+            const uint8* Elements = ArrayPool + PoolOffset;
+
+            switch (Prop.InnerType)
+            {
+            case EPropertyType::Int32:
+            {
+                TArray<int32>& Array = *Prop.GetValuePtr<TArray<int32>>(Object);
+                Array.resize(Count);
+                memcpy(Array.data(), Elements, ByteSize);
+                break;
+            }
+            case EPropertyType::Float:
+            {
+                TArray<float>& Array = *Prop.GetValuePtr<TArray<float>>(Object);
+                Array.resize(Count);
+                memcpy(Array.data(), Elements, ByteSize);
+                break;
+            }
+            case EPropertyType::Bool:
+            {
+                TArray<bool>& Array = *Prop.GetValuePtr<TArray<bool>>(Object);
+                Array.clear();
+                Array.reserve(Count);
+                for (uint32 Index = 0; Index < Count; ++Index)
+                {
+                    Array.push_back(Elements[Index] != 0);
+                }
+                break;
+            }
+            case EPropertyType::FString:
+            {
+                TArray<FString>& Array = *Prop.GetValuePtr<TArray<FString>>(Object);
+                Array.clear();
+                Array.reserve(Count);
+                for (uint32 Index = 0; Index < Count; ++Index)
+                {
+                    Array.Add(GetString(ReadIndex(Elements + Index * sizeof(uint32))));
+                }
+                break;
+            }
+            case EPropertyType::Sound:
+            {
+                TArray<USound*>& Array = *Prop.GetValuePtr<TArray<USound*>>(Object);
+                Array.clear();
+                Array.reserve(Count);
+                for (uint32 Index = 0; Index < Count; ++Index)
+                {
+                    Array.Add(LoadResource<USound>(ReadIndex(Elements + Index * sizeof(uint32)), EPropertyType::Sound));
+                }
+                break;
+            }
+            default:
+                break;
+            }
+        }
+
+        TArray<FLoadClassPlan> Plans;
+        TArray<FName> Names;
+        TArray<bool> NameResolved;
+        TMap<uint64, UObject*> ResourceCache;
+        const uint8* ArrayPool = nullptr;
+        uint32 ArrayPoolSize = 0;
+    };
+
+    void WriteCamera(FBinaryWriter& Out, const FLevelEditorCameraData& InData)
+    {
+        Out.WriteBytes(&InData.Location, sizeof(float) * 3);
+        Out.WriteBytes(&InData.Rotation, sizeof(float) * 3);
+        Out.Write<float>(InData.FOV);
+        Out.Write<float>(InData.NearClip);
+        Out.Write<float>(InData.FarClip);
+    }
+
+    FLevelEditorCameraData ReadCamera(FBinaryReader& Reader)
+    {
+        FLevelEditorCameraData Data;
+        if (const uint8* Bytes = Reader.Skip(sizeof(float) * 3))
+        {
+            memcpy(&Data.Location, Bytes, sizeof(float) * 3);
+        }
+        if (const uint8* Bytes = Reader.Skip(sizeof(float) * 3))
+        {
+            memcpy(&Data.Rotation, Bytes, sizeof(float) * 3);
+        }
+        Data.FOV = Reader.Read<float>();
+        Data.NearClip = Reader.Read<float>();
+        Data.FarClip = Reader.Read<float>();
+        return Data;
+    }
+}
+
+bool FLevelBinarySerializer::IsBinaryLevelFile(const FWideString& InFilePath)
+{
+    std::ifstream File(InFilePath, std::ios::binary);
+    uint32 Magic = 0;
+    if (!File.read(reinterpret_cast<char*>(&Magic), sizeof(Magic)))
+    {
+        return false;
+    }
+    return Magic == FileMagic;
+}
+
+bool FLevelBinarySerializer::SaveLevel(ULevel* InLevel, const FWideString& InFilePath, FLevelFileStats* OutStats)
+{
+    if (!InLevel)
+    {
+        return false;
+    }
+
+    const uint64 StartCycles = FPlatformTime::Cycles64();
+    FLevelSaveContext Context;
+    FBinaryWriter& Objects = Context.Objects;
+
+    uint32 NumActors = 0;
+    uint32 NumComponents = 0;
+    for (AActor* Actor : InLevel->GetActors())
+    {
+        NumActors += Actor ? 1 : 0;
+    }
+    Objects.Write<uint32>(NumActors);
+
+    for (AActor* Actor : InLevel->GetActors())
+    {
+        if (!Actor)
+        {
+            continue;
+        }
+
+        // 클래스가 직접 쓰는 값까지 얻기 위해 기존 Serialize(false)를 그대로 쓰고, 리플렉션 키는 레코드로 옮김
+        JSON ActorJson = JSON::Make(JSON::Class::Object);
+        Actor->Serialize(false, ActorJson);
+
+        const uint32 ActorClassIndex = Context.GetClassIndex(Actor->GetClass());
+        Context.WriteRecord(ActorClassIndex, Actor);
+
+        uint32 RootComponentId = 0;
+        FJsonSerializer::ReadUint32(ActorJson, "RootComponentId", RootComponentId, 0, false);
+
+        // AActor::Serialize와 같은 순서로 순회하므로 OwnedComponents 배열 원소와 1:1로 대응
+        TArray<UActorComponent*> SavedComponents;
+        JSON ComponentsJson;
+        if (FJsonSerializer::ReadArray(ActorJson, "OwnedComponents", ComponentsJson, JSON(), false))
+        {
+            for (UActorComponent* Component : Actor->GetOwnedComponents())
+            {
+                if (Component && Component->IsEditable())
+                {
+                    SavedComponents.Add(Component);
+                }
+            }
+        }
+        const int32 NumComponentJson = std::max(ComponentsJson.size(), 0);   // 배열이 없으면 size()는 -1
+        if (SavedComponents.Num() != NumComponentJson)
+        {
+            UE_LOG("[LevelBinary] Component count mismatch on actor %u (%d vs %d).", Actor->UUID, SavedComponents.Num(), NumComponentJson);
+        }
+        const uint32 NumSaved = static_cast<uint32>(std::min(SavedComponents.Num(), NumComponentJson));
+
+        Objects.Write<uint32>(ActorClassIndex);
+        Objects.Write<uint32>(RootComponentId);
+        Context.WriteExtras(Objects, ActorJson, ActorClassIndex, ActorStructureKeys);
+        Objects.Write<uint32>(NumSaved);
+
+        for (uint32 Index = 0; Index < NumSaved; ++Index)
+        {
+            UActorComponent* Component = SavedComponents[Index];
+            const uint32 ComponentClassIndex = Context.GetClassIndex(Component->GetClass());
+            Context.WriteRecord(ComponentClassIndex, Component);
+
+            Objects.Write<uint32>(ComponentClassIndex);
+            Context.WriteExtras(Objects, ComponentsJson.at(Index), ComponentClassIndex, ComponentStructureKeys);
+        }
+        NumComponents += NumSaved;
+    }
+
+    FBinaryWriter FileData;
+    FileData.Write<uint32>(FileMagic);
+    FileData.Write<uint32>(FileVersion);
+    FileData.Write<uint32>(UObject::PeekNextUUID());
+
+    FLevelEditorCameraData CameraData;
+    ULevel::CaptureEditorCamera(CameraData);
+    WriteCamera(FileData, CameraData);
+
+    Context.WriteTables(FileData);
+
+    std::ofstream File(InFilePath, std::ios::binary | std::ios::trunc);
+    if (!File.is_open())
+    {
+        return false;
+    }
+    File.write(reinterpret_cast<const char*>(FileData.Buffer.data()), FileData.Buffer.size());
+    File.close();
+    if (File.fail())
+    {
+        return false;
+    }
+
+    if (OutStats)
+    {
+        OutStats->FileBytes = FileData.Buffer.size();
+        OutStats->NumActors = NumActors;
+        OutStats->NumComponents = NumComponents;
+        OutStats->NumStrings = static_cast<uint32>(Context.Strings.Num());
+        OutStats->NumClasses = static_cast<uint32>(Context.Classes.Num());
+        OutStats->Milliseconds = FPlatformTime::ToMilliseconds(FPlatformTime::Cycles64() - StartCycles);
+    }
+    return true;
+}
+
+bool FLevelBinarySerializer::LoadLevel(ULevel* OutLevel, const FWideString& InFilePath, FLevelFileStats* OutStats)
+{
+    if (!OutLevel)
+    {
+        return false;
+    }
+
+    const uint64 StartCycles = FPlatformTime::Cycles64();
+    FWindowsMappedFile File(InFilePath);
+    if (!File.IsOpen() || !File.GetData())
+    {
+        return false;
+    }
+
+    FBinaryReader Reader(reinterpret_cast<const uint8*>(File.GetData()), File.GetSize());
+    if (Reader.Read<uint32>() != FileMagic)
+    {
+        UE_LOG("[error] LevelBinary: Not a binary level file.");
+        return false;
+    }
+    const uint32 Version = Reader.Read<uint32>();
+    if (Version == 0 || Version > FileVersion)
+    {
+        UE_LOG("[error] LevelBinary: Unsupported level version %u (max %u).", Version, FileVersion);
+        return false;
+    }
+    Reader.Read<uint32>();  // 저장 당시 NextUUID (JSON 포맷과 같이 참고용)
+    const FLevelEditorCameraData CameraData = ReadCamera(Reader);
+
+    FLevelLoadContext Context;
+    if (!Context.ReadTables(Reader))
+    {
+        UE_LOG("[error] LevelBinary: Level file is truncated or corrupt.");
+        return false;
+    }
+
+    ULevel::ApplyEditorCamera(CameraData);
+
+    uint32 NumLoadedActors = 0;
+    uint32 NumLoadedComponents = 0;
+    const uint32 NumActors = Reader.Read<uint32>();
+    for (uint32 ActorIndex = 0; ActorIndex < NumActors && !Reader.HasError(); ++ActorIndex)
+    {
+        const uint32 ActorClassIndex = Reader.Read<uint32>();
+        const uint32 RootComponentId = Reader.Read<uint32>();
+        JSON ActorExtras = Context.ReadJsonValue(Reader);
+        const uint32 NumComponents = Reader.Read<uint32>();
+
+        FLoadClassPlan* ActorPlan = Context.GetPlan(ActorClassIndex);
+        const uint8* ActorRecord = ActorPlan ? Context.TakeRecord(*ActorPlan) : nullptr;
+
+        AActor* NewActor = nullptr;
+        if (ActorRecord && ActorPlan->Class && ActorPlan->Class->IsChildOf(AActor::StaticClass()))
+        {
+            NewActor = Cast<AActor>(ObjectFactory::NewObject(ActorPlan->Class));
+        }
+        if (NewActor)
+        {
+            OutLevel->AddActor(NewActor);
+            Context.ApplyRecord(*ActorPlan, ActorRecord, NewActor);
+
+            // 액터 생성자에서 만들어진 컴포넌트를 무시하고 저장된 컴포넌트만 다시 붙인다 (AActor::Serialize와 동일)
+            NewActor->DestroyAllComponents();
+        }
+
+        for (uint32 ComponentIndex = 0; ComponentIndex < NumComponents && !Reader.HasError(); ++ComponentIndex)
+        {
+            const uint32 ComponentClassIndex = Reader.Read<uint32>();
+            JSON ComponentExtras = Context.ReadJsonValue(Reader);
+
+            FLoadClassPlan* ComponentPlan = Context.GetPlan(ComponentClassIndex);
+            const uint8* ComponentRecord = ComponentPlan ? Context.TakeRecord(*ComponentPlan) : nullptr;
+            if (!NewActor || !ComponentRecord || !ComponentPlan->Class || !ComponentPlan->Class->IsChildOf(UActorComponent::StaticClass()))
+            {
+                continue;
+            }
+
+            UActorComponent* NewComponent = Cast<UActorComponent>(ObjectFactory::NewObject(ComponentPlan->Class));
+            Context.ApplyRecord(*ComponentPlan, ComponentRecord, NewComponent);
+            SerializeRemainder(NewComponent, ComponentExtras);
+
+            if (USceneComponent* NewSceneComponent = Cast<USceneComponent>(NewComponent))
+            {
+                if (RootComponentId == NewSceneComponent->GetSceneId())
+                {
+                    NewActor->SetRootComponent(NewSceneComponent);
+                }
+            }
+            NewActor->AddOwnedComponent(NewComponent);
+            ++NumLoadedComponents;
+        }
+
+        if (NewActor)
+        {
+            NewActor->AttachLoadedComponents();
+            SerializeRemainder(NewActor, ActorExtras);
+            ++NumLoadedActors;
+        }
+    }
+
+    if (Reader.HasError())
+    {
+        UE_LOG("[error] LevelBinary: Object stream ended early, loaded %u of %u actors.", NumLoadedActors, NumActors);
+    }
+
+    if (OutStats)
+    {
+        OutStats->FileBytes = File.GetSize();
+        OutStats->NumActors = NumLoadedActors;
+        OutStats->NumComponents = NumLoadedComponents;
+        OutStats->NumStrings = static_cast<uint32>(Context.Strings.Num());
+        OutStats->NumClasses = Context.GetNumClasses();
+        OutStats->Milliseconds = FPlatformTime::ToMilliseconds(FPlatformTime::Cycles64() - StartCycles);
+    }
+    return !Reader.HasError();
+}
+
+void FLevelBinarySerializer::SerializeRemainder(UObject* Object, JSON& Extras)
+{
+    const UObject* PreviousTarget = UObject::BinaryLoadTarget;
+    UObject::BinaryLoadTarget = Object;
+    Object->Serialize(true, Extras);
+    UObject::BinaryLoadTarget = PreviousTarget;
+}
@@ -0,0 +1,42 @@
+﻿#pragma once
+#include "UEContainer.h"
+
+class ULevel;
+class UObject;
+namespace json { class JSON; }
+
+// 레벨 파일 저장/로드 결과 (로그/벤치마크용)
+struct FLevelFileStats
+{
+    uint64 FileBytes = 0;
+    uint32 NumActors = 0;
+    uint32 NumComponents = 0;
+    uint32 NumStrings = 0;
+    uint32 NumClasses = 0;
+    double Milliseconds = 0.0;
+};
+
+/**
+ * FProperty 리플렉션 기반 바이너리 레벨 포맷
+ * [헤더][문자열 테이블][클래스 스키마][클래스별 프로퍼티 레코드][배열 풀][객체 스트림]
+ * - 리플렉션 프로퍼티는 클래스별 고정 크기 레코드에 연속으로 저장 (문자열/FName/리소스 경로는 문자열 테이블 인덱스)
+ * - 클래스 Serialize()가 직접 쓰는 나머지 값(Id/ParentId, 머티리얼 슬롯 등)은 JSON 트리를 바이너리로 인코딩해 객체마다 붙임
+ * - 로드는 파일을 매핑해 한 번에 훑으며, 스키마 프로퍼티를 현재 클래스에 이름+타입으로 맞춰 적용
+ *   (프로퍼티가 추가/삭제/타입 변경되어도 나머지 값은 그대로 읽힘)
+ * JSON 씬은 내보내기/디버그용으로 유지하고, 로드 쪽은 매직 값으로 포맷을 구분함
+ */
+class FLevelBinarySerializer
+{
+public:
+    static constexpr uint32 FileMagic = 0x4D4C5642;   // "BVLM"
+    static constexpr uint32 FileVersion = 1;
+
+    static bool IsBinaryLevelFile(const FWideString& InFilePath);
+
+    static bool SaveLevel(ULevel* InLevel, const FWideString& InFilePath, FLevelFileStats* OutStats = nullptr);
+    static bool LoadLevel(ULevel* OutLevel, const FWideString& InFilePath, FLevelFileStats* OutStats = nullptr);
+
+private:
+    // 레코드를 적용한 객체에 클래스 Serialize(true)를 호출 (리플렉션 루프/컴포넌트 재구성은 건너뜀)
+    static void SerializeRemainder(UObject* Object, json::JSON& Extras);
+};
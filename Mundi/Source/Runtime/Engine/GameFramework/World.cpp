@@ -26,11 +26,13 @@
 #include "AmbientLightComponent.h"
 #include "Frustum.h"
 #include "Level.h"
+#include "LevelBinarySerializer.h"
 #include "LightManager.h"
 #include "LuaManager.h"
 #include "ShapeComponent.h"
 #include "PlayerCameraManager.h"
 #include "Hash.h"
+#include "ObjectDuplication.h"
 
 IMPLEMENT_CLASS(UWorld)
 
@@ -83,6 +85,7 @@ UWorld::~UWorld()
 		DestroyActor(Actor);
 	}
 	EditorActors.clear();
+	PendingTransformUpdates.clear();
 
 	GridActor = nullptr;
 	GizmoActor = nullptr;
@@ -162,13 +165,30 @@ bool UWorld::TryLoadLastUsedLevel()
 bool UWorld::LoadLevelFromFile(const FWideString& Path)
 {
 	std::unique_ptr<ULevel> NewLevel = ULevelService::CreateDefaultLevel();
-	JSON LevelJsonData;
 
-	if (FJsonSerializer::LoadJsonFromFile(LevelJsonData, Path))
+	// 바이너리 레벨이 기본, 예전 JSON 씬도 그대로 읽음
+	bool bLoaded = false;
+	if (FLevelBinarySerializer::IsBinaryLevelFile(Path))
 	{
-		NewLevel->Serialize(true, LevelJsonData);
+		FLevelFileStats Stats;
+		bLoaded = FLevelBinarySerializer::LoadLevel(NewLevel.get(), Path, &Stats);
+		if (bLoaded)
+		{
+			UE_LOG("UWorld: Binary level %u actors / %u components, %.1f KB, %.2f ms",
+				Stats.NumActors, Stats.NumComponents, Stats.FileBytes / 1024.0, Stats.Milliseconds);
+		}
 	}
 	else
+	{
+		JSON LevelJsonData;
+		bLoaded = FJsonSerializer::LoadJsonFromFile(LevelJsonData, Path);
+		if (bLoaded)
+		{
+			NewLevel->Serialize(true, LevelJsonData);
+		}
+	}
+
+	if (!bLoaded)
 	{
 		UE_LOG("[error] MainToolbar: Failed To Load Level From: %s", Path.c_str());
 		return false;
@@ -284,6 +304,19 @@ void UWorld::Tick(float DeltaSeconds)
 
 	// 지연 삭제 처리
 	ProcessPendingKillActors();
+
+	// 이번 틱에 바뀐 트랜스폼의 알림을 부모 → 자식 순으로 한 번씩 처리
+	FlushTransformUpdates();
+}
+
+void UWorld::FlushTransformUpdates()
+{
+	if (PendingTransformUpdates.IsEmpty() || bIsTearingDown)
+	{
+		return;
+	}
+
+	USceneComponent::FlushPendingTransformUpdates(PendingTransformUpdates);
 }
 
 UWorld* UWorld::DuplicateWorldForPIE(UWorld* InEditorWorld)
@@ -305,6 +338,12 @@ UWorld* UWorld::DuplicateWorldForPIE(UWorld* InEditorWorld)
 	GEngine.AddWorldContext(PIEWorldContext);
 	
 	const TArray<AActor*>& SourceActors = InEditorWorld->GetLevel()->GetActors();
+
+	// 원본 → 사본 테이블은 전체 액터/컴포넌트에 대해 한 번만 예약 (액터당 컴포넌트 몇 개로 어림)
+	FObjectDuplicationContext DuplicationContext(SourceActors.Num() * 4);
+	TArray<AActor*> NewActors;
+	NewActors.Reserve(SourceActors.Num());
+
 	for (AActor* SourceActor : SourceActors)
 	{
 		if (!SourceActor)
@@ -321,18 +360,30 @@ UWorld* UWorld::DuplicateWorldForPIE(UWorld* InEditorWorld)
 			continue;
 		}
 
-		// PlayerCameraManager 복사
-		if (InEditorWorld->PlayerCameraManager == SourceActor)
+		DuplicationContext.Record(SourceActor, NewActor);
+		NewActors.Add(NewActor);
+	}
+
+	// PlayerCameraManager 복사
+	if (APlayerCameraManager* NewPlayerCameraManager = Cast<APlayerCameraManager>(DuplicationContext.FindCopy(InEditorWorld->PlayerCameraManager)))
+	{
+		PIEWorld->PlayerCameraManager = NewPlayerCameraManager;
+	}
+
+	// 모든 사본이 만들어진 뒤에 액터/컴포넌트가 원본을 가리키는 참조를 사본으로 재연결하고 레벨에 추가
+	for (AActor* NewActor : NewActors)
+	{
+		DuplicationContext.RemapObjectReferences(NewActor);
+		for (UActorComponent* NewComponent : NewActor->GetOwnedComponents())
 		{
-			if (APlayerCameraManager* NewPlayerCameraManager = Cast<APlayerCameraManager>(NewActor))
-			{
-				PIEWorld->PlayerCameraManager = NewPlayerCameraManager;
-			}
+			DuplicationContext.RemapObjectReferences(NewComponent);
 		}
-
-		PIEWorld->AddActorToLevel(NewActor);
+		PIEWorld->GetLevel()->AddActor(NewActor);
 	}
 
+	// 컴포넌트 등록은 모든 액터가 레벨에 들어간 뒤 한 번에 (파티션은 BulkRegister 한 번)
+	PIEWorld->RegisterActorsBatched(NewActors);
+
 	return PIEWorld;
 }
 
@@ -503,19 +554,7 @@ void UWorld::SetLevel(std::unique_ptr<ULevel> InLevel)
     // Adopt actors: set world and register
     if (Level)
     {
-		// Bulk register only if partition exists
-		if (Partition)
-		{
-			Partition->BulkRegister(Level->GetActors());
-		}
-        for (AActor* Actor : Level->GetActors())
-        {
-			if (Actor)
-			{
-				Actor->SetWorld(this);
-				Actor->RegisterAllComponents(this);
-}
-        }
+		RegisterActorsBatched(Level->GetActors());
     }
 
 	// 씬에서 PCM 검색
@@ -546,6 +585,56 @@ void UWorld::AddActorToLevel(AActor* Actor)
 	}
 }
 
+// 후보가 2개 이상일 때만 레벨 배열을 한 번 훑어 레벨 순서로 다시 채움
+void UWorld::SortActorsByLevelOrder(TArray<AActor*>& InOutActors) const
+{
+	if (InOutActors.Num() < 2 || !Level)
+	{
+		return;
+	}
+
+	TFlatSet<const AActor*> Candidates;
+	Candidates.reserve(InOutActors.Num());
+	for (AActor* Actor : InOutActors)
+	{
+		Candidates.Add(Actor);
+	}
+
+	InOutActors.clear();
+	for (AActor* Actor : Level->GetActors())
+	{
+		if (Actor && Candidates.Contains(Actor))
+		{
+			InOutActors.Add(Actor);
+		}
+	}
+}
+
+void UWorld::RegisterActorsBatched(const TArray<AActor*>& Actors)
+{
+	// 개별 Register는 더티 큐를 거쳐 틱 budget 단위로 나뉘어 반영되므로, 등록 동안 끄고 끝에 한 번에 넣음
+	// (Bulk register only if partition exists)
+	if (Partition)
+	{
+		Partition->SetDeferRegister(true);
+	}
+
+	for (AActor* Actor : Actors)
+	{
+		if (Actor)
+		{
+			Actor->SetWorld(this);
+			Actor->RegisterAllComponents(this);
+		}
+	}
+
+	if (Partition)
+	{
+		Partition->SetDeferRegister(false);
+		Partition->BulkRegister(Actors);
+	}
+}
+
 void UWorld::AddPendingKillActor(AActor* Actor)
 {
 	PendingKillActors.Add(Actor);
@@ -5,6 +5,7 @@
 #include "Level.h"
 #include "Gizmo/GizmoActor.h"
 #include "LightManager.h"
+#include "ObjectIterator.h"
 
 // Forward Declarations
 class UResourceManager;
@@ -27,6 +28,7 @@ class BVHierachy;
 class UStaticMesh;
 class FOcclusionCullingManagerCPU;
 class APlayerCameraManager;
+class USceneComponent;
 
 struct FTransform;
 struct FSceneCompData;
@@ -83,6 +85,8 @@ public:
     AActor* SpawnActor(UClass* Class);
     AActor* SpawnPrefabActor(const FWideString& PrefabPath);
     void AddActorToLevel(AActor* Actor);
+    // 이미 레벨에 있는 액터들을 월드에 편입: 월드 설정 → 컴포넌트 등록 → 파티션 일괄 등록 (BVH 리빌드 한 번)
+    void RegisterActorsBatched(const TArray<AActor*>& Actors);
 
     void AddPendingKillActor(AActor* Actor);
     void ProcessPendingKillActors();
@@ -118,6 +122,11 @@ public:
     // Overlap pair de-duplication (per-frame)
     bool TryMarkOverlapPair(const AActor* A, const AActor* B);
 
+    // 트랜스폼이 바뀐 씬 컴포넌트의 OnTransformUpdated를 모아서 처리 (틱 끝, 렌더 직전에 호출)
+    void FlushTransformUpdates();
+    TArray<USceneComponent*>& GetPendingTransformUpdates() { return PendingTransformUpdates; }
+    bool IsTearingDown() const { return bIsTearingDown; }
+
     TMap<TWeakObjectPtr<AActor>, FActorTimeState> ActorTimingMap;
 
     /** === 필요한 엑터 게터 === */
@@ -140,6 +149,11 @@ public:
 private:
     bool DestroyActor(AActor* Actor);   // 즉시 삭제
 
+    // FindActor/FindActors 보조: 클래스별 객체 목록에서 레벨 액터를 모으고, 레벨 배열 순서로 맞춤
+    template<typename T>
+    TArray<AActor*> CollectLevelActorsOfClass();
+    void SortActorsByLevelOrder(TArray<AActor*>& InOutActors) const;
+
 private:
     /** === 에디터 특수 액터 관리 === */
     TArray<AActor*> EditorActors;
@@ -174,6 +188,9 @@ private:
     // Per-frame processed overlap pairs (A,B) keyed canonically
     TSet<uint64> FrameOverlapPairs;
 
+    // 이번 프레임에 트랜스폼 변경 알림을 기다리는 컴포넌트 (컴포넌트당 한 번만 올라감)
+    TArray<USceneComponent*> PendingTransformUpdates;
+
     //Timinig
     float UnscaledDelta;
     float SlomoOnlyDelta;
@@ -216,79 +233,94 @@ inline T* UWorld::SpawnActor(const FTransform& Transform)
 }
 
 // 월드에서 특정 클래스(T)의 '첫 번째' 액터를 찾아 반환합니다. 없으면 nullptr.
+// T와 파생 클래스의 객체 목록만 보고 이 월드 레벨에 속한 액터로 거름 (레벨 전체를 훑지 않음)
+// 후보가 여럿이면 레벨 배열 순서로 첫 번째 (객체 목록은 생성 순서라서)
 template<typename T>
 inline T* UWorld::FindActor()
 {
     static_assert(std::is_base_of_v<AActor, T>, "T must be derived from AActor.");
 
-    UClass* TypeClass = T::StaticClass();
-    if (!TypeClass)
-    {
-        return nullptr;
-    }
-
-    for (AActor* Actor : Level->GetActors())
-    {
-        if (Actor && !Actor->IsPendingDestroy() &&Actor->IsA(TypeClass))
-        {
-            // 찾은 액터를 T* 타입으로 캐스팅하여 반환합니다.
-            // (IsA를 통과했으므로 Cast는 안전함)
-            return Cast<T>(Actor);
-        }
-    }
-    return nullptr;
+    TArray<AActor*> Candidates = CollectLevelActorsOfClass<T>();
+    SortActorsByLevelOrder(Candidates);
+    return Candidates.IsEmpty() ? nullptr : static_cast<T*>(Candidates[0]);
 }
 
-// 월드에서 특정 클래스(T)의 '모든' 액터를 찾아 반환합니다. 없으면 nullptr.
+// 월드에서 특정 클래스(T)의 '모든' 액터를 레벨 순서로 찾아 반환합니다. 없으면 빈 배열.
 template<typename T>
 inline TArray<T*> UWorld::FindActors()
 {
     static_assert(std::is_base_of_v<AActor, T>, "T must be derived from AActor.");
 
+    TArray<AActor*> Candidates = CollectLevelActorsOfClass<T>();
+    SortActorsByLevelOrder(Candidates);
+
     TArray<T*> FoundActors;
+    FoundActors.Reserve(Candidates.Num());
+    for (AActor* Actor : Candidates)
+    {
+        FoundActors.Add(static_cast<T*>(Actor));
+    }
+    return FoundActors;
+}
 
-    UClass* TypeClass = T::StaticClass();
-    if (!TypeClass)
+// T와 파생 클래스의 객체 목록에서 이 월드 레벨에 속한 (삭제 대기 아닌) 액터만 모음. 순서는 객체 목록 순서
+template<typename T>
+inline TArray<AActor*> UWorld::CollectLevelActorsOfClass()
+{
+    TArray<AActor*> Candidates;
+    if (!Level)
     {
-        return FoundActors; // 빈 배열 반환
+        return Candidates;
     }
 
-    for (AActor* Actor : Level->GetActors())
+    for (TObjectIterator<T> It; It; ++It)
     {
-        if (Actor && !Actor->IsPendingDestroy() && Actor->IsA(TypeClass))
+        T* Actor = *It;
+        if (Actor->GetLevel() == Level.get() && !Actor->IsPendingDestroy())
         {
-            // 일치하는 모든 액터를 캐스팅하여 배열에 추가
-            FoundActors.Add(Cast<T>(Actor));
+            Candidates.Add(Actor);
         }
     }
-    return FoundActors;
+    return Candidates;
 }
 
-// 모든 액터의 컴포넌트를 순회해서 클래스(T)의 '첫 번째' 컴포넌트를 찾아 반환합니다. 없으면 nullptr. (비용이 크기 때문에 매 프레임 호출 비권장)
+// 레벨 액터가 가진 클래스(T)의 '첫 번째' 컴포넌트를 찾아 반환합니다. 없으면 nullptr.
+// T와 파생 클래스의 컴포넌트 목록만 보고 소유 액터가 이 월드 레벨에 있는지 확인
+// 후보가 여럿이면 소유 액터의 레벨 순서로 첫 번째
 template<typename T>
 inline T* UWorld::FindComponent()
 {
     static_assert(std::is_base_of_v<UActorComponent, T>, "T must be derived from UActorComponent.");
 
-    UClass* TypeClass = T::StaticClass();
-    if (!TypeClass)
+    if (!Level)
     {
         return nullptr;
     }
 
-    for (AActor* Actor : Level->GetActors())
+    T* FirstFound = nullptr;
+    TFlatMap<const AActor*, T*> FoundByOwner;
+    for (TObjectIterator<T> It; It; ++It)
     {
-        if (Actor && !Actor->IsPendingDestroy())
+        T* Component = *It;
+        AActor* Owner = Component->GetOwner();
+        if (Owner && Owner->GetLevel() == Level.get() && !Owner->IsPendingDestroy() && !Component->IsPendingDestroy())
         {
-            for (UActorComponent* Component : Actor->GetOwnedComponents())
-            {
-                if (Component && !Component->IsPendingDestroy() && Component->IsA(TypeClass))
-                {
-                    return Cast<T>(Component);
-                }
-            }
+            FirstFound = FirstFound ? FirstFound : Component;
+            FoundByOwner.try_emplace(Owner, Component);
         }
     }
 
+    if (FoundByOwner.Num() <= 1)
+    {
+        return FirstFound;
+    }
+
+    for (AActor* Actor : Level->GetActors())
+    {
+        if (T* const* Found = FoundByOwner.Find(Actor))
+        {
+            return *Found;
+        }
+    }
     return nullptr;
 }
@@ -49,6 +49,10 @@ void UWorldPartitionManager::Clear()
 // 새로 만들어진 StaticMeshComponent를 등록하는 상황에서 맥락을 분명히 드러내기 위한 API입니다.
 void UWorldPartitionManager::Register(UPrimitiveComponent* Smc)
 {
+	if (bDeferRegister)
+	{
+		return; // 뒤따르는 BulkRegister가 처리
+	}
 	MarkDirty(Smc);
 }
 
@@ -59,17 +63,26 @@ void UWorldPartitionManager::BulkRegister(const TArray<AActor*>& Actors)
 	TArray<UPrimitiveComponent*> StaticMeshComponents;
 	StaticMeshComponents.Reserve(Actors.size());
 
+	// 에디터 액터는 포함하지 않는다. (액터마다 배열을 복사해 찾지 않도록 한 번만 모아 둠)
+	TFlatSet<const AActor*> EditorActors;
+	if (GWorld)
+	{
+		for (AActor* EditorActor : GWorld->GetEditorActors())
+		{
+			EditorActors.Add(EditorActor);
+		}
+	}
+
 	for (AActor* Actor : Actors)
 	{
-		TArray<AActor*> EditorActors = GWorld->GetEditorActors();
-		auto it = std::find(EditorActors.begin(), EditorActors.end(), Actor);
-		if (it != EditorActors.end())
-			continue; // 에디터 액터는 포함하지 않는다.
+		if (!Actor || EditorActors.Contains(Actor))
+			continue;
 
-		const TArray<USceneComponent*> Components = Actor->GetSceneComponents();
-		for (USceneComponent* Component : Components)
+		for (USceneComponent* Component : Actor->GetSceneComponents())
 		{
-			if (UPrimitiveComponent* Smc = Cast<UPrimitiveComponent>(Component))
+			// MarkDirty와 같은 기준: 에디터 전용 컴포넌트는 제외
+			UPrimitiveComponent* Smc = Cast<UPrimitiveComponent>(Component);
+			if (Smc && Smc->IsEditable())
 			{
 				StaticMeshComponents.push_back(Smc);
 				ComponentDirtySet.erase(Smc);
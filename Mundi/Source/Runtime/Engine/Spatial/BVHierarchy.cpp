@@ -62,8 +62,8 @@ FBVHierarchy::~FBVHierarchy()
 
 void FBVHierarchy::Clear()
 {
-    // NOTE: TMap, TArray를 clear로 비우면 capacity가 그대로이기 때문에 새 객체로 초기화
-    StaticMeshComponentBounds = TMap<UPrimitiveComponent*, FAABB>();
+    // NOTE: TFlatMap, TArray를 clear로 비우면 capacity가 그대로이기 때문에 새 객체로 초기화
+    StaticMeshComponentBounds = TFlatMap<UPrimitiveComponent*, FAABB>();
     StaticMeshComponentArray = TArray<UPrimitiveComponent*>();
     Nodes = TArray<FLBVHNode>();
     Bounds = FAABB();
@@ -509,7 +509,7 @@ TArray<UPrimitiveComponent*> FBVHierarchy::QueryIntersectedComponentsGeneric(
     NodeIntersectFunc NodeIntersects,
     ComponentIntersectFunc ComponentIntersects) const
 {
-    TSet<UPrimitiveComponent*> IntersectedComponents;
+    TFlatSet<UPrimitiveComponent*> IntersectedComponents;
     if (Nodes.empty())
         return TArray<UPrimitiveComponent*>();
     TArray<int32> IdxStack;
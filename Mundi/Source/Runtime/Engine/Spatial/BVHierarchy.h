@@ -76,7 +76,7 @@ private:
     int MaxObjects;
     FAABB Bounds;
 
-    TMap<UPrimitiveComponent*, FAABB> StaticMeshComponentBounds;
+    TFlatMap<UPrimitiveComponent*, FAABB> StaticMeshComponentBounds;
     TArray<UPrimitiveComponent*> StaticMeshComponentArray;
 
     // LBVH nodes
@@ -1,7 +1,7 @@
 ﻿#include "pch.h"
 #include "MeshBVH.h"
 
-void FMeshBVH::Build(const TArray<FNormalVertex>& Vertices, const TArray<uint32>& Indices)
+void FMeshBVH::Build(const TArray<FVector>& Positions, const TArray<uint32>& Indices)
 {
 	TriIndices.Empty();
 	Nodes.Empty();
@@ -12,13 +12,13 @@ void FMeshBVH::Build(const TArray<FNormalVertex>& Vertices, const TArray<uint32>
 	for (uint32 t = 0; t < TriCount; ++t)
 		TriIndices.Add(t);
 
-	BuildRecursive(0, TriCount, Vertices, Indices);
+	BuildRecursive(0, TriCount, Positions, Indices);
 }
 
 // 삼각형과 맞을 경우 , BVH를 따라 내려가면서 교차 가능성 있는 노드만 검사한다. 
 // Möller–Trumbore로 교차 체크 ! 
 bool FMeshBVH::IntersectRay(const FRay& InLocalRay,
-	const TArray<FNormalVertex>& InVertices,
+	const TArray<FVector>& InPositions,
 	const TArray<uint32>& InIndices,
 	float& OutHitDistance)
 {
@@ -62,9 +62,9 @@ bool FMeshBVH::IntersectRay(const FRay& InLocalRay,
 				const uint32 V1 = InIndices[3 * TriangleID + 1];
 				const uint32 V2 = InIndices[3 * TriangleID + 2];
 
-				const FVector& A = InVertices[V0].pos;
-				const FVector& B = InVertices[V1].pos;
-				const FVector& C = InVertices[V2].pos;
+				const FVector& A = InPositions[V0];
+				const FVector& B = InPositions[V1];
+				const FVector& C = InPositions[V2];
 
 				float HitT = 0.0f;
 				if (IntersectRayTriangleMT(InLocalRay, A, B, C, HitT))
@@ -188,7 +188,7 @@ bool FMeshBVH::IntersectRay(const FRay& InLocalRay,
 //	return false;
 //}
 
-FAABB FMeshBVH::ComputeTriBounds(uint32 TriangleID, const TArray<FNormalVertex>& Vertices, const TArray<uint32>& Indices) const
+FAABB FMeshBVH::ComputeTriBounds(uint32 TriangleID, const TArray<FVector>& Positions, const TArray<uint32>& Indices) const
 {
 	// TriangleID : 몇 번째 삼각형인지 (0번, 1번 , 2번)
 	uint32 VertexIndex0, VertexIndex1, VertexIndex2;
@@ -200,9 +200,9 @@ FAABB FMeshBVH::ComputeTriBounds(uint32 TriangleID, const TArray<FNormalVertex>&
 
 
 	// 실제 정점 좌표들을 가져온다. 
-	const FVector& VertexA = Vertices[VertexIndex0].pos;
-	const FVector& VertexB = Vertices[VertexIndex1].pos;
-	const FVector& VertexC = Vertices[VertexIndex2].pos;
+	const FVector& VertexA = Positions[VertexIndex0];
+	const FVector& VertexB = Positions[VertexIndex1];
+	const FVector& VertexC = Positions[VertexIndex2];
 
 	// AABB 최소/최대 좌표 계산
 	FVector MinCorner(
@@ -221,7 +221,7 @@ FAABB FMeshBVH::ComputeTriBounds(uint32 TriangleID, const TArray<FNormalVertex>&
 	return FAABB(MinCorner, MaxCorner);
 }
 
-FVector FMeshBVH::ComputeTriCenter(uint32 TriangleID, const TArray<FNormalVertex>& Vertices, const TArray<uint32>& Indices) const
+FVector FMeshBVH::ComputeTriCenter(uint32 TriangleID, const TArray<FVector>& Positions, const TArray<uint32>& Indices) const
 {
 	// 삼각형을 구성하는 세 개의 정점 인덱스
 	const uint32 VertexIndex0 = Indices[TriangleID * 3 + 0];
@@ -229,9 +229,9 @@ FVector FMeshBVH::ComputeTriCenter(uint32 TriangleID, const TArray<FNormalVertex
 	const uint32 VertexIndex2 = Indices[TriangleID * 3 + 2];
 
 	// 실제 좌표
-	const FVector& Position0 = Vertices[VertexIndex0].pos;
-	const FVector& Position1 = Vertices[VertexIndex1].pos;
-	const FVector& Position2 = Vertices[VertexIndex2].pos;
+	const FVector& Position0 = Positions[VertexIndex0];
+	const FVector& Position1 = Positions[VertexIndex1];
+	const FVector& Position2 = Positions[VertexIndex2];
 
 	// 중심점(무게중심) 계산
 
@@ -241,15 +241,15 @@ FVector FMeshBVH::ComputeTriCenter(uint32 TriangleID, const TArray<FNormalVertex
 }
 
 // 여러 삼각형을 한 번에 감싸는 AABB를 계산 
-FAABB FMeshBVH::ComputeBounds(uint32 Start, uint32 Count, const TArray<FNormalVertex>& Vertices, const TArray<uint32>& Indices) const
+FAABB FMeshBVH::ComputeBounds(uint32 Start, uint32 Count, const TArray<FVector>& Positions, const TArray<uint32>& Indices) const
 {
 	// 첫 번째 삼각형 ID로 AABB 초기화 
-	FAABB Bounds = ComputeTriBounds(TriIndices[Start], Vertices, Indices);
+	FAABB Bounds = ComputeTriBounds(TriIndices[Start], Positions, Indices);
 	// Start+1 ~ Start+Count-1 까지 모든 삼각형에 대해 반복 
 	// 가장 큰 MIN , MAX 찾아낸다. 
 	for (uint32 i = 1; i < Count; i++)
 	{
-		FAABB TB = ComputeTriBounds(TriIndices[Start + i], Vertices, Indices);
+		FAABB TB = ComputeTriBounds(TriIndices[Start + i], Positions, Indices);
 		Bounds.Min = Bounds.Min.ComponentMin(TB.Min);
 		Bounds.Max = Bounds.Max.ComponentMax(TB.Max);
 	}
@@ -257,14 +257,14 @@ FAABB FMeshBVH::ComputeBounds(uint32 Start, uint32 Count, const TArray<FNormalVe
 }
 
 // BVH 트리 -> 재귀 구축 
-int FMeshBVH::BuildRecursive(uint32 Start, uint32 Count, const TArray<FNormalVertex>& Vertices, const TArray<uint32>& Indices)
+int FMeshBVH::BuildRecursive(uint32 Start, uint32 Count, const TArray<FVector>& Positions, const TArray<uint32>& Indices)
 {
 	FMeshBVHNode Node;
 	Node.Start = Start;
 	Node.Count = Count;
 
 	// 이 노드가 감싸는 AABB 계산
-	Node.Bounds = ComputeBounds(Start, Count, Vertices, Indices);
+	Node.Bounds = ComputeBounds(Start, Count, Positions, Indices);
 
 	// 현재 노드 인덱스 확보 & 추가 -> 자식으로 쪼갤 때 사용 
 	int NodeIndex = Nodes.Num();
@@ -308,8 +308,8 @@ int FMeshBVH::BuildRecursive(uint32 Start, uint32 Count, const TArray<FNormalVer
 		TriIndices.begin() + Start + Count, // 분할할 구간의 끝 
 		[&](uint32 A, uint32 B)			// 비교함수 
 		{
-			FVector CenterA = ComputeTriCenter(A, Vertices, Indices);
-			FVector CenterB = ComputeTriCenter(B, Vertices, Indices);
+			FVector CenterA = ComputeTriCenter(A, Positions, Indices);
+			FVector CenterB = ComputeTriCenter(B, Positions, Indices);
 
 			switch (Axis)
 			{
@@ -326,8 +326,8 @@ int FMeshBVH::BuildRecursive(uint32 Start, uint32 Count, const TArray<FNormalVer
 	// 자식 생성으로 본인 Count 초기화.
 	// Left, Right에 자식 달기 
 	Nodes[NodeIndex].Count = 0;
-	Nodes[NodeIndex].Left = BuildRecursive(Start, Mid - Start, Vertices, Indices);
-	Nodes[NodeIndex].Right = BuildRecursive(Mid, Start + Count - Mid, Vertices, Indices);
+	Nodes[NodeIndex].Left = BuildRecursive(Start, Mid - Start, Positions, Indices);
+	Nodes[NodeIndex].Right = BuildRecursive(Mid, Start + Count - Mid, Positions, Indices);
 
 	return NodeIndex;
 }
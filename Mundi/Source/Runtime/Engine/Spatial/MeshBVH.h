@@ -21,20 +21,22 @@ class FMeshBVH
 {
 public:
 
-	void Build(const TArray<FNormalVertex>& Vertices, const TArray<uint32>& Indices);
+	void Build(const TArray<FVector>& Positions, const TArray<uint32>& Indices);
 
-	bool IntersectRay(const FRay& InLocalRay, const TArray<FNormalVertex>& InVertices, const TArray<uint32>& InIndices, float& OutHitDistance);
+	bool IntersectRay(const FRay& InLocalRay, const TArray<FVector>& InPositions, const TArray<uint32>& InIndices, float& OutHitDistance);
+
+	uint64 GetMemoryBytes() const { return Nodes.size() * sizeof(FMeshBVHNode) + TriIndices.size() * sizeof(uint32); }
 
 
 private:
 	// Helper 함수들
-	FAABB ComputeTriBounds(uint32 TriangleID, const TArray<FNormalVertex>& Vertices, const TArray<uint32>& Indices) const;
+	FAABB ComputeTriBounds(uint32 TriangleID, const TArray<FVector>& Positions, const TArray<uint32>& Indices) const;
 
-	FVector ComputeTriCenter(uint32 TriangleID, const TArray<FNormalVertex>& Vertices, const TArray<uint32>& Indices) const;
+	FVector ComputeTriCenter(uint32 TriangleID, const TArray<FVector>& Positions, const TArray<uint32>& Indices) const;
 
-	FAABB ComputeBounds(uint32 Start, uint32 Count, const TArray<FNormalVertex>& Vertices, const TArray<uint32>& Indices) const;
+	FAABB ComputeBounds(uint32 Start, uint32 Count, const TArray<FVector>& Positions, const TArray<uint32>& Indices) const;
 
-	int BuildRecursive(uint32 Start, uint32 Count, const TArray<FNormalVertex>& Vertices, const TArray<uint32>& Indices);
+	int BuildRecursive(uint32 Start, uint32 Count, const TArray<FVector>& Positions, const TArray<uint32>& Indices);
 
 private:
 
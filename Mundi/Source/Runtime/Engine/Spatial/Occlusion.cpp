@@ -1,228 +1,841 @@
 ﻿#include "pch.h"
 #include "Occlusion.h"
-#include "Frustum.h"
+#include "TaskScheduler.h"
+#include "PlatformTime.h"
+#include <immintrin.h>
+#include <atomic>
+#include <cstring>
 
-// NDC Z가 [-1..1]인 프로젝션이면 아래 변환을 켜세요.
-// static inline float To01(float z_ndc) { return z_ndc * 0.5f + 0.5f; }
-static inline void Clamp01(float& v) { v = std::max(0.0f, std::min(1.0f, v)); }
+namespace
+{
+	inline float HorizontalMin(__m256 V)
+	{
+		__m128 M = _mm_min_ps(_mm256_castps256_ps128(V), _mm256_extractf128_ps(V, 1));
+		M = _mm_min_ps(M, _mm_movehl_ps(M, M));
+		M = _mm_min_ss(M, _mm_shuffle_ps(M, M, 1));
+		return _mm_cvtss_f32(M);
+	}
+
+	inline float HorizontalMax(__m256 V)
+	{
+		__m128 M = _mm_max_ps(_mm256_castps256_ps128(V), _mm256_extractf128_ps(V, 1));
+		M = _mm_max_ps(M, _mm_movehl_ps(M, M));
+		M = _mm_max_ss(M, _mm_shuffle_ps(M, M, 1));
+		return _mm_cvtss_f32(M);
+	}
+
+	// 클립 공간 보간 (Near 클리핑용)
+	inline FVector4 LerpClip(const FVector4& A, const FVector4& B, float T)
+	{
+		return FVector4(
+			A.X + (B.X - A.X) * T,
+			A.Y + (B.Y - A.Y) * T,
+			A.Z + (B.Z - A.Z) * T,
+			A.W + (B.W - A.W) * T);
+	}
+}
 
-// 헬퍼: 뷰공간 Z → [0..1] 선형
-static inline float LinearizeZ01(float zView, float zNear, float zFar) {
-	// LH 기준, 카메라 앞 z가 + 방향일 때
-	float z = (zView - zNear) / (zFar - zNear);
-	return std::max(0.f, std::min(1.f, z));
+void FOcclusionCullingManagerCPU::Initialize(int32 InWidth, int32 InHeight)
+{
+	const int32 NewWidth = std::max(TileSize, (InWidth + TileSize - 1) / TileSize * TileSize);
+	const int32 NewHeight = std::max(TileSize, (InHeight + TileSize - 1) / TileSize * TileSize);
+	if (NewWidth == Width && NewHeight == Height)
+	{
+		return;
+	}
+
+	Width = NewWidth;
+	Height = NewHeight;
+	TilesX = Width / TileSize;
+	TilesY = Height / TileSize;
+
+	Depth.assign(size_t(TilesX) * TilesY * TileSize * TileSize, 1.0f);
+	TileMaxDepth.assign(size_t(TilesX) * TilesY, 1.0f);
+	TileRowBins.resize(TilesY);
+	ReprojectScratch.assign(size_t(Width) * Height, -1.0f);
+	ReprojectTargets.assign(size_t(Width) * Height, -1);
+	ReprojectDepths.assign(size_t(Width) * Height, 1.0f);
+	bHasHistory = false;
+
+	// HZB 밉 체인 (레벨 0은 Depth 자체를 사용하므로 HZB 버퍼에는 레벨 1부터 저장)
+	MipWidths[0] = Width;
+	MipHeights[0] = Height;
+	MipOffsets[0] = 0;
+	MipCount = 1;
+	size_t TotalTexels = 0;
+	while (MipCount < MaxMipCount && (MipWidths[MipCount - 1] > 1 || MipHeights[MipCount - 1] > 1))
+	{
+		MipWidths[MipCount] = std::max(1, (MipWidths[MipCount - 1] + 1) / 2);
+		MipHeights[MipCount] = std::max(1, (MipHeights[MipCount - 1] + 1) / 2);
+		MipOffsets[MipCount] = TotalTexels;
+		TotalTexels += size_t(MipWidths[MipCount]) * MipHeights[MipCount];
+		++MipCount;
+	}
+	HZB.assign(TotalTexels, 1.0f);
+
+	Stats.BufferWidth = static_cast<uint32>(Width);
+	Stats.BufferHeight = static_cast<uint32>(Height);
 }
 
-// FBound(Min/Max) → 8코너
-static inline void MakeAabbCornersMinMax(const FAABB& B, FVector Corners[8])
+void FOcclusionCullingManagerCPU::Shutdown()
 {
-	const FVector& mn = B.Min;
-	const FVector& mx = B.Max;
-	Corners[0] = { mn.X, mn.Y, mn.Z };
-	Corners[1] = { mx.X, mn.Y, mn.Z };
-	Corners[2] = { mn.X, mx.Y, mn.Z };
-	Corners[3] = { mx.X, mx.Y, mn.Z };
-	Corners[4] = { mn.X, mn.Y, mx.Z };
-	Corners[5] = { mx.X, mn.Y, mx.Z };
-	Corners[6] = { mn.X, mx.Y, mx.Z };
-	Corners[7] = { mx.X, mx.Y, mx.Z };
+	Width = Height = TilesX = TilesY = MipCount = 0;
+	Depth.Empty();
+	TileMaxDepth.Empty();
+	HZB.Empty();
+	ClipVertices.Empty();
+	VertexOffsets.Empty();
+	TriangleOffsets.Empty();
+	TriangleCounts.Empty();
+	Triangles.Empty();
+	TileRowBins.Empty();
+	ReprojectScratch.Empty();
+	ReprojectTargets.Empty();
+	ReprojectDepths.Empty();
+	Phase1Results.Empty();
+	Phase1Occluders.Empty();
+	RetestIndices.Empty();
+	bHasHistory = false;
 }
 
-bool FOcclusionCullingManagerCPU::ComputeRectAndMinZ(
-	const FCandidateDrawable& D, int /*ViewW*/, int /*ViewH*/, FOcclusionRect& OutR)
+void FOcclusionCullingManagerCPU::BeginFrame()
 {
-	FVector C[8];
-	MakeAabbCornersMinMax(D.Bound, C);
+	ClearDepth();
 
-	float MinX = +1e9f, MinY = +1e9f, MaxX = -1e9f, MaxY = -1e9f;
-	float MinZLin = +1e9f, MaxZLin = -1e9f; // ★ 선형 깊이(0..1)
+	Stats.Reset();
+	Stats.BufferWidth = static_cast<uint32>(Width);
+	Stats.BufferHeight = static_cast<uint32>(Height);
+}
 
-	int used = 0;
-	for (int i = 0; i < 8; i++)
+void FOcclusionCullingManagerCPU::EndFrame(const FMatrix& ViewProj)
+{
+	PrevViewProj = ViewProj;
+	bHasHistory = Width > 0;
+}
+
+void FOcclusionCullingManagerCPU::ClearDepth()
+{
+	std::fill(Depth.begin(), Depth.end(), 1.0f);
+	std::fill(TileMaxDepth.begin(), TileMaxDepth.end(), 1.0f);
+}
+
+//====================================================================================
+// 오클루더 래스터화
+//====================================================================================
+
+void FOcclusionCullingManagerCPU::RasterizeOccluders(const TArray<FOccluderDesc>& Occluders)
+{
+	if (Occluders.IsEmpty() || Width == 0)
 	{
-		const float p[4] = { C[i].X, C[i].Y, C[i].Z, 1.0f };
+		return;
+	}
 
-		// 1) 화면 사각형용: WVP → NDC
-		float c[4];
-		MulPointRow(p, D.WorldViewProj, c);
-		if (c[3] <= 0.0f) continue;
+	const uint64 StartCycles = FPlatformTime::Cycles64();
+	const int32 NumOccluders = Occluders.Num();
 
-		const float invW = 1.0f / c[3];
-		const float ndcX = c[0] * invW;  // -1..1
-		const float ndcY = c[1] * invW;  // -1..1
-		// const float ndcZ = c[2] * invW; // 깊이는 쓰지 않음
+	// 오클루더별 정점/삼각형 출력 위치 (Near 클리핑으로 삼각형이 최대 2개로 늘어날 수 있어 2칸씩 예약)
+	VertexOffsets.resize(NumOccluders);
+	TriangleOffsets.resize(NumOccluders);
+	TriangleCounts.resize(NumOccluders);
+	uint32 TotalVertices = 0;
+	uint32 TotalTriangleSlots = 0;
+	for (int32 i = 0; i < NumOccluders; ++i)
+	{
+		VertexOffsets[i] = TotalVertices;
+		TriangleOffsets[i] = TotalTriangleSlots;
+		TotalVertices += Occluders[i].NumVertices;
+		TotalTriangleSlots += (Occluders[i].NumIndices / 3) * 2;
+		Stats.OccluderTriangles += Occluders[i].NumIndices / 3;
+	}
+	Stats.OccluderCount += static_cast<uint32>(NumOccluders);
 
-		const float u = 0.5f * (ndcX + 1.0f);
-		const float v = 0.5f * (ndcY + 1.0f);
+	if (ClipVertices.size() < TotalVertices) ClipVertices.resize(TotalVertices);
+	if (Triangles.size() < TotalTriangleSlots) Triangles.resize(TotalTriangleSlots);
 
-		MinX = std::min(MinX, u); MinY = std::min(MinY, v);
-		MaxX = std::max(MaxX, u); MaxY = std::max(MaxY, v);
+	// 1) 정점 변환 + 삼각형 준비 (오클루더 단위 병렬, 출력 구간이 겹치지 않음)
+	FTaskScheduler::GetInstance().ParallelFor(NumOccluders, 1, [&](int32 Begin, int32 End)
+		{
+			for (int32 OccluderIndex = Begin; OccluderIndex < End; ++OccluderIndex)
+			{
+				const FOccluderDesc& Desc = Occluders[OccluderIndex];
+				FVector4* Clip = &ClipVertices[VertexOffsets[OccluderIndex]];
+				const uint8* PositionBytes = reinterpret_cast<const uint8*>(Desc.Positions);
+
+				for (uint32 v = 0; v < Desc.NumVertices; ++v)
+				{
+					const FVector& P = *reinterpret_cast<const FVector*>(PositionBytes + size_t(v) * Desc.PositionStride);
+					Clip[v] = FVector4(P.X, P.Y, P.Z, 1.0f) * Desc.WorldViewProj;
+				}
+
+				FOccluderTriangle* OutTriangles = &Triangles[TriangleOffsets[OccluderIndex]];
+				uint32 Count = 0;
+				for (uint32 i = 0; i + 2 < Desc.NumIndices; i += 3)
+				{
+					const uint32 I0 = Desc.Indices[i];
+					const uint32 I1 = Desc.Indices[i + 1];
+					const uint32 I2 = Desc.Indices[i + 2];
+					if (I0 >= Desc.NumVertices || I1 >= Desc.NumVertices || I2 >= Desc.NumVertices)
+					{
+						continue;
+					}
+					Count += SetupTriangle(Clip[I0], Clip[I1], Clip[I2], OutTriangles + Count);
+				}
+				TriangleCounts[OccluderIndex] = Count;
+			}
+		});
+
+	// 2) 타일 행 빈 채우기 (오클루더 순서를 유지해 결과가 워커 수와 무관하도록)
+	for (TArray<uint32>& Bin : TileRowBins)
+	{
+		Bin.clear();
+	}
+	for (int32 OccluderIndex = 0; OccluderIndex < NumOccluders; ++OccluderIndex)
+	{
+		const uint32 First = TriangleOffsets[OccluderIndex];
+		const uint32 Count = TriangleCounts[OccluderIndex];
+		for (uint32 t = First; t < First + Count; ++t)
+		{
+			const FOccluderTriangle& Tri = Triangles[t];
+			for (int32 TileY = Tri.MinTileY; TileY <= Tri.MaxTileY; ++TileY)
+			{
+				TileRowBins[TileY].push_back(t);
+			}
+		}
+		Stats.RasterizedTriangles += Count;
+	}
 
-		// 2) 깊이: WorldView로 뷰 공간 z → 선형 0..1
-		float v4[4];
-		MulPointRow(p, D.WorldView, v4);     // p_world * (World*View) == p_world * View (월드좌표니까 View만 와도 OK)
-		const float zView = v4[2];          // LH: +Z 앞
-		const float zLin01 = LinearizeZ01(zView, D.NearClip, D.FarClip);
+	// 3) 타일 행 병렬 래스터화
+	FTaskScheduler::GetInstance().ParallelFor(TilesY, 1, [&](int32 Begin, int32 End)
+		{
+			for (int32 TileY = Begin; TileY < End; ++TileY)
+			{
+				RasterizeTileRow(TileY);
+			}
+		});
 
-		MinZLin = std::min(MinZLin, zLin01);
-		MaxZLin = std::max(MaxZLin, zLin01);
+	Stats.RasterizeTimeMS += static_cast<float>(FPlatformTime::ToMilliseconds(FPlatformTime::Cycles64() - StartCycles));
+}
 
-		used++;
+int32 FOcclusionCullingManagerCPU::SetupTriangle(const FVector4& V0, const FVector4& V1, const FVector4& V2, FOccluderTriangle* OutTriangles) const
+{
+	// 세 정점이 모두 같은 절두체 평면 바깥이면 버림
+	if ((V0.X > V0.W && V1.X > V1.W && V2.X > V2.W) || (V0.X < -V0.W && V1.X < -V1.W && V2.X < -V2.W) ||
+		(V0.Y > V0.W && V1.Y > V1.W && V2.Y > V2.W) || (V0.Y < -V0.W && V1.Y < -V1.W && V2.Y < -V2.W) ||
+		(V0.Z < 0.0f && V1.Z < 0.0f && V2.Z < 0.0f) || (V0.Z > V0.W && V1.Z > V1.W && V2.Z > V2.W))
+	{
+		return 0;
 	}
 
-	if (used == 0) return false;
-	if (MaxX < 0 || MaxY < 0 || MinX > 1 || MinY > 1) return false;
+	if (V0.Z >= 0.0f && V1.Z >= 0.0f && V2.Z >= 0.0f)
+	{
+		return SetupScreenTriangle(V0, V1, V2, OutTriangles[0]) ? 1 : 0;
+	}
 
-	Clamp01(MinX); Clamp01(MinY); Clamp01(MaxX); Clamp01(MaxY);
-	Clamp01(MinZLin); Clamp01(MaxZLin);
+	// Near 평면(z = 0) 클리핑 → 최대 사각형 하나 (삼각형 2개)
+	const FVector4 In[3] = { V0, V1, V2 };
+	FVector4 Poly[4];
+	int32 NumPoly = 0;
+	for (int32 i = 0; i < 3; ++i)
+	{
+		const FVector4& A = In[i];
+		const FVector4& B = In[(i + 1) % 3];
+		if (A.Z >= 0.0f)
+		{
+			Poly[NumPoly++] = A;
+		}
+		if ((A.Z >= 0.0f) != (B.Z >= 0.0f))
+		{
+			Poly[NumPoly++] = LerpClip(A, B, A.Z / (A.Z - B.Z));
+		}
+	}
 
-	OutR.MinX = MinX; OutR.MinY = MinY; OutR.MaxX = MaxX; OutR.MaxY = MaxY;
-	OutR.MinZ = MinZLin;   // ★ 선형 깊이
-	OutR.MaxZ = MaxZLin;
-	OutR.ActorIndex = D.ActorIndex;
-	return true;
+	int32 Count = 0;
+	for (int32 i = 1; i + 1 < NumPoly; ++i)
+	{
+		if (SetupScreenTriangle(Poly[0], Poly[i], Poly[i + 1], OutTriangles[Count]))
+		{
+			++Count;
+		}
+	}
+	return Count;
 }
-void FOcclusionCullingManagerCPU::BuildOccluderDepth(
-	const TArray<FCandidateDrawable>& Occluders, int ViewW, int ViewH)
-{
-	Grid.Clear();
 
-	const int GW = Grid.GetWidth();
-	const int GH = Grid.GetHeight();
+bool FOcclusionCullingManagerCPU::SetupScreenTriangle(const FVector4& V0, const FVector4& V1, const FVector4& V2, FOccluderTriangle& Out) const
+{
+	if (V0.W <= KINDA_SMALL_NUMBER || V1.W <= KINDA_SMALL_NUMBER || V2.W <= KINDA_SMALL_NUMBER)
+	{
+		return false;
+	}
 
-	// --- 튜닝 파라미터 ---
-	const float ErodeScale = 0.5f;     // 0.5배 축소
-	const int   Dilate = 1;        // 경계 1px 팽창
-	const int   MinPxEdge = 8;        // 너무 작은 사각형은 erosion 스킵
-	const float MaxCover = 0.6f;     // 화면의 60% 이상 덮으면 erosion 스킵
+	// 화면 좌표 (픽셀, Y 아래 방향). 큰 좌표에서 변 방정식 정밀도를 위해 셋업은 double로 계산
+	const FVector4* V[3] = { &V0, &V1, &V2 };
+	double X[3], Y[3], Z[3];
+	for (int32 i = 0; i < 3; ++i)
+	{
+		const double InvW = 1.0 / V[i]->W;
+		X[i] = (V[i]->X * InvW * 0.5 + 0.5) * Width;
+		Y[i] = (0.5 - V[i]->Y * InvW * 0.5) * Height;
+		Z[i] = V[i]->Z * InvW;
+	}
 
-	for (const auto& D : Occluders)
+	// D3D 기본 래스터라이저(CULL_BACK, 시계 방향 = 앞면)와 같은 기준으로 뒷면 제거
+	const double Area = (X[1] - X[0]) * (Y[2] - Y[0]) - (X[2] - X[0]) * (Y[1] - Y[0]);
+	if (Area <= 0.0)
 	{
-		FOcclusionRect R;
-		if (!ComputeRectAndMinZ(D, ViewW, ViewH, R))
-			continue;
+		return false;
+	}
 
-		int minPX = (int)std::floor(R.MinX * GW);
-		int minPY = (int)std::floor(R.MinY * GH);
-		int maxPX = (int)std::ceil(R.MaxX * GW) - 1;
-		int maxPY = (int)std::ceil(R.MaxY * GH) - 1;
-
-		// --- 화면 사각형 erosion(오클루더 영향 완화) ---
-		int w = std::max(0, maxPX - minPX + 1);
-		int h = std::max(0, maxPY - minPY + 1);
-		const bool bigCover =
-			(w >= int(MaxCover * GW)) || (h >= int(MaxCover * GH));
-		if (ErodeScale < 1.0f && w >= MinPxEdge && h >= MinPxEdge && !bigCover)
-		{
-			const float cx = 0.5f * float(minPX + maxPX);
-			const float cy = 0.5f * float(minPY + maxPY);
-			const float hw = 0.5f * float(w) * ErodeScale;
-			const float hh = 0.5f * float(h) * ErodeScale;
-
-			minPX = int(std::floor(cx - hw));
-			maxPX = int(std::ceil(cx + hw));
-			minPY = int(std::floor(cy - hh));
-			maxPY = int(std::ceil(cy + hh));
-		}
+	const double MinX = std::min({ X[0], X[1], X[2] });
+	const double MaxX = std::max({ X[0], X[1], X[2] });
+	const double MinY = std::min({ Y[0], Y[1], Y[2] });
+	const double MaxY = std::max({ Y[0], Y[1], Y[2] });
+	if (MaxX < 0.0 || MaxY < 0.0 || MinX >= Width || MinY >= Height)
+	{
+		return false;
+	}
 
+	const int32 MinPixelX = static_cast<int32>(std::max(0.0, std::floor(MinX)));
+	const int32 MaxPixelX = static_cast<int32>(std::min(double(Width - 1), std::ceil(MaxX)));
+	Out.MinPixelY = static_cast<int32>(std::max(0.0, std::floor(MinY)));
+	Out.MaxPixelY = static_cast<int32>(std::min(double(Height - 1), std::ceil(MaxY)));
+	Out.MinTileX = MinPixelX / TileSize;
+	Out.MaxTileX = MaxPixelX / TileSize;
+	Out.MinTileY = Out.MinPixelY / TileSize;
+	Out.MaxTileY = Out.MaxPixelY / TileSize;
+
+	// 변 방정식: E(p) = (Xj - Xi)(py - Yi) - (Yj - Yi)(px - Xi), 앞면 삼각형 내부에서 양수
+	for (int32 i = 0; i < 3; ++i)
+	{
+		const int32 j = (i + 1) % 3;
+		const double A = Y[i] - Y[j];
+		const double B = X[j] - X[i];
+		Out.EdgeA[i] = static_cast<float>(A);
+		Out.EdgeB[i] = static_cast<float>(B);
+		Out.EdgeC[i] = static_cast<float>(-(A * X[i] + B * Y[i]));
+	}
 
-		// 화면 경계 클램프
-		minPX = std::max(0, std::min(GW - 1, minPX));
-		minPY = std::max(0, std::min(GH - 1, minPY));
-		maxPX = std::max(0, std::min(GW - 1, maxPX));
-		maxPY = std::max(0, std::min(GH - 1, maxPY));
-		if (minPX > maxPX || minPY > maxPY) continue;
+	// 깊이 평면
+	const double InvArea = 1.0 / Area;
+	const double DZDX = ((Z[1] - Z[0]) * (Y[2] - Y[0]) - (Z[2] - Z[0]) * (Y[1] - Y[0])) * InvArea;
+	const double DZDY = ((X[1] - X[0]) * (Z[2] - Z[0]) - (X[2] - X[0]) * (Z[1] - Z[0])) * InvArea;
+	Out.DepthDX = static_cast<float>(DZDX);
+	Out.DepthDY = static_cast<float>(DZDY);
+	Out.Depth0 = static_cast<float>(Z[0] - DZDX * X[0] - DZDY * Y[0]);
+	Out.MinZ = static_cast<float>(std::min({ Z[0], Z[1], Z[2] }));
+	return true;
+}
 
-		Grid.RasterizeRectDepthMin(minPX, minPY, maxPX, maxPY, R.MaxZ);
+void FOcclusionCullingManagerCPU::RasterizeTileRow(int32 TileY)
+{
+	const TArray<uint32>& Bin = TileRowBins[TileY];
+	for (uint32 TriangleIndex : Bin)
+	{
+		const FOccluderTriangle& Tri = Triangles[TriangleIndex];
+		for (int32 TileX = Tri.MinTileX; TileX <= Tri.MaxTileX; ++TileX)
+		{
+			const int32 Tile = TileY * TilesX + TileX;
+
+			// 타일에 이미 기록된 가장 먼 깊이보다 삼각형이 전부 뒤에 있으면 갱신할 픽셀이 없음
+			if (Tri.MinZ >= TileMaxDepth[Tile])
+			{
+				continue;
+			}
+			RasterizeTriangleInTile(Tri, TileX, TileY, &Depth[size_t(Tile) * TileSize * TileSize]);
+		}
 	}
 }
 
-// 2) 후보 가시성 판정(HZB 샘플)
-void FOcclusionCullingManagerCPU::TestOcclusion(const TArray<FCandidateDrawable>& Candidates, int ViewW, int ViewH, TArray<uint8_t>& OutVisibleFlags)
+void FOcclusionCullingManagerCPU::RasterizeTriangleInTile(const FOccluderTriangle& Tri, int32 TileX, int32 TileY, float* TileDepth)
 {
-	const float eps = 2e-3f;  // 1차 바이어스
-	const float eps2 = 2 * eps;  // 레벨0 재검증 바이어스(조금 더 큼)
-	// --- 크기 보장 ---
-	uint32_t maxId = 0;
-	for (auto& c : Candidates) maxId = std::max(maxId, c.ActorIndex);
+	// 픽셀 중심 기준 샘플
+	const float X0 = TileX * TileSize + 0.5f;
+	const float Y0 = TileY * TileSize + 0.5f;
+	const float X1 = X0 + (TileSize - 1);
+	const float Y1 = Y0 + (TileSize - 1);
+
+	// 타일 모서리 네 픽셀 중심에서 변 방정식이 모두 음수면 타일 전체가 바깥, 모두 양수면 전체가 안쪽
+	bool bFullyInside = true;
+	for (int32 e = 0; e < 3; ++e)
+	{
+		const float A = Tri.EdgeA[e];
+		const float B = Tri.EdgeB[e];
+		const float C = Tri.EdgeC[e];
+		const float MaxE = (A > 0.0f ? A * X1 : A * X0) + (B > 0.0f ? B * Y1 : B * Y0) + C;
+		const float MinE = (A > 0.0f ? A * X0 : A * X1) + (B > 0.0f ? B * Y0 : B * Y1) + C;
+		if (MaxE < 0.0f)
+		{
+			return;
+		}
+		bFullyInside &= (MinE >= 0.0f);
+	}
 
-	if (OutVisibleFlags.size() <= maxId) OutVisibleFlags.resize(maxId + 1, 1);
-	if (VisibleStreak.size() <= maxId) VisibleStreak.resize(maxId + 1, 0);
-	if (OccludedStreak.size() <= maxId) OccludedStreak.resize(maxId + 1, 0);
-	if (LastState.size() <= maxId) LastState.resize(maxId + 1, 1); // 초기=보임
+	const __m256 LaneX = _mm256_add_ps(_mm256_set1_ps(X0), _mm256_setr_ps(0.0f, 1.0f, 2.0f, 3.0f, 4.0f, 5.0f, 6.0f, 7.0f));
+	const __m256 Zero = _mm256_setzero_ps();
+	const __m256 MinZ = _mm256_set1_ps(Tri.MinZ);
+	const __m256 DepthDX = _mm256_mul_ps(_mm256_set1_ps(Tri.DepthDX), LaneX);
+	const __m256 EdgeAX0 = _mm256_mul_ps(_mm256_set1_ps(Tri.EdgeA[0]), LaneX);
+	const __m256 EdgeAX1 = _mm256_mul_ps(_mm256_set1_ps(Tri.EdgeA[1]), LaneX);
+	const __m256 EdgeAX2 = _mm256_mul_ps(_mm256_set1_ps(Tri.EdgeA[2]), LaneX);
 
-	for (const auto& D : Candidates)
+	const int32 FirstRow = std::max(0, Tri.MinPixelY - TileY * TileSize);
+	const int32 LastRow = std::min(TileSize - 1, Tri.MaxPixelY - TileY * TileSize);
+
+	for (int32 Row = FirstRow; Row <= LastRow; ++Row)
 	{
-		uint32_t id = D.ActorIndex;
+		const float Y = Y0 + Row;
+		float* RowDepth = TileDepth + Row * TileSize;
+
+		// 보간 오차로 정점보다 가까워지지 않도록 MinZ로 클램프 (오클루더가 실제보다 앞에 기록되면 과잉 컬링)
+		__m256 Z = _mm256_add_ps(DepthDX, _mm256_set1_ps(Tri.DepthDY * Y + Tri.Depth0));
+		Z = _mm256_max_ps(Z, MinZ);
 
-		FOcclusionRect R;
-		if (!ComputeRectAndMinZ(D, ViewW, ViewH, R))
+		const __m256 Old = _mm256_loadu_ps(RowDepth);
+		__m256 New = _mm256_min_ps(Old, Z);
+		if (!bFullyInside)
 		{
-			// 화면 밖(또는 w<=0 코너만) → 가려짐으로 처리
-			OutVisibleFlags[id] = 0;
-			// streak 업데이트 (선택): occluded 누적
-			OccludedStreak[id] = std::min<uint8_t>(255, OccludedStreak[id] + 1);
-			VisibleStreak[id] = 0;
-			LastState[id] = 0;
-			continue;
+			const __m256 E0 = _mm256_add_ps(EdgeAX0, _mm256_set1_ps(Tri.EdgeB[0] * Y + Tri.EdgeC[0]));
+			const __m256 E1 = _mm256_add_ps(EdgeAX1, _mm256_set1_ps(Tri.EdgeB[1] * Y + Tri.EdgeC[1]));
+			const __m256 E2 = _mm256_add_ps(EdgeAX2, _mm256_set1_ps(Tri.EdgeB[2] * Y + Tri.EdgeC[2]));
+			const __m256 Inside = _mm256_and_ps(
+				_mm256_and_ps(_mm256_cmp_ps(E0, Zero, _CMP_GE_OQ), _mm256_cmp_ps(E1, Zero, _CMP_GE_OQ)),
+				_mm256_cmp_ps(E2, Zero, _CMP_GE_OQ));
+			New = _mm256_blendv_ps(Old, New, Inside);
 		}
+		_mm256_storeu_ps(RowDepth, New);
+	}
+
+	// 타일 최대 깊이 갱신 (이 타일은 현재 워커만 접근)
+	__m256 TileMax = _mm256_loadu_ps(TileDepth);
+	for (int32 Row = 1; Row < TileSize; ++Row)
+	{
+		TileMax = _mm256_max_ps(TileMax, _mm256_loadu_ps(TileDepth + Row * TileSize));
+	}
+	TileMaxDepth[TileY * TilesX + TileX] = HorizontalMax(TileMax);
+}
+
+//====================================================================================
+// HZB
+//====================================================================================
+
+void FOcclusionCullingManagerCPU::BuildHZB()
+{
+	if (MipCount <= 1)
+	{
+		return;
+	}
 
-		const float rw = std::max(0.0f, R.MaxX - R.MinX);
-		const float rh = std::max(0.0f, R.MaxY - R.MinY);
-		const float pxW = rw * GetGrid().GetWidth();
-		const float pxH = rh * GetGrid().GetHeight();
+	const uint64 StartCycles = FPlatformTime::Cycles64();
 
-		// --- 작은 사각형 가드: 한 변이라도 2px 미만이면 컬링하지 않음 ---
-		if (std::min(pxW, pxH) < 2.0f)
+	// 레벨 1: 타일 배치 깊이 버퍼의 2x2 max (Width/Height가 8의 배수라 경계 처리 불필요)
+	{
+		float* Dst = &HZB[MipOffsets[1]];
+		const int32 DstWidth = MipWidths[1];
+		FTaskScheduler::GetInstance().ParallelFor(MipHeights[1], 8, [&](int32 Begin, int32 End)
+			{
+				for (int32 y = Begin; y < End; ++y)
+				{
+					for (int32 x = 0; x < DstWidth; ++x)
+					{
+						const int32 SX = x * 2;
+						const int32 SY = y * 2;
+						Dst[size_t(y) * DstWidth + x] = std::max(
+							std::max(GetDepth(SX, SY), GetDepth(SX + 1, SY)),
+							std::max(GetDepth(SX, SY + 1), GetDepth(SX + 1, SY + 1)));
+					}
+				}
+			});
+	}
+
+	// 레벨 2~: 이전 레벨의 2x2 max (홀수 크기는 마지막 텍셀을 포함하도록 클램프)
+	for (int32 Level = 2; Level < MipCount; ++Level)
+	{
+		const float* Src = &HZB[MipOffsets[Level - 1]];
+		float* Dst = &HZB[MipOffsets[Level]];
+		const int32 SrcWidth = MipWidths[Level - 1];
+		const int32 SrcHeight = MipHeights[Level - 1];
+		const int32 DstWidth = MipWidths[Level];
+		const int32 DstHeight = MipHeights[Level];
+
+		for (int32 y = 0; y < DstHeight; ++y)
 		{
-			OutVisibleFlags[id] = 1;
-			VisibleStreak[id] = std::min<uint8_t>(255, VisibleStreak[id] + 1);
-			OccludedStreak[id] = 0;
-			LastState[id] = 1;
-			continue;
+			const int32 SY0 = std::min(y * 2, SrcHeight - 1);
+			const int32 SY1 = std::min(y * 2 + 1, SrcHeight - 1);
+			for (int32 x = 0; x < DstWidth; ++x)
+			{
+				const int32 SX0 = std::min(x * 2, SrcWidth - 1);
+				const int32 SX1 = std::min(x * 2 + 1, SrcWidth - 1);
+				Dst[size_t(y) * DstWidth + x] = std::max(
+					std::max(Src[size_t(SY0) * SrcWidth + SX0], Src[size_t(SY0) * SrcWidth + SX1]),
+					std::max(Src[size_t(SY1) * SrcWidth + SX0], Src[size_t(SY1) * SrcWidth + SX1]));
+			}
 		}
+	}
 
-		// --- 보수적 mip 선택 ---
-		int mip = std::max(0, Grid.ChooseMip(rw, rh) - 1);
-		if (pxW < 48.0f || pxH < 48.0f)
-			mip = std::max(0, mip - 1);
+	Stats.HZBTimeMS += static_cast<float>(FPlatformTime::ToMilliseconds(FPlatformTime::Cycles64() - StartCycles));
+}
 
+//====================================================================================
+// 오클루디 테스트
+//====================================================================================
 
-		// --- MAX HZB 적응형 샘플 ---
-		const float hzbMax = Grid.SampleMaxRectAdaptive(R.MinX, R.MinY, R.MaxX, R.MaxY, mip);
+bool FOcclusionCullingManagerCPU::IsRectOccluded(float MinX, float MinY, float MaxX, float MaxY, float MinZ) const
+{
+	// 사각형이 걸치는 모든 픽셀 (부분적으로 걸쳐도 포함)
+	const int32 PX0 = std::max(0, static_cast<int32>(std::floor(MinX)));
+	const int32 PY0 = std::max(0, static_cast<int32>(std::floor(MinY)));
+	const int32 PX1 = std::min(Width - 1, std::max(PX0, static_cast<int32>(std::ceil(MaxX)) - 1));
+	const int32 PY1 = std::min(Height - 1, std::max(PY0, static_cast<int32>(std::ceil(MaxY)) - 1));
+
+	// 한 변이 4텍셀 이하가 되는 레벨부터 시작
+	const int32 Extent = std::max(PX1 - PX0, PY1 - PY0) + 1;
+	int32 Level = 0;
+	while (Level + 1 < MipCount && (Extent >> Level) > 4)
+	{
+		++Level;
+	}
 
-		bool occluded = ((hzbMax + eps) <= R.MinZ);
+	// 거친 레벨에서 실패하면 한 단계 아래 레벨에서 한 번 더 (최대 약 10x10 텍셀)
+	const int32 LastLevel = std::max(0, Level - 1);
+	for (int32 L = Level; L >= LastLevel; --L)
+	{
+		const int32 TX0 = PX0 >> L;
+		const int32 TY0 = PY0 >> L;
+		const int32 TX1 = std::min(MipWidths[L] - 1, PX1 >> L);
+		const int32 TY1 = std::min(MipHeights[L] - 1, PY1 >> L);
 
-		// --- 레벨0 정밀 재검증(occluded일 때만) ---
-		if (occluded)
+		bool bOccluded = true;
+		for (int32 Y = TY0; Y <= TY1 && bOccluded; ++Y)
 		{
-			if (!Grid.FullyOccludedAtLevel0(R.MinX, R.MinY, R.MaxX, R.MaxY, R.MinZ, eps2))
-				occluded = false;
+			for (int32 X = TX0; X <= TX1; ++X)
+			{
+				if (SampleHZB(L, X, Y) >= MinZ)
+				{
+					bOccluded = false;
+					break;
+				}
+			}
 		}
+		if (bOccluded)
+		{
+			return true;
+		}
+	}
+	return false;
+}
+
+EOcclusionResult FOcclusionCullingManagerCPU::ClassifyAABB(const FAABB& Bound, const FMatrix& ViewProj) const
+{
+	if (Width == 0)
+	{
+		return EOcclusionResult::Visible;
+	}
+
+	const FVector& Mn = Bound.Min;
+	const FVector& Mx = Bound.Max;
+
+	// 8개 코너를 한 번에 클립 공간으로 변환
+	const __m256 X = _mm256_setr_ps(Mn.X, Mx.X, Mn.X, Mx.X, Mn.X, Mx.X, Mn.X, Mx.X);
+	const __m256 Y = _mm256_setr_ps(Mn.Y, Mn.Y, Mx.Y, Mx.Y, Mn.Y, Mn.Y, Mx.Y, Mx.Y);
+	const __m256 Z = _mm256_setr_ps(Mn.Z, Mn.Z, Mn.Z, Mn.Z, Mx.Z, Mx.Z, Mx.Z, Mx.Z);
+
+	auto TransformColumn = [&](int32 Column) -> __m256
+		{
+			__m256 R = _mm256_mul_ps(X, _mm256_set1_ps(ViewProj.M[0][Column]));
+			R = _mm256_add_ps(R, _mm256_mul_ps(Y, _mm256_set1_ps(ViewProj.M[1][Column])));
+			R = _mm256_add_ps(R, _mm256_mul_ps(Z, _mm256_set1_ps(ViewProj.M[2][Column])));
+			return _mm256_add_ps(R, _mm256_set1_ps(ViewProj.M[3][Column]));
+		};
+
+	const __m256 ClipX = TransformColumn(0);
+	const __m256 ClipY = TransformColumn(1);
+	const __m256 ClipZ = TransformColumn(2);
+	const __m256 ClipW = TransformColumn(3);
+
+	// 8개 코너가 모두 한 클립 평면 바깥이면 뷰 밖 (카메라 뒤 포함)
+	const __m256 NegW = _mm256_sub_ps(_mm256_setzero_ps(), ClipW);
+	const bool bOutsideFrustum =
+		_mm256_movemask_ps(_mm256_cmp_ps(ClipX, ClipW, _CMP_GT_OQ)) == 0xFF ||
+		_mm256_movemask_ps(_mm256_cmp_ps(ClipX, NegW, _CMP_LT_OQ)) == 0xFF ||
+		_mm256_movemask_ps(_mm256_cmp_ps(ClipY, ClipW, _CMP_GT_OQ)) == 0xFF ||
+		_mm256_movemask_ps(_mm256_cmp_ps(ClipY, NegW, _CMP_LT_OQ)) == 0xFF ||
+		_mm256_movemask_ps(_mm256_cmp_ps(ClipZ, _mm256_setzero_ps(), _CMP_LT_OQ)) == 0xFF ||
+		_mm256_movemask_ps(_mm256_cmp_ps(ClipZ, ClipW, _CMP_GT_OQ)) == 0xFF;
+	if (bOutsideFrustum)
+	{
+		return EOcclusionResult::OutsideView;
+	}
+
+	// Near 평면 앞(카메라 쪽)에 코너가 있으면 투영 사각형을 믿을 수 없으므로 보수적으로 보임 처리
+	if (_mm256_movemask_ps(_mm256_cmp_ps(ClipZ, _mm256_setzero_ps(), _CMP_LT_OQ)) != 0)
+	{
+		return EOcclusionResult::Visible;
+	}
 
-		// --- 양방향 히스테리시스(2~3프레임 연속일 때만 상태 전환) ---
-		const int thresh = 2; // 2~3 추천
+	const __m256 InvW = _mm256_div_ps(_mm256_set1_ps(1.0f), ClipW);
+	const __m256 Half = _mm256_set1_ps(0.5f);
+	const __m256 ScreenX = _mm256_mul_ps(_mm256_add_ps(_mm256_mul_ps(_mm256_mul_ps(ClipX, InvW), Half), Half), _mm256_set1_ps(static_cast<float>(Width)));
+	const __m256 ScreenY = _mm256_mul_ps(_mm256_sub_ps(Half, _mm256_mul_ps(_mm256_mul_ps(ClipY, InvW), Half)), _mm256_set1_ps(static_cast<float>(Height)));
+	const float MinZ = HorizontalMin(_mm256_mul_ps(ClipZ, InvW));
 
-		if (occluded)
+	const float MinX = HorizontalMin(ScreenX);
+	const float MaxX = HorizontalMax(ScreenX);
+	const float MinY = HorizontalMin(ScreenY);
+	const float MaxY = HorizontalMax(ScreenY);
+
+	// 화면 밖이거나 Far 평면 너머
+	if (MaxX <= 0.0f || MaxY <= 0.0f || MinX >= Width || MinY >= Height || MinZ > 1.0f)
+	{
+		return EOcclusionResult::OutsideView;
+	}
+
+	return IsRectOccluded(MinX, MinY, MaxX, MaxY, MinZ) ? EOcclusionResult::Occluded : EOcclusionResult::Visible;
+}
+
+void FOcclusionCullingManagerCPU::TestOccludees(const TArray<FAABB>& Bounds, const FMatrix& ViewProj, TArray<uint8>& OutVisibleFlags)
+{
+	const uint64 StartCycles = FPlatformTime::Cycles64();
+	const int32 Num = Bounds.Num();
+	OutVisibleFlags.resize(Num);
+
+	std::atomic<uint32> Occluded{ 0 };
+	std::atomic<uint32> OutsideView{ 0 };
+	FTaskScheduler::GetInstance().ParallelFor(Num, 64, [&](int32 Begin, int32 End)
 		{
-			OccludedStreak[id] = std::min<uint8_t>(255, OccludedStreak[id] + 1);
-			VisibleStreak[id] = 0;
+			uint32 BatchOccluded = 0;
+			uint32 BatchOutsideView = 0;
+			for (int32 i = Begin; i < End; ++i)
+			{
+				const EOcclusionResult Result = ClassifyAABB(Bounds[i], ViewProj);
+				OutVisibleFlags[i] = (Result == EOcclusionResult::Visible) ? 1 : 0;
+				BatchOccluded += (Result == EOcclusionResult::Occluded) ? 1 : 0;
+				BatchOutsideView += (Result == EOcclusionResult::OutsideView) ? 1 : 0;
+			}
+			Occluded += BatchOccluded;
+			OutsideView += BatchOutsideView;
+		});
+
+	Stats.TestedCount += static_cast<uint32>(Num);
+	Stats.CulledCount += Occluded.load();
+	Stats.OutsideViewCount += OutsideView.load();
+	Stats.TestTimeMS += static_cast<float>(FPlatformTime::ToMilliseconds(FPlatformTime::Cycles64() - StartCycles));
+}
+
+//====================================================================================
+// 2단계 시간적 컬링
+//====================================================================================
 
-			// 직전이 보임이면, thresh 미만 동안은 보임 유지
-			if (LastState[id] == 1 && OccludedStreak[id] < thresh)
-				occluded = false;
+void FOcclusionCullingManagerCPU::ReprojectPreviousDepth(const FMatrix& ViewProj)
+{
+	const uint64 StartCycles = FPlatformTime::Cycles64();
+
+	// 이전 클립 → 월드 → 현재 클립
+	const FMatrix Reproject = PrevViewProj.Inverse() * ViewProj;
+
+	// 1) 이전 픽셀 중심을 8개씩 변환해 도착 픽셀과 깊이를 구함 (타일의 한 행 = 연속 8픽셀)
+	FTaskScheduler::GetInstance().ParallelFor(Height, 8, [&](int32 Begin, int32 End)
+		{
+			const __m256 LaneX = _mm256_setr_ps(0.5f, 1.5f, 2.5f, 3.5f, 4.5f, 5.5f, 6.5f, 7.5f);
+			const __m256 NdcScaleX = _mm256_set1_ps(2.0f / Width);
+			const __m256 One = _mm256_set1_ps(1.0f);
+			const __m256 Half = _mm256_set1_ps(0.5f);
+			const __m256 ScreenW = _mm256_set1_ps(static_cast<float>(Width));
+			const __m256 ScreenH = _mm256_set1_ps(static_cast<float>(Height));
+
+			for (int32 Y = Begin; Y < End; ++Y)
+			{
+				const float NdcY = 1.0f - (Y + 0.5f) * (2.0f / Height);
+				// 행마다 상수인 Y 항을 미리 더해 둠
+				__m256 RowTerm[4];
+				for (int32 c = 0; c < 4; ++c)
+				{
+					RowTerm[c] = _mm256_set1_ps(NdcY * Reproject.M[1][c] + Reproject.M[3][c]);
+				}
+
+				for (int32 TileX = 0; TileX < TilesX; ++TileX)
+				{
+					const float* Src = &Depth[(size_t(Y / TileSize) * TilesX + TileX) * TileSize * TileSize + (Y % TileSize) * TileSize];
+					const __m256 NdcZ = _mm256_loadu_ps(Src);
+					const __m256 NdcX = _mm256_sub_ps(_mm256_mul_ps(_mm256_add_ps(_mm256_set1_ps(static_cast<float>(TileX * TileSize)), LaneX), NdcScaleX), One);
+
+					__m256 Clip[4];
+					for (int32 c = 0; c < 4; ++c)
+					{
+						Clip[c] = _mm256_add_ps(RowTerm[c], _mm256_add_ps(
+							_mm256_mul_ps(NdcX, _mm256_set1_ps(Reproject.M[0][c])),
+							_mm256_mul_ps(NdcZ, _mm256_set1_ps(Reproject.M[2][c]))));
+					}
+
+					const __m256 InvW = _mm256_div_ps(One, Clip[3]);
+					const __m256 TX = _mm256_floor_ps(_mm256_mul_ps(_mm256_add_ps(_mm256_mul_ps(_mm256_mul_ps(Clip[0], InvW), Half), Half), ScreenW));
+					const __m256 TY = _mm256_floor_ps(_mm256_mul_ps(_mm256_sub_ps(Half, _mm256_mul_ps(_mm256_mul_ps(Clip[1], InvW), Half)), ScreenH));
+					const __m256 TZ = _mm256_min_ps(_mm256_mul_ps(Clip[2], InvW), One);
+
+					// 카메라 뒤, Near 앞, 화면 밖이면 버림
+					__m256 Valid = _mm256_cmp_ps(Clip[3], _mm256_set1_ps(1e-6f), _CMP_GT_OQ);
+					Valid = _mm256_and_ps(Valid, _mm256_cmp_ps(Clip[2], _mm256_setzero_ps(), _CMP_GE_OQ));
+					Valid = _mm256_and_ps(Valid, _mm256_cmp_ps(TX, _mm256_setzero_ps(), _CMP_GE_OQ));
+					Valid = _mm256_and_ps(Valid, _mm256_cmp_ps(TX, ScreenW, _CMP_LT_OQ));
+					Valid = _mm256_and_ps(Valid, _mm256_cmp_ps(TY, _mm256_setzero_ps(), _CMP_GE_OQ));
+					Valid = _mm256_and_ps(Valid, _mm256_cmp_ps(TY, ScreenH, _CMP_LT_OQ));
+
+					// 도착 픽셀 인덱스 (무효면 -1)
+					const __m256i Target = _mm256_cvttps_epi32(_mm256_add_ps(_mm256_mul_ps(TY, ScreenW), TX));
+					const __m256i TargetOrInvalid = _mm256_castps_si256(_mm256_blendv_ps(
+						_mm256_castsi256_ps(_mm256_set1_epi32(-1)), _mm256_castsi256_ps(Target), Valid));
+
+					const size_t Out = size_t(Y) * Width + TileX * TileSize;
+					_mm256_storeu_si256(reinterpret_cast<__m256i*>(&ReprojectTargets[Out]), TargetOrInvalid);
+					_mm256_storeu_ps(&ReprojectDepths[Out], TZ);
+				}
+			}
+		});
+
+	// 2) 흩뿌리기. 한 픽셀에 여러 샘플이 떨어지면 가장 먼 깊이를 남김 (보수적)
+	std::fill(ReprojectScratch.begin(), ReprojectScratch.end(), -1.0f);
+	const int32 NumPixels = Width * Height;
+	for (int32 i = 0; i < NumPixels; ++i)
+	{
+		const int32 Target = ReprojectTargets[i];
+		if (Target >= 0)
+		{
+			ReprojectScratch[Target] = std::max(ReprojectScratch[Target], ReprojectDepths[i]);
 		}
-		else
+	}
+
+	// 3) 샘플이 없는 픽셀은 상하좌우가 모두 채워졌을 때만 그 최댓값으로 메우고, 나머지는 Far
+	//    (확대/회전으로 생긴 한 픽셀짜리 구멍만 메우고 실제 디스오클루전 영역은 비워 둠)
+	FTaskScheduler::GetInstance().ParallelFor(Height, 8, [&](int32 Begin, int32 End)
 		{
-			VisibleStreak[id] = std::min<uint8_t>(255, VisibleStreak[id] + 1);
-			OccludedStreak[id] = 0;
+			for (int32 Y = Begin; Y < End; ++Y)
+			{
+				for (int32 X = 0; X < Width; ++X)
+				{
+					float Value = ReprojectScratch[size_t(Y) * Width + X];
+					if (Value < 0.0f)
+					{
+						Value = 1.0f;
+						if (X > 0 && Y > 0 && X + 1 < Width && Y + 1 < Height)
+						{
+							const float L = ReprojectScratch[size_t(Y) * Width + X - 1];
+							const float R = ReprojectScratch[size_t(Y) * Width + X + 1];
+							const float U = ReprojectScratch[size_t(Y - 1) * Width + X];
+							const float D = ReprojectScratch[size_t(Y + 1) * Width + X];
+							if (L >= 0.0f && R >= 0.0f && U >= 0.0f && D >= 0.0f)
+							{
+								Value = std::max(std::max(L, R), std::max(U, D));
+							}
+						}
+					}
+					const int32 Tile = (Y / TileSize) * TilesX + (X / TileSize);
+					Depth[size_t(Tile) * TileSize * TileSize + (Y % TileSize) * TileSize + (X % TileSize)] = Value;
+				}
+			}
+		});
+
+	Stats.ReprojectTimeMS += static_cast<float>(FPlatformTime::ToMilliseconds(FPlatformTime::Cycles64() - StartCycles));
+}
 
-			// 직전이 가려짐이면, thresh 미만 동안은 가려짐 유지
-			if (LastState[id] == 0 && VisibleStreak[id] < thresh)
-				occluded = true;
+void FOcclusionCullingManagerCPU::CullTwoPhase(const TArray<FOccluderDesc>& Occluders, const TArray<int32>& OccluderOccludeeIndices,
+	const TArray<FAABB>& Bounds, const FMatrix& ViewProj, TArray<uint8>& OutVisibleFlags)
+{
+	// 기록이 없으면 (첫 프레임, 해상도 변경) 모든 오클루더로 한 번에 처리
+	if (!bHasHistory)
+	{
+		BeginFrame();
+		RasterizeOccluders(Occluders);
+		BuildHZB();
+		TestOccludees(Bounds, ViewProj, OutVisibleFlags);
+		EndFrame(ViewProj);
+		return;
+	}
+
+	Stats.Reset();
+	Stats.BufferWidth = static_cast<uint32>(Width);
+	Stats.BufferHeight = static_cast<uint32>(Height);
+	Stats.bTemporal = true;
+
+	// 1단계: 이전 프레임 깊이를 재투영한 HZB로 모든 오클루디 테스트
+	//        카메라가 그대로면 지난 프레임의 깊이 버퍼와 HZB를 그대로 사용
+	if (std::memcmp(&PrevViewProj, &ViewProj, sizeof(FMatrix)) != 0)
+	{
+		ReprojectPreviousDepth(ViewProj);
+		BuildHZB();
+	}
+
+	const int32 Num = Bounds.Num();
+	uint64 StartCycles = FPlatformTime::Cycles64();
+	Phase1Results.resize(Num);
+	FTaskScheduler::GetInstance().ParallelFor(Num, 64, [&](int32 Begin, int32 End)
+		{
+			for (int32 i = Begin; i < End; ++i)
+			{
+				Phase1Results[i] = ClassifyAABB(Bounds[i], ViewProj);
+			}
+		});
+	Stats.TestTimeMS += static_cast<float>(FPlatformTime::ToMilliseconds(FPlatformTime::Cycles64() - StartCycles));
+
+	OutVisibleFlags.resize(Num);
+	RetestIndices.Empty();
+	for (int32 i = 0; i < Num; ++i)
+	{
+		OutVisibleFlags[i] = 0;
+		if (Phase1Results[i] == EOcclusionResult::OutsideView)
+		{
+			++Stats.OutsideViewCount;
+			continue;
 		}
+		Stats.Phase1CulledCount += (Phase1Results[i] == EOcclusionResult::Occluded) ? 1 : 0;
+		RetestIndices.Add(i);
+	}
+	Stats.TestedCount = static_cast<uint32>(Num);
 
-		LastState[id] = occluded ? 0 : 1;
-		OutVisibleFlags[id] = occluded ? 0 : 1;
+	// 1단계에서 가려진 오클루더는 래스터화하지 않음 (화면 밖 오클루더는 RasterizeOccluders에서 걸러짐)
+	Phase1Occluders.Empty();
+	for (int32 i = 0; i < Occluders.Num(); ++i)
+	{
+		const int32 OccludeeIndex = i < OccluderOccludeeIndices.Num() ? OccluderOccludeeIndices[i] : -1;
+		if (OccludeeIndex >= 0 && OccludeeIndex < Num && Phase1Results[OccludeeIndex] == EOcclusionResult::Occluded)
+		{
+			++Stats.SkippedOccluderCount;
+			continue;
+		}
+		Phase1Occluders.Add(Occluders[i]);
 	}
-}
\ No newline at end of file
+
+	// 2단계: 새 깊이 버퍼로 화면 안의 오클루디를 다시 테스트
+	//        GPU 방식과 달리 아직 아무것도 그리지 않았으므로 1단계에서 보인 것도 다시 걸러냄.
+	//        1단계에서 가려졌는데 여기서 보이면 디스오클루전 (1단계 false negative)
+	ClearDepth();
+	RasterizeOccluders(Phase1Occluders);
+	BuildHZB();
+
+	StartCycles = FPlatformTime::Cycles64();
+	std::atomic<uint32> Occluded{ 0 };
+	std::atomic<uint32> Rescued{ 0 };
+	FTaskScheduler::GetInstance().ParallelFor(RetestIndices.Num(), 64, [&](int32 Begin, int32 End)
+		{
+			uint32 BatchOccluded = 0;
+			uint32 BatchRescued = 0;
+			for (int32 k = Begin; k < End; ++k)
+			{
+				const int32 i = RetestIndices[k];
+				if (ClassifyAABB(Bounds[i], ViewProj) == EOcclusionResult::Visible)
+				{
+					OutVisibleFlags[i] = 1;
+					BatchRescued += (Phase1Results[i] == EOcclusionResult::Occluded) ? 1 : 0;
+				}
+				else
+				{
+					++BatchOccluded;
+				}
+			}
+			Occluded += BatchOccluded;
+			Rescued += BatchRescued;
+		});
+	Stats.TestTimeMS += static_cast<float>(FPlatformTime::ToMilliseconds(FPlatformTime::Cycles64() - StartCycles));
+
+	Stats.RescuedCount = Rescued.load();
+	Stats.CulledCount = Occluded.load();
+
+	EndFrame(ViewProj);
+}
@@ -1,257 +1,164 @@
 ﻿#pragma once
+#include "AABB.h"
+#include "OcclusionStats.h"
 
-struct FVector;
-struct FVector4;
-struct FMatrix; // row-major, p' = p * M 가정(네 컨벤션대로)
-struct FAABB; // AABB
+/*
+    CPU 소프트웨어 오클루전 컬링 (Masked Occlusion Culling 방식의 단순화 버전)
 
-struct FCandidateDrawable
+    1) 저폴리 오클루더 메시의 삼각형을 저해상도 깊이 버퍼에 SIMD(AVX)로 래스터화
+       - 깊이 버퍼는 8x8 픽셀 타일 단위로 저장 (타일 한 행 = __m256 하나)
+       - 타일 행 단위로 삼각형을 빈(bin)에 나눈 뒤 워커가 타일 행을 하나씩 맡아 래스터화
+    2) 깊이 버퍼로 HZB(max 피라미드)를 만든다. 모든 밉은 Initialize에서 한 번만 할당
+    3) 오클루디 AABB를 일괄 테스트 (8개 코너를 __m256 한 번에 변환)
+
+    CullTwoPhase는 이전 프레임 깊이를 재투영한 HZB로 먼저 거른 뒤(1단계), 살아남은 오클루더만
+    래스터화한 새 HZB로 화면 안의 오클루디를 다시 테스트한다(2단계, 디스오클루전 복구).
+    카메라가 거의 움직이지 않으면 가려진 오클루더의 래스터화 비용이 빠진다.
+
+    깊이는 D3D 클립 공간 z/w (0 = Near, 1 = Far), 화면 좌표는 왼쪽 위가 (0, 0)
+*/
+
+// 오클루더 한 개 (메시 로컬 정점 + 인덱스 + 로컬 → 클립 변환)
+struct FOccluderDesc
 {
-    uint32_t ActorIndex;   // VisibleFlags 인덱스
-    FAABB   Bound;        // 월드 AABB (Min/Max)
-    FMatrix  WorldViewProj;// 행벡터 기준 WVP
-    FMatrix  WorldView;    // ★ 추가: World-space * View  (여기서는 View만 주면 됨)
-    float    NearClip;        // ★ 추가
-    float    FarClip;         // ★ 추가
+    const FVector* Positions = nullptr;   // 첫 정점의 위치
+    uint32 PositionStride = sizeof(FVector); // 정점 간 바이트 간격 (FNormalVertex 배열을 그대로 넘길 수 있도록)
+    uint32 NumVertices = 0;
+    const uint32* Indices = nullptr;
+    uint32 NumIndices = 0;
+    FMatrix WorldViewProj;                // 행벡터 기준 World * View * Proj
 };
 
-// 교체 (MaxZ 추가)
-struct FOcclusionRect
+enum class EOcclusionResult : uint8
 {
-    float MinX, MinY, MaxX, MaxY; // [0..1]
-    float MinZ;                   // 가장 가까운
-    float MaxZ;                   // 가장 먼      <<--- 추가
-    uint32_t ActorIndex;
+    Visible,
+    Occluded,
+    OutsideView,    // 화면 밖 또는 Far 평면 너머
 };
 
-// 저해상도 깊이맵 + HZB(min) - CPU 전용
-class FOcclusionGrid
+class FOcclusionCullingManagerCPU
 {
 public:
-    void Initialize(int InWidth, int InHeight)
-    {
-        Width = InWidth; Height = InHeight;
-        // 교체: 1.0f (Far)
-        Depth.assign(size_t(Width * Height), 1.0f);
-        BuildLevels.clear();
-    }
-    void Clear()
-    {
-        // Clear 도 동일하게 1.0f로
-        std::fill(Depth.begin(), Depth.end(), 1.0f);
-        BuildLevels.clear();
-    }
+    static constexpr int32 TileSize = 8;          // 깊이 버퍼 타일 한 변 (픽셀)
+    static constexpr int32 MaxMipCount = 16;
 
-    /*
-        왜 R.MaxZ를 쓰는데 min 누적을 하나?
+    FOcclusionCullingManagerCPU() = default;
 
-        오클루더 AABB가 두껍거나 경계 근사 때문에 일부 픽셀이 원래보다 더 멀게 잡힐 수 있다.
+    // 깊이 버퍼와 HZB를 미리 할당 (크기가 같으면 아무 일도 하지 않음). 크기는 TileSize 배수로 올림
+    void Initialize(int32 InWidth, int32 InHeight);
+    void Shutdown();
 
-        레벨0은 per-pixel 가장 가까운 오클루더가 들어가야 하므로, 여러 오클루더가 겹칠 때 **min(current, MaxZ)**로 더 가까운 값으로만 낮춘다.
+    // 1) 깊이 버퍼를 Far(1.0)로 지우고 프레임 통계 초기화
+    void BeginFrame();
 
-        이렇게 해야 상위 레벨의 MAX 피라미드가 보수적이 됨(=오버컬링 방지).
-    */
+    // 프레임 끝: 이번 깊이 버퍼를 다음 프레임 재투영 기록으로 남김
+    void EndFrame(const FMatrix& ViewProj);
 
-    void RasterizeRectDepthMin(int MinPX, int MinPY, int MaxPX, int MaxPY, float MaxZ)
-    {
-        MinPX = std::max(0, MinPX); MinPY = std::max(0, MinPY);
-        MaxPX = std::min(Width - 1, MaxPX); MaxPY = std::min(Height - 1, MaxPY);
-        for (int y = MinPY; y <= MaxPY; ++y)
-        {
-            float* Row = &Depth[size_t(y) * Width];
-            for (int x = MinPX; x <= MaxPX; ++x)
-            {
-                Row[x] = std::min(Row[x], MaxZ); // 가장 가까운 깊이로 갱신
-            }
-        }
-    }
+    // 이전 프레임 기록 폐기 (카메라 컷 등)
+    void InvalidateHistory() { bHasHistory = false; }
+    bool HasHistory() const { return bHasHistory; }
 
-    void BuildHZB()
-    {
-        BuildLevels.clear();
-        BuildLevels.push_back(Depth); // level 0
-
-        int W = Width, H = Height;
-        while (W > 1 || H > 1)
-        {
-            int NW = std::max(1, W >> 1);
-            int NH = std::max(1, H >> 1);
-            TArray<float> Next(size_t(NW * NH), +FLT_MAX);
-
-            for (int y = 0; y < NH; ++y)
-                for (int x = 0; x < NW; ++x)
-                {
-                    int sx = x * 2, sy = y * 2;
-                    float a = SampleSafe(BuildLevels.back(), W, H, sx + 0, sy + 0);
-                    float b = SampleSafe(BuildLevels.back(), W, H, sx + 1, sy + 0);
-                    float c = SampleSafe(BuildLevels.back(), W, H, sx + 0, sy + 1);
-                    float d = SampleSafe(BuildLevels.back(), W, H, sx + 1, sy + 1);
-                    Next[size_t(y) * NW + x] = std::max(std::max(a, b), std::max(c, d));
-                }
-            BuildLevels.push_back(std::move(Next));
-            W = NW; H = NH;
-        }
-    }
+    // 2) 오클루더 삼각형을 깊이 버퍼에 래스터화 (여러 번 호출 가능)
+    void RasterizeOccluders(const TArray<FOccluderDesc>& Occluders);
 
-    int ChooseMip(float RectW01, float RectH01) const
-    {
-        float pxW = RectW01 * Width;
-        float pxH = RectH01 * Height;
-        float s = std::max(pxW, pxH);
-        int mip = int(std::floor(std::log2(std::max(1.0f, s))));
-        mip = std::max(0, std::min(mip, int(BuildLevels.size() - 1)));
-        return mip;
-    }
+    // 3) 깊이 버퍼 → HZB(max) 갱신
+    void BuildHZB();
 
-    float SampleMaxRect(float MinX01, float MinY01, float MaxX01, float MaxY01, int Mip) const
-    {
-        const TArray<float>& L = BuildLevels[size_t(Mip)];
-        int W = std::max(1, Width >> Mip);
-        int H = std::max(1, Height >> Mip);
-
-        auto ToPx = [&](float u, float v)->std::pair<int, int> {
-            int x = int(u * W + 0.5f);
-            int y = int(v * H + 0.5f);
-            x = std::max(0, std::min(W - 1, x));
-            y = std::max(0, std::min(H - 1, y));
-            return { x,y };
-            };
-        auto Smp = [&](float u, float v)->float {
-            auto [x, y] = ToPx(u, v);
-            return L[size_t(y) * W + x];
-            };
-
-        float cx = 0.5f * (MinX01 + MaxX01);
-        float cy = 0.5f * (MinY01 + MaxY01);
-
-        float s0 = Smp(cx, cy);
-        float s1 = Smp(MinX01, MinY01);
-        float s2 = Smp(MaxX01, MinY01);
-        float s3 = Smp(MinX01, MaxY01);
-        float s4 = Smp(MaxX01, MaxY01);
-
-        return std::max(s0, std::max(s1, std::max(s2, std::max(s3, s4)))); // ★ MAX
-    }
-    // FOcclusionGrid 내부에 추가
-    float SampleMaxRectAdaptive(float MinX01, float MinY01, float MaxX01, float MaxY01, int Mip) const
-    {
-        const TArray<float>& L = BuildLevels[size_t(Mip)];
-        const int W = std::max(1, Width >> Mip);
-        const int H = std::max(1, Height >> Mip);
-
-        auto ToPx = [&](float u, float v)->std::pair<int, int> {
-            int x = int(u * W + 0.5f);
-            int y = int(v * H + 0.5f);
-            x = std::max(0, std::min(W - 1, x));
-            y = std::max(0, std::min(H - 1, y));
-            return { x,y };
-            };
-        auto Smp = [&](float u, float v)->float {
-            auto [x, y] = ToPx(u, v);
-            return L[size_t(y) * W + x];
-            };
-
-        // 샘플 밀도: 화면 픽셀 크기에 비례 (최대 5x5)
-        const int grid = ((MaxX01 - MinX01) * Width + (MaxY01 - MinY01) * Height > 80) ? 5 :
-            ((MaxX01 - MinX01) * Width + (MaxY01 - MinY01) * Height > 30) ? 4 : 3;
-
-        float best = 0.0f; // MAX 피라미드이므로 최댓값을 모음
-        for (int j = 0; j < grid; j++)
-        {
-            float v = std::lerp(MinY01, MaxY01, (grid == 1) ? 0.5f : float(j) / (grid - 1));
-            for (int i = 0; i < grid; i++)
-            {
-                float u = std::lerp(MinX01, MaxX01, (grid == 1) ? 0.5f : float(i) / (grid - 1));
-                best = std::max(best, Smp(u, v));
-            }
-        }
-        return best;
-    }
-    // FOcclusionGrid 내부에 추가 (레벨0 정밀 검사)
-    bool FullyOccludedAtLevel0(float MinX01, float MinY01, float MaxX01, float MaxY01, float MinZ, float eps2) const
-    {
-        const TArray<float>& L0 = BuildLevels[0];
-        const int W = Width, H = Height;
-
-        int x0 = std::max(0, std::min(W - 1, int(MinX01 * W)));
-        int y0 = std::max(0, std::min(H - 1, int(MinY01 * H)));
-        int x1 = std::max(0, std::min(W - 1, int(MaxX01 * W)));
-        int y1 = std::max(0, std::min(H - 1, int(MaxY01 * H)));
-
-        // 너무 큰 박스는 샘플링 간격을 둠 (성능)
-        const int maxScan = 128 * 128; // 임계 픽셀수
-        int w = std::max(1, x1 - x0 + 1);
-        int h = std::max(1, y1 - y0 + 1);
-        int step = (w * h > maxScan) ? 2 : 1;
-
-        for (int y = y0; y <= y1; y += step)
-        {
-            const float* row = &L0[size_t(y) * W];
-            for (int x = x0; x <= x1; x += step)
-            {
-                float z = row[x];           // 레벨0의 MAX-기반 값(=멀리 기록한 것들의 min 축약 결과 아님!)
-                // 주의: 우리는 base에 'MaxZ를 min으로 누적'시켰고, HZB는 최대화했음.
-                // 레벨0에서도 보수성 유지: z + eps2 <= MinZ 일 때만 occluded 픽셀로 간주.
-                if (z + eps2 > MinZ)
-                    return false; // 한 픽셀이라도 덮여있지 않음 → 전체 가림 실패
-            }
-        }
-        return true; // 전부 덮임
-    }
-    int GetWidth()  const { return Width; }
-    int GetHeight() const { return Height; }
+    // 4) 월드 AABB 일괄 테스트. OutVisibleFlags[i] = 0이면 가려짐
+    void TestOccludees(const TArray<FAABB>& Bounds, const FMatrix& ViewProj, TArray<uint8>& OutVisibleFlags);
 
+    // 2단계 시간적 컬링 (BeginFrame ~ EndFrame 전체를 대신함). 기록이 없으면 1단계 없이 한 번에 처리
+    // OccluderOccludeeIndices[i] = Occluders[i]에 해당하는 Bounds 인덱스 (-1이면 항상 래스터화)
+    void CullTwoPhase(const TArray<FOccluderDesc>& Occluders, const TArray<int32>& OccluderOccludeeIndices,
+        const TArray<FAABB>& Bounds, const FMatrix& ViewProj, TArray<uint8>& OutVisibleFlags);
 
-private:
-    static float SampleSafe(const TArray<float>& L, int W, int H, int X, int Y)
-    {
-        X = std::max(0, std::min(W - 1, X));
-        Y = std::max(0, std::min(H - 1, Y));
-        return L[size_t(Y) * W + X];
-    }
-
-private:
-    int Width = 0, Height = 0;
-    TArray<float> Depth;                     // level 0
-    TArray<TArray<float>> BuildLevels;  // [0..N-1], min chain
+    // 단일 AABB 테스트 (BuildHZB 이후)
+    EOcclusionResult ClassifyAABB(const FAABB& Bound, const FMatrix& ViewProj) const;
+    bool IsAABBVisible(const FAABB& Bound, const FMatrix& ViewProj) const { return ClassifyAABB(Bound, ViewProj) == EOcclusionResult::Visible; }
 
+    int32 GetWidth() const { return Width; }
+    int32 GetHeight() const { return Height; }
+    int32 GetMipCount() const { return MipCount; }
 
-};
-
-// CPU 오클루전 매니저
-class FOcclusionCullingManagerCPU
-{
-public:
-    void Initialize(int GridW, int GridH) { Grid.Initialize(GridW, GridH); }
-    void Shutdown() {}
-
-    // 1) 오클루더로 저해상도 Depth 채우기
-    void BuildOccluderDepth(const TArray<FCandidateDrawable>& Occluders, int ViewW, int ViewH);
-
-    // 2) CPU HZB
-    void BuildHZB() { Grid.BuildHZB(); }
-
-    // 3) 후보 가시성 판정
-    void TestOcclusion(const TArray<FCandidateDrawable>& Candidates, int ViewW, int ViewH, TArray<uint8_t>& OutVisibleFlags);
+    // 레벨 0 깊이 (타일 배치를 풀어서 읽음)
+    float GetDepth(int32 X, int32 Y) const
+    {
+        const int32 Tile = (Y / TileSize) * TilesX + (X / TileSize);
+        return Depth[size_t(Tile) * TileSize * TileSize + (Y % TileSize) * TileSize + (X % TileSize)];
+    }
 
-    const FOcclusionGrid& GetGrid() const { return Grid; }
+    const FOcclusionStats& GetStats() const { return Stats; }
 
 private:
-    // AABB(Min/Max) → 화면 사각형 + MinZ (★이제 MinZ는 '선형 깊이 0..1')
-    static bool ComputeRectAndMinZ(const FCandidateDrawable& D, int ViewW, int ViewH, FOcclusionRect& OutRect);
-
-    // 행벡터: Out = In(1x4) * M(4x4)
-    static inline void MulPointRow(const float In[4], const FMatrix& M, float Out[4])
+    // 래스터화 준비가 끝난 화면 공간 삼각형 (앞면만, Near 클리핑 이후)
+    struct FOccluderTriangle
+    {
+        float EdgeA[3];
+        float EdgeB[3];
+        float EdgeC[3];     // E(x, y) = A*x + B*y + C >= 0 이면 변 안쪽
+        float DepthDX;
+        float DepthDY;
+        float Depth0;       // Z(x, y) = DepthDX*x + DepthDY*y + Depth0
+        float MinZ;         // 세 정점 중 가장 가까운 깊이 (타일 HiZ 조기 거부용)
+        int32 MinTileX, MinTileY, MaxTileX, MaxTileY;
+        int32 MinPixelY, MaxPixelY;
+    };
+
+    // 클립 공간 삼각형 하나를 Near 평면(z >= 0)으로 잘라 화면 삼각형 0~2개를 만든다
+    int32 SetupTriangle(const FVector4& V0, const FVector4& V1, const FVector4& V2, FOccluderTriangle* OutTriangles) const;
+    bool SetupScreenTriangle(const FVector4& V0, const FVector4& V1, const FVector4& V2, FOccluderTriangle& OutTriangle) const;
+
+    // 타일 행 하나에 빈에 담긴 삼각형들을 래스터화 (워커 하나가 타일 행 하나를 담당)
+    void RasterizeTileRow(int32 TileY);
+    void RasterizeTriangleInTile(const FOccluderTriangle& Tri, int32 TileX, int32 TileY, float* TileDepth);
+
+    void ClearDepth();
+
+    // 이전 프레임 깊이를 현재 ViewProj로 전방 재투영해 깊이 버퍼를 채움
+    void ReprojectPreviousDepth(const FMatrix& ViewProj);
+
+    // HZB 밉 Level의 (X, Y) 텍셀. Level 0은 타일 배치 깊이 버퍼
+    float SampleHZB(int32 Level, int32 X, int32 Y) const
     {
-        Out[0] = In[0] * M.M[0][0] + In[1] * M.M[1][0] + In[2] * M.M[2][0] + In[3] * M.M[3][0];
-        Out[1] = In[0] * M.M[0][1] + In[1] * M.M[1][1] + In[2] * M.M[2][1] + In[3] * M.M[3][1];
-        Out[2] = In[0] * M.M[0][2] + In[1] * M.M[1][2] + In[2] * M.M[2][2] + In[3] * M.M[3][2];
-        Out[3] = In[0] * M.M[0][3] + In[1] * M.M[1][3] + In[2] * M.M[2][3] + In[3] * M.M[3][3];
+        return Level == 0 ? GetDepth(X, Y) : HZB[MipOffsets[Level] + size_t(Y) * MipWidths[Level] + X];
     }
 
+    // 화면 사각형(픽셀, [Min, Max))의 모든 텍셀이 MinZ보다 가까우면 가려짐
+    bool IsRectOccluded(float MinX, float MinY, float MaxX, float MaxY, float MinZ) const;
+
 private:
-    FOcclusionGrid Grid;
-    TArray<uint8_t> VisibleStreak;   // 연속 보임 프레임 수
-    TArray<uint8_t> OccludedStreak;  // 연속 가림 프레임 수
-    TArray<uint8_t> LastState;       // 0=occluded, 1=visible
-};
\ No newline at end of file
+    int32 Width = 0;
+    int32 Height = 0;
+    int32 TilesX = 0;
+    int32 TilesY = 0;
+
+    TArray<float> Depth;            // 레벨 0 (TilesX * TilesY * 64, 타일 배치)
+    TArray<float> TileMaxDepth;     // 타일별 가장 먼 깊이 (래스터화 중 HiZ 조기 거부)
+
+    // HZB 레벨 1~N (행 우선, 하나의 버퍼에 이어 붙임)
+    TArray<float> HZB;
+    int32 MipCount = 0;
+    size_t MipOffsets[MaxMipCount] = {};
+    int32 MipWidths[MaxMipCount] = {};
+    int32 MipHeights[MaxMipCount] = {};
+
+    // 프레임 간 재사용하는 래스터화 작업 버퍼
+    TArray<FVector4> ClipVertices;
+    TArray<uint32> VertexOffsets;          // 오클루더별 ClipVertices 시작 위치
+    TArray<uint32> TriangleOffsets;        // 오클루더별 Triangles 시작 위치 (입력 삼각형당 2칸)
+    TArray<uint32> TriangleCounts;         // 오클루더별 실제 생성된 삼각형 수
+    TArray<FOccluderTriangle> Triangles;
+    TArray<TArray<uint32>> TileRowBins;    // 타일 행별 삼각형 인덱스 (오클루더 순서 유지)
+
+    // 시간적 컬링
+    bool bHasHistory = false;
+    FMatrix PrevViewProj;
+    TArray<int32> ReprojectTargets;        // 이전 픽셀별 도착 픽셀 (행 우선, -1 = 버림)
+    TArray<float> ReprojectDepths;         // 이전 픽셀별 재투영 깊이
+    TArray<float> ReprojectScratch;        // 재투영 결과 (행 우선, 음수 = 샘플 없음)
+    TArray<EOcclusionResult> Phase1Results;
+    TArray<FOccluderDesc> Phase1Occluders;
+    TArray<int32> RetestIndices;
+
+    FOcclusionStats Stats;
+};
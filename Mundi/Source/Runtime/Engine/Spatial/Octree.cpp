@@ -262,7 +262,9 @@ void FOctree::Update(AActor* InActor)
     auto it = ActorLastBounds.find(InActor);
     if (it != ActorLastBounds.end())
     {
-        Update(InActor, it->second, InActor->GetBounds());
+        // 갱신 중 ActorLastBounds가 재배치될 수 있으므로 값으로 복사해 넘김
+        const FAABB OldBounds = it->second;
+        Update(InActor, OldBounds, InActor->GetBounds());
     }
     else
     {
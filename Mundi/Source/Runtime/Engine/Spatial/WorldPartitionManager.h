@@ -26,6 +26,8 @@ public:
 	// 신규 등록 API
 	void Register(UPrimitiveComponent* Smc);         // StaticMeshComponent 하나 추가
 	void BulkRegister(const TArray<AActor*>& Actors); // 여러 액터 한 번에 추가 (+즉시 리빌드)
+	// 켜져 있는 동안 Register를 무시 (컴포넌트를 한꺼번에 등록한 뒤 BulkRegister로 한 번에 넣을 때 사용)
+	void SetDeferRegister(bool bInDefer) { bDeferRegister = bInDefer; }
 	
 	void Unregister(UPrimitiveComponent* Component);
 
@@ -55,7 +57,8 @@ private:
 	void ClearBVHierarchy();
 	
 	TQueue<UPrimitiveComponent*> ComponentDirtyQueue; // 추가 혹은 갱신이 필요한 요소의 대기 큐
-	TSet<UPrimitiveComponent*> ComponentDirtySet;     // 더티 큐 중복 추가를 막기 위한 Set
+	TFlatSet<UPrimitiveComponent*> ComponentDirtySet;     // 더티 큐 중복 추가를 막기 위한 Set
 	FOctree* SceneOctree = nullptr;
 	FBVHierarchy* BVH = nullptr;
+	bool bDeferRegister = false;
 };
@@ -198,6 +198,10 @@ struct FTileCullingBufferType
     uint32 bUseTileCulling;   // 타일 컬링 활성화 여부 (0=비활성화, 1=활성화)
     uint32 ViewportStartX;    // 뷰포트 시작 X 좌표
     uint32 ViewportStartY;    // 뷰포트 시작 Y 좌표
+    uint32 bUseClusteredCulling; // 클러스터 컬링 여부 (1이면 TileSize/TileCount는 클러스터 화면 그리드)
+    uint32 ClusterSliceCount; // 로그 깊이 슬라이스 개수
+    float ClusterDepthScale;  // Slice = floor(log(ViewZ) * Scale + Bias)
+    float ClusterDepthBias;
     uint32 Padding[2];
 };
 
@@ -0,0 +1,78 @@
+﻿#include "pch.h"
+#include "D3D11CommandContext.h"
+
+void FD3D11CommandContext::SetPipeline(FRHIHandle InputLayout, FRHIHandle VertexShader, FRHIHandle PixelShader)
+{
+	DeviceContext->IASetInputLayout(static_cast<ID3D11InputLayout*>(InputLayout));
+	DeviceContext->VSSetShader(static_cast<ID3D11VertexShader*>(VertexShader), nullptr, 0);
+	DeviceContext->PSSetShader(static_cast<ID3D11PixelShader*>(PixelShader), nullptr, 0);
+}
+
+void FD3D11CommandContext::SetShaderResources(uint32 StartSlot, uint32 Count, const FRHIHandle* Views)
+{
+	ID3D11ShaderResourceView* SRVs[FRHICommand::MaxHandles] = {};
+	for (uint32 i = 0; i < Count; ++i)
+	{
+		SRVs[i] = static_cast<ID3D11ShaderResourceView*>(Views[i]);
+	}
+	DeviceContext->PSSetShaderResources(StartSlot, Count, SRVs);
+}
+
+void FD3D11CommandContext::SetSamplers(uint32 StartSlot, uint32 Count, const FRHIHandle* Samplers)
+{
+	ID3D11SamplerState* SamplerStates[FRHICommand::MaxHandles] = {};
+	for (uint32 i = 0; i < Count; ++i)
+	{
+		SamplerStates[i] = static_cast<ID3D11SamplerState*>(Samplers[i]);
+	}
+	DeviceContext->PSSetSamplers(StartSlot, Count, SamplerStates);
+}
+
+void FD3D11CommandContext::SetVertexBuffer(FRHIHandle Buffer, uint32 Stride, uint32 Offset)
+{
+	ID3D11Buffer* VertexBuffer = static_cast<ID3D11Buffer*>(Buffer);
+	UINT VertexStride = Stride;
+	UINT VertexOffset = Offset;
+	DeviceContext->IASetVertexBuffers(0, 1, &VertexBuffer, &VertexStride, &VertexOffset);
+}
+
+void FD3D11CommandContext::SetIndexBuffer(FRHIHandle Buffer, ERHIIndexFormat Format, uint32 Offset)
+{
+	const DXGI_FORMAT IndexFormat = (Format == ERHIIndexFormat::UInt16) ? DXGI_FORMAT_R16_UINT : DXGI_FORMAT_R32_UINT;
+	DeviceContext->IASetIndexBuffer(static_cast<ID3D11Buffer*>(Buffer), IndexFormat, Offset);
+}
+
+void FD3D11CommandContext::SetPrimitiveTopology(uint32 Topology)
+{
+	DeviceContext->IASetPrimitiveTopology(static_cast<D3D11_PRIMITIVE_TOPOLOGY>(Topology));
+}
+
+void FD3D11CommandContext::UpdateConstantBuffer(FRHIHandle Buffer, const void* Data, uint32 Size)
+{
+	// D3D11RHI::ConstantBufferUpdate와 동일하게 WRITE_DISCARD로 갱신
+	ID3D11Buffer* ConstantBuffer = static_cast<ID3D11Buffer*>(Buffer);
+	D3D11_MAPPED_SUBRESOURCE MSR;
+	if (SUCCEEDED(DeviceContext->Map(ConstantBuffer, 0, D3D11_MAP_WRITE_DISCARD, 0, &MSR)))
+	{
+		memcpy(MSR.pData, Data, Size);
+		DeviceContext->Unmap(ConstantBuffer, 0);
+	}
+}
+
+void FD3D11CommandContext::SetConstantBuffer(uint8 StageMask, uint32 Slot, FRHIHandle Buffer)
+{
+	ID3D11Buffer* ConstantBuffer = static_cast<ID3D11Buffer*>(Buffer);
+	if (StageMask & RHI_STAGE_Vertex)
+	{
+		DeviceContext->VSSetConstantBuffers(Slot, 1, &ConstantBuffer);
+	}
+	if (StageMask & RHI_STAGE_Pixel)
+	{
+		DeviceContext->PSSetConstantBuffers(Slot, 1, &ConstantBuffer);
+	}
+}
+
+void FD3D11CommandContext::DrawIndexed(uint32 IndexCount, uint32 StartIndex, int32 BaseVertex)
+{
+	DeviceContext->DrawIndexed(IndexCount, StartIndex, BaseVertex);
+}
@@ -0,0 +1,29 @@
+﻿#pragma once
+#include <d3d11.h>
+#include "RHICommandList.h"
+
+/**
+ * @class FD3D11CommandContext
+ * @brief FRHICommandList를 D3D11 Immediate Context에 재생하는 백엔드.
+ */
+class FD3D11CommandContext : public IRHICommandContext
+{
+public:
+	explicit FD3D11CommandContext(ID3D11DeviceContext* InDeviceContext)
+		: DeviceContext(InDeviceContext)
+	{
+	}
+
+	void SetPipeline(FRHIHandle InputLayout, FRHIHandle VertexShader, FRHIHandle PixelShader) override;
+	void SetShaderResources(uint32 StartSlot, uint32 Count, const FRHIHandle* Views) override;
+	void SetSamplers(uint32 StartSlot, uint32 Count, const FRHIHandle* Samplers) override;
+	void SetVertexBuffer(FRHIHandle Buffer, uint32 Stride, uint32 Offset) override;
+	void SetIndexBuffer(FRHIHandle Buffer, ERHIIndexFormat Format, uint32 Offset) override;
+	void SetPrimitiveTopology(uint32 Topology) override;
+	void UpdateConstantBuffer(FRHIHandle Buffer, const void* Data, uint32 Size) override;
+	void SetConstantBuffer(uint8 StageMask, uint32 Slot, FRHIHandle Buffer) override;
+	void DrawIndexed(uint32 IndexCount, uint32 StartIndex, int32 BaseVertex) override;
+
+private:
+	ID3D11DeviceContext* DeviceContext = nullptr;
+};
@@ -1,6 +1,7 @@
 ﻿#include "pch.h"
 #include "StatsOverlayD2D.h"
 #include "Color.h"
+#include "D3D11CommandContext.h"
 
 void D3D11RHI::Initialize(HWND hWindow)
 {
@@ -303,14 +304,33 @@ HRESULT D3D11RHI::CreateIndexBuffer(ID3D11Device* device, const FStaticMesh* mes
     if (!mesh || mesh->Indices.empty())
         return E_FAIL;
 
+    // LOD가 있으면 LOD0 뒤에 LOD1..N 인덱스를 이어 붙여 하나의 버퍼로 (UStaticMesh::GetLODIndexOffset)
+    TArray<uint32> Combined;
+    const TArray<uint32>* Indices = &mesh->Indices;
+    if (!mesh->LODs.empty())
+    {
+        size_t Total = mesh->Indices.size();
+        for (const FStaticMeshLOD& LOD : mesh->LODs)
+        {
+            Total += LOD.Indices.size();
+        }
+        Combined.reserve(Total);
+        Combined.insert(Combined.end(), mesh->Indices.begin(), mesh->Indices.end());
+        for (const FStaticMeshLOD& LOD : mesh->LODs)
+        {
+            Combined.insert(Combined.end(), LOD.Indices.begin(), LOD.Indices.end());
+        }
+        Indices = &Combined;
+    }
+
     D3D11_BUFFER_DESC ibd = {};
     ibd.Usage = D3D11_USAGE_DEFAULT;
-    ibd.ByteWidth = static_cast<UINT>(sizeof(uint32) * mesh->Indices.size());
+    ibd.ByteWidth = static_cast<UINT>(sizeof(uint32) * Indices->size());
     ibd.BindFlags = D3D11_BIND_INDEX_BUFFER;
     ibd.CPUAccessFlags = 0;
 
     D3D11_SUBRESOURCE_DATA iinitData = {};
-    iinitData.pSysMem = mesh->Indices.data();
+    iinitData.pSysMem = Indices->data();
 
     return device->CreateBuffer(&ibd, &iinitData, outBuffer);
 }
@@ -345,6 +365,17 @@ void D3D11RHI::ConstantBufferSet(ID3D11Buffer* ConstantBuffer, uint32 Slot, bool
 }
 
 
+void D3D11RHI::SubmitCommandList(const FRHICommandList& CommandList)
+{
+    if (CommandList.IsEmpty())
+    {
+        return;
+    }
+
+    FD3D11CommandContext CommandContext(DeviceContext);
+    CommandList.Execute(CommandContext);
+}
+
 void D3D11RHI::IASetPrimitiveTopology()
 {
     DeviceContext->IASetPrimitiveTopology(D3D11_PRIMITIVE_TOPOLOGY_TRIANGLELIST);
@@ -3,6 +3,7 @@
 #include "ResourceManager.h"
 #include "VertexData.h"
 #include "ConstantBufferType.h"
+#include "RHICommandList.h"
 
 
 #define DECLARE_CONSTANT_BUFFER(TYPE)\
@@ -28,6 +29,12 @@ CreateConstantBuffer(&TYPE##Buffer, sizeof(TYPE));
 	{\
 		ConstantBufferSetUpdate(TYPE##Buffer, Data, TYPE##Slot, TYPE##IsVS, TYPE##IsPS);	\
 	}
+// 커맨드 리스트에 상수 버퍼 갱신 + 바인딩을 기록 (즉시 실행하지 않음)
+#define DECLARE_RECORD_SET_UPDATE_CONSTANT_BUFFER_FUNC(TYPE) \
+	void RecordSetAndUpdateConstantBuffer(FRHICommandList& CommandList, const TYPE& Data) const	\
+	{\
+		CommandList.SetAndUpdateConstantBuffer(TYPE##Buffer, TYPE##Slot, TYPE##IsVS, TYPE##IsPS, &Data, sizeof(TYPE));	\
+	}
 
 
 struct FLinearColor;
@@ -88,18 +95,27 @@ public:
 	CONSTANT_BUFFER_LIST(DECLARE_UPDATE_CONSTANT_BUFFER_FUNC)
 	CONSTANT_BUFFER_LIST(DECLARE_SET_CONSTANT_BUFFER_FUNC)
 	CONSTANT_BUFFER_LIST(DECLARE_SET_UPDATE_CONSTANT_BUFFER_FUNC)
+	CONSTANT_BUFFER_LIST(DECLARE_RECORD_SET_UPDATE_CONSTANT_BUFFER_FUNC)
+
+	/** @brief 녹화된 커맨드 리스트를 Immediate Context에 순서대로 재생합니다. (렌더 스레드에서만 호출) */
+	void SubmitCommandList(const FRHICommandList& CommandList);
 	
+	template <typename TVertex, typename TAllocator>
+	void VertexBufferUpdate(ID3D11Buffer* VertexBuffer, const std::vector<TVertex, TAllocator>& Data)
+	{
+		VertexBufferUpdate(VertexBuffer, Data.data(), Data.size());
+	}
 	template <typename TVertex>
-	void VertexBufferUpdate(ID3D11Buffer* VertexBuffer, const std::vector<TVertex>& Data)
+	void VertexBufferUpdate(ID3D11Buffer* VertexBuffer, const TVertex* Data, size_t NumVertices)
 	{
 		// 데이터가 없으면 맵/언맵을 시도하지 않습니다.
-		if (Data.empty()) { return; }
+		if (NumVertices == 0) { return; }
 
 		D3D11_MAPPED_SUBRESOURCE MSR;
 		DeviceContext->Map(VertexBuffer, 0, D3D11_MAP_WRITE_DISCARD, 0, &MSR);
 
-		const size_t DataSizeInBytes = Data.size() * sizeof(TVertex);
-		memcpy(MSR.pData, Data.data(), DataSizeInBytes);
+		const size_t DataSizeInBytes = NumVertices * sizeof(TVertex);
+		memcpy(MSR.pData, Data, DataSizeInBytes);
 
 		DeviceContext->Unmap(VertexBuffer, 0);
 	}
@@ -380,6 +396,13 @@ inline HRESULT D3D11RHI::CreateVertexBuffer<FVertexDynamic>(ID3D11Device* device
 	return CreateVertexBufferImpl<FVertexDynamic>(device, srcVertices, outBuffer, D3D11_USAGE_DEFAULT, 0);
 }
 
+// PositionPackedNormalTexture (COMPACT_VERTEX)
+template<>
+inline HRESULT D3D11RHI::CreateVertexBuffer<FPackedNormalVertex>(ID3D11Device* device, const std::vector<FNormalVertex>& srcVertices, ID3D11Buffer** outBuffer)
+{
+	return CreateVertexBufferImpl<FPackedNormalVertex>(device, srcVertices, outBuffer, D3D11_USAGE_DEFAULT, 0);
+}
+
 // Billboard
 template<>
 inline HRESULT D3D11RHI::CreateVertexBuffer<FBillboardVertexInfo_GPU>(ID3D11Device* device, const std::vector<FNormalVertex>& srcVertices, ID3D11Buffer** outBuffer)
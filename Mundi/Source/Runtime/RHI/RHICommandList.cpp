@@ -0,0 +1,439 @@
+﻿#include "pch.h"
+#include "RHICommandList.h"
+
+namespace
+{
+	// [StartSlot, StartSlot + Count) 범위의 캐시가 모두 유효하고 같은 핸들인지 확인
+	bool IsSlotRangeCached(uint32 ValidMask, const FRHIHandle* Cached, uint32 MaxSlots, uint32 StartSlot, uint32 Count, const FRHIHandle* Handles)
+	{
+		if (StartSlot + Count > MaxSlots)
+		{
+			return false;
+		}
+
+		for (uint32 i = 0; i < Count; ++i)
+		{
+			const uint32 Slot = StartSlot + i;
+			if ((ValidMask & (1u << Slot)) == 0 || Cached[Slot] != Handles[i])
+			{
+				return false;
+			}
+		}
+		return true;
+	}
+
+	void CacheSlotRange(uint32& ValidMask, FRHIHandle* Cached, uint32 MaxSlots, uint32 StartSlot, uint32 Count, const FRHIHandle* Handles)
+	{
+		for (uint32 i = 0; i < Count; ++i)
+		{
+			const uint32 Slot = StartSlot + i;
+			if (Slot < MaxSlots)
+			{
+				ValidMask |= (1u << Slot);
+				Cached[Slot] = Handles[i];
+			}
+		}
+	}
+}
+
+//====================================================================================
+// FRHICommandList
+//====================================================================================
+
+void FRHICommandList::Reset()
+{
+	Commands.Empty();
+	ConstantData.Empty();
+	LastConstantUpdates.Empty();
+	State = FStateCache();
+	Stats = FRHICommandListStats();
+}
+
+FRHICommand& FRHICommandList::AddCommand(ERHICommandType Type)
+{
+	FRHICommand& Command = Commands.emplace_back();
+	Command.Type = Type;
+	++Stats.NumCommands;
+	return Command;
+}
+
+void FRHICommandList::SetPipeline(FRHIHandle InputLayout, FRHIHandle VertexShader, FRHIHandle PixelShader)
+{
+	if (State.bPipelineValid &&
+		State.InputLayout == InputLayout &&
+		State.VertexShader == VertexShader &&
+		State.PixelShader == PixelShader)
+	{
+		++Stats.NumFilteredCommands;
+		return;
+	}
+
+	FRHICommand& Command = AddCommand(ERHICommandType::SetPipeline);
+	Command.Handles[0] = InputLayout;
+	Command.Handles[1] = VertexShader;
+	Command.Handles[2] = PixelShader;
+
+	State.bPipelineValid = true;
+	State.InputLayout = InputLayout;
+	State.VertexShader = VertexShader;
+	State.PixelShader = PixelShader;
+}
+
+void FRHICommandList::SetShaderResources(uint32 StartSlot, uint32 Count, const FRHIHandle* Views)
+{
+	assert(Count > 0 && Count <= FRHICommand::MaxHandles);
+
+	if (IsSlotRangeCached(State.SRVValidMask, State.SRVs, MaxCachedSRVSlots, StartSlot, Count, Views))
+	{
+		++Stats.NumFilteredCommands;
+		return;
+	}
+
+	FRHICommand& Command = AddCommand(ERHICommandType::SetShaderResources);
+	Command.StartSlot = static_cast<uint8>(StartSlot);
+	Command.Count = static_cast<uint8>(Count);
+	for (uint32 i = 0; i < Count; ++i)
+	{
+		Command.Handles[i] = Views[i];
+	}
+
+	CacheSlotRange(State.SRVValidMask, State.SRVs, MaxCachedSRVSlots, StartSlot, Count, Views);
+}
+
+void FRHICommandList::SetSamplers(uint32 StartSlot, uint32 Count, const FRHIHandle* Samplers)
+{
+	assert(Count > 0 && Count <= FRHICommand::MaxHandles);
+
+	if (IsSlotRangeCached(State.SamplerValidMask, State.Samplers, MaxCachedSamplerSlots, StartSlot, Count, Samplers))
+	{
+		++Stats.NumFilteredCommands;
+		return;
+	}
+
+	FRHICommand& Command = AddCommand(ERHICommandType::SetSamplers);
+	Command.StartSlot = static_cast<uint8>(StartSlot);
+	Command.Count = static_cast<uint8>(Count);
+	for (uint32 i = 0; i < Count; ++i)
+	{
+		Command.Handles[i] = Samplers[i];
+	}
+
+	CacheSlotRange(State.SamplerValidMask, State.Samplers, MaxCachedSamplerSlots, StartSlot, Count, Samplers);
+}
+
+void FRHICommandList::SetVertexBuffer(FRHIHandle Buffer, uint32 Stride, uint32 Offset)
+{
+	if (State.bVertexBufferValid &&
+		State.VertexBuffer == Buffer &&
+		State.VertexStride == Stride &&
+		State.VertexOffset == Offset)
+	{
+		++Stats.NumFilteredCommands;
+		return;
+	}
+
+	FRHICommand& Command = AddCommand(ERHICommandType::SetVertexBuffer);
+	Command.Handles[0] = Buffer;
+	Command.Args[0] = Stride;
+	Command.Args[1] = Offset;
+
+	State.bVertexBufferValid = true;
+	State.VertexBuffer = Buffer;
+	State.VertexStride = Stride;
+	State.VertexOffset = Offset;
+}
+
+void FRHICommandList::SetIndexBuffer(FRHIHandle Buffer, ERHIIndexFormat Format, uint32 Offset)
+{
+	if (State.bIndexBufferValid &&
+		State.IndexBuffer == Buffer &&
+		State.IndexFormat == Format &&
+		State.IndexOffset == Offset)
+	{
+		++Stats.NumFilteredCommands;
+		return;
+	}
+
+	FRHICommand& Command = AddCommand(ERHICommandType::SetIndexBuffer);
+	Command.Handles[0] = Buffer;
+	Command.Args[0] = static_cast<uint32>(Format);
+	Command.Args[1] = Offset;
+
+	State.bIndexBufferValid = true;
+	State.IndexBuffer = Buffer;
+	State.IndexFormat = Format;
+	State.IndexOffset = Offset;
+}
+
+void FRHICommandList::SetPrimitiveTopology(uint32 Topology)
+{
+	if (State.bTopologyValid && State.Topology == Topology)
+	{
+		++Stats.NumFilteredCommands;
+		return;
+	}
+
+	FRHICommand& Command = AddCommand(ERHICommandType::SetPrimitiveTopology);
+	Command.Args[0] = Topology;
+
+	State.bTopologyValid = true;
+	State.Topology = Topology;
+}
+
+void FRHICommandList::UpdateConstantBuffer(FRHIHandle Buffer, const void* Data, uint32 Size)
+{
+	if (!Buffer || !Data || Size == 0)
+	{
+		return;
+	}
+
+	// 같은 버퍼를 직전과 동일한 내용으로 갱신하는 경우 Map/Unmap 자체를 생략
+	FConstantUpdateRecord* LastUpdate = nullptr;
+	for (FConstantUpdateRecord& Record : LastConstantUpdates)
+	{
+		if (Record.Buffer == Buffer)
+		{
+			LastUpdate = &Record;
+			break;
+		}
+	}
+
+	if (LastUpdate && LastUpdate->Size == Size &&
+		memcmp(ConstantData.GetData() + LastUpdate->Offset, Data, Size) == 0)
+	{
+		++Stats.NumFilteredCommands;
+		return;
+	}
+
+	// 상수 데이터는 16바이트 단위로 정렬하여 저장
+	const uint32 Offset = static_cast<uint32>((ConstantData.size() + 15) & ~static_cast<SIZE_T>(15));
+	ConstantData.resize(Offset + Size);
+	memcpy(ConstantData.GetData() + Offset, Data, Size);
+
+	FRHICommand& Command = AddCommand(ERHICommandType::UpdateConstantBuffer);
+	Command.Handles[0] = Buffer;
+	Command.Args[0] = Offset;
+	Command.Args[1] = Size;
+	Stats.ConstantBytes += Size;
+
+	if (LastUpdate)
+	{
+		LastUpdate->Offset = Offset;
+		LastUpdate->Size = Size;
+	}
+	else
+	{
+		LastConstantUpdates.Add({ Buffer, Offset, Size });
+	}
+}
+
+void FRHICommandList::SetConstantBuffer(uint8 StageMask, uint32 Slot, FRHIHandle Buffer)
+{
+	// 이미 바인딩된 스테이지는 마스크에서 제외
+	uint8 RequiredStages = RHI_STAGE_None;
+	const bool bCachedSlot = Slot < MaxCachedConstantBufferSlots;
+	const uint32 SlotBit = bCachedSlot ? (1u << Slot) : 0;
+
+	if (StageMask & RHI_STAGE_Vertex)
+	{
+		if (!bCachedSlot || (State.VSConstantValidMask & SlotBit) == 0 || State.VSConstantBuffers[Slot] != Buffer)
+		{
+			RequiredStages |= RHI_STAGE_Vertex;
+		}
+	}
+	if (StageMask & RHI_STAGE_Pixel)
+	{
+		if (!bCachedSlot || (State.PSConstantValidMask & SlotBit) == 0 || State.PSConstantBuffers[Slot] != Buffer)
+		{
+			RequiredStages |= RHI_STAGE_Pixel;
+		}
+	}
+
+	if (RequiredStages == RHI_STAGE_None)
+	{
+		++Stats.NumFilteredCommands;
+		return;
+	}
+
+	FRHICommand& Command = AddCommand(ERHICommandType::SetConstantBuffer);
+	Command.StageMask = RequiredStages;
+	Command.StartSlot = static_cast<uint8>(Slot);
+	Command.Handles[0] = Buffer;
+
+	if (bCachedSlot)
+	{
+		if (RequiredStages & RHI_STAGE_Vertex)
+		{
+			State.VSConstantValidMask |= SlotBit;
+			State.VSConstantBuffers[Slot] = Buffer;
+		}
+		if (RequiredStages & RHI_STAGE_Pixel)
+		{
+			State.PSConstantValidMask |= SlotBit;
+			State.PSConstantBuffers[Slot] = Buffer;
+		}
+	}
+}
+
+void FRHICommandList::SetAndUpdateConstantBuffer(FRHIHandle Buffer, uint32 Slot, bool bIsVS, bool bIsPS, const void* Data, uint32 Size)
+{
+	UpdateConstantBuffer(Buffer, Data, Size);
+
+	uint8 StageMask = RHI_STAGE_None;
+	if (bIsVS) { StageMask |= RHI_STAGE_Vertex; }
+	if (bIsPS) { StageMask |= RHI_STAGE_Pixel; }
+	if (StageMask != RHI_STAGE_None)
+	{
+		SetConstantBuffer(StageMask, Slot, Buffer);
+	}
+}
+
+void FRHICommandList::DrawIndexed(uint32 IndexCount, uint32 StartIndex, int32 BaseVertex)
+{
+	FRHICommand& Command = AddCommand(ERHICommandType::DrawIndexed);
+	Command.Args[0] = IndexCount;
+	Command.Args[1] = StartIndex;
+	Command.Args[2] = static_cast<uint32>(BaseVertex);
+	++Stats.NumDraws;
+}
+
+void FRHICommandList::Execute(IRHICommandContext& Context) const
+{
+	for (const FRHICommand& Command : Commands)
+	{
+		switch (Command.Type)
+		{
+		case ERHICommandType::SetPipeline:
+			Context.SetPipeline(Command.Handles[0], Command.Handles[1], Command.Handles[2]);
+			break;
+		case ERHICommandType::SetShaderResources:
+			Context.SetShaderResources(Command.StartSlot, Command.Count, Command.Handles);
+			break;
+		case ERHICommandType::SetSamplers:
+			Context.SetSamplers(Command.StartSlot, Command.Count, Command.Handles);
+			break;
+		case ERHICommandType::SetVertexBuffer:
+			Context.SetVertexBuffer(Command.Handles[0], Command.Args[0], Command.Args[1]);
+			break;
+		case ERHICommandType::SetIndexBuffer:
+			Context.SetIndexBuffer(Command.Handles[0], static_cast<ERHIIndexFormat>(Command.Args[0]), Command.Args[1]);
+			break;
+		case ERHICommandType::SetPrimitiveTopology:
+			Context.SetPrimitiveTopology(Command.Args[0]);
+			break;
+		case ERHICommandType::UpdateConstantBuffer:
+			Context.UpdateConstantBuffer(Command.Handles[0], ConstantData.GetData() + Command.Args[0], Command.Args[1]);
+			break;
+		case ERHICommandType::SetConstantBuffer:
+			Context.SetConstantBuffer(Command.StageMask, Command.StartSlot, Command.Handles[0]);
+			break;
+		case ERHICommandType::DrawIndexed:
+			Context.DrawIndexed(Command.Args[0], Command.Args[1], static_cast<int32>(Command.Args[2]));
+			break;
+		}
+	}
+}
+
+//====================================================================================
+// FNullRHICommandContext
+//====================================================================================
+
+void FNullRHICommandContext::AddError(const char* Message)
+{
+	Errors.Add(FString(Message) + " (command #" + std::to_string(NumCommands) + ")");
+}
+
+void FNullRHICommandContext::SetPipeline(FRHIHandle InputLayout, FRHIHandle InVertexShader, FRHIHandle InPixelShader)
+{
+	++NumCommands;
+	VertexShader = InVertexShader;
+	PixelShader = InPixelShader;
+}
+
+void FNullRHICommandContext::SetShaderResources(uint32 StartSlot, uint32 Count, const FRHIHandle* Views)
+{
+	++NumCommands;
+	if (Count == 0 || !Views)
+	{
+		AddError("SetShaderResources: empty slot range");
+	}
+}
+
+void FNullRHICommandContext::SetSamplers(uint32 StartSlot, uint32 Count, const FRHIHandle* Samplers)
+{
+	++NumCommands;
+	if (Count == 0 || !Samplers)
+	{
+		AddError("SetSamplers: empty slot range");
+	}
+}
+
+void FNullRHICommandContext::SetVertexBuffer(FRHIHandle Buffer, uint32 Stride, uint32 Offset)
+{
+	++NumCommands;
+	VertexBuffer = Buffer;
+	VertexStride = Stride;
+	if (Buffer && Stride == 0)
+	{
+		AddError("SetVertexBuffer: zero stride");
+	}
+}
+
+void FNullRHICommandContext::SetIndexBuffer(FRHIHandle Buffer, ERHIIndexFormat Format, uint32 Offset)
+{
+	++NumCommands;
+	IndexBuffer = Buffer;
+}
+
+void FNullRHICommandContext::SetPrimitiveTopology(uint32 InTopology)
+{
+	++NumCommands;
+	Topology = InTopology;
+}
+
+void FNullRHICommandContext::UpdateConstantBuffer(FRHIHandle Buffer, const void* Data, uint32 Size)
+{
+	++NumCommands;
+	++NumConstantUpdates;
+	if (!Buffer || !Data || Size == 0)
+	{
+		AddError("UpdateConstantBuffer: invalid buffer or data");
+	}
+}
+
+void FNullRHICommandContext::SetConstantBuffer(uint8 StageMask, uint32 Slot, FRHIHandle Buffer)
+{
+	++NumCommands;
+	if (StageMask == RHI_STAGE_None)
+	{
+		AddError("SetConstantBuffer: no shader stage");
+	}
+}
+
+void FNullRHICommandContext::DrawIndexed(uint32 IndexCount, uint32 StartIndex, int32 BaseVertex)
+{
+	++NumCommands;
+	++NumDraws;
+	NumIndices += IndexCount;
+
+	if (!VertexShader || !PixelShader)
+	{
+		AddError("DrawIndexed: pipeline not bound");
+	}
+	if (!VertexBuffer || VertexStride == 0)
+	{
+		AddError("DrawIndexed: vertex buffer not bound");
+	}
+	if (!IndexBuffer)
+	{
+		AddError("DrawIndexed: index buffer not bound");
+	}
+	if (Topology == 0)
+	{
+		AddError("DrawIndexed: primitive topology not set");
+	}
+	if (IndexCount == 0)
+	{
+		AddError("DrawIndexed: zero index count");
+	}
+}
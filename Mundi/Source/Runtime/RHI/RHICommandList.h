@@ -0,0 +1,239 @@
+﻿#pragma once
+#include "UEContainer.h"
+
+// NOTE: 이 헤더는 D3D11에 의존하지 않습니다. (Null 백엔드로 커맨드 스트림을 녹화/검증할 수 있도록)
+// D3D11 백엔드는 FD3D11CommandContext(D3D11CommandContext.h)에서 핸들을 ID3D11* 로 해석합니다.
+
+// 백엔드 독립 GPU 리소스 핸들 (D3D11에서는 ID3D11Buffer*, ID3D11ShaderResourceView* 등)
+typedef void* FRHIHandle;
+
+// 셰이더 스테이지 마스크 (상수 버퍼 바인딩용)
+enum ERHIShaderStage : uint8
+{
+	RHI_STAGE_None = 0,
+	RHI_STAGE_Vertex = 1 << 0,
+	RHI_STAGE_Pixel = 1 << 1,
+};
+
+enum class ERHIIndexFormat : uint8
+{
+	UInt16,
+	UInt32,
+};
+
+enum class ERHICommandType : uint8
+{
+	SetPipeline,            // InputLayout + VS + PS
+	SetShaderResources,     // PS SRV 슬롯 범위
+	SetSamplers,            // PS 샘플러 슬롯 범위
+	SetVertexBuffer,        // IA 0번 슬롯
+	SetIndexBuffer,
+	SetPrimitiveTopology,
+	UpdateConstantBuffer,   // 데이터는 커맨드 리스트의 ConstantData에 저장
+	SetConstantBuffer,      // VS/PS 슬롯 바인딩
+	DrawIndexed,
+};
+
+/**
+ * @struct FRHICommand
+ * @brief 커맨드 리스트에 저장되는 고정 크기 명령. 타입에 따라 필드 의미가 달라집니다.
+ */
+struct FRHICommand
+{
+	static constexpr uint32 MaxHandles = 4;
+
+	ERHICommandType Type = ERHICommandType::DrawIndexed;
+	uint8 StartSlot = 0;
+	uint8 Count = 0;
+	uint8 StageMask = RHI_STAGE_None;
+
+	// DrawIndexed: IndexCount, StartIndex, BaseVertex
+	// SetVertexBuffer: Stride, Offset
+	// SetIndexBuffer: Format, Offset
+	// SetPrimitiveTopology: Topology
+	// UpdateConstantBuffer: ConstantData 오프셋, 크기
+	uint32 Args[3] = { 0, 0, 0 };
+
+	FRHIHandle Handles[MaxHandles] = { nullptr, nullptr, nullptr, nullptr };
+};
+
+/**
+ * @class IRHICommandContext
+ * @brief 녹화된 커맨드를 실제로 실행하는 백엔드 인터페이스.
+ */
+class IRHICommandContext
+{
+public:
+	virtual ~IRHICommandContext() = default;
+
+	virtual void SetPipeline(FRHIHandle InputLayout, FRHIHandle VertexShader, FRHIHandle PixelShader) = 0;
+	virtual void SetShaderResources(uint32 StartSlot, uint32 Count, const FRHIHandle* Views) = 0;
+	virtual void SetSamplers(uint32 StartSlot, uint32 Count, const FRHIHandle* Samplers) = 0;
+	virtual void SetVertexBuffer(FRHIHandle Buffer, uint32 Stride, uint32 Offset) = 0;
+	virtual void SetIndexBuffer(FRHIHandle Buffer, ERHIIndexFormat Format, uint32 Offset) = 0;
+	virtual void SetPrimitiveTopology(uint32 Topology) = 0;
+	virtual void UpdateConstantBuffer(FRHIHandle Buffer, const void* Data, uint32 Size) = 0;
+	virtual void SetConstantBuffer(uint8 StageMask, uint32 Slot, FRHIHandle Buffer) = 0;
+	virtual void DrawIndexed(uint32 IndexCount, uint32 StartIndex, int32 BaseVertex) = 0;
+};
+
+// 커맨드 리스트 녹화 통계
+struct FRHICommandListStats
+{
+	uint32 NumCommands = 0;          // 실제로 기록된 명령 수
+	uint32 NumDraws = 0;             // DrawIndexed 수
+	uint32 NumFilteredCommands = 0;  // 중복 상태로 판단되어 버려진 명령 수
+	uint32 ConstantBytes = 0;        // 기록된 상수 데이터 크기
+
+	void Accumulate(const FRHICommandListStats& Other)
+	{
+		NumCommands += Other.NumCommands;
+		NumDraws += Other.NumDraws;
+		NumFilteredCommands += Other.NumFilteredCommands;
+		ConstantBytes += Other.ConstantBytes;
+	}
+};
+
+/**
+ * @class FRHICommandList
+ * @brief 드로우에 필요한 상태 변경/상수 갱신/드로우 콜을 녹화했다가 한 번에 재생하는 커맨드 리스트.
+ *
+ * - 녹화 시점에 직전 상태와 같은 바인딩/상수 데이터는 기록하지 않습니다. (중복 상태 필터링)
+ * - 리스트끼리는 상태를 공유하지 않으므로 서로 다른 스레드에서 동시에 녹화할 수 있습니다.
+ * - 재생(Execute)은 반드시 하나의 스레드(D3D11에서는 Immediate Context 소유 스레드)에서 순서대로 호출해야 합니다.
+ */
+class FRHICommandList
+{
+public:
+	FRHICommandList() { Reset(); }
+
+	/** @brief 녹화된 명령과 상태 캐시를 모두 비웁니다. (메모리는 재사용) */
+	void Reset();
+
+	// --- 녹화 (Record) ---
+	void SetPipeline(FRHIHandle InputLayout, FRHIHandle VertexShader, FRHIHandle PixelShader);
+	void SetShaderResources(uint32 StartSlot, uint32 Count, const FRHIHandle* Views);
+	void SetSamplers(uint32 StartSlot, uint32 Count, const FRHIHandle* Samplers);
+	void SetVertexBuffer(FRHIHandle Buffer, uint32 Stride, uint32 Offset = 0);
+	void SetIndexBuffer(FRHIHandle Buffer, ERHIIndexFormat Format = ERHIIndexFormat::UInt32, uint32 Offset = 0);
+	void SetPrimitiveTopology(uint32 Topology);
+	void UpdateConstantBuffer(FRHIHandle Buffer, const void* Data, uint32 Size);
+	void SetConstantBuffer(uint8 StageMask, uint32 Slot, FRHIHandle Buffer);
+	void DrawIndexed(uint32 IndexCount, uint32 StartIndex, int32 BaseVertex);
+
+	/** @brief 상수 데이터를 갱신하고 지정한 스테이지/슬롯에 바인딩합니다. (D3D11RHI::ConstantBufferSetUpdate 대응) */
+	void SetAndUpdateConstantBuffer(FRHIHandle Buffer, uint32 Slot, bool bIsVS, bool bIsPS, const void* Data, uint32 Size);
+
+	// --- 재생 (Submit) ---
+	/** @brief 녹화된 명령을 순서대로 Context에 재생합니다. */
+	void Execute(IRHICommandContext& Context) const;
+
+	bool IsEmpty() const { return Commands.IsEmpty(); }
+	const TArray<FRHICommand>& GetCommands() const { return Commands; }
+	const uint8* GetConstantData(uint32 Offset) const { return ConstantData.GetData() + Offset; }
+	const FRHICommandListStats& GetStats() const { return Stats; }
+
+private:
+	FRHICommand& AddCommand(ERHICommandType Type);
+
+private:
+	// 녹화 시점 상태 캐시가 추적하는 최대 슬롯 수
+	static constexpr uint32 MaxCachedSRVSlots = 16;
+	static constexpr uint32 MaxCachedSamplerSlots = 16;
+	static constexpr uint32 MaxCachedConstantBufferSlots = 14;	// D3D11_COMMONSHADER_CONSTANT_BUFFER_API_SLOT_COUNT
+
+	// 마지막으로 갱신한 상수 버퍼 내용 (같은 데이터로 다시 갱신하는 것을 막음)
+	struct FConstantUpdateRecord
+	{
+		FRHIHandle Buffer = nullptr;
+		uint32 Offset = 0;
+		uint32 Size = 0;
+	};
+
+	// 녹화 시점의 '예상' GPU 상태. bValid가 false인 항목은 알 수 없는 상태로 간주하여 항상 기록합니다.
+	struct FStateCache
+	{
+		bool bPipelineValid = false;
+		FRHIHandle InputLayout = nullptr;
+		FRHIHandle VertexShader = nullptr;
+		FRHIHandle PixelShader = nullptr;
+
+		uint32 SRVValidMask = 0;
+		FRHIHandle SRVs[MaxCachedSRVSlots] = {};
+
+		uint32 SamplerValidMask = 0;
+		FRHIHandle Samplers[MaxCachedSamplerSlots] = {};
+
+		bool bVertexBufferValid = false;
+		FRHIHandle VertexBuffer = nullptr;
+		uint32 VertexStride = 0;
+		uint32 VertexOffset = 0;
+
+		bool bIndexBufferValid = false;
+		FRHIHandle IndexBuffer = nullptr;
+		ERHIIndexFormat IndexFormat = ERHIIndexFormat::UInt32;
+		uint32 IndexOffset = 0;
+
+		bool bTopologyValid = false;
+		uint32 Topology = 0;
+
+		uint32 VSConstantValidMask = 0;
+		uint32 PSConstantValidMask = 0;
+		FRHIHandle VSConstantBuffers[MaxCachedConstantBufferSlots] = {};
+		FRHIHandle PSConstantBuffers[MaxCachedConstantBufferSlots] = {};
+	};
+
+	TArray<FRHICommand> Commands;
+	TArray<uint8> ConstantData;
+	TArray<FConstantUpdateRecord> LastConstantUpdates;
+
+	FStateCache State;
+	FRHICommandListStats Stats;
+};
+
+/**
+ * @class FNullRHICommandContext
+ * @brief GPU 없이 커맨드 스트림을 재생하며 유효성을 검사하는 Null 백엔드.
+ *
+ * 드로우 시점에 파이프라인/버퍼/토폴로지가 바인딩되어 있는지 등을 확인하고, 명령 수를 집계합니다.
+ * 테스트나 CPU 측 녹화 비용 측정에 사용합니다.
+ */
+class FNullRHICommandContext : public IRHICommandContext
+{
+public:
+	void SetPipeline(FRHIHandle InputLayout, FRHIHandle VertexShader, FRHIHandle PixelShader) override;
+	void SetShaderResources(uint32 StartSlot, uint32 Count, const FRHIHandle* Views) override;
+	void SetSamplers(uint32 StartSlot, uint32 Count, const FRHIHandle* Samplers) override;
+	void SetVertexBuffer(FRHIHandle Buffer, uint32 Stride, uint32 Offset) override;
+	void SetIndexBuffer(FRHIHandle Buffer, ERHIIndexFormat Format, uint32 Offset) override;
+	void SetPrimitiveTopology(uint32 Topology) override;
+	void UpdateConstantBuffer(FRHIHandle Buffer, const void* Data, uint32 Size) override;
+	void SetConstantBuffer(uint8 StageMask, uint32 Slot, FRHIHandle Buffer) override;
+	void DrawIndexed(uint32 IndexCount, uint32 StartIndex, int32 BaseVertex) override;
+
+	uint32 GetNumCommands() const { return NumCommands; }
+	uint32 GetNumDraws() const { return NumDraws; }
+	uint32 GetNumIndices() const { return NumIndices; }
+	uint32 GetNumConstantUpdates() const { return NumConstantUpdates; }
+
+	uint32 GetNumErrors() const { return static_cast<uint32>(Errors.size()); }
+	const TArray<FString>& GetErrors() const { return Errors; }
+
+private:
+	void AddError(const char* Message);
+
+private:
+	FRHIHandle VertexShader = nullptr;
+	FRHIHandle PixelShader = nullptr;
+	FRHIHandle VertexBuffer = nullptr;
+	FRHIHandle IndexBuffer = nullptr;
+	uint32 VertexStride = 0;
+	uint32 Topology = 0;
+
+	uint32 NumCommands = 0;
+	uint32 NumDraws = 0;
+	uint32 NumIndices = 0;
+	uint32 NumConstantUpdates = 0;
+
+	TArray<FString> Errors;
+};
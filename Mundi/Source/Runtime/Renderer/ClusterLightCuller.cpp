@@ -0,0 +1,403 @@
+﻿#include "pch.h"
+#include "ClusterLightCuller.h"
+#include "TaskScheduler.h"
+#include "PlatformTime.h"
+#include <algorithm>
+
+FClusterLightCuller::FClusterLightCuller()
+	: RHI(nullptr)
+	, ClusterTileSize(64)
+	, SliceCount(24)
+	, ClusterCountX(0)
+	, ClusterCountY(0)
+	, TotalClusterCount(0)
+	, ViewportWidthF(0.0f)
+	, ViewportHeightF(0.0f)
+	, ProjScaleX(1.0f)
+	, ProjScaleY(1.0f)
+	, DepthSliceScale(0.0f)
+	, DepthSliceBias(0.0f)
+	, LightIndexBuffer(nullptr)
+	, LightIndexBufferSRV(nullptr)
+	, LightIndexBufferCapacity(0)
+{
+}
+
+FClusterLightCuller::~FClusterLightCuller()
+{
+	Release();
+}
+
+void FClusterLightCuller::Initialize(D3D11RHI* InRHI, UINT InClusterTileSize, UINT InSliceCount)
+{
+	RHI = InRHI;
+	ClusterTileSize = FMath::Max(1u, InClusterTileSize);
+	SliceCount = FMath::Max(1u, InSliceCount);
+}
+
+void FClusterLightCuller::CullLights(
+	const TArray<FPointLightInfo>& PointLights,
+	const TArray<FSpotLightInfo>& SpotLights,
+	const FMatrix& ViewMatrix,
+	const FMatrix& ProjMatrix,
+	float NearPlane,
+	float FarPlane,
+	UINT ViewportWidth,
+	UINT ViewportHeight)
+{
+	BuildClusterLightLists(PointLights, SpotLights, ViewMatrix, ProjMatrix, NearPlane, FarPlane, ViewportWidth, ViewportHeight);
+
+	const UINT RequiredSize = static_cast<UINT>(ClusterLightData.Num());
+
+	// 인덱스 리스트 길이는 매 프레임 달라지므로 부족할 때만 여유 있게 재생성
+	if (!LightIndexBuffer || LightIndexBufferCapacity < RequiredSize)
+	{
+		if (LightIndexBufferSRV)
+		{
+			LightIndexBufferSRV->Release();
+			LightIndexBufferSRV = nullptr;
+		}
+		if (LightIndexBuffer)
+		{
+			LightIndexBuffer->Release();
+			LightIndexBuffer = nullptr;
+		}
+
+		LightIndexBufferCapacity = RequiredSize + RequiredSize / 2;
+		HRESULT hr = RHI->CreateStructuredBuffer(sizeof(uint32), LightIndexBufferCapacity, nullptr, &LightIndexBuffer);
+		if (SUCCEEDED(hr))
+		{
+			RHI->CreateStructuredBufferSRV(LightIndexBuffer, &LightIndexBufferSRV);
+		}
+		else
+		{
+			LightIndexBufferCapacity = 0;
+			return;
+		}
+	}
+
+	RHI->UpdateStructuredBuffer(LightIndexBuffer, ClusterLightData.GetData(), RequiredSize * sizeof(uint32));
+	Stats.LightIndexBufferSizeBytes = LightIndexBufferCapacity * sizeof(uint32);
+}
+
+void FClusterLightCuller::BuildClusterLightLists(
+	const TArray<FPointLightInfo>& PointLights,
+	const TArray<FSpotLightInfo>& SpotLights,
+	const FMatrix& ViewMatrix,
+	const FMatrix& ProjMatrix,
+	float NearPlane,
+	float FarPlane,
+	UINT ViewportWidth,
+	UINT ViewportHeight)
+{
+	const uint64 StartCycles = FPlatformTime::Cycles64();
+
+	// 클러스터 그리드 계산
+	ClusterCountX = (ViewportWidth + ClusterTileSize - 1) / ClusterTileSize;
+	ClusterCountY = (ViewportHeight + ClusterTileSize - 1) / ClusterTileSize;
+	TotalClusterCount = ClusterCountX * ClusterCountY * SliceCount;
+
+	ViewportWidthF = static_cast<float>(ViewportWidth);
+	ViewportHeightF = static_cast<float>(ViewportHeight);
+	ProjScaleX = ProjMatrix.M[0][0];
+	ProjScaleY = ProjMatrix.M[1][1];
+
+	// 로그 깊이 슬라이스: Slice = S * log(z / Near) / log(Far / Near)
+	NearPlane = FMath::Max(NearPlane, KINDA_SMALL_NUMBER);
+	FarPlane = FMath::Max(FarPlane, NearPlane * 1.001f);
+	const float LogDepthRange = std::log(FarPlane / NearPlane);
+	DepthSliceScale = static_cast<float>(SliceCount) / LogDepthRange;
+	DepthSliceBias = -static_cast<float>(SliceCount) * std::log(NearPlane) / LogDepthRange;
+
+	SliceDepths.SetNum(SliceCount + 1);
+	for (UINT Slice = 0; Slice <= SliceCount; ++Slice)
+	{
+		SliceDepths[Slice] = NearPlane * std::pow(FarPlane / NearPlane, static_cast<float>(Slice) / static_cast<float>(SliceCount));
+	}
+
+	// 타일 경계의 NDC (픽셀 → NDC, Y축 반전)
+	TileNdcX.SetNum(ClusterCountX + 1);
+	for (UINT X = 0; X <= ClusterCountX; ++X)
+	{
+		const float Pixel = static_cast<float>(FMath::Min(X * ClusterTileSize, ViewportWidth));
+		TileNdcX[X] = (Pixel / ViewportWidthF) * 2.0f - 1.0f;
+	}
+	TileNdcY.SetNum(ClusterCountY + 1);
+	for (UINT Y = 0; Y <= ClusterCountY; ++Y)
+	{
+		const float Pixel = static_cast<float>(FMath::Min(Y * ClusterTileSize, ViewportHeight));
+		TileNdcY[Y] = 1.0f - (Pixel / ViewportHeightF) * 2.0f;
+	}
+
+	// 통계 초기화
+	Stats.Reset();
+	Stats.bClustered = true;
+	Stats.TileCountX = ClusterCountX;
+	Stats.TileCountY = ClusterCountY;
+	Stats.ClusterSliceCount = SliceCount;
+	Stats.TotalPointLights = PointLights.Num();
+	Stats.TotalSpotLights = SpotLights.Num();
+	Stats.TotalLights = PointLights.Num() + SpotLights.Num();
+
+	// 라이트를 뷰 공간으로 한 번만 변환
+	PrepareLights(PointLights, SpotLights, ViewMatrix);
+
+	// 슬라이스 단위로 워커에 분배 (슬라이스마다 독립된 출력)
+	SliceLists.SetNum(SliceCount);
+	FTaskScheduler::GetInstance().ParallelFor(static_cast<int32>(SliceCount), 1, [this](int32 Begin, int32 End)
+		{
+			for (int32 Slice = Begin; Slice < End; ++Slice)
+			{
+				BuildSlice(Slice);
+			}
+		});
+
+	// 슬라이스 결과를 헤더(offset, count) + 전역 인덱스 리스트로 합침
+	const UINT ClustersPerSlice = ClusterCountX * ClusterCountY;
+	const UINT HeaderSize = TotalClusterCount * 2;
+	UINT TotalIndices = 0;
+	for (const FSliceLightList& SliceList : SliceLists)
+	{
+		TotalIndices += static_cast<UINT>(SliceList.LightIndices.Num());
+	}
+	ClusterLightData.SetNum(HeaderSize + TotalIndices);
+
+	Stats.MinLightsPerTile = TotalClusterCount > 0 ? UINT_MAX : 0;
+	UINT Running = HeaderSize;
+	for (UINT Slice = 0; Slice < SliceCount; ++Slice)
+	{
+		const FSliceLightList& SliceList = SliceLists[Slice];
+		for (UINT Cluster = 0; Cluster < ClustersPerSlice; ++Cluster)
+		{
+			const UINT ClusterIndex = Slice * ClustersPerSlice + Cluster;
+			const uint32 Count = SliceList.ClusterCounts[Cluster];
+			ClusterLightData[ClusterIndex * 2 + 0] = Running + SliceList.ClusterOffsets[Cluster];
+			ClusterLightData[ClusterIndex * 2 + 1] = Count;
+
+			// 클러스터 점유 통계
+			Stats.MinLightsPerTile = FMath::Min(Stats.MinLightsPerTile, Count);
+			Stats.MaxLightsPerTile = FMath::Max(Stats.MaxLightsPerTile, Count);
+			Stats.OccupiedClusterCount += (Count > 0) ? 1 : 0;
+			Stats.ClusterOccupancyHistogram[FTileCullingStats::GetOccupancyBucket(Count)]++;
+		}
+
+		if (SliceList.LightIndices.Num() > 0)
+		{
+			memcpy(ClusterLightData.GetData() + Running, SliceList.LightIndices.GetData(), SliceList.LightIndices.Num() * sizeof(uint32));
+		}
+		Running += static_cast<UINT>(SliceList.LightIndices.Num());
+	}
+
+	Stats.TotalLightsPassed = TotalIndices;
+	Stats.TotalLightTests = TotalClusterCount * Stats.TotalLights;
+	Stats.CalculateStats();
+
+	Stats.CPUCullingTimeMS = static_cast<float>(FPlatformTime::ToMilliseconds(FPlatformTime::Cycles64() - StartCycles));
+}
+
+void FClusterLightCuller::PrepareLights(
+	const TArray<FPointLightInfo>& PointLights,
+	const TArray<FSpotLightInfo>& SpotLights,
+	const FMatrix& ViewMatrix)
+{
+	const int32 NumLights = PointLights.Num() + SpotLights.Num();
+	ViewLights.Empty();
+	ViewLights.Reserve(NumLights);
+
+	// 측면 평면 (뷰 공간 원점을 지나는 평면) 법선 길이 보정값
+	const float InvLenX = 1.0f / std::sqrt(ProjScaleX * ProjScaleX + 1.0f);
+	const float InvLenY = 1.0f / std::sqrt(ProjScaleY * ProjScaleY + 1.0f);
+	const float NearPlane = SliceDepths[0];
+	const float FarPlane = SliceDepths[SliceCount];
+
+	for (int32 LightIndex = 0; LightIndex < NumLights; ++LightIndex)
+	{
+		// Point Light 먼저, Spot Light는 그 뒤에 (타일 컬링과 같은 순서/인코딩)
+		const bool bIsPoint = LightIndex < PointLights.Num();
+		const int32 LocalIndex = bIsPoint ? LightIndex : LightIndex - PointLights.Num();
+		const FVector WorldCenter = bIsPoint ? PointLights[LocalIndex].Position : SpotLights[LocalIndex].Position;
+
+		FViewLight Light;
+		Light.Center = WorldCenter * ViewMatrix;
+		Light.Radius = bIsPoint ? PointLights[LocalIndex].AttenuationRadius : SpotLights[LocalIndex].AttenuationRadius;
+		Light.IndexCode = bIsPoint ? static_cast<uint32>(LocalIndex) : ((1u << 16) | static_cast<uint32>(LocalIndex));
+
+		const FVector& C = Light.Center;
+		const float R = Light.Radius;
+
+		// 깊이 범위 밖 또는 측면 평면 밖이면 제외
+		const bool bOutsideDepth = (C.Z + R < NearPlane) || (C.Z - R > FarPlane);
+		const bool bOutsideSides =
+			(C.X * ProjScaleX - C.Z) * InvLenX > R ||
+			(-C.X * ProjScaleX - C.Z) * InvLenX > R ||
+			(C.Y * ProjScaleY - C.Z) * InvLenY > R ||
+			(-C.Y * ProjScaleY - C.Z) * InvLenY > R;
+		if (bOutsideDepth || bOutsideSides)
+		{
+			Stats.LightsOutsideView++;
+			continue;
+		}
+
+		Light.MinSlice = DepthToSlice(FMath::Max(C.Z - R, NearPlane));
+		Light.MaxSlice = DepthToSlice(FMath::Min(C.Z + R, FarPlane));
+		ViewLights.Add(Light);
+	}
+}
+
+void FClusterLightCuller::BuildSlice(int32 Slice)
+{
+	FSliceLightList& SliceList = SliceLists[Slice];
+	const int32 ClustersPerSlice = static_cast<int32>(ClusterCountX * ClusterCountY);
+	SliceList.ClusterCounts.SetNum(ClustersPerSlice);
+	SliceList.ClusterOffsets.SetNum(ClustersPerSlice);
+	std::fill(SliceList.ClusterCounts.begin(), SliceList.ClusterCounts.end(), 0u);
+	SliceList.LightIndices.Empty();
+
+	const float SliceNear = SliceDepths[Slice];
+	const float SliceFar = SliceDepths[Slice + 1];
+
+	// 1. 이 슬라이스에 걸치는 라이트의 화면 타일 범위 계산
+	using FCandidate = FSliceCandidate;
+	TArray<FCandidate>& Candidates = SliceList.Candidates;
+	Candidates.Empty();
+
+	auto ToTile = [this](float Pixel, UINT Count)
+		{
+			const float Clamped = FMath::Clamp(Pixel, 0.0f, static_cast<float>(Count * ClusterTileSize) - 1.0f);
+			return static_cast<int32>(Clamped) / static_cast<int32>(ClusterTileSize);
+		};
+
+	for (int32 LightIndex = 0; LightIndex < ViewLights.Num(); ++LightIndex)
+	{
+		const FViewLight& Light = ViewLights[LightIndex];
+		if (Slice < Light.MinSlice || Slice > Light.MaxSlice)
+		{
+			continue;
+		}
+
+		// 구와 슬라이스 깊이 구간의 교집합
+		const FVector& C = Light.Center;
+		const float R = Light.Radius;
+		const float ZMin = FMath::Max(SliceNear, C.Z - R);
+		const float ZMax = FMath::Min(SliceFar, C.Z + R);
+		if (ZMin > ZMax)
+		{
+			continue;
+		}
+
+		// 구간 안에서 구 단면의 최대 반지름
+		const float DZ = (C.Z < ZMin) ? (ZMin - C.Z) : ((C.Z > ZMax) ? (C.Z - ZMax) : 0.0f);
+		const float SectionRadius = std::sqrt(FMath::Max(R * R - DZ * DZ, 0.0f));
+
+		// [C ± r] × [ZMin, ZMax] 상자를 투영한 NDC 범위 (ZMin > 0)
+		const float X0 = C.X - SectionRadius, X1 = C.X + SectionRadius;
+		const float Y0 = C.Y - SectionRadius, Y1 = C.Y + SectionRadius;
+		const float NdcMinX = ProjScaleX * FMath::Min(X0 / ZMin, X0 / ZMax);
+		const float NdcMaxX = ProjScaleX * FMath::Max(X1 / ZMin, X1 / ZMax);
+		const float NdcMinY = ProjScaleY * FMath::Min(Y0 / ZMin, Y0 / ZMax);
+		const float NdcMaxY = ProjScaleY * FMath::Max(Y1 / ZMin, Y1 / ZMax);
+		if (NdcMinX > 1.0f || NdcMaxX < -1.0f || NdcMinY > 1.0f || NdcMaxY < -1.0f)
+		{
+			continue;
+		}
+
+		FCandidate Candidate;
+		Candidate.LightIndex = LightIndex;
+		Candidate.MinX = ToTile((NdcMinX * 0.5f + 0.5f) * ViewportWidthF, ClusterCountX);
+		Candidate.MaxX = ToTile((NdcMaxX * 0.5f + 0.5f) * ViewportWidthF, ClusterCountX);
+		Candidate.MinY = ToTile((0.5f - NdcMaxY * 0.5f) * ViewportHeightF, ClusterCountY);
+		Candidate.MaxY = ToTile((0.5f - NdcMinY * 0.5f) * ViewportHeightF, ClusterCountY);
+		Candidates.Add(Candidate);
+	}
+
+	// 2. 클러스터별 라이트 개수 (구-AABB 정밀 테스트)
+	for (const FCandidate& Candidate : Candidates)
+	{
+		const FViewLight& Light = ViewLights[Candidate.LightIndex];
+		for (int32 Y = Candidate.MinY; Y <= Candidate.MaxY; ++Y)
+		{
+			for (int32 X = Candidate.MinX; X <= Candidate.MaxX; ++X)
+			{
+				if (SphereIntersectsCluster(Light, X, Y, Slice))
+				{
+					SliceList.ClusterCounts[Y * ClusterCountX + X]++;
+				}
+			}
+		}
+	}
+
+	// 3. 슬라이스 내 오프셋 (prefix sum)
+	uint32 Running = 0;
+	for (int32 Cluster = 0; Cluster < ClustersPerSlice; ++Cluster)
+	{
+		SliceList.ClusterOffsets[Cluster] = Running;
+		Running += SliceList.ClusterCounts[Cluster];
+	}
+	SliceList.LightIndices.SetNum(Running);
+
+	// 4. 라이트 순서를 유지하며 인덱스 기록
+	TArray<uint32> WriteCursor(SliceList.ClusterOffsets.begin(), SliceList.ClusterOffsets.end());
+	for (const FCandidate& Candidate : Candidates)
+	{
+		const FViewLight& Light = ViewLights[Candidate.LightIndex];
+		for (int32 Y = Candidate.MinY; Y <= Candidate.MaxY; ++Y)
+		{
+			for (int32 X = Candidate.MinX; X <= Candidate.MaxX; ++X)
+			{
+				if (SphereIntersectsCluster(Light, X, Y, Slice))
+				{
+					SliceList.LightIndices[WriteCursor[Y * ClusterCountX + X]++] = Light.IndexCode;
+				}
+			}
+		}
+	}
+}
+
+bool FClusterLightCuller::SphereIntersectsCluster(const FViewLight& Light, int32 X, int32 Y, int32 Slice) const
+{
+	// 클러스터 프러스텀 조각을 감싸는 뷰 공간 AABB
+	const float ZNear = SliceDepths[Slice];
+	const float ZFar = SliceDepths[Slice + 1];
+
+	const float Left = TileNdcX[X], Right = TileNdcX[X + 1];
+	const float Top = TileNdcY[Y], Bottom = TileNdcY[Y + 1];
+
+	const float MinX = FMath::Min(Left * ZNear, Left * ZFar) / ProjScaleX;
+	const float MaxX = FMath::Max(Right * ZNear, Right * ZFar) / ProjScaleX;
+	const float MinY = FMath::Min(Bottom * ZNear, Bottom * ZFar) / ProjScaleY;
+	const float MaxY = FMath::Max(Top * ZNear, Top * ZFar) / ProjScaleY;
+
+	// 구 중심에서 AABB까지의 거리 제곱
+	const FVector& C = Light.Center;
+	const float DX = (C.X < MinX) ? (MinX - C.X) : ((C.X > MaxX) ? (C.X - MaxX) : 0.0f);
+	const float DY = (C.Y < MinY) ? (MinY - C.Y) : ((C.Y > MaxY) ? (C.Y - MaxY) : 0.0f);
+	const float DZ = (C.Z < ZNear) ? (ZNear - C.Z) : ((C.Z > ZFar) ? (C.Z - ZFar) : 0.0f);
+	return DX * DX + DY * DY + DZ * DZ <= Light.Radius * Light.Radius;
+}
+
+int32 FClusterLightCuller::DepthToSlice(float ViewZ) const
+{
+	// 셰이더(GetClusterSlice)와 같은 식
+	const int32 Slice = static_cast<int32>(std::floor(std::log(ViewZ) * DepthSliceScale + DepthSliceBias));
+	return FMath::Clamp(Slice, 0, static_cast<int32>(SliceCount) - 1);
+}
+
+void FClusterLightCuller::Release()
+{
+	if (LightIndexBufferSRV)
+	{
+		LightIndexBufferSRV->Release();
+		LightIndexBufferSRV = nullptr;
+	}
+
+	if (LightIndexBuffer)
+	{
+		LightIndexBuffer->Release();
+		LightIndexBuffer = nullptr;
+	}
+
+	LightIndexBufferCapacity = 0;
+	ClusterLightData.Empty();
+	SliceLists.Empty();
+	ViewLights.Empty();
+}
@@ -0,0 +1,141 @@
+﻿#pragma once
+#include "LightManager.h"
+#include "TileCullingStats.h"
+#include "D3D11RHI.h"
+
+// 클러스터(3D froxel) 기반 라이트 컬링을 CPU에서 수행하는 클래스
+// 화면을 ClusterTileSize 타일로 나누고 깊이를 로그 슬라이스로 나눠, 각 클러스터에 영향을 주는 라이트를 계산
+//
+// Structured Buffer 레이아웃 (t2, 타일 컬링과 같은 슬롯 사용)
+// [ClusterIndex * 2 + 0] = 해당 클러스터 라이트 목록의 시작 위치 (버퍼 내 절대 인덱스)
+// [ClusterIndex * 2 + 1] = 라이트 개수
+// [ClusterCount * 2 ~ ...] = 모든 클러스터의 라이트 인덱스 (상위 16비트: 타입, 하위 16비트: 인덱스)
+// ClusterIndex = (Slice * ClusterCountY + Y) * ClusterCountX + X
+class FClusterLightCuller
+{
+public:
+	FClusterLightCuller();
+	~FClusterLightCuller();
+
+	// 초기화 (버퍼는 CullLights에서 필요한 크기로 생성)
+	void Initialize(D3D11RHI* InRHI, UINT InClusterTileSize = 64, UINT InSliceCount = 24);
+
+	// 클러스터 컬링 수행 후 GPU 버퍼 업데이트 (매 프레임 호출)
+	void CullLights(
+		const TArray<FPointLightInfo>& PointLights,
+		const TArray<FSpotLightInfo>& SpotLights,
+		const FMatrix& ViewMatrix,
+		const FMatrix& ProjMatrix,
+		float NearPlane,
+		float FarPlane,
+		UINT ViewportWidth,
+		UINT ViewportHeight
+	);
+
+	// CPU 컬링 단계만 수행 (헤드리스 벤치마크용). 투영 행렬은 원근 투영이어야 함
+	void BuildClusterLightLists(
+		const TArray<FPointLightInfo>& PointLights,
+		const TArray<FSpotLightInfo>& SpotLights,
+		const FMatrix& ViewMatrix,
+		const FMatrix& ProjMatrix,
+		float NearPlane,
+		float FarPlane,
+		UINT ViewportWidth,
+		UINT ViewportHeight
+	);
+
+	ID3D11ShaderResourceView* GetLightIndexBufferSRV() const { return LightIndexBufferSRV; }
+	const TArray<uint32>& GetClusterLightData() const { return ClusterLightData; }
+	const FTileCullingStats& GetStats() const { return Stats; }
+
+	// 셰이더 상수 (b11)
+	UINT GetClusterTileSize() const { return ClusterTileSize; }
+	UINT GetClusterCountX() const { return ClusterCountX; }
+	UINT GetClusterCountY() const { return ClusterCountY; }
+	UINT GetSliceCount() const { return SliceCount; }
+	// Slice = floor(log(ViewZ) * DepthSliceScale + DepthSliceBias)
+	float GetDepthSliceScale() const { return DepthSliceScale; }
+	float GetDepthSliceBias() const { return DepthSliceBias; }
+
+	// 리소스 해제
+	void Release();
+
+private:
+	// 이 슬라이스에 걸치는 라이트와 화면 타일 범위 (BuildSlice 임시 데이터)
+	struct FSliceCandidate
+	{
+		int32 LightIndex;
+		int32 MinX, MinY, MaxX, MaxY;
+	};
+
+	// 슬라이스 하나의 클러스터 라이트 목록 (워커 하나가 슬라이스 하나를 담당)
+	// 컬러가 뷰포트별로 유지되므로 배열 용량은 프레임 간 재사용됨
+	struct FSliceLightList
+	{
+		TArray<uint32> ClusterCounts;   // 슬라이스 내 클러스터별 라이트 개수
+		TArray<uint32> ClusterOffsets;  // 슬라이스 내 클러스터별 시작 위치 (LightIndices 기준)
+		TArray<uint32> LightIndices;    // 슬라이스 내 클러스터 순서대로 이어 붙인 라이트 인덱스
+		TArray<FSliceCandidate> Candidates;
+	};
+
+	// 뷰 공간 라이트 구 (PrepareLights 결과, Point → Spot 순서)
+	struct FViewLight
+	{
+		FVector Center;
+		float Radius;
+		uint32 IndexCode;
+		int32 MinSlice;
+		int32 MaxSlice;
+	};
+
+	void PrepareLights(
+		const TArray<FPointLightInfo>& PointLights,
+		const TArray<FSpotLightInfo>& SpotLights,
+		const FMatrix& ViewMatrix
+	);
+
+	// 슬라이스 하나에 대해 라이트를 클러스터에 배정
+	void BuildSlice(int32 Slice);
+
+	// 구가 클러스터 (X, Y, Slice)의 뷰 공간 AABB와 겹치는지
+	bool SphereIntersectsCluster(const FViewLight& Light, int32 X, int32 Y, int32 Slice) const;
+
+	int32 DepthToSlice(float ViewZ) const;
+
+private:
+	D3D11RHI* RHI;
+
+	// 클러스터 그리드
+	UINT ClusterTileSize;
+	UINT SliceCount;
+	UINT ClusterCountX;
+	UINT ClusterCountY;
+	UINT TotalClusterCount;
+
+	// 뷰/투영 파라미터
+	float ViewportWidthF;
+	float ViewportHeightF;
+	float ProjScaleX;       // ProjMatrix.M[0][0]
+	float ProjScaleY;       // ProjMatrix.M[1][1]
+	float DepthSliceScale;
+	float DepthSliceBias;
+
+	// 클러스터 경계 (NDC X/Y, 뷰 공간 깊이)
+	TArray<float> TileNdcX;      // ClusterCountX + 1
+	TArray<float> TileNdcY;      // ClusterCountY + 1 (위쪽이 +1)
+	TArray<float> SliceDepths;   // SliceCount + 1
+
+	TArray<FViewLight> ViewLights;
+	TArray<FSliceLightList> SliceLists;
+
+	// GPU로 올릴 데이터 (헤더 + 전역 인덱스 리스트)
+	TArray<uint32> ClusterLightData;
+
+	// GPU 리소스
+	ID3D11Buffer* LightIndexBuffer;
+	ID3D11ShaderResourceView* LightIndexBufferSRV;
+	UINT LightIndexBufferCapacity;
+
+	// 통계
+	FTileCullingStats Stats;
+};
@@ -1,6 +1,7 @@
 ﻿#include "pch.h"
 #include "FViewport.h"
 #include "FViewportClient.h"
+#include "Renderer.h"
 
 FViewport::FViewport()
 {
@@ -8,6 +9,11 @@ FViewport::FViewport()
 
 FViewport::~FViewport()
 {
+	// 렌더러가 뷰포트별로 들고 있는 상태 (오클루전 깊이 버퍼 등) 해제. 종료 시 렌더러가 먼저 정리됐으면 생략
+	if (URenderer* Renderer = GEngine.GetRenderer())
+	{
+		Renderer->ReleaseViewportResources(this);
+	}
 	Cleanup();
 }
 
@@ -0,0 +1,93 @@
+#pragma once
+#include "UEContainer.h"
+
+// 소프트웨어 오클루전 컬링 통계
+// 오클루더 래스터화 비용과 컬링 결과를 추적
+struct FOcclusionStats
+{
+	// 깊이 버퍼 해상도
+	uint32 BufferWidth = 0;
+	uint32 BufferHeight = 0;
+
+	// 오클루더
+	uint32 OccluderCount = 0;
+	uint32 OccluderTriangles = 0;     // 입력 삼각형 수
+	uint32 RasterizedTriangles = 0;   // 뒷면/화면 밖 제거 후 래스터화된 삼각형 수
+
+	// 오클루디
+	uint32 TestedCount = 0;
+	uint32 CulledCount = 0;           // HZB에 가려진 수
+	uint32 OutsideViewCount = 0;      // 화면 밖이라 제외된 수 (CulledCount에 포함하지 않음)
+
+	// 2단계 시간적 컬링 (이전 프레임 HZB 재투영)
+	bool bTemporal = false;           // 이번 프레임에 재투영 HZB를 사용했는지 (이전 프레임 기록이 없으면 false)
+	uint32 Phase1CulledCount = 0;     // 1단계(재투영 HZB)에서 가려진 수
+	uint32 RescuedCount = 0;          // 1단계에서 가려졌지만 2단계(새 HZB)에서 보인 수 (1단계 false negative)
+	uint32 SkippedOccluderCount = 0;  // 1단계에서 가려져 래스터화를 건너뛴 오클루더 수
+
+	// CPU 시간 (ms)
+	float RasterizeTimeMS = 0.0f;
+	float HZBTimeMS = 0.0f;
+	float TestTimeMS = 0.0f;
+	float ReprojectTimeMS = 0.0f;
+
+	// 모든 통계를 0으로 리셋
+	void Reset()
+	{
+		*this = FOcclusionStats();
+	}
+
+	float GetTotalTimeMS() const
+	{
+		return RasterizeTimeMS + HZBTimeMS + TestTimeMS + ReprojectTimeMS;
+	}
+
+	float GetCulledPercent() const
+	{
+		return TestedCount > 0 ? 100.0f * CulledCount / TestedCount : 0.0f;
+	}
+
+	// 1단계에서 가려졌다고 판단한 것 중 실제로는 보였던 비율
+	float GetFalseNegativePercent() const
+	{
+		return Phase1CulledCount > 0 ? 100.0f * RescuedCount / Phase1CulledCount : 0.0f;
+	}
+};
+
+// 오클루전 통계 전역 매니저 (싱글톤)
+// UStatsOverlayD2D에서 접근할 수 있도록 전역 통계 제공
+class FOcclusionStatManager
+{
+public:
+	static FOcclusionStatManager& GetInstance()
+	{
+		static FOcclusionStatManager Instance;
+		return Instance;
+	}
+
+	// 통계 업데이트
+	void UpdateStats(const FOcclusionStats& InStats)
+	{
+		CurrentStats = InStats;
+	}
+
+	// 통계 조회
+	const FOcclusionStats& GetStats() const
+	{
+		return CurrentStats;
+	}
+
+	// 통계 리셋
+	void ResetStats()
+	{
+		CurrentStats.Reset();
+	}
+
+private:
+	FOcclusionStatManager() = default;
+	~FOcclusionStatManager() = default;
+	FOcclusionStatManager(const FOcclusionStatManager&) = delete;
+	FOcclusionStatManager& operator=(const FOcclusionStatManager&) = delete;
+
+	FOcclusionStats CurrentStats;
+};
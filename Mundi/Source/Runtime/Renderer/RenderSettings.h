@@ -43,6 +43,36 @@ public:
     void SetTileSize(uint32 Value) { TileSize = Value; }
     uint32 GetTileSize() const { return TileSize; }
 
+    // Clustered light culling
+    void SetLightCullingMode(ELightCullingMode In) { LightCullingMode = In; }
+    ELightCullingMode GetLightCullingMode() const { return LightCullingMode; }
+
+    void SetClusterTileSize(uint32 Value) { ClusterTileSize = Value; }
+    uint32 GetClusterTileSize() const { return ClusterTileSize; }
+
+    void SetClusterSliceCount(uint32 Value) { ClusterSliceCount = Value; }
+    uint32 GetClusterSliceCount() const { return ClusterSliceCount; }
+
+    // CPU 소프트웨어 오클루전 컬링
+    void SetOcclusionBufferWidth(uint32 Value) { OcclusionBufferWidth = Value; }
+    uint32 GetOcclusionBufferWidth() const { return OcclusionBufferWidth; }
+
+    void SetOccluderTriangleBudget(uint32 Value) { OccluderTriangleBudget = Value; }
+    uint32 GetOccluderTriangleBudget() const { return OccluderTriangleBudget; }
+
+    void SetMaxTrianglesPerOccluder(uint32 Value) { MaxTrianglesPerOccluder = Value; }
+    uint32 GetMaxTrianglesPerOccluder() const { return MaxTrianglesPerOccluder; }
+
+    void SetTemporalOcclusionEnabled(bool bEnabled) { bTemporalOcclusion = bEnabled; }
+    bool IsTemporalOcclusionEnabled() const { return bTemporalOcclusion; }
+
+    // 스태틱 메시 LOD
+    void SetForcedStaticMeshLOD(int32 Value) { ForcedStaticMeshLOD = Value; }
+    int32 GetForcedStaticMeshLOD() const { return ForcedStaticMeshLOD; }
+
+    void SetStaticMeshLODScale(float Value) { StaticMeshLODScale = Value; }
+    float GetStaticMeshLODScale() const { return StaticMeshLODScale; }
+
     // 그림자 안티 에일리어싱
     void SetShadowAATechnique(EShadowAATechnique In) { ShadowAATechnique = In; }
     EShadowAATechnique GetShadowAATechnique() const { return ShadowAATechnique; }
@@ -64,6 +94,21 @@ private:
     // Tile-based light culling
     uint32 TileSize = 16;                   // 타일 크기 (픽셀, 기본값: 16)
 
+    // Clustered light culling
+    ELightCullingMode LightCullingMode = ELightCullingMode::Tiled;
+    uint32 ClusterTileSize = 64;            // 클러스터 화면 타일 크기 (픽셀, 기본값: 64)
+    uint32 ClusterSliceCount = 24;          // 로그 깊이 슬라이스 개수 (기본값: 24)
+
+    // CPU 소프트웨어 오클루전 컬링
+    uint32 OcclusionBufferWidth = 320;      // 깊이 버퍼 가로 해상도 (세로는 뷰 비율, 기본값: 320)
+    uint32 OccluderTriangleBudget = 65536;  // 프레임당 래스터화할 오클루더 삼각형 총량
+    uint32 MaxTrianglesPerOccluder = 16384; // 이보다 삼각형이 많은 메시는 오클루더로 쓰지 않음
+    bool bTemporalOcclusion = false;        // 이전 프레임 HZB 재투영을 이용한 2단계 컬링 (정지 카메라에서 유리)
+
+    // 스태틱 메시 LOD
+    int32 ForcedStaticMeshLOD = -1;         // 0 이상이면 화면 크기와 무관하게 이 LOD 사용 (-1: 자동)
+    float StaticMeshLODScale = 1.0f;        // 화면 크기에 곱하는 값 (클수록 상세 LOD를 오래 유지)
+
     // 그림자 안티 에일리어싱
     EShadowAATechnique ShadowAATechnique = EShadowAATechnique::PCF; // 기본값 PCF
 
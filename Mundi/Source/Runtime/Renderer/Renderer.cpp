@@ -20,6 +20,7 @@
 #include "Octree.h"
 #include "BVHierarchy.h"
 #include "Occlusion.h"
+#include "ClusterLightCuller.h"
 #include "Frustum.h"
 #include "ResourceManager.h"
 #include "RHIDevice.h"
@@ -49,6 +50,18 @@ URenderer::~URenderer()
 	{
 		delete LineBatchData;
 	}
+
+	for (auto& Pair : OcclusionCullers)
+	{
+		delete Pair.second;
+	}
+	OcclusionCullers.Empty();
+
+	for (auto& Pair : ClusterLightCullers)
+	{
+		delete Pair.second;
+	}
+	ClusterLightCullers.Empty();
 }
 
 void URenderer::BeginFrame()
@@ -70,13 +83,63 @@ void URenderer::EndFrame()
 
 void URenderer::RenderSceneForView(UWorld* World, FSceneView* View, FViewport* Viewport)
 {
+	// 틱 이후(에디터 기즈모 등)에 바뀐 트랜스폼의 알림을 그리기 전에 처리 (라이트/파티션 반영)
+	if (World)
+	{
+		World->FlushTransformUpdates();
+	}
+
 	// 씬을 그리는 FSceneRenderer 를 생성합니다.
-	FSceneRenderer SceneRenderer(World, View, this);
+	// 클러스터 컬러는 클러스터 모드일 때만 만들고, 뷰포트별로 유지해 GPU 버퍼를 재사용
+	FClusterLightCuller* ClusterCuller = nullptr;
+	if (World && World->GetRenderSettings().GetLightCullingMode() == ELightCullingMode::Clustered)
+	{
+		ClusterCuller = GetClusterLightCuller(Viewport);
+	}
+	FSceneRenderer SceneRenderer(World, View, this, GetOcclusionCuller(Viewport), ClusterCuller);
 
 	// 실제로 렌더를 수행합니다.
 	SceneRenderer.Render();
 }
 
+FOcclusionCullingManagerCPU* URenderer::GetOcclusionCuller(FViewport* InViewport)
+{
+	if (FOcclusionCullingManagerCPU** Found = OcclusionCullers.Find(InViewport))
+	{
+		return *Found;
+	}
+
+	FOcclusionCullingManagerCPU* NewCuller = new FOcclusionCullingManagerCPU();
+	OcclusionCullers.Add(InViewport, NewCuller);
+	return NewCuller;
+}
+
+FClusterLightCuller* URenderer::GetClusterLightCuller(FViewport* InViewport)
+{
+	if (FClusterLightCuller** Found = ClusterLightCullers.Find(InViewport))
+	{
+		return *Found;
+	}
+
+	FClusterLightCuller* NewCuller = new FClusterLightCuller();
+	ClusterLightCullers.Add(InViewport, NewCuller);
+	return NewCuller;
+}
+
+void URenderer::ReleaseViewportResources(FViewport* InViewport)
+{
+	if (FOcclusionCullingManagerCPU** Found = OcclusionCullers.Find(InViewport))
+	{
+		delete *Found;
+		OcclusionCullers.Remove(InViewport);
+	}
+	if (FClusterLightCuller** Found = ClusterLightCullers.Find(InViewport))
+	{
+		delete *Found;
+		ClusterLightCullers.Remove(InViewport);
+	}
+}
+
 UPrimitiveComponent* URenderer::GetPrimitiveCollided(int MouseX, int MouseY) const
 {
 	//GPU와 동기화 문제 때문에 Map이 호출될때까지 기다려야해서 피킹 하는 프레임에 엄청난 프레임 드랍이 일어남.
@@ -109,7 +172,7 @@ UPrimitiveComponent* URenderer::GetPrimitiveCollided(int MouseX, int MouseY) con
 		DeviceContext->Unmap(RHIDevice->GetIdStagingBuffer(), 0);
 	}
 
-	if (PickedId == 0)
+	if (PickedId == 0 || PickedId >= static_cast<uint32>(GUObjectArray.Num()))
 		return nullptr;
 	return Cast<UPrimitiveComponent>(GUObjectArray[PickedId]);
 }
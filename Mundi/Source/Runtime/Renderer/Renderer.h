@@ -12,6 +12,9 @@ class UBillboardComponent;
 class UPrimitiveComponent;
 class UCameraComponent;
 class FSceneView;
+class FViewport;
+class FOcclusionCullingManagerCPU;
+class FClusterLightCuller;
 
 struct FMaterialSlot;
 
@@ -49,6 +52,13 @@ public:
 	void SetCurrentCamera(ACameraActor* InCamera) { CurrentCamera = InCamera; }
 	ACameraActor* GetCurrentCamera() const { return CurrentCamera; }
 
+	// 뷰포트별 CPU 오클루전 컬러 (깊이 버퍼/HZB를 프레임 간 재사용하기 위해 렌더러가 소유)
+	FOcclusionCullingManagerCPU* GetOcclusionCuller(FViewport* InViewport);
+	// 뷰포트별 클러스터 라이트 컬러 (인덱스 버퍼/슬라이스 목록을 프레임 간 재사용)
+	FClusterLightCuller* GetClusterLightCuller(FViewport* InViewport);
+	// 뷰포트가 삭제될 때 (FViewport 소멸자) 그 뷰포트용 상태를 해제. 같은 주소에 새 뷰포트가 생겨도 이전 HZB를 물려받지 않음
+	void ReleaseViewportResources(FViewport* InViewport);
+
 private:
 	D3D11RHI* RHIDevice;    // NOTE: 개발 편의성을 위해서 DX11를 종속적으로 사용한다 (URHIDevice를 사용하지 않음)
 
@@ -74,5 +84,8 @@ private:
 	ID3D11ShaderResourceView* PreSRV = nullptr;*/
 
 	ACameraActor* CurrentCamera = nullptr;
+
+	TMap<FViewport*, FOcclusionCullingManagerCPU*> OcclusionCullers;
+	TMap<FViewport*, FClusterLightCuller*> ClusterLightCullers;
 };
 
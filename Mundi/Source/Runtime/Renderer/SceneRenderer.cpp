@@ -42,6 +42,7 @@
 #include "../RHI/ConstantBufferType.h"
 #include <chrono>
 #include "TileLightCuller.h"
+#include "ClusterLightCuller.h"
 #include "LineComponent.h"
 #include "LightStats.h"
 #include "ShadowStats.h"
@@ -49,20 +50,30 @@
 #include "PostProcessing/VignettePass.h"
 #include "FbxLoader.h"
 #include "SkinnedMeshComponent.h"
+#include "TaskScheduler.h"
+#include "OcclusionStats.h"
 
-FSceneRenderer::FSceneRenderer(UWorld* InWorld, FSceneView* InView, URenderer* InOwnerRenderer)
+FSceneRenderer::FSceneRenderer(UWorld* InWorld, FSceneView* InView, URenderer* InOwnerRenderer, FOcclusionCullingManagerCPU* InOcclusionCuller,
+	FClusterLightCuller* InClusterLightCuller)
 	: World(InWorld)
 	, View(InView) // 전달받은 FSceneView 저장
 	, OwnerRenderer(InOwnerRenderer)
 	, RHIDevice(InOwnerRenderer->GetRHIDevice())
+	, OcclusionCuller(InOcclusionCuller)
 {
-	//OcclusionCPU = std::make_unique<FOcclusionCullingManagerCPU>();
-
 	// 타일 라이트 컬러 초기화
 	TileLightCuller = std::make_unique<FTileLightCuller>();
 	uint32 TileSize = World->GetRenderSettings().GetTileSize();
 	TileLightCuller->Initialize(RHIDevice, TileSize);
 
+	// 클러스터 라이트 컬러 설정 갱신 (선택된 경우에만, 버퍼는 컬러가 프레임 간 유지)
+	const URenderSettings& RenderSettings = World->GetRenderSettings();
+	if (RenderSettings.GetLightCullingMode() == ELightCullingMode::Clustered && InClusterLightCuller)
+	{
+		ClusterLightCuller = InClusterLightCuller;
+		ClusterLightCuller->Initialize(RHIDevice, RenderSettings.GetClusterTileSize(), RenderSettings.GetClusterSliceCount());
+	}
+
 	// 라인 수집 시작
 	OwnerRenderer->BeginLineBatch();
 }
@@ -119,6 +130,11 @@ void FSceneRenderer::Render()
     // 렌더링할 대상 수집 (Cull + Gather)
     GatherVisibleProxies();
 
+	// 배치 수집 전에 가려진 메시 판정
+	TIME_PROFILE(OcclusionCulling)
+	PerformOcclusionCulling();
+	TIME_PROFILE_END(OcclusionCulling)
+
 	TIME_PROFILE(ShadowMapPass)
 	RenderShadowMaps();
 	TIME_PROFILE_END(ShadowMapPass)
@@ -528,40 +544,25 @@ void FSceneRenderer::RenderShadowDepthPass(FShadowRenderRequest& ShadowRequest,
 	ViewProjBufferType ViewProjBuffer = ViewProjBufferType(ShadowRequest.ViewMatrix, ShadowRequest.ProjectionMatrix, WorldLocation, FMatrix::Identity());	// NOTE: 그림자 맵 셰이더에는 역행렬이 필요 없으므로 Identity를 전달함
 	RHIDevice->SetAndUpdateConstantBuffer(ViewProjBufferType(ViewProjBuffer));
 
-	// 4. (DrawMeshBatches와 유사하게) 배치 순회하며 그리기
-	ID3D11Buffer* CurrentVertexBuffer = nullptr;
-	ID3D11Buffer* CurrentIndexBuffer = nullptr;
-	UINT CurrentVertexStride = 0;
-	D3D11_PRIMITIVE_TOPOLOGY CurrentTopology = D3D11_PRIMITIVE_TOPOLOGY_UNDEFINED;
+	// 4. (DrawMeshBatches와 유사하게) 배치를 커맨드 리스트에 녹화한 뒤 제출
+	//    셰이더/픽셀 상태 변경 불필요, IA 상태 중복은 커맨드 리스트가 걸러냄
+	FRHICommandList& CommandList = ShadowCommandList;
+	CommandList.Reset();
 
 	for (const FMeshBatchElement& Batch : InShadowBatches)
 	{
-		// 셰이더/픽셀 상태 변경 불필요
-
-		// IA 상태 변경
-		if (Batch.VertexBuffer != CurrentVertexBuffer ||
-			Batch.IndexBuffer != CurrentIndexBuffer ||
-			Batch.VertexStride != CurrentVertexStride ||
-			Batch.PrimitiveTopology != CurrentTopology)
-		{
-			UINT Stride = Batch.VertexStride;
-			UINT Offset = 0;
-			RHIDevice->GetDeviceContext()->IASetVertexBuffers(0, 1, &Batch.VertexBuffer, &Stride, &Offset);
-			RHIDevice->GetDeviceContext()->IASetIndexBuffer(Batch.IndexBuffer, DXGI_FORMAT_R32_UINT, 0);
-			RHIDevice->GetDeviceContext()->IASetPrimitiveTopology(Batch.PrimitiveTopology);
-
-			CurrentVertexBuffer = Batch.VertexBuffer;
-			CurrentIndexBuffer = Batch.IndexBuffer;
-			CurrentVertexStride = Batch.VertexStride;
-			CurrentTopology = Batch.PrimitiveTopology;
-		}
+		CommandList.SetVertexBuffer(Batch.VertexBuffer, Batch.VertexStride, 0);
+		CommandList.SetIndexBuffer(Batch.IndexBuffer, ERHIIndexFormat::UInt32, 0);
+		CommandList.SetPrimitiveTopology(static_cast<uint32>(Batch.PrimitiveTopology));
 
 		// 오브젝트별 World 행렬 설정 (VS에서 필요)
-		RHIDevice->SetAndUpdateConstantBuffer(ModelBufferType(Batch.WorldMatrix, Batch.WorldMatrix.InverseAffine().Transpose()));
+		RHIDevice->RecordSetAndUpdateConstantBuffer(CommandList, ModelBufferType(Batch.WorldMatrix, Batch.WorldMatrix.InverseAffine().Transpose()));
 
 		// 드로우 콜
-		RHIDevice->GetDeviceContext()->DrawIndexed(Batch.IndexCount, Batch.StartIndex, Batch.BaseVertexIndex);
+		CommandList.DrawIndexed(Batch.IndexCount, Batch.StartIndex, Batch.BaseVertexIndex);
 	}
+
+	RHIDevice->SubmitCommandList(CommandList);
 }
 
 
@@ -840,8 +841,32 @@ void FSceneRenderer::PerformTileLightCulling()
 	UINT ViewportWidth = static_cast<UINT>(View->ViewRect.Width());
 	UINT ViewportHeight = static_cast<UINT>(View->ViewRect.Height());
 
+	// 클러스터 모드는 로그 깊이 슬라이스를 쓰므로 원근 투영에서만 사용 (직교 투영은 타일 방식으로 대체)
+	const bool bUseClusteredCulling = bTileCullingEnabled && ClusterLightCuller
+		&& View->ProjectionMode == ECameraProjectionMode::Perspective;
+
 	// 타일 컬링이 활성화된 경우에만 컬링 수행
-	if (bTileCullingEnabled)
+	if (bUseClusteredCulling)
+	{
+		TArray<FPointLightInfo>& PointLights = World->GetLightManager()->GetPointLightInfoList();
+		TArray<FSpotLightInfo>& SpotLights = World->GetLightManager()->GetSpotLightInfoList();
+
+		// 클러스터 컬링 수행
+		ClusterLightCuller->CullLights(
+			PointLights,
+			SpotLights,
+			View->ViewMatrix,
+			View->ProjectionMatrix,
+			View->NearClip,
+			View->FarClip,
+			ViewportWidth,
+			ViewportHeight
+		);
+
+		// 통계를 전역 매니저에 업데이트
+		FTileCullingStatManager::GetInstance().UpdateStats(ClusterLightCuller->GetStats());
+	}
+	else if (bTileCullingEnabled)
 	{
 		// PointLight와 SpotLight 정보 수집
 		TArray<FPointLightInfo>& PointLights = World->GetLightManager()->GetPointLightInfoList();
@@ -865,20 +890,33 @@ void FSceneRenderer::PerformTileLightCulling()
 
 	// 타일 컬링 상수 버퍼 업데이트
 	uint32 TileSize = RenderSettings.GetTileSize();
-	FTileCullingBufferType TileCullingBuffer;
+	FTileCullingBufferType TileCullingBuffer = {};
 	TileCullingBuffer.TileSize = TileSize;
 	TileCullingBuffer.TileCountX = (ViewportWidth + TileSize - 1) / TileSize;
 	TileCullingBuffer.TileCountY = (ViewportHeight + TileSize - 1) / TileSize;
 	TileCullingBuffer.bUseTileCulling = bTileCullingEnabled ? 1 : 0;  // ShowFlag에 따라 설정
 	TileCullingBuffer.ViewportStartX = View->ViewRect.MinX;  // ShowFlag에 따라 설정
 	TileCullingBuffer.ViewportStartY = View->ViewRect.MinY;  // ShowFlag에 따라 설정
+	TileCullingBuffer.bUseClusteredCulling = bUseClusteredCulling ? 1 : 0;
+	if (bUseClusteredCulling)
+	{
+		// 클러스터 모드에서는 타일 그리드 자리에 클러스터 화면 그리드를 넣는다
+		TileCullingBuffer.TileSize = ClusterLightCuller->GetClusterTileSize();
+		TileCullingBuffer.TileCountX = ClusterLightCuller->GetClusterCountX();
+		TileCullingBuffer.TileCountY = ClusterLightCuller->GetClusterCountY();
+		TileCullingBuffer.ClusterSliceCount = ClusterLightCuller->GetSliceCount();
+		TileCullingBuffer.ClusterDepthScale = ClusterLightCuller->GetDepthSliceScale();
+		TileCullingBuffer.ClusterDepthBias = ClusterLightCuller->GetDepthSliceBias();
+	}
 
 	RHIDevice->SetAndUpdateConstantBuffer(TileCullingBuffer);
 
 	// Structured Buffer SRV를 t2 슬롯에 바인딩 (타일 컬링 활성화 시에만)
 	if (bTileCullingEnabled)
 	{
-		ID3D11ShaderResourceView* TileLightIndexSRV = TileLightCuller->GetLightIndexBufferSRV();
+		ID3D11ShaderResourceView* TileLightIndexSRV = bUseClusteredCulling
+			? ClusterLightCuller->GetLightIndexBufferSRV()
+			: TileLightCuller->GetLightIndexBufferSRV();
 		if (TileLightIndexSRV)
 		{
 			RHIDevice->GetDeviceContext()->PSSetShaderResources(2, 1, &TileLightIndexSRV);
@@ -906,6 +944,151 @@ void FSceneRenderer::PerformFrustumCulling()
 	//}
 }
 
+namespace
+{
+	// 오클루더는 단색 깊이로 래스터화되므로 모든 머티리얼 슬롯이 불투명해야 함
+	// 투명도(Tr/d)나 알파 마스크 텍스처가 있는 슬롯(유리, 잎 등)이 하나라도 있으면 뒤의 물체를 잘못 가리므로 제외
+	// 비어 있는 슬롯은 기본 머티리얼(불투명)로 그려짐
+	bool CanBeOccluder(const UMeshComponent* InComponent)
+	{
+		for (const UMaterialInterface* Material : InComponent->GetMaterialSlots())
+		{
+			if (!Material)
+			{
+				continue;
+			}
+			const FMaterialInfo& Info = Material->GetMaterialInfo();
+			if (Info.Transparency > 0.0f || !Info.TransparencyTextureFileName.empty())
+			{
+				return false;
+			}
+		}
+		return true;
+	}
+}
+
+void FSceneRenderer::PerformOcclusionCulling()
+{
+	MeshOcclusionVisibility.Empty();
+
+	const URenderSettings& RenderSettings = World->GetRenderSettings();
+	if (!OcclusionCuller || !RenderSettings.IsShowFlagEnabled(EEngineShowFlags::SF_OcclusionCulling) ||
+		View->ProjectionMode != ECameraProjectionMode::Perspective || Proxies.Meshes.IsEmpty())
+	{
+		return;
+	}
+
+	// 깊이 버퍼: 가로는 설정값, 세로는 뷰 비율에 맞춤 (크기가 같으면 재할당 없음)
+	const float ViewWidth = static_cast<float>(std::max(1u, View->ViewRect.Width()));
+	const float ViewHeight = static_cast<float>(std::max(1u, View->ViewRect.Height()));
+	const int32 BufferWidth = static_cast<int32>(RenderSettings.GetOcclusionBufferWidth());
+	const int32 BufferHeight = static_cast<int32>(BufferWidth * ViewHeight / ViewWidth);
+	OcclusionCuller->Initialize(BufferWidth, BufferHeight);
+
+	const FMatrix ViewProj = View->ViewMatrix * View->ProjectionMatrix;
+
+	// 오클루더 후보: 삼각형 수가 적고 화면에서 크게 보이는 스태틱 메시
+	struct FOccluderCandidate
+	{
+		UStaticMeshComponent* Component;
+		const UStaticMesh* Mesh;
+		int32 OccludeeIndex;
+		float ScreenSize;   // 바운딩 구 반지름 / 거리
+	};
+	constexpr float MinOccluderScreenSize = 0.05f;
+	const uint32 MaxTrianglesPerOccluder = RenderSettings.GetMaxTrianglesPerOccluder();
+
+	// 컬러에 넘기지 않는 이번 프레임 전용 목록은 프레임 할당기 사용
+	TArray<FOccluderCandidate, TFrameAllocator<FOccluderCandidate>> Candidates;
+	TArray<FAABB> OccludeeBounds;
+	TArray<int32, TFrameAllocator<int32>> OccludeeMeshIndices;
+	for (int32 MeshIndex = 0; MeshIndex < Proxies.Meshes.Num(); ++MeshIndex)
+	{
+		// 스켈레탈 메시는 애니메이션 바운드를 신뢰할 수 없어 항상 보임 처리
+		UStaticMeshComponent* StaticMeshComponent = Cast<UStaticMeshComponent>(Proxies.Meshes[MeshIndex]);
+		if (!StaticMeshComponent || !StaticMeshComponent->GetStaticMesh() || !StaticMeshComponent->GetStaticMesh()->HasMeshData())
+		{
+			continue;
+		}
+
+		const FAABB Bound = StaticMeshComponent->GetWorldAABB();
+		OccludeeBounds.Add(Bound);
+		OccludeeMeshIndices.Add(MeshIndex);
+
+		const UStaticMesh* Mesh = StaticMeshComponent->GetStaticMesh();
+		const uint32 NumTriangles = static_cast<uint32>(Mesh->GetCollisionIndices().size() / 3);
+		if (NumTriangles == 0 || NumTriangles > MaxTrianglesPerOccluder || Mesh->GetCollisionPositions().empty())
+		{
+			continue;
+		}
+
+		if (!CanBeOccluder(StaticMeshComponent))
+		{
+			continue;
+		}
+
+		const float Distance = std::max((Bound.GetCenter() - View->ViewLocation).Size(), View->NearClip);
+		const float ScreenSize = Bound.GetHalfExtent().Size() / Distance;
+		if (ScreenSize >= MinOccluderScreenSize)
+		{
+			Candidates.Add({ StaticMeshComponent, Mesh, OccludeeBounds.Num() - 1, ScreenSize });
+		}
+	}
+
+	// 화면에서 큰 순서대로 삼각형 예산만큼 오클루더로 사용
+	std::sort(Candidates.begin(), Candidates.end(),
+		[](const FOccluderCandidate& A, const FOccluderCandidate& B) { return A.ScreenSize > B.ScreenSize; });
+
+	TArray<FOccluderDesc> Occluders;
+	TArray<int32> OccluderOccludeeIndices;
+	uint32 RemainingTriangles = RenderSettings.GetOccluderTriangleBudget();
+	for (const FOccluderCandidate& Candidate : Candidates)
+	{
+		const TArray<FVector>& Positions = Candidate.Mesh->GetCollisionPositions();
+		const TArray<uint32>& Indices = Candidate.Mesh->GetCollisionIndices();
+		const uint32 NumTriangles = static_cast<uint32>(Indices.size() / 3);
+		if (NumTriangles > RemainingTriangles)
+		{
+			continue;
+		}
+		RemainingTriangles -= NumTriangles;
+
+		FOccluderDesc Desc;
+		Desc.Positions = Positions.data();
+		Desc.PositionStride = sizeof(FVector);
+		Desc.NumVertices = static_cast<uint32>(Positions.size());
+		Desc.Indices = Indices.data();
+		Desc.NumIndices = static_cast<uint32>(Indices.size());
+		Desc.WorldViewProj = Candidate.Component->GetWorldMatrix() * ViewProj;
+		Occluders.Add(Desc);
+		OccluderOccludeeIndices.Add(Candidate.OccludeeIndex);
+	}
+
+	TArray<uint8> OccludeeVisibility;
+	if (RenderSettings.IsTemporalOcclusionEnabled())
+	{
+		// 1단계: 이전 프레임 HZB 재투영으로 가려진 오클루더는 래스터화에서 제외
+		// 2단계: 새 HZB로 화면 안의 오클루디를 모두 다시 테스트 (1단계에서 보인 것 포함)
+		OcclusionCuller->CullTwoPhase(Occluders, OccluderOccludeeIndices, OccludeeBounds, ViewProj, OccludeeVisibility);
+	}
+	else
+	{
+		OcclusionCuller->BeginFrame();
+		OcclusionCuller->RasterizeOccluders(Occluders);
+		OcclusionCuller->BuildHZB();
+		OcclusionCuller->TestOccludees(OccludeeBounds, ViewProj, OccludeeVisibility);
+		OcclusionCuller->EndFrame(ViewProj);
+	}
+
+	MeshOcclusionVisibility.SetNum(Proxies.Meshes.Num(), 1);
+	for (int32 i = 0; i < OccludeeMeshIndices.Num(); ++i)
+	{
+		MeshOcclusionVisibility[OccludeeMeshIndices[i]] = OccludeeVisibility[i];
+	}
+
+	FOcclusionStatManager::GetInstance().UpdateStats(OcclusionCuller->GetStats());
+}
+
 void FSceneRenderer::RenderOpaquePass(EViewMode InRenderViewMode)
 {
 	// --- 1. 수집 (Collect) ---
@@ -918,9 +1101,14 @@ void FSceneRenderer::RenderOpaquePass(EViewMode InRenderViewMode)
 		}
 	}
 	MeshBatchElements.Empty();
-	for (UMeshComponent* MeshComponent : Proxies.Meshes)
+	const bool bHasOcclusionResult = MeshOcclusionVisibility.Num() == Proxies.Meshes.Num();
+	for (int32 MeshIndex = 0; MeshIndex < Proxies.Meshes.Num(); ++MeshIndex)
 	{
-		MeshComponent->CollectMeshBatches(MeshBatchElements, View);
+		if (bHasOcclusionResult && !MeshOcclusionVisibility[MeshIndex])
+		{
+			continue;
+		}
+		Proxies.Meshes[MeshIndex]->CollectMeshBatches(MeshBatchElements, View);
 	}
 
 	for (UBillboardComponent* BillboardComponent : Proxies.Billboards)
@@ -977,6 +1165,9 @@ void FSceneRenderer::RenderDecalPass()
 		return;
 	}
 
+	// 압축 정점 메시(FPackedNormalVertex)용 변형은 그런 대상이 있을 때만 컴파일
+	FShaderVariant* CompactShaderVariant = nullptr;
+
 	// 데칼 렌더 설정
 	RHIDevice->RSSetState(ERasterizerMode::Decal);
 	RHIDevice->OMSetDepthStencilState(EComparisonFunc::LessEqualReadOnly); // 깊이 쓰기 OFF
@@ -1030,10 +1221,34 @@ void FSceneRenderer::RenderDecalPass()
 		{
 			BatchElement.InstanceShaderResourceView = Decal->GetDecalTexture()->GetShaderResourceView();
 			BatchElement.Material = Decal->GetMaterial(0);
-			BatchElement.InputLayout = ShaderVariant->InputLayout;
-			BatchElement.VertexShader = ShaderVariant->VertexShader;
-			BatchElement.PixelShader = ShaderVariant->PixelShader;
-			BatchElement.VertexStride = sizeof(FVertexDynamic);
+
+			FShaderVariant* TargetVariant = ShaderVariant;
+			if (BatchElement.VertexStride == sizeof(FPackedNormalVertex))
+			{
+				if (!CompactShaderVariant)
+				{
+					TArray<FShaderMacro> CompactMacros = View->ViewShaderMacros;
+					FShaderMacro CompactVertexMacro;
+					CompactVertexMacro.Name = FNameLiteral("COMPACT_VERTEX");
+					CompactVertexMacro.Definition = FNameLiteral("1");
+					CompactMacros.Add(CompactVertexMacro);
+					CompactShaderVariant = DecalShader->GetOrCompileShaderVariant(CompactMacros);
+				}
+				if (!CompactShaderVariant)
+				{
+					BatchElement.IndexCount = 0;    // 맞는 입력 레이아웃이 없으면 그리지 않음
+					continue;
+				}
+				TargetVariant = CompactShaderVariant;
+			}
+			else
+			{
+				BatchElement.VertexStride = sizeof(FVertexDynamic);
+			}
+
+			BatchElement.InputLayout = TargetVariant->InputLayout;
+			BatchElement.VertexShader = TargetVariant->VertexShader;
+			BatchElement.PixelShader = TargetVariant->PixelShader;
 		}
 		DrawMeshBatches(MeshBatchElements, true);
 
@@ -1333,25 +1548,82 @@ void FSceneRenderer::DrawMeshBatches(TArray<FMeshBatchElement>& InMeshBatches, b
 	FPixelConstBufferType DefaultPixelConst{};
 	RHIDevice->SetAndUpdateConstantBuffer(DefaultPixelConst);
 
-	// 현재 GPU 상태 캐싱용 변수 (UStaticMesh* 대신 실제 GPU 리소스로 변경)
-	ID3D11VertexShader* CurrentVertexShader = nullptr;
-	ID3D11PixelShader* CurrentPixelShader = nullptr;
-	UMaterialInterface* CurrentMaterial = nullptr;
-	ID3D11ShaderResourceView* CurrentInstanceSRV = nullptr; // [추가] Instance SRV 캐시
-	ID3D11Buffer* CurrentVertexBuffer = nullptr;
-	ID3D11Buffer* CurrentIndexBuffer = nullptr;
-	UINT CurrentVertexStride = 0;
-	D3D11_PRIMITIVE_TOPOLOGY CurrentTopology = D3D11_PRIMITIVE_TOPOLOGY_UNDEFINED;
+	// UMaterialInstanceDynamic::GetMaterialInfo()는 첫 호출 시 내부 캐시를 갱신하므로,
+	// 병렬 녹화 전에 메인 스레드에서 한 번씩 호출해 두어 워커에서는 읽기만 일어나도록 합니다.
+	UMaterialInterface* LastMaterial = nullptr;
+	for (const FMeshBatchElement& Batch : InMeshBatches)
+	{
+		if (Batch.Material && Batch.Material != LastMaterial)
+		{
+			Batch.Material->GetMaterialInfo();
+			LastMaterial = Batch.Material;
+		}
+	}
+
+	// --- 1. 녹화 (Record) ---
+	// 배치가 충분히 많을 때만 여러 커맨드 리스트로 나누어 워커 스레드에서 병렬 녹화합니다.
+	// 리스트마다 상태 캐시가 따로 있으므로 각 리스트의 첫 상태 변경은 항상 기록됩니다.
+	constexpr int32 MinBatchesPerCommandList = 256;
+	const int32 NumBatches = InMeshBatches.Num();
+	const int32 MaxCommandLists = static_cast<int32>(FTaskScheduler::GetInstance().GetNumWorkers()) + 1;
+	const int32 NumCommandLists = std::clamp(NumBatches / MinBatchesPerCommandList, 1, MaxCommandLists);
+	const int32 BatchesPerCommandList = (NumBatches + NumCommandLists - 1) / NumCommandLists;
+
+	if (MeshCommandLists.Num() < NumCommandLists)
+	{
+		MeshCommandLists.SetNum(NumCommandLists);
+	}
+
+	FTaskScheduler::GetInstance().ParallelFor(NumCommandLists, 1, [&](int32 Begin, int32 End)
+		{
+			for (int32 ListIndex = Begin; ListIndex < End; ++ListIndex)
+			{
+				FRHICommandList& CommandList = MeshCommandLists[ListIndex];
+				CommandList.Reset();
+
+				const int32 FirstBatch = ListIndex * BatchesPerCommandList;
+				const int32 LastBatch = std::min(FirstBatch + BatchesPerCommandList, NumBatches);
+				if (FirstBatch < LastBatch)
+				{
+					RecordMeshBatches(InMeshBatches.GetData() + FirstBatch, LastBatch - FirstBatch, CommandList);
+				}
+			}
+		});
+
+	// --- 2. 제출 (Submit) ---
+	// Immediate Context에는 녹화 순서대로 한 스레드에서만 재생합니다.
+	for (int32 ListIndex = 0; ListIndex < NumCommandLists; ++ListIndex)
+	{
+		RHIDevice->SubmitCommandList(MeshCommandLists[ListIndex]);
+	}
+
+	// 루프 종료 후 리스트 비우기 (옵션)
+	if (bClearListAfterDraw)
+	{
+		InMeshBatches.Empty();
+	}
+}
+
+void FSceneRenderer::RecordMeshBatches(const FMeshBatchElement* InBatches, int32 NumBatches, FRHICommandList& CommandList) const
+{
+	// 중복 상태 필터링은 FRHICommandList가 녹화 시점에 처리하므로, 여기서는 배치마다 필요한 상태를 모두 기록합니다.
 
 	// 기본 샘플러 미리 가져오기 (루프 내 반복 호출 방지)
 	ID3D11SamplerState* DefaultSampler = RHIDevice->GetSamplerState(RHI_Sampler_Index::Default);
 	// Shadow PCF용 샘플러 추가
 	ID3D11SamplerState* ShadowSampler = RHIDevice->GetSamplerState(RHI_Sampler_Index::Shadow);
 	ID3D11SamplerState* VSMSampler = RHIDevice->GetSamplerState(RHI_Sampler_Index::VSM);
+	FRHIHandle Samplers[4] = { DefaultSampler, DefaultSampler, ShadowSampler, VSMSampler };
 
-	// 정렬된 리스트 순회
-	for (const FMeshBatchElement& Batch : InMeshBatches)
+	// 픽셀 상태(텍스처, 재질 CBuffer)는 'Material' 또는 'Instance SRV'가 바뀔 때만 다시 계산합니다.
+	bool bHasPixelState = false;
+	UMaterialInterface* CurrentMaterial = nullptr;
+	ID3D11ShaderResourceView* CurrentInstanceSRV = nullptr;
+
+	for (int32 BatchIndex = 0; BatchIndex < NumBatches; ++BatchIndex)
 	{
+		const FMeshBatchElement& Batch = InBatches[BatchIndex];
+
 		// --- 필수 요소 유효성 검사 ---
 		if (!Batch.VertexShader || !Batch.PixelShader || !Batch.VertexBuffer || !Batch.IndexBuffer || Batch.VertexStride == 0)
 		{
@@ -1360,23 +1632,11 @@ void FSceneRenderer::DrawMeshBatches(TArray<FMeshBatchElement>& InMeshBatches, b
 			continue;
 		}
 
-		// 1. 셰이더 상태 변경
-		if (Batch.VertexShader != CurrentVertexShader || Batch.PixelShader != CurrentPixelShader)
-		{
-			RHIDevice->GetDeviceContext()->IASetInputLayout(Batch.InputLayout);
-			RHIDevice->GetDeviceContext()->VSSetShader(Batch.VertexShader, nullptr, 0);
-
-			RHIDevice->GetDeviceContext()->PSSetShader(Batch.PixelShader, nullptr, 0);
-
-			CurrentVertexShader = Batch.VertexShader;
-			CurrentPixelShader = Batch.PixelShader;
-		}
+		// 1. 셰이더 상태
+		CommandList.SetPipeline(Batch.InputLayout, Batch.VertexShader, Batch.PixelShader);
 
-		// --- 2. 픽셀 상태 (텍스처, 샘플러, 재질CBuffer) 변경 (캐싱됨) ---
-		//
-		// 'Material' 또는 'Instance SRV' 둘 중 하나라도 바뀌면
-		// 모든 픽셀 리소스를 다시 바인딩해야 합니다.
-		if (Batch.Material != CurrentMaterial || Batch.InstanceShaderResourceView != CurrentInstanceSRV)
+		// 2. 픽셀 상태 (텍스처, 샘플러, 재질CBuffer)
+		if (!bHasPixelState || Batch.Material != CurrentMaterial || Batch.InstanceShaderResourceView != CurrentInstanceSRV)
 		{
 			ID3D11ShaderResourceView* DiffuseTextureSRV = nullptr; // t0
 			ID3D11ShaderResourceView* NormalTextureSRV = nullptr;  // t1
@@ -1424,64 +1684,33 @@ void FSceneRenderer::DrawMeshBatches(TArray<FMeshBatchElement>& InMeshBatches, b
 					}
 				}
 			}
-			
-			// --- RHI 상태 업데이트 ---
-			// 1. 텍스처(SRV) 바인딩
-			ID3D11ShaderResourceView* Srvs[2] = { DiffuseTextureSRV, NormalTextureSRV };
-			RHIDevice->GetDeviceContext()->PSSetShaderResources(0, 2, Srvs);
-
-			// 2. 샘플러 바인딩
-			ID3D11SamplerState* Samplers[4] = { DefaultSampler, DefaultSampler, ShadowSampler, VSMSampler };
-			RHIDevice->GetDeviceContext()->PSSetSamplers(0, 4, Samplers);			
 
-			// 3. 재질 CBuffer 바인딩
-			RHIDevice->SetAndUpdateConstantBuffer(PixelConst);
+			// 텍스처(SRV), 샘플러, 재질 CBuffer
+			FRHIHandle Srvs[2] = { DiffuseTextureSRV, NormalTextureSRV };
+			CommandList.SetShaderResources(0, 2, Srvs);
+			CommandList.SetSamplers(0, 4, Samplers);
+			RHIDevice->RecordSetAndUpdateConstantBuffer(CommandList, PixelConst);
 
-			// --- 캐시 업데이트 ---
+			bHasPixelState = true;
 			CurrentMaterial = Batch.Material;
 			CurrentInstanceSRV = Batch.InstanceShaderResourceView;
 		}
 
-		// 3. IA (Input Assembler) 상태 변경
-		if (Batch.VertexBuffer != CurrentVertexBuffer ||
-			Batch.IndexBuffer != CurrentIndexBuffer ||
-			Batch.VertexStride != CurrentVertexStride ||
-			Batch.PrimitiveTopology != CurrentTopology)
-		{
-			UINT Stride = Batch.VertexStride;
-			UINT Offset = 0;
-
-			// Vertex/Index 버퍼 바인딩
-			RHIDevice->GetDeviceContext()->IASetVertexBuffers(0, 1, &Batch.VertexBuffer, &Stride, &Offset);
-			RHIDevice->GetDeviceContext()->IASetIndexBuffer(Batch.IndexBuffer, DXGI_FORMAT_R32_UINT, 0);
+		// 3. IA (Input Assembler) 상태
+		CommandList.SetVertexBuffer(Batch.VertexBuffer, Batch.VertexStride, 0);
+		CommandList.SetIndexBuffer(Batch.IndexBuffer, ERHIIndexFormat::UInt32, 0);
+		CommandList.SetPrimitiveTopology(static_cast<uint32>(Batch.PrimitiveTopology));
 
-			// 토폴로지 설정 (이전 코드의 5번에서 이동하여 최적화)
-			RHIDevice->GetDeviceContext()->IASetPrimitiveTopology(Batch.PrimitiveTopology);
-
-			// 현재 IA 상태 캐싱
-			CurrentVertexBuffer = Batch.VertexBuffer;
-			CurrentIndexBuffer = Batch.IndexBuffer;
-			CurrentVertexStride = Batch.VertexStride;
-			CurrentTopology = Batch.PrimitiveTopology;
-		}
-
-		// 4. 오브젝트별 상수 버퍼 설정 (매번 변경)
-		RHIDevice->SetAndUpdateConstantBuffer(ModelBufferType(Batch.WorldMatrix, Batch.WorldMatrix.InverseAffine().Transpose()));
-		RHIDevice->SetAndUpdateConstantBuffer(ColorBufferType(Batch.InstanceColor, Batch.ObjectID));
+		// 4. 오브젝트별 상수 버퍼 (내용이 같으면 커맨드 리스트에서 걸러짐)
+		RHIDevice->RecordSetAndUpdateConstantBuffer(CommandList, ModelBufferType(Batch.WorldMatrix, Batch.WorldMatrix.InverseAffine().Transpose()));
+		RHIDevice->RecordSetAndUpdateConstantBuffer(CommandList, ColorBufferType(Batch.InstanceColor, Batch.ObjectID));
 
 		// GPU 스키닝: 본 행렬 상수 버퍼 바인딩 (b6)
 		// nullptr를 전달하면 해당 슬롯을 언바인드합니다
-		ID3D11Buffer* BoneBuffer = Batch.BoneMatricesBuffer;
-		RHIDevice->GetDeviceContext()->VSSetConstantBuffers(6, 1, &BoneBuffer);
-
-		// 5. 드로우 콜 실행
-		RHIDevice->GetDeviceContext()->DrawIndexed(Batch.IndexCount, Batch.StartIndex, Batch.BaseVertexIndex);
-	}
+		CommandList.SetConstantBuffer(RHI_STAGE_Vertex, 6, Batch.BoneMatricesBuffer);
 
-	// 루프 종료 후 리스트 비우기 (옵션)
-	if (bClearListAfterDraw)
-	{
-		InMeshBatches.Empty();
+		// 5. 드로우 콜
+		CommandList.DrawIndexed(Batch.IndexCount, Batch.StartIndex, Batch.BaseVertexIndex);
 	}
 }
 
@@ -1,5 +1,6 @@
 ﻿#pragma once
 #include "Frustum.h"
+#include "RHICommandList.h"
 
 // TODO : Post Processing 떼어내기, 전방선언으로라든지...
 #include "PostProcessing/FadeInOutPass.h"
@@ -27,10 +28,10 @@ class UTextRenderComponent;
 class UGizmoArrowComponent;
 class FSceneView;
 class FTileLightCuller;
+class FClusterLightCuller;
+class FOcclusionCullingManagerCPU;
 class ULineComponent;
 
-struct FCandidateDrawable;
-
 // 렌더링할 대상들의 집합을 담는 구조체
 struct FVisibleRenderProxySet
 {
@@ -70,7 +71,8 @@ struct FSceneGlobals
 class FSceneRenderer
 {
 public:
-	FSceneRenderer(UWorld* InWorld, FSceneView* InView, URenderer* InOwnerRenderer);
+	FSceneRenderer(UWorld* InWorld, FSceneView* InView, URenderer* InOwnerRenderer, FOcclusionCullingManagerCPU* InOcclusionCuller = nullptr,
+		FClusterLightCuller* InClusterLightCuller = nullptr);
 	~FSceneRenderer();
 
 	/** @brief 이 씬 렌더러의 모든 렌더링 파이프라인을 실행합니다. */
@@ -97,6 +99,9 @@ private:
 	/** @brief 씬을 순회하며 컬링을 통과한 모든 렌더링 대상을 수집합니다. */
 	void GatherVisibleProxies();
 
+	/** @brief 저폴리 스태틱 메시를 CPU 깊이 버퍼에 래스터화하고, 가려진 메시를 불투명 패스에서 제외합니다. */
+	void PerformOcclusionCulling();
+
 	/** @brief 타일 기반 라이트 컬링을 수행하고 Structured Buffer를 업데이트합니다. */
 	void PerformTileLightCulling();
 
@@ -105,6 +110,9 @@ private:
 
 	void DrawMeshBatches(TArray<FMeshBatchElement>& InMeshBatches, bool bClearListAfterDraw);
 
+	/** @brief 배치 구간을 커맨드 리스트에 녹화합니다. 워커 스레드에서 호출될 수 있으므로 멤버 상태를 변경하지 않습니다. */
+	void RecordMeshBatches(const FMeshBatchElement* InBatches, int32 NumBatches, FRHICommandList& CommandList) const;
+
 	/** @brief 데칼(Decal)을 렌더링하는 패스입니다. */
 	void RenderDecalPass();
 
@@ -144,12 +152,25 @@ private:
 	// 컬링을 거친 가시성 목록, NOTE: 추후 컴포넌트 단위로 수정
 	TArray<UPrimitiveComponent*> PotentiallyVisibleComponents;
 
+	// CPU 오클루전 컬러 (URenderer가 뷰포트별로 소유, 없으면 오클루전 컬링 생략)
+	FOcclusionCullingManagerCPU* OcclusionCuller;
+
+	// Proxies.Meshes와 같은 순서의 오클루전 결과 (비어 있으면 전부 보임). 그림자 패스는 사용하지 않음
+	TArray<uint8> MeshOcclusionVisibility;
+
 	// 각 패스에서 수집된 드로우 콜 정보 리스트
 	TArray<FMeshBatchElement> MeshBatchElements;
 
+	// DrawMeshBatches가 녹화에 사용하는 커맨드 리스트 (패스 간에 메모리 재사용)
+	TArray<FRHICommandList> MeshCommandLists;
+	FRHICommandList ShadowCommandList;
+
 	// 타일 기반 라이트 컬링 시스템 (매 프레임 생성되고 소멸되어서 스마트 포인터로 설정)
 	std::unique_ptr<FTileLightCuller> TileLightCuller;
 
+	// 클러스터 라이트 컬링 (URenderer가 뷰포트별로 소유, ELightCullingMode::Clustered일 때만 전달됨)
+	FClusterLightCuller* ClusterLightCuller = nullptr;
+
 	// TODO : 자동으로 등록되게 바꾸기!, bloom 빼고 다 stateless해서 걔네는 static(etc..) 등 하이브리도 구조로 바꾸기
 	// PostProcessing
 	FHeightFogPass HeightFogPass;
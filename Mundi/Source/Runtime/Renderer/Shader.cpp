@@ -316,21 +316,45 @@ void UShader::CreateInputLayout(ID3D11Device* Device, const FString& InShaderPat
 
 	// GPU 스키닝을 사용하는 경우 BoneIndices와 BoneWeights 추가
 	bool bHasGPUSkinning = false;
+	bool bHasCompactVertex = false;
 	for (const FShaderMacro& Macro : InMacros)
 	{
-		if (Macro.Name.ToString() == "GPU_SKINNING")
+		const FString MacroName = Macro.Name.ToString();
+		if (MacroName == "GPU_SKINNING")
 		{
 			bHasGPUSkinning = true;
-			break;
+		}
+		else if (MacroName == "COMPACT_VERTEX")
+		{
+			bHasCompactVertex = true;
+		}
+	}
+
+	// 압축 정점: 정점 전체 입력을 받는 셰이더만 교체 (위치만 읽는 레이아웃은 그대로 호환)
+	if (bHasCompactVertex && 1 < descArray.Num())
+	{
+		descArray.clear();
+		for (uint32 i = 0; i < FVertexPackedNormalTexture::GetLayoutCount(); ++i)
+		{
+			descArray.Add(FVertexPackedNormalTexture::GetLayout()[i]);
 		}
 	}
 
 	if (bHasGPUSkinning && InShaderPath.find("UberLit") != FString::npos)
 	{
 		// GPU 스키닝을 위한 추가 입력 요소
-		// FSkinnedVertex: Position(12) + Normal(12) + UV(8) + Tangent(16) + Color(16) + BoneIndices(16) + BoneWeights(16)
-		descArray.Add({ "BLENDINDICES", 0, DXGI_FORMAT_R32G32B32A32_UINT, 0, 64, D3D11_INPUT_PER_VERTEX_DATA, 0 });
-		descArray.Add({ "BLENDWEIGHT", 0, DXGI_FORMAT_R32G32B32A32_FLOAT, 0, 80, D3D11_INPUT_PER_VERTEX_DATA, 0 });
+		if (bHasCompactVertex)
+		{
+			// FPackedSkinnedVertex: FPackedNormalVertex(32) + BoneIndices(4) + BoneWeights(4)
+			descArray.Add({ "BLENDINDICES", 0, DXGI_FORMAT_R8G8B8A8_UINT, 0, 32, D3D11_INPUT_PER_VERTEX_DATA, 0 });
+			descArray.Add({ "BLENDWEIGHT", 0, DXGI_FORMAT_R8G8B8A8_UNORM, 0, 36, D3D11_INPUT_PER_VERTEX_DATA, 0 });
+		}
+		else
+		{
+			// FSkinnedVertex: Position(12) + Normal(12) + UV(8) + Tangent(16) + Color(16) + BoneIndices(16) + BoneWeights(16)
+			descArray.Add({ "BLENDINDICES", 0, DXGI_FORMAT_R32G32B32A32_UINT, 0, 64, D3D11_INPUT_PER_VERTEX_DATA, 0 });
+			descArray.Add({ "BLENDWEIGHT", 0, DXGI_FORMAT_R32G32B32A32_FLOAT, 0, 80, D3D11_INPUT_PER_VERTEX_DATA, 0 });
+		}
 	}
 
 	const D3D11_INPUT_ELEMENT_DESC* layout = descArray.data();
@@ -107,6 +107,24 @@ struct FVertexPositionColorTexturNormal
 	static uint32 GetLayoutCount() { return 4; }
 };
 
+// FPackedNormalVertex (COMPACT_VERTEX). 셰이더 입력 이름은 FVertexDynamic과 같고 형식만 다름
+struct FVertexPackedNormalTexture
+{
+	static const D3D11_INPUT_ELEMENT_DESC* GetLayout()
+	{
+		static const D3D11_INPUT_ELEMENT_DESC layout[] = {
+			{ "POSITION", 0, DXGI_FORMAT_R32G32B32_FLOAT, 0, 0, D3D11_INPUT_PER_VERTEX_DATA, 0 },
+			{ "NORMAL", 0, DXGI_FORMAT_R16G16_SNORM, 0, 12, D3D11_INPUT_PER_VERTEX_DATA, 0 },
+			{ "TEXCOORD", 0, DXGI_FORMAT_R16G16_FLOAT, 0, 16, D3D11_INPUT_PER_VERTEX_DATA, 0 },
+			{ "TANGENT", 0, DXGI_FORMAT_R16G16B16A16_SNORM, 0, 20, D3D11_INPUT_PER_VERTEX_DATA, 0 },
+			{ "COLOR", 0, DXGI_FORMAT_R8G8B8A8_UNORM, 0, 28, D3D11_INPUT_PER_VERTEX_DATA, 0 }
+		};
+		return layout;
+	}
+
+	static uint32 GetLayoutCount() { return 5; }
+};
+
 struct FVertexPositionBillBoard
 
 {
@@ -24,9 +24,29 @@ struct FTileCullingStats
 	float CullingEfficiency = 0.0f; // 컬링된 라이트 비율 (%)
 	uint32 TotalLightTests = 0;     // 전체 라이트-타일 테스트 수
 	uint32 TotalLightsPassed = 0;   // 컬링을 통과한 라이트 수
+	uint32 LightsOutsideView = 0;   // 화면/깊이 범위 밖이라 타일 테스트 전에 제외된 라이트 수
+
+	// 클러스터 컬링 (bClustered일 때 TileCountX/Y는 클러스터 화면 그리드, TotalTileCount는 전체 클러스터 수)
+	static constexpr int32 NumOccupancyBuckets = 6;   // 0, 1~2, 3~4, 5~8, 9~16, 17+
+	bool bClustered = false;
+	uint32 ClusterSliceCount = 0;
+	uint32 OccupiedClusterCount = 0;                   // 라이트가 1개 이상인 클러스터 수
+	uint32 ClusterOccupancyHistogram[NumOccupancyBuckets] = {};
+
+	// 라이트 개수 → 히스토그램 구간
+	static int32 GetOccupancyBucket(uint32 LightCount)
+	{
+		if (LightCount == 0) return 0;
+		if (LightCount <= 2) return 1;
+		if (LightCount <= 4) return 2;
+		if (LightCount <= 8) return 3;
+		if (LightCount <= 16) return 4;
+		return 5;
+	}
 
 	// 성능 메트릭
 	float ComputeShaderTimeMS = 0.0f;
+	float CPUCullingTimeMS = 0.0f;  // CPU 타일 컬링 소요 시간 (업로드 제외)
 	uint32 LightIndexBufferSizeBytes = 0;
 
 	// 시각화 모드
@@ -56,15 +76,24 @@ struct FTileCullingStats
 		CullingEfficiency = 0.0f;
 		TotalLightTests = 0;
 		TotalLightsPassed = 0;
+		LightsOutsideView = 0;
 		ComputeShaderTimeMS = 0.0f;
+		CPUCullingTimeMS = 0.0f;
 		LightIndexBufferSizeBytes = 0;
+		bClustered = false;
+		ClusterSliceCount = 0;
+		OccupiedClusterCount = 0;
+		for (uint32& Bucket : ClusterOccupancyHistogram)
+		{
+			Bucket = 0;
+		}
 	}
 
 	// 파생 통계 계산
 	void CalculateStats()
 	{
 		TotalLights = TotalPointLights + TotalSpotLights;
-		TotalTileCount = TileCountX * TileCountY;
+		TotalTileCount = TileCountX * TileCountY * (bClustered ? ClusterSliceCount : 1);
 
 		if (TotalTileCount > 0)
 		{
@@ -1,6 +1,9 @@
 ﻿#include "pch.h"
 #include "TileLightCuller.h"
+#include "TaskScheduler.h"
+#include "PlatformTime.h"
 #include <algorithm>
+#include <immintrin.h>
 
 FTileLightCuller::FTileLightCuller()
 	: RHI(nullptr)
@@ -35,6 +38,45 @@ void FTileLightCuller::CullLights(
 	float FarPlane,
 	UINT ViewportWidth,
 	UINT ViewportHeight)
+{
+	BuildTileLightLists(PointLights, SpotLights, ViewMatrix, ProjMatrix, NearPlane, FarPlane, ViewportWidth, ViewportHeight);
+
+	const UINT RequiredSize = TotalTileCount * MaxLightsPerTile;
+	Stats.LightIndexBufferSizeBytes = RequiredSize * sizeof(uint32);
+
+	// GPU 버퍼 생성 또는 업데이트
+	if (!LightIndexBuffer)
+	{
+		// 버퍼 생성
+		HRESULT hr = RHI->CreateStructuredBuffer(
+			sizeof(uint32),
+			RequiredSize,
+			TileLightIndices.GetData(),
+			&LightIndexBuffer
+		);
+
+		if (SUCCEEDED(hr))
+		{
+			// SRV 생성
+			RHI->CreateStructuredBufferSRV(LightIndexBuffer, &LightIndexBufferSRV);
+		}
+	}
+	else
+	{
+		// 기존 버퍼 업데이트
+		RHI->UpdateStructuredBuffer(
+			LightIndexBuffer,
+			TileLightIndices.GetData(),
+			RequiredSize * sizeof(uint32)
+		);
+	}
+}
+
+void FTileLightCuller::BeginTileCulling(
+	const TArray<FPointLightInfo>& PointLights,
+	const TArray<FSpotLightInfo>& SpotLights,
+	UINT ViewportWidth,
+	UINT ViewportHeight)
 {
 	// 타일 그리드 계산
 	TileCountX = (ViewportWidth + TileSize - 1) / TileSize;
@@ -56,9 +98,329 @@ void FTileLightCuller::CullLights(
 	{
 		TileLightIndices.SetNum(RequiredSize);
 	}
+}
+
+// 한 행의 후보 라이트를 8개 배치로 묶어 둔 작업 공간 (워커마다 하나)
+struct FTileLightCuller::FTileRowScratch
+{
+	TArray<float> CenterX;
+	TArray<float> CenterY;
+	TArray<float> CenterZ;
+	TArray<float> NegRadius;
+	TArray<float> MinTileX;
+	TArray<float> MaxTileX;
+	TArray<uint32> IndexCodes;
+};
+
+void FTileLightCuller::BuildTileLightLists(
+	const TArray<FPointLightInfo>& PointLights,
+	const TArray<FSpotLightInfo>& SpotLights,
+	const FMatrix& ViewMatrix,
+	const FMatrix& ProjMatrix,
+	float NearPlane,
+	float FarPlane,
+	UINT ViewportWidth,
+	UINT ViewportHeight)
+{
+	const uint64 StartCycles = FPlatformTime::Cycles64();
+
+	BeginTileCulling(PointLights, SpotLights, ViewportWidth, ViewportHeight);
+
+	// 라이트별 화면 범위는 프레임당 한 번만 계산
+	PrepareLightBounds(PointLights, SpotLights, ViewMatrix * ProjMatrix);
+
+	// Inverse View-Projection 행렬 계산
+	FMatrix InvViewProj = ProjMatrix.InversePerspectiveProjection() * ViewMatrix.InverseAffine();
+
+	// 타일 행 단위로 워커에 분배. 각 타일은 자기 슬롯(count + indices)만 쓰므로 잠금이 필요 없음
+	// 개수 슬롯 뒤의 사용하지 않는 영역은 셰이더가 읽지 않으므로 매 프레임 memset하지 않는다
+	RowStats.SetNum(TileCountY);
+	FTaskScheduler::GetInstance().ParallelFor(static_cast<int32>(TileCountY), 1, [&](int32 Begin, int32 End)
+		{
+			FTileRowScratch Scratch;
+			for (int32 TileY = Begin; TileY < End; ++TileY)
+			{
+				CullTileRow(static_cast<UINT>(TileY), InvViewProj, NearPlane, FarPlane, Scratch);
+			}
+		});
+
+	// 행 통계 합산
+	Stats.MinLightsPerTile = TileCountY > 0 ? UINT_MAX : 0;
+	Stats.MaxLightsPerTile = 0;
+	for (const FTileRowStats& Row : RowStats)
+	{
+		Stats.MinLightsPerTile = FMath::Min(Stats.MinLightsPerTile, Row.MinLights);
+		Stats.MaxLightsPerTile = FMath::Max(Stats.MaxLightsPerTile, Row.MaxLights);
+		Stats.TotalLightsPassed += Row.LightsPassed;
+	}
+
+	// 화면 범위로 거른 쌍도 판정이 끝난 것이므로 테스트 수는 (타일 × 라이트) 전체
+	Stats.TotalLightTests = TotalTileCount * Stats.TotalLights;
+
+	// 컬링 효율성/평균 계산
+	Stats.CalculateStats();
+
+	Stats.CPUCullingTimeMS = static_cast<float>(FPlatformTime::ToMilliseconds(FPlatformTime::Cycles64() - StartCycles));
+}
+
+void FTileLightCuller::PrepareLightBounds(
+	const TArray<FPointLightInfo>& PointLights,
+	const TArray<FSpotLightInfo>& SpotLights,
+	const FMatrix& ViewProj)
+{
+	const int32 NumLights = PointLights.Num() + SpotLights.Num();
+
+	LightCenterX.SetNum(NumLights);
+	LightCenterY.SetNum(NumLights);
+	LightCenterZ.SetNum(NumLights);
+	LightRadius.SetNum(NumLights);
+	LightIndexCodes.SetNum(NumLights);
+	LightTileRects.SetNum(NumLights);
+
+	// 프러스텀 생성과 동일하게 패딩된 타일 그리드 크기를 화면 크기로 사용
+	const float GridWidth = static_cast<float>(TileCountX * TileSize);
+	const float GridHeight = static_cast<float>(TileCountY * TileSize);
+	const float InvTileSize = 1.0f / static_cast<float>(TileSize);
+	const FLightTileRect FullRect = { 0, 0, static_cast<int32>(TileCountX) - 1, static_cast<int32>(TileCountY) - 1 };
+	const FLightTileRect EmptyRect = { 0, 0, -1, -1 };
+
+	for (int32 LightIndex = 0; LightIndex < NumLights; ++LightIndex)
+	{
+		// Point Light 먼저, Spot Light는 그 뒤에 (기존 타일 리스트 순서 유지)
+		const bool bIsPoint = LightIndex < PointLights.Num();
+		const int32 LocalIndex = bIsPoint ? LightIndex : LightIndex - PointLights.Num();
+		const FVector Center = bIsPoint ? PointLights[LocalIndex].Position : SpotLights[LocalIndex].Position;
+		const float Radius = bIsPoint ? PointLights[LocalIndex].AttenuationRadius : SpotLights[LocalIndex].AttenuationRadius;
+
+		LightCenterX[LightIndex] = Center.X;
+		LightCenterY[LightIndex] = Center.Y;
+		LightCenterZ[LightIndex] = Center.Z;
+		LightRadius[LightIndex] = Radius;
+		// 상위 16비트: 타입(0=Point, 1=Spot), 하위 16비트: 인덱스
+		LightIndexCodes[LightIndex] = bIsPoint ? static_cast<uint32>(LocalIndex) : ((1u << 16) | static_cast<uint32>(LocalIndex));
+
+		// 구를 감싸는 AABB의 8개 코너를 클립 공간으로 변환
+		// 클립 좌표는 위치에 대해 선형이므로 중심 + (±R)*축 행으로 코너를 만든다
+		const FVector4 ClipCenter = FVector4(Center.X, Center.Y, Center.Z, 1.0f) * ViewProj;
+		const FVector4 AxisX = FVector4(Radius, 0.0f, 0.0f, 0.0f) * ViewProj;
+		const FVector4 AxisY = FVector4(0.0f, Radius, 0.0f, 0.0f) * ViewProj;
+		const FVector4 AxisZ = FVector4(0.0f, 0.0f, Radius, 0.0f) * ViewProj;
+
+		// 클립 공간 아웃코드: 모든 코너가 같은 평면 밖이면 구 전체가 뷰 밖 (깊이 범위 포함)
+		uint32 OutsideAll = 0x3F;
+		bool bAllInFrontOfEye = true;
+		float MinNdcX = std::numeric_limits<float>::max(), MaxNdcX = -std::numeric_limits<float>::max();
+		float MinNdcY = std::numeric_limits<float>::max(), MaxNdcY = -std::numeric_limits<float>::max();
+
+		for (int32 Corner = 0; Corner < 8; ++Corner)
+		{
+			const float SX = (Corner & 1) ? 1.0f : -1.0f;
+			const float SY = (Corner & 2) ? 1.0f : -1.0f;
+			const float SZ = (Corner & 4) ? 1.0f : -1.0f;
+			const float X = ClipCenter.X + SX * AxisX.X + SY * AxisY.X + SZ * AxisZ.X;
+			const float Y = ClipCenter.Y + SX * AxisX.Y + SY * AxisY.Y + SZ * AxisZ.Y;
+			const float Z = ClipCenter.Z + SX * AxisX.Z + SY * AxisY.Z + SZ * AxisZ.Z;
+			const float W = ClipCenter.W + SX * AxisX.W + SY * AxisY.W + SZ * AxisZ.W;
+
+			uint32 OutCode = 0;
+			OutCode |= (X < -W) ? 0x01 : 0;
+			OutCode |= (X > W) ? 0x02 : 0;
+			OutCode |= (Y < -W) ? 0x04 : 0;
+			OutCode |= (Y > W) ? 0x08 : 0;
+			OutCode |= (Z < 0.0f) ? 0x10 : 0;
+			OutCode |= (Z > W) ? 0x20 : 0;
+			OutsideAll &= OutCode;
+
+			if (W <= KINDA_SMALL_NUMBER)
+			{
+				bAllInFrontOfEye = false;
+				continue;
+			}
+
+			const float InvW = 1.0f / W;
+			MinNdcX = FMath::Min(MinNdcX, X * InvW);
+			MaxNdcX = FMath::Max(MaxNdcX, X * InvW);
+			MinNdcY = FMath::Min(MinNdcY, Y * InvW);
+			MaxNdcY = FMath::Max(MaxNdcY, Y * InvW);
+		}
+
+		if (OutsideAll != 0)
+		{
+			LightTileRects[LightIndex] = EmptyRect;
+			Stats.LightsOutsideView++;
+			continue;
+		}
+
+		// 눈 평면을 가로지르면 투영 범위를 신뢰할 수 없으므로 전체 화면으로 처리 (보수적)
+		if (!bAllInFrontOfEye)
+		{
+			LightTileRects[LightIndex] = FullRect;
+			continue;
+		}
+
+		// NDC → 픽셀 → 타일 (Y축 반전). 역행렬로 만든 타일 평면과의 오차를 덮도록 반 픽셀 여유를 둔다
+		// 눈 근처 코너는 NDC가 매우 커질 수 있으므로 정수 변환 전에 그리드 범위로 클램프
+		auto ToTile = [InvTileSize](float Pixel, float GridSize)
+			{
+				return static_cast<int32>(std::floor(FMath::Clamp(Pixel, -1.0f, GridSize + 1.0f) * InvTileSize));
+			};
+
+		FLightTileRect Rect;
+		Rect.MinX = FMath::Max(0, ToTile((MinNdcX * 0.5f + 0.5f) * GridWidth - 0.5f, GridWidth));
+		Rect.MaxX = FMath::Min(FullRect.MaxX, ToTile((MaxNdcX * 0.5f + 0.5f) * GridWidth + 0.5f, GridWidth));
+		Rect.MinY = FMath::Max(0, ToTile((0.5f - MaxNdcY * 0.5f) * GridHeight - 0.5f, GridHeight));
+		Rect.MaxY = FMath::Min(FullRect.MaxY, ToTile((0.5f - MinNdcY * 0.5f) * GridHeight + 0.5f, GridHeight));
+		LightTileRects[LightIndex] = Rect;
+	}
+}
+
+void FTileLightCuller::CullTileRow(UINT TileY, const FMatrix& InvViewProj, float NearPlane, float FarPlane, FTileRowScratch& Scratch)
+{
+	// 1. 이 행에 걸치는 라이트만 후보로 모음 (원래 순서 유지)
+	Scratch.CenterX.Empty();
+	Scratch.CenterY.Empty();
+	Scratch.CenterZ.Empty();
+	Scratch.NegRadius.Empty();
+	Scratch.MinTileX.Empty();
+	Scratch.MaxTileX.Empty();
+	Scratch.IndexCodes.Empty();
+
+	const int32 Row = static_cast<int32>(TileY);
+	for (int32 LightIndex = 0; LightIndex < LightTileRects.Num(); ++LightIndex)
+	{
+		const FLightTileRect& Rect = LightTileRects[LightIndex];
+		if (Row < Rect.MinY || Row > Rect.MaxY)
+		{
+			continue;
+		}
+
+		Scratch.CenterX.Add(LightCenterX[LightIndex]);
+		Scratch.CenterY.Add(LightCenterY[LightIndex]);
+		Scratch.CenterZ.Add(LightCenterZ[LightIndex]);
+		Scratch.NegRadius.Add(-LightRadius[LightIndex]);
+		Scratch.MinTileX.Add(static_cast<float>(Rect.MinX));
+		Scratch.MaxTileX.Add(static_cast<float>(Rect.MaxX));
+		Scratch.IndexCodes.Add(LightIndexCodes[LightIndex]);
+	}
+
+	// 배치 경계까지 패딩 (타일 범위가 비어 있어 항상 탈락)
+	const int32 NumCandidates = Scratch.IndexCodes.Num();
+	const int32 PaddedCandidates = (NumCandidates + LightBatchSize - 1) / LightBatchSize * LightBatchSize;
+	for (int32 PadIndex = NumCandidates; PadIndex < PaddedCandidates; ++PadIndex)
+	{
+		Scratch.CenterX.Add(0.0f);
+		Scratch.CenterY.Add(0.0f);
+		Scratch.CenterZ.Add(0.0f);
+		Scratch.NegRadius.Add(std::numeric_limits<float>::max());
+		Scratch.MinTileX.Add(1.0f);
+		Scratch.MaxTileX.Add(-1.0f);
+	}
+
+	FTileRowStats RowStat = { UINT_MAX, 0, 0 };
+
+	// 2. 타일마다 후보 라이트를 8개씩 평면 테스트
+	for (UINT TileX = 0; TileX < TileCountX; ++TileX)
+	{
+		const UINT TileIndex = TileY * TileCountX + TileX;
+		uint32* TileData = TileLightIndices.GetData() + TileIndex * MaxLightsPerTile;
+		uint32 LightCount = 0;
+
+		if (NumCandidates > 0)
+		{
+			// 타일 프러스텀 생성
+			const FFrustum Frustum = CreateTileFrustum(TileX, TileY, InvViewProj, NearPlane, FarPlane);
+
+			// SphereIntersectsFrustum과 같은 평면 순서
+			const FPlane* Planes[6] = {
+				&Frustum.LeftFace,
+				&Frustum.RightFace,
+				&Frustum.TopFace,
+				&Frustum.BottomFace,
+				&Frustum.NearFace,
+				&Frustum.FarFace
+			};
+
+			__m256 PlaneNX[6], PlaneNY[6], PlaneNZ[6], PlaneD[6];
+			for (int32 PlaneIndex = 0; PlaneIndex < 6; ++PlaneIndex)
+			{
+				PlaneNX[PlaneIndex] = _mm256_set1_ps(Planes[PlaneIndex]->Normal.X);
+				PlaneNY[PlaneIndex] = _mm256_set1_ps(Planes[PlaneIndex]->Normal.Y);
+				PlaneNZ[PlaneIndex] = _mm256_set1_ps(Planes[PlaneIndex]->Normal.Z);
+				PlaneD[PlaneIndex] = _mm256_set1_ps(Planes[PlaneIndex]->Distance);
+			}
+			const __m256 TileXValue = _mm256_set1_ps(static_cast<float>(TileX));
+
+			for (int32 Base = 0; Base < PaddedCandidates && LightCount < MaxLightsPerTile - 1; Base += LightBatchSize)
+			{
+				// 화면 타일 범위 검사
+				const __m256 InRange = _mm256_and_ps(
+					_mm256_cmp_ps(_mm256_loadu_ps(&Scratch.MinTileX[Base]), TileXValue, _CMP_LE_OQ),
+					_mm256_cmp_ps(_mm256_loadu_ps(&Scratch.MaxTileX[Base]), TileXValue, _CMP_GE_OQ));
+				int32 Mask = _mm256_movemask_ps(InRange);
+				if (Mask == 0)
+				{
+					continue;
+				}
+
+				// 구-평면 테스트: Dot(N, C) + D < -R 이면 탈락 (SphereIntersectsFrustum과 동일한 연산 순서)
+				const __m256 CX = _mm256_loadu_ps(&Scratch.CenterX[Base]);
+				const __m256 CY = _mm256_loadu_ps(&Scratch.CenterY[Base]);
+				const __m256 CZ = _mm256_loadu_ps(&Scratch.CenterZ[Base]);
+				const __m256 NegR = _mm256_loadu_ps(&Scratch.NegRadius[Base]);
+				for (int32 PlaneIndex = 0; PlaneIndex < 6 && Mask != 0; ++PlaneIndex)
+				{
+					__m256 Dist = _mm256_add_ps(_mm256_mul_ps(PlaneNX[PlaneIndex], CX), _mm256_mul_ps(PlaneNY[PlaneIndex], CY));
+					Dist = _mm256_add_ps(Dist, _mm256_mul_ps(PlaneNZ[PlaneIndex], CZ));
+					Dist = _mm256_add_ps(Dist, PlaneD[PlaneIndex]);
+					Mask &= _mm256_movemask_ps(_mm256_cmp_ps(Dist, NegR, _CMP_NLT_UQ));
+				}
+
+				// 통과한 라이트를 원래 순서대로 기록
+				for (int32 Lane = 0; Lane < LightBatchSize && Mask != 0; ++Lane)
+				{
+					if ((Mask & (1 << Lane)) == 0)
+					{
+						continue;
+					}
+					Mask &= ~(1 << Lane);
+
+					if (LightCount >= MaxLightsPerTile - 1)
+					{
+						break;
+					}
+					TileData[1 + LightCount] = Scratch.IndexCodes[Base + Lane];
+					LightCount++;
+				}
+			}
+		}
+
+		// 첫 번째 요소에 라이트 개수 저장
+		TileData[0] = LightCount;
+
+		RowStat.MinLights = FMath::Min(RowStat.MinLights, LightCount);
+		RowStat.MaxLights = FMath::Max(RowStat.MaxLights, LightCount);
+		RowStat.LightsPassed += LightCount;
+	}
+
+	RowStats[TileY] = RowStat;
+}
+
+void FTileLightCuller::BuildTileLightListsReference(
+	const TArray<FPointLightInfo>& PointLights,
+	const TArray<FSpotLightInfo>& SpotLights,
+	const FMatrix& ViewMatrix,
+	const FMatrix& ProjMatrix,
+	float NearPlane,
+	float FarPlane,
+	UINT ViewportWidth,
+	UINT ViewportHeight)
+{
+	const uint64 StartCycles = FPlatformTime::Cycles64();
+
+	BeginTileCulling(PointLights, SpotLights, ViewportWidth, ViewportHeight);
 
 	// 버퍼 초기화 (모든 타일의 라이트 개수를 0으로)
-	memset(TileLightIndices.GetData(), 0, RequiredSize * sizeof(uint32));
+	memset(TileLightIndices.GetData(), 0, TileLightIndices.Num() * sizeof(uint32));
 
 	// Inverse View-Projection 행렬 계산
 	FMatrix InvViewProj = ProjMatrix.InversePerspectiveProjection() * ViewMatrix.InverseAffine();
@@ -66,7 +428,6 @@ void FTileLightCuller::CullLights(
 	// 각 타일에 대해 컬링 수행
 	Stats.MinLightsPerTile = UINT_MAX;
 	Stats.MaxLightsPerTile = 0;
-	uint32 TotalLightsAcrossAllTiles = 0;
 
 	for (UINT TileY = 0; TileY < TileCountY; ++TileY)
 	{
@@ -114,47 +475,13 @@ void FTileLightCuller::CullLights(
 			// 통계 업데이트
 			Stats.MinLightsPerTile = FMath::Min(Stats.MinLightsPerTile, LightCount);
 			Stats.MaxLightsPerTile = FMath::Max(Stats.MaxLightsPerTile, LightCount);
-			TotalLightsAcrossAllTiles += LightCount;
 		}
 	}
 
-	// 평균 계산
-	if (TotalTileCount > 0)
-	{
-		Stats.AvgLightsPerTile = static_cast<float>(TotalLightsAcrossAllTiles) / static_cast<float>(TotalTileCount);
-	}
-
-	// 컬링 효율성 계산
+	// 컬링 효율성/평균 계산
 	Stats.CalculateStats();
 
-	// GPU 버퍼 생성 또는 업데이트
-	if (!LightIndexBuffer)
-	{
-		// 버퍼 생성
-		HRESULT hr = RHI->CreateStructuredBuffer(
-			sizeof(uint32),
-			RequiredSize,
-			TileLightIndices.GetData(),
-			&LightIndexBuffer
-		);
-
-		if (SUCCEEDED(hr))
-		{
-			// SRV 생성
-			RHI->CreateStructuredBufferSRV(LightIndexBuffer, &LightIndexBufferSRV);
-		}
-
-		Stats.LightIndexBufferSizeBytes = RequiredSize * sizeof(uint32);
-	}
-	else
-	{
-		// 기존 버퍼 업데이트
-		RHI->UpdateStructuredBuffer(
-			LightIndexBuffer,
-			TileLightIndices.GetData(),
-			RequiredSize * sizeof(uint32)
-		);
-	}
+	Stats.CPUCullingTimeMS = static_cast<float>(FPlatformTime::ToMilliseconds(FPlatformTime::Cycles64() - StartCycles));
 }
 
 FFrustum FTileLightCuller::CreateTileFrustum(
@@ -162,7 +489,7 @@ FFrustum FTileLightCuller::CreateTileFrustum(
 	UINT TileY,
 	const FMatrix& InvViewProj,
 	float NearPlane,
-	float FarPlane)
+	float FarPlane) const
 {
 	FFrustum Frustum;
 
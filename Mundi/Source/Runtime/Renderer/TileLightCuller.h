@@ -27,12 +27,43 @@ public:
 		UINT ViewportHeight
 	);
 
+	// CPU 컬링 단계만 수행하고 GPU 버퍼는 건드리지 않음 (CullLights 내부 + 헤드리스 벤치마크용)
+	// 라이트 화면 범위를 한 번 계산한 뒤 타일 행을 워커에 나눠 8개 라이트 단위 SIMD 평면 테스트를 수행
+	void BuildTileLightLists(
+		const TArray<FPointLightInfo>& PointLights,
+		const TArray<FSpotLightInfo>& SpotLights,
+		const FMatrix& ViewMatrix,
+		const FMatrix& ProjMatrix,
+		float NearPlane,
+		float FarPlane,
+		UINT ViewportWidth,
+		UINT ViewportHeight
+	);
+
+	// 타일마다 모든 라이트를 스칼라로 테스트하는 기존 방식 (결과 검증/벤치마크 비교용)
+	void BuildTileLightListsReference(
+		const TArray<FPointLightInfo>& PointLights,
+		const TArray<FSpotLightInfo>& SpotLights,
+		const FMatrix& ViewMatrix,
+		const FMatrix& ProjMatrix,
+		float NearPlane,
+		float FarPlane,
+		UINT ViewportWidth,
+		UINT ViewportHeight
+	);
+
 	// 컬링 결과를 Structured Buffer에 업데이트하고 SRV 반환
 	ID3D11ShaderResourceView* GetLightIndexBufferSRV();
 
 	// 통계 정보 반환
 	const FTileCullingStats& GetStats() const { return Stats; }
 
+	// CPU 측 타일 라이트 인덱스 (레이아웃은 TileLightIndices 주석 참고)
+	const TArray<uint32>& GetTileLightIndices() const { return TileLightIndices; }
+
+	// 타일당 최대 라이트 개수 (보수적으로 설정, 첫 슬롯은 개수)
+	static constexpr UINT MaxLightsPerTile = 256;
+
 	// 리소스 해제
 	void Release();
 
@@ -44,8 +75,27 @@ private:
 		const FMatrix& InvViewProj,
 		float NearPlane,
 		float FarPlane
+	) const;
+
+	// 타일 그리드 계산 + 통계/인덱스 버퍼 초기화
+	void BeginTileCulling(
+		const TArray<FPointLightInfo>& PointLights,
+		const TArray<FSpotLightInfo>& SpotLights,
+		UINT ViewportWidth,
+		UINT ViewportHeight
+	);
+
+	// 라이트마다 화면 타일 범위와 클립 공간 깊이 범위를 한 번만 계산해 SoA로 저장
+	void PrepareLightBounds(
+		const TArray<FPointLightInfo>& PointLights,
+		const TArray<FSpotLightInfo>& SpotLights,
+		const FMatrix& ViewProj
 	);
 
+	// 타일 한 행을 컬링하고 행 통계를 기록 (워커 스레드에서 호출)
+	struct FTileRowScratch;
+	void CullTileRow(UINT TileY, const FMatrix& InvViewProj, float NearPlane, float FarPlane, FTileRowScratch& Scratch);
+
 	// 라이트가 타일 프러스텀과 교차하는지 테스트
 	bool TestPointLightAgainstFrustum(const FPointLightInfo& Light, const FFrustum& Frustum, const FMatrix& ViewMatrix);
 	bool TestSpotLightAgainstFrustum(const FSpotLightInfo& Light, const FFrustum& Frustum, const FMatrix& ViewMatrix);
@@ -71,14 +121,36 @@ private:
 	UINT TileCountY;        // 세로 타일 개수
 	UINT TotalTileCount;    // 전체 타일 개수
 
-	// 타일당 최대 라이트 개수 (보수적으로 설정)
-	static constexpr UINT MaxLightsPerTile = 256;
-
 	// 타일별 라이트 인덱스 저장
 	// [TileIndex * MaxLightsPerTile] 위치에 라이트 개수 저장
 	// [TileIndex * MaxLightsPerTile + 1 ~ ...] 위치에 라이트 인덱스 저장
 	TArray<uint32> TileLightIndices;
 
+	// SIMD 평면 테스트 한 번에 처리하는 라이트 수 (AVX 8-wide)
+	static constexpr int32 LightBatchSize = 8;
+
+	// 라이트별 컬링 입력 (PrepareLightBounds 결과, Point → Spot 순서)
+	// 타일 테스트에 쓰는 구 중심/반지름과 라이트가 걸칠 수 있는 타일 범위
+	struct FLightTileRect
+	{
+		int32 MinX, MinY, MaxX, MaxY;
+	};
+	TArray<float> LightCenterX;
+	TArray<float> LightCenterY;
+	TArray<float> LightCenterZ;
+	TArray<float> LightRadius;
+	TArray<uint32> LightIndexCodes;     // TileLightIndices에 기록할 값 (상위 16비트: 타입, 하위 16비트: 인덱스)
+	TArray<FLightTileRect> LightTileRects;
+
+	// 행별 통계 (워커가 각자 기록하고 메인 스레드에서 합산)
+	struct FTileRowStats
+	{
+		uint32 MinLights;
+		uint32 MaxLights;
+		uint32 LightsPassed;
+	};
+	TArray<FTileRowStats> RowStats;
+
 	// GPU 리소스
 	ID3D11Buffer* LightIndexBuffer;
 	ID3D11ShaderResourceView* LightIndexBufferSRV;
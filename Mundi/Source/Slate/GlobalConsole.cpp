@@ -1,8 +1,17 @@
 ﻿#include "pch.h"
 #include "Widgets/ConsoleWidget.h"
+#include "TaskScheduler.h"
+#include <mutex>
 
 IMPLEMENT_CLASS(UGlobalConsole)
 
+namespace
+{
+    // 워커 스레드에서 남긴 로그 (콘솔 위젯은 게임 스레드 전용이라 여기 모았다가 넘김)
+    std::mutex GPendingLogMutex;
+    TArray<FString> GPendingLogs;
+}
+
 UConsoleWidget* UGlobalConsole::ConsoleWidget = nullptr;
 
 void UGlobalConsole::Initialize()
@@ -46,6 +55,17 @@ void UGlobalConsole::Log(const char* fmt, ...)
 void UGlobalConsole::LogV(const char* fmt, va_list args)
 {
 #ifdef _EDITOR
+    if (FTaskScheduler::IsInWorkerThread())
+    {
+        char tmp[1024];
+        vsnprintf_s(tmp, _countof(tmp), _TRUNCATE, fmt, args);
+        std::lock_guard<std::mutex> Lock(GPendingLogMutex);
+        GPendingLogs.Add(tmp);
+        return;
+    }
+
+    FlushPendingLogs();
+
     if (ConsoleWidget)
     {
         ConsoleWidget->VAddLog(fmt, args);
@@ -62,6 +82,35 @@ void UGlobalConsole::LogV(const char* fmt, va_list args)
 #endif
 }
 
+void UGlobalConsole::FlushPendingLogs()
+{
+#ifdef _EDITOR
+    TArray<FString> Logs;
+    {
+        std::lock_guard<std::mutex> Lock(GPendingLogMutex);
+        if (GPendingLogs.IsEmpty())
+        {
+            return;
+        }
+        Logs.swap(GPendingLogs);
+    }
+
+    for (const FString& Line : Logs)
+    {
+        if (ConsoleWidget)
+        {
+            ConsoleWidget->AddLog("%s", Line.c_str());
+        }
+        else
+        {
+            OutputDebugStringA("[No Console] ");
+            OutputDebugStringA(Line.c_str());
+            OutputDebugStringA("\n");
+        }
+    }
+#endif
+}
+
 // Global C functions for compatibility
 extern "C" void ConsoleLog(const char* fmt, ...)
 {
@@ -25,6 +25,9 @@ public:
     static void Log(const char* fmt, ...);
     static void LogV(const char* fmt, va_list args);
 
+    // 워커 스레드에서 쌓인 로그를 콘솔로 옮김 (게임 스레드에서 호출, 게임 스레드 로그 전에 자동 호출됨)
+    static void FlushPendingLogs();
+
 private:
     static UConsoleWidget* ConsoleWidget;
 };
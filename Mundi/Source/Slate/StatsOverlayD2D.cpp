@@ -14,6 +14,7 @@
 #include "LightStats.h"
 #include "ShadowStats.h"
 #include "SkinningStats.h"
+#include "OcclusionStats.h"
 #include "SkinnedMeshComponent.h"
 
 #pragma comment(lib, "d2d1")
@@ -165,7 +166,7 @@ static void DrawTextBlock(
 
 void UStatsOverlayD2D::Draw()
 {
-	if (!bInitialized || (!bShowFPS && !bShowMemory && !bShowPicking && !bShowDecal && !bShowTileCulling && !bShowLights && !bShowShadow && !bShowSkinning) || !SwapChain)
+	if (!bInitialized || (!bShowFPS && !bShowMemory && !bShowPicking && !bShowDecal && !bShowTileCulling && !bShowLights && !bShowShadow && !bShowSkinning && !bShowOcclusion && !bShowStreaming) || !SwapChain)
 		return;
 
 	// D2D 리소스 초기화 (최초 1회만 실행)
@@ -243,18 +244,32 @@ void UStatsOverlayD2D::Draw()
 
 	if (bShowMemory)
 	{
-		double Mb = static_cast<double>(FMemoryManager::TotalAllocationBytes) / (1024.0 * 1024.0);
+		const double Mb = static_cast<double>(FMemoryManager::GetTotalAllocationBytes()) / (1024.0 * 1024.0);
+		const double PoolMb = static_cast<double>(FMemoryManager::GetPoolReservedBytes()) / (1024.0 * 1024.0);
 
-		wchar_t Buf[128];
-		swprintf_s(Buf, L"Memory: %.1f MB\nAllocs: %u", Mb, FMemoryManager::TotalAllocationCount);
+		wchar_t Buf[512];
+		swprintf_s(Buf, L"Memory: %.1f MB\nAllocs: %lld\nPool pages: %.1f MB",
+			Mb, FMemoryManager::GetTotalAllocationCount(), PoolMb);
+
+		// 태그별 (현재 개수 / KB). Frame은 이번 프레임 선형 할당 사용량
+		for (uint8 TagIndex = 0; TagIndex < static_cast<uint8>(EMemoryTag::Count); ++TagIndex)
+		{
+			const EMemoryTag Tag = static_cast<EMemoryTag>(TagIndex);
+			const FMemoryTagStats TagStats = FMemoryManager::GetTagStats(Tag);
+			wchar_t Line[96];
+			swprintf_s(Line, L"\n%hs: %lld (%.0f KB)", GetMemoryTagName(Tag), TagStats.LiveCount,
+				static_cast<double>(TagStats.LiveBytes) / 1024.0);
+			wcscat_s(Buf, Line);
+		}
 
-		D2D1_RECT_F Rc = D2D1::RectF(Margin, NextY, Margin + PanelWidth, NextY + PanelHeight);
+		const float MemoryPanelHeight = 8.0f + 20.0f * (3 + static_cast<uint8>(EMemoryTag::Count));
+		D2D1_RECT_F Rc = D2D1::RectF(Margin, NextY, Margin + PanelWidth, NextY + MemoryPanelHeight);
 		DrawTextBlock(
 			D2dCtx, CachedBrush, TextFormat, Buf, Rc,
 			D2D1::ColorF(0, 0, 0, 0.6f),
 			D2D1::ColorF(D2D1::ColorF::LightGreen));
 
-		NextY += PanelHeight + Space;
+		NextY += MemoryPanelHeight + Space;
 	}
 
 	if (bShowDecal)
@@ -296,7 +311,7 @@ void UStatsOverlayD2D::Draw()
 
 		// 2. 출력할 문자열 버퍼를 만듭니다.
 		wchar_t Buf[512];
-		swprintf_s(Buf, L"[Tile Culling Stats]\nTiles: %u x %u (%u)\nLights: %u (P:%u S:%u)\nMin/Avg/Max: %u / %.1f / %u\nCulling Eff: %.1f%%\nBuffer: %u KB",
+		swprintf_s(Buf, L"[Tile Culling Stats]\nTiles: %u x %u (%u)\nLights: %u (P:%u S:%u)\nMin/Avg/Max: %u / %.1f / %u\nCulling Eff: %.1f%% (Off-screen: %u)\nCPU: %.3f ms\nBuffer: %u KB",
 			TileStats.TileCountX,
 			TileStats.TileCountY,
 			TileStats.TotalTileCount,
@@ -307,10 +322,29 @@ void UStatsOverlayD2D::Draw()
 			TileStats.AvgLightsPerTile,
 			TileStats.MaxLightsPerTile,
 			TileStats.CullingEfficiency,
+			TileStats.LightsOutsideView,
+			TileStats.CPUCullingTimeMS,
 			TileStats.LightIndexBufferSizeBytes / 1024);
 
+		// 클러스터 모드: 그리드 차원과 클러스터 점유 분포를 덧붙입니다.
+		float tilePanelHeight = 180.0f;
+		if (TileStats.bClustered)
+		{
+			const uint32 TotalClusters = FMath::Max(TileStats.TotalTileCount, 1u);
+			const uint32* Histogram = TileStats.ClusterOccupancyHistogram;
+			wchar_t ClusterBuf[256];
+			swprintf_s(ClusterBuf, L"\n[Clusters] %u x %u x %u\nOccupied: %u (%.1f%%)\n0:%u 1-2:%u 3-4:%u 5-8:%u 9-16:%u 17+:%u",
+				TileStats.TileCountX,
+				TileStats.TileCountY,
+				TileStats.ClusterSliceCount,
+				TileStats.OccupiedClusterCount,
+				100.0f * static_cast<float>(TileStats.OccupiedClusterCount) / static_cast<float>(TotalClusters),
+				Histogram[0], Histogram[1], Histogram[2], Histogram[3], Histogram[4], Histogram[5]);
+			wcscat_s(Buf, ClusterBuf);
+			tilePanelHeight += 80.0f;
+		}
+
 		// 3. 텍스트를 여러 줄 표시해야 하므로 패널 높이를 늘립니다.
-		const float tilePanelHeight = 160.0f;
 		D2D1_RECT_F rc = D2D1::RectF(Margin, NextY, Margin + PanelWidth, NextY + tilePanelHeight);
 
 		// 4. DrawTextBlock 함수를 호출하여 화면에 그립니다. 색상은 구분을 위해 cyan으로 설정합니다.
@@ -472,6 +506,95 @@ void UStatsOverlayD2D::Draw()
 		NextY += gpuPanelHeight + Space;
 	}
 
+	if (bShowOcclusion)
+	{
+		const FOcclusionStats& OcclusionStats = FOcclusionStatManager::GetInstance().GetStats();
+
+		wchar_t Buf[512];
+		swprintf_s(Buf,
+			L"[Occlusion Culling]\n"
+			L"Depth Buffer: %u x %u\n"
+			L"Occluders: %u (%u tris)\n"
+			L"Rasterized Tris: %u\n"
+			L"Tested: %u\n"
+			L"Occluded: %u (%.1f%%)\n"
+			L"Off-screen: %u\n"
+			L"Raster: %.3f ms\n"
+			L"HZB: %.3f ms\n"
+			L"Test: %.3f ms\n"
+			L"Temporal: %ls\n"
+			L"  Phase1 Occluded: %u\n"
+			L"  Rescued: %u (FN %.1f%%)\n"
+			L"  Skipped Occluders: %u\n"
+			L"  Reproject: %.3f ms",
+			OcclusionStats.BufferWidth,
+			OcclusionStats.BufferHeight,
+			OcclusionStats.OccluderCount,
+			OcclusionStats.OccluderTriangles,
+			OcclusionStats.RasterizedTriangles,
+			OcclusionStats.TestedCount,
+			OcclusionStats.CulledCount,
+			OcclusionStats.GetCulledPercent(),
+			OcclusionStats.OutsideViewCount,
+			OcclusionStats.RasterizeTimeMS,
+			OcclusionStats.HZBTimeMS,
+			OcclusionStats.TestTimeMS,
+			OcclusionStats.bTemporal ? L"On" : L"Off",
+			OcclusionStats.Phase1CulledCount,
+			OcclusionStats.RescuedCount,
+			OcclusionStats.GetFalseNegativePercent(),
+			OcclusionStats.SkippedOccluderCount,
+			OcclusionStats.ReprojectTimeMS);
+
+		const float occlusionPanelHeight = 300.0f;
+		D2D1_RECT_F rc = D2D1::RectF(Margin, NextY, Margin + PanelWidth, NextY + occlusionPanelHeight);
+		DrawTextBlock(
+			D2dCtx, CachedBrush, TextFormat, Buf, rc,
+			D2D1::ColorF(0, 0, 0, 0.6f),
+			D2D1::ColorF(D2D1::ColorF::Orange));
+
+		NextY += occlusionPanelHeight + Space;
+	}
+
+	if (bShowStreaming)
+	{
+		const FAsyncLoadStats& StreamingStats = RESOURCE.GetAsyncLoadStats();
+
+		wchar_t Buf[512];
+		swprintf_s(Buf,
+			L"[Async Loading]\n"
+			L"Queued: %u\n"
+			L"In Flight: %u\n"
+			L"Finalized: %u\n"
+			L"Stall: %.3f ms (max %.3f)\n"
+			L"  Issue: %.3f ms\n"
+			L"  Finalize: %.3f ms\n"
+			L"Completed: %u\n"
+			L"Failed: %u\n"
+			L"Cancelled: %u\n"
+			L"Coalesced: %u",
+			StreamingStats.QueuedJobs,
+			StreamingStats.InFlightJobs,
+			StreamingStats.FinalizedJobs,
+			StreamingStats.GetStallMS(),
+			StreamingStats.MaxStallMS,
+			StreamingStats.IssueTimeMS,
+			StreamingStats.FinalizeTimeMS,
+			StreamingStats.CompletedRequests,
+			StreamingStats.FailedRequests,
+			StreamingStats.CancelledRequests,
+			StreamingStats.CoalescedRequests);
+
+		const float streamingPanelHeight = 220.0f;
+		D2D1_RECT_F rc = D2D1::RectF(Margin, NextY, Margin + PanelWidth, NextY + streamingPanelHeight);
+		DrawTextBlock(
+			D2dCtx, CachedBrush, TextFormat, Buf, rc,
+			D2D1::ColorF(0, 0, 0, 0.6f),
+			D2D1::ColorF(D2D1::ColorF::LightSkyBlue));
+
+		NextY += streamingPanelHeight + Space;
+	}
+
 	D2dCtx->EndDraw();
 	D2dCtx->SetTarget(nullptr);
 
@@ -552,6 +675,26 @@ void UStatsOverlayD2D::ToggleShadow()
 	bShowShadow = !bShowShadow;
 }
 
+void UStatsOverlayD2D::SetShowOcclusion(bool b)
+{
+	bShowOcclusion = b;
+}
+
+void UStatsOverlayD2D::ToggleOcclusion()
+{
+	bShowOcclusion = !bShowOcclusion;
+}
+
+void UStatsOverlayD2D::SetShowStreaming(bool b)
+{
+	bShowStreaming = b;
+}
+
+void UStatsOverlayD2D::ToggleStreaming()
+{
+	bShowStreaming = !bShowStreaming;
+}
+
 void UStatsOverlayD2D::SetShowSkinning(bool b)
 {
 	bShowSkinning = b;
@@ -20,6 +20,8 @@ public:
     void SetShowLights(bool b);
     void SetShowShadow(bool b);
     void SetShowSkinning(bool b);
+    void SetShowOcclusion(bool b);
+    void SetShowStreaming(bool b);
     void ToggleFPS();
     void ToggleMemory();
     void TogglePicking();
@@ -28,6 +30,8 @@ public:
     void ToggleLights();
     void ToggleShadow();
     void ToggleSkinning();
+    void ToggleOcclusion();
+    void ToggleStreaming();
     bool IsFPSVisible() const { return bShowFPS; }
     bool IsMemoryVisible() const { return bShowMemory; }
     bool IsPickingVisible() const { return bShowPicking; }
@@ -36,6 +40,8 @@ public:
     bool IsLightsVisible() const { return bShowLights; }
     bool IsShadowVisible() const { return bShowShadow; }
     bool IsSkinningVisible() const { return bShowSkinning; }
+    bool IsOcclusionVisible() const { return bShowOcclusion; }
+    bool IsStreamingVisible() const { return bShowStreaming; }
 
 private:
     UStatsOverlayD2D() = default;
@@ -56,6 +62,8 @@ private:
     bool bShowShadow = false;
     bool bShowLights = false;
     bool bShowSkinning = false;
+    bool bShowOcclusion = false;
+    bool bShowStreaming = false;
 
     ID3D11Device* D3DDevice = nullptr;
     ID3D11DeviceContext* D3DContext = nullptr;
@@ -98,6 +98,10 @@ void FThumbnailManager::ClearCache()
 	// 캐시된 썸네일 모두 해제 (Manager가 소유한 것만)
 	for (auto& Pair : ThumbnailCache)
 	{
+		if (Pair.second.PinnedResource)
+		{
+			Pair.second.PinnedResource->ReleaseResidencyRef();
+		}
 		if (Pair.second.bOwnedByManager)
 		{
 			if (Pair.second.SRV)
@@ -146,6 +150,10 @@ FThumbnailData* FThumbnailManager::CreateImageThumbnail(const std::string& FileP
 	Data.Height = Texture->GetHeight();
 	Data.bOwnedByManager = false;  // ResourceManager가 소유, 우리는 Release 안 함
 
+	// SRV를 캐싱하므로 상주 관리가 텍스처를 축출하지 않도록 고정
+	Texture->AddResidencyRef();
+	Data.PinnedResource = Texture;
+
 	ThumbnailCache[FilePath] = Data;
 	return &ThumbnailCache[FilePath];
 }
@@ -3,6 +3,8 @@
 #include <unordered_map>
 #include <d3d11.h>
 
+class UResourceBase;
+
 /**
  * @brief 썸네일 데이터 구조체
  */
@@ -13,6 +15,7 @@ struct FThumbnailData
 	int Width = 0;
 	int Height = 0;
 	bool bOwnedByManager = true;  // true면 Manager가 Release 책임, false면 외부(ResourceManager)가 관리
+	UResourceBase* PinnedResource = nullptr;  // SRV를 들고 있는 동안 축출되지 않도록 고정한 리소스
 };
 
 /**
@@ -5,6 +5,9 @@
 #include "StatsOverlayD2D.h"
 #include "SlateManager.h"
 #include "SkinnedMeshComponent.h"
+#include "EngineBenchmarks.h"
+#include "AsyncLoadTest.h"
+#include "ResidencyStressTest.h"
 #include <windows.h>
 #include <cstdarg>
 #include <cctype>
@@ -56,6 +59,11 @@ void UConsoleWidget::Initialize()
 	HelpCommandList.Add("STAT NONE");
 	HelpCommandList.Add("STAT LIGHT");
 	HelpCommandList.Add("STAT SHADOW");
+	HelpCommandList.Add("STAT OCCLUSION");
+	HelpCommandList.Add("STAT STREAMING");
+	HelpCommandList.Add("ASYNCLOAD TEST");
+	HelpCommandList.Add("RESIDENCY");
+	HelpCommandList.Add("BENCH");
 
 	// Add welcome messages
 	AddLog("=== Console Widget Initialized ===");
@@ -357,6 +365,8 @@ void UConsoleWidget::ExecCommand(const char* command_line)
 		AddLog("- STAT PICKING");
 		AddLog("- STAT DECAL");
 		AddLog("- STAT SKINNING");
+		AddLog("- STAT OCCLUSION");
+		AddLog("- STAT STREAMING");
 		AddLog("- STAT ALL");
 		AddLog("- STAT LIGHT");
 		AddLog("- STAT NONE");
@@ -400,6 +410,16 @@ void UConsoleWidget::ExecCommand(const char* command_line)
 		UStatsOverlayD2D::Get().ToggleSkinning();
 		AddLog("STAT SKINNING TOGGLED");
 	}
+	else if (Stricmp(command_line, "STAT OCCLUSION") == 0)
+	{
+		UStatsOverlayD2D::Get().ToggleOcclusion();
+		AddLog("STAT OCCLUSION TOGGLED");
+	}
+	else if (Stricmp(command_line, "STAT STREAMING") == 0)
+	{
+		UStatsOverlayD2D::Get().ToggleStreaming();
+		AddLog("STAT STREAMING TOGGLED");
+	}
 	else if (Stricmp(command_line, "STAT NONE") == 0)
 	{
 		UStatsOverlayD2D::Get().SetShowFPS(false);
@@ -408,6 +428,8 @@ void UConsoleWidget::ExecCommand(const char* command_line)
 		UStatsOverlayD2D::Get().SetShowDecal(false);
 		UStatsOverlayD2D::Get().SetShowTileCulling(false);
 		UStatsOverlayD2D::Get().SetShowSkinning(false);
+		UStatsOverlayD2D::Get().SetShowOcclusion(false);
+		UStatsOverlayD2D::Get().SetShowStreaming(false);
 		AddLog("STAT: OFF");
 	}
 	else if (Strnicmp(command_line, "SKINNING GPU", 12) == 0)
@@ -462,6 +484,72 @@ void UConsoleWidget::ExecCommand(const char* command_line)
 			AddLog("ERROR: Could not find any World");
 		}
 	}
+	else if (Stricmp(command_line, "ASYNCLOAD TEST") == 0)
+	{
+		FAsyncLoadTest::Start();
+	}
+	else if (Stricmp(command_line, "RESIDENCY") == 0)
+	{
+		AddLog("RESIDENCY commands:");
+		AddLog("- RESIDENCY REPORT [topN]");
+		AddLog("- RESIDENCY BUDGET <cpuMB> <gpuMB>");
+		AddLog("- RESIDENCY TRIM");
+		AddLog("- RESIDENCY STRESS [cycles] [budgetMB]");
+		AddLog("- RESIDENCY MESHCPU");
+	}
+	else if (Strnicmp(command_line, "RESIDENCY REPORT", 16) == 0)
+	{
+		int TopN = 10;
+		sscanf_s(command_line + 16, "%d", &TopN);
+		RESOURCE.LogResidencyReport(TopN);
+	}
+	else if (Strnicmp(command_line, "RESIDENCY BUDGET", 16) == 0)
+	{
+		unsigned int CPUBudgetMB = 0;
+		unsigned int GPUBudgetMB = 0;
+		if (sscanf_s(command_line + 16, "%u %u", &CPUBudgetMB, &GPUBudgetMB) == 2)
+		{
+			RESOURCE.SetResidencyBudgetMB(CPUBudgetMB, GPUBudgetMB);
+			EditorINI["ResidencyCPUBudgetMB"] = std::to_string(CPUBudgetMB);
+			EditorINI["ResidencyGPUBudgetMB"] = std::to_string(GPUBudgetMB);
+			RESOURCE.FlushResidency();
+			AddLog("Residency budget: CPU %u MB, GPU %u MB", CPUBudgetMB, GPUBudgetMB);
+		}
+		else
+		{
+			AddLog("Usage: RESIDENCY BUDGET <cpuMB> <gpuMB>");
+		}
+	}
+	else if (Stricmp(command_line, "RESIDENCY TRIM") == 0)
+	{
+		const uint32 EvictionsBefore = RESOURCE.GetResidencyStats().TotalEvictions;
+		RESOURCE.FlushResidency(true);
+		AddLog("Evicted %u unreferenced resources", RESOURCE.GetResidencyStats().TotalEvictions - EvictionsBefore);
+	}
+	else if (Strnicmp(command_line, "RESIDENCY STRESS", 16) == 0)
+	{
+		int Cycles = 3;
+		unsigned int BudgetMB = 0;
+		sscanf_s(command_line + 16, "%d %u", &Cycles, &BudgetMB);
+		FResidencyStressTest::Start(Cycles, BudgetMB);
+	}
+	else if (Stricmp(command_line, "RESIDENCY MESHCPU") == 0)
+	{
+		FResidencyStressTest::MeasureMeshCPUResidency();
+	}
+	else if (Stricmp(command_line, "BENCH") == 0)
+	{
+		AddLog("BENCH commands:");
+		for (const FString& Name : EngineBenchmarks::GetBenchmarkNames())
+			AddLog("- BENCH %s", Name.c_str());
+	}
+	else if (Strnicmp(command_line, "BENCH ", 6) == 0)
+	{
+		if (!EngineBenchmarks::Run(FString(command_line + 6)))
+		{
+			AddLog("Unknown benchmark: '%s'", command_line + 6);
+		}
+	}
 	else
 	{
 		AddLog("Unknown command: '%s'", command_line);
@@ -2,6 +2,7 @@
 #include "MainToolbarWidget.h"
 #include "ImGui/imgui.h"
 #include "Level.h"
+#include "LevelBinarySerializer.h"
 #include "JsonSerializer.h"
 #include "SelectionManager.h"
 #include "CameraActor.h"
@@ -205,10 +206,10 @@ void UMainToolbarWidget::RenderSceneButtons()
     {
         if (ImGui::ImageButton("##SaveBtn", (void*)IconSave->GetShaderResourceView(), IconSizeVec))
         {
-            PendingCommand = EToolbarCommand::SaveScene;
+            PendingCommand = ImGui::GetIO().KeyShift ? EToolbarCommand::ExportSceneJson : EToolbarCommand::SaveScene;
         }
         if (ImGui::IsItemHovered())
-            ImGui::SetTooltip("현재 씬을 저장합니다 [Ctrl+S]");
+            ImGui::SetTooltip("현재 씬을 저장합니다 [Ctrl+S]\nShift+클릭: JSON으로 내보내기 [Ctrl+Shift+S]");
     }
 
     ImGui::SameLine();
@@ -563,7 +564,7 @@ void UMainToolbarWidget::OnNewScene()
     }
 }
 
-void UMainToolbarWidget::OnSaveScene()
+void UMainToolbarWidget::OnSaveScene(bool bExportJson)
 {
     const FWideString BaseDir = UTF8ToWide(GDataDir) + L"/Scenes";
     const FWideString Extension = L".scene";
@@ -591,9 +592,24 @@ void UMainToolbarWidget::OnSaveScene()
             return;
         }
 
-        JSON LevelJson;
-        CurrentWorld->GetLevel()->Serialize(false, LevelJson);
-        bool bSuccess = FJsonSerializer::SaveJsonToFile(LevelJson, SelectedPath);
+        bool bSuccess = false;
+        if (bExportJson)
+        {
+            // JSON은 내보내기/디버그용 (로드 쪽은 두 포맷 모두 읽음)
+            JSON LevelJson;
+            CurrentWorld->GetLevel()->Serialize(false, LevelJson);
+            bSuccess = FJsonSerializer::SaveJsonToFile(LevelJson, SelectedPath);
+        }
+        else
+        {
+            FLevelFileStats Stats;
+            bSuccess = FLevelBinarySerializer::SaveLevel(CurrentWorld->GetLevel(), SelectedPath, &Stats);
+            if (bSuccess)
+            {
+                UE_LOG("MainToolbar: Binary level %u actors / %u components, %.1f KB, %.2f ms",
+                    Stats.NumActors, Stats.NumComponents, Stats.FileBytes / 1024.0, Stats.Milliseconds);
+            }
+        }
 
         if (bSuccess)
         {
@@ -636,19 +652,13 @@ void UMainToolbarWidget::OnLoadScene()
         UUIManager::GetInstance().ClearTransformWidgetSelection();
         GWorld->GetSelectionManager()->ClearSelection();
 
-        std::unique_ptr<ULevel> NewLevel = ULevelService::CreateDefaultLevel();
-        JSON LevelJsonData;
-        if (FJsonSerializer::LoadJsonFromFile(LevelJsonData, SelectedPath))
-        {
-            NewLevel->Serialize(true, LevelJsonData);
-            EditorINI["LastUsedLevel"] = WideToUTF8(fs::relative(SelectedPath));
-        }
-        else
+        // 바이너리/JSON 포맷은 LoadLevelFromFile이 파일 매직으로 구분
+        if (!CurrentWorld->LoadLevelFromFile(SelectedPath.wstring()))
         {
             UE_LOG("[error] MainToolbar: Failed To Load Level From: %s", SelectedPath.generic_u8string().c_str());
             return;
         }
-        CurrentWorld->SetLevel(std::move(NewLevel));
+        EditorINI["LastUsedLevel"] = WideToUTF8(fs::relative(SelectedPath));
 
         UE_LOG("MainToolbar: Scene loaded successfully: %s", SelectedPath.generic_u8string().c_str());
     }
@@ -796,6 +806,10 @@ void UMainToolbarWidget::ProcessPendingCommands()
         OnSaveScene();
         break;
 
+    case EToolbarCommand::ExportSceneJson:
+        OnSaveScene(true);
+        break;
+
     case EToolbarCommand::LoadScene:
         OnLoadScene();
         break;
@@ -898,10 +912,10 @@ void UMainToolbarWidget::HandleKeyboardShortcuts()
         PendingCommand = EToolbarCommand::NewScene;
     }
 
-    // Ctrl+S: Save Scene
+    // Ctrl+S: Save Scene, Ctrl+Shift+S: Export Scene as JSON
     if (io.KeyCtrl && ImGui::IsKeyPressed(ImGuiKey_S, false))
     {
-        PendingCommand = EToolbarCommand::SaveScene;
+        PendingCommand = io.KeyShift ? EToolbarCommand::ExportSceneJson : EToolbarCommand::SaveScene;
     }
 
     // Ctrl+O: Open/Load Scene
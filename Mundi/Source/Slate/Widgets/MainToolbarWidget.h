@@ -33,7 +33,7 @@ private:
 
     // 이벤트 핸들러
     void OnNewScene();
-    void OnSaveScene();
+    void OnSaveScene(bool bExportJson = false);   // 기본은 바이너리 레벨, bExportJson이면 JSON 내보내기
     void OnLoadScene();
 
     // 키보드 입력 처리
@@ -49,6 +49,7 @@ private:
         None,
         NewScene,
         SaveScene,
+        ExportSceneJson,
         LoadScene,
         SpawnActor,
         StartPIE,
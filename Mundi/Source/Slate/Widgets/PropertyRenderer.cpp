@@ -842,7 +842,7 @@ bool UPropertyRenderer::RenderScriptFileProperty(const FProperty& Property, void
 		if (ImGui::Button("스크립트 생성"))
 		{
 			// 1. 경로 및 확장자 설정
-			const FString* ExtPtr = Property.Metadata.Find(FName("FileExtension"));
+			const FString* ExtPtr = Property.Metadata.Find(FName(FNameLiteral("FileExtension")));
 			FString Extension = (ExtPtr) ? *ExtPtr : ".lua";
 			if (Extension[0] != '.') Extension = "." + Extension;
 
@@ -1884,6 +1884,44 @@ void SViewportWindow::RenderShowFlagDropdownMenu()
 			// 현재 설정값 표시
 			ImGui::Text("현재 타일 크기: %d x %d", RenderSettings.GetTileSize(), RenderSettings.GetTileSize());
 
+			ImGui::Separator();
+
+			// 컬링 방식 (2D 타일 / 3D 클러스터)
+			int cullingModeInt = static_cast<int>(RenderSettings.GetLightCullingMode());
+			const int oldCullingModeInt = cullingModeInt;
+			ImGui::RadioButton(" 2D 타일", &cullingModeInt, static_cast<int>(ELightCullingMode::Tiled));
+			if (ImGui::IsItemHovered())
+			{
+				ImGui::SetTooltip("화면 타일마다 near~far 전체 범위로 라이트를 모읍니다.");
+			}
+			ImGui::SameLine();
+			ImGui::RadioButton(" 3D 클러스터", &cullingModeInt, static_cast<int>(ELightCullingMode::Clustered));
+			if (ImGui::IsItemHovered())
+			{
+				ImGui::SetTooltip("화면 타일을 로그 깊이 슬라이스로 나눠 깊이 방향으로도 라이트를 컬링합니다.\n(원근 투영에서만 사용, 직교 투영은 2D 타일로 대체)");
+			}
+			if (cullingModeInt != oldCullingModeInt)
+			{
+				RenderSettings.SetLightCullingMode(static_cast<ELightCullingMode>(cullingModeInt));
+			}
+
+			if (RenderSettings.GetLightCullingMode() == ELightCullingMode::Clustered)
+			{
+				int clusterTileSize = static_cast<int>(RenderSettings.GetClusterTileSize());
+				ImGui::SetNextItemWidth(100);
+				if (ImGui::InputInt("클러스터 타일 크기##ClusterTileSize", &clusterTileSize, 8, 32))
+				{
+					RenderSettings.SetClusterTileSize(static_cast<uint32>(FMath::Clamp(clusterTileSize, 8, 256)));
+				}
+
+				int sliceCount = static_cast<int>(RenderSettings.GetClusterSliceCount());
+				ImGui::SetNextItemWidth(100);
+				if (ImGui::InputInt("깊이 슬라이스 수##ClusterSlices", &sliceCount, 1, 8))
+				{
+					RenderSettings.SetClusterSliceCount(static_cast<uint32>(FMath::Clamp(sliceCount, 1, 64)));
+				}
+			}
+
 			ImGui::EndMenu();
 		}
 		if (ImGui::IsItemHovered())
@@ -1970,6 +2008,78 @@ void SViewportWindow::RenderShowFlagDropdownMenu()
 			ImGui::SetTooltip("GPU 스키닝을 사용합니다. (비활성화 시 CPU 스키닝)");
 		}
 
+		// CPU Occlusion Culling
+		bool bOcclusionCulling = RenderSettings.IsShowFlagEnabled(EEngineShowFlags::SF_OcclusionCulling);
+		if (ImGui::Checkbox("##OcclusionCulling", &bOcclusionCulling))
+		{
+			RenderSettings.ToggleShowFlag(EEngineShowFlags::SF_OcclusionCulling);
+		}
+		ImGui::SameLine();
+		if (ImGui::BeginMenu(" 오클루전 컬링"))
+		{
+			ImGui::TextColored(ImVec4(0.6f, 0.6f, 0.6f, 1.0f), "CPU 소프트웨어 오클루전 컬링");
+			ImGui::Separator();
+
+			int BufferWidth = static_cast<int>(RenderSettings.GetOcclusionBufferWidth());
+			if (ImGui::SliderInt("깊이 버퍼 너비", &BufferWidth, 128, 1024))
+			{
+				RenderSettings.SetOcclusionBufferWidth(static_cast<uint32>(BufferWidth));
+			}
+
+			int TriangleBudget = static_cast<int>(RenderSettings.GetOccluderTriangleBudget());
+			if (ImGui::InputInt("오클루더 삼각형 예산", &TriangleBudget, 1024, 8192))
+			{
+				RenderSettings.SetOccluderTriangleBudget(static_cast<uint32>(std::max(0, TriangleBudget)));
+			}
+
+			int MaxPerOccluder = static_cast<int>(RenderSettings.GetMaxTrianglesPerOccluder());
+			if (ImGui::InputInt("오클루더당 최대 삼각형", &MaxPerOccluder, 256, 4096))
+			{
+				RenderSettings.SetMaxTrianglesPerOccluder(static_cast<uint32>(std::max(0, MaxPerOccluder)));
+			}
+
+			bool bTemporalOcclusion = RenderSettings.IsTemporalOcclusionEnabled();
+			if (ImGui::Checkbox("이전 프레임 재투영 (2단계)", &bTemporalOcclusion))
+			{
+				RenderSettings.SetTemporalOcclusionEnabled(bTemporalOcclusion);
+			}
+			if (ImGui::IsItemHovered())
+			{
+				ImGui::SetTooltip("이전 프레임 깊이로 가려진 오클루더는 래스터화하지 않고,\n가려졌던 메시만 새 깊이 버퍼로 다시 확인합니다.");
+			}
+
+			ImGui::EndMenu();
+		}
+		if (ImGui::IsItemHovered())
+		{
+			ImGui::SetTooltip("저폴리 스태틱 메시를 CPU 깊이 버퍼에 래스터화해 가려진 메시를 그리지 않습니다.");
+		}
+
+		// Static Mesh LOD
+		if (ImGui::BeginMenu(" 스태틱 메시 LOD"))
+		{
+			ImGui::TextColored(ImVec4(0.6f, 0.6f, 0.6f, 1.0f), "화면 크기 기반 LOD 선택");
+			ImGui::Separator();
+
+			int ForcedLOD = RenderSettings.GetForcedStaticMeshLOD();
+			if (ImGui::SliderInt("강제 LOD (-1: 자동)", &ForcedLOD, -1, 3))
+			{
+				RenderSettings.SetForcedStaticMeshLOD(ForcedLOD);
+			}
+
+			float LODScale = RenderSettings.GetStaticMeshLODScale();
+			if (ImGui::SliderFloat("화면 크기 배율", &LODScale, 0.25f, 4.0f, "%.2f"))
+			{
+				RenderSettings.SetStaticMeshLODScale(LODScale);
+			}
+			if (ImGui::IsItemHovered())
+			{
+				ImGui::SetTooltip("클수록 상세한 LOD를 더 멀리까지 유지합니다.");
+			}
+
+			ImGui::EndMenu();
+		}
+
 		ImGui::PopStyleColor(3);
 		ImGui::PopStyleVar(2);
 		ImGui::EndPopup();
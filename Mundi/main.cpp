@@ -1,5 +1,6 @@
 ﻿#include "pch.h"
 #include "EditorEngine.h"
+#include "TextureCooker.h"
 
 #if defined(_MSC_VER) && defined(_DEBUG)
 #   define _CRTDBG_MAP_ALLOC
@@ -17,6 +18,10 @@ int WINAPI WinMain(HINSTANCE hInstance, HINSTANCE hPrevInstance, LPSTR lpCmdLine
     _CrtSetBreakAlloc(0);
 #endif
 
+    // Mundi.exe -CookTextures [-bc7] [-dir=<폴더>]: 창 없이 텍스처만 쿡하고 종료
+    if (FTextureCooker::IsCommandletRequested(lpCmdLine))
+        return FTextureCooker::RunCommandlet(lpCmdLine);
+
     if (!GEngine.Startup(hInstance))
         return -1;
 